@@ -0,0 +1,531 @@
+/*
+ ==============================================================================
+
+    DetectionBenchmark.cpp
+    PlayMe - SignalProcessor
+    What the detectors actually do : synthetic signals with a known ground
+    truth (click tracks, a drum loop with annotated onsets, noise beds, tones
+    and a sine sweep) go through AnalysisEngine, block by block as a host
+    would hand them to the plugin, and the features it emits are compared to
+    the truth : impulse latency, precision and recall, fundamental frequency
+    error.
+
+    The block sizes and the beat detection settings can be swept, to tune
+    thresholdFactor, averageEnergyBufferSize and averagingBufferSize
+
+ ==============================================================================
+ */
+
+#include "AnalysisEngine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//==============================================================================
+struct Options
+{
+    double sampleRate = 44100;
+    double toleranceMs = 50;                    // An impulse matches an onset up to toleranceMs after it
+    std::vector<int> blockSizes { 64, 256, 512, 1024, 2048 };
+    std::vector<float> thresholdFactors { 4 };
+    std::vector<int> averageEnergyBufferSizes { 8 };
+    std::vector<int> averagingBufferSizes { 2048 };
+    std::string filter;
+    bool json = false;
+};
+
+static Options options;
+
+// What the engine emitted, in samples
+struct CapturingSink  : public FeatureSink
+{
+    void signalLevelComputed (int, int64_t, float) override                                          {}
+    void signalInstantValComputed (int, int64_t, float) override                                     {}
+    void impulseDetected (int, int64_t time) override                                                { impulses.push_back (time); }
+    void logFFTComputed (int, int64_t time, const float*, int, float fundamentalFreq) override       { fundamentals.push_back (Fundamental { time, fundamentalFreq }); }
+    void linearFFTComputed (int, int64_t time, const float*, int, float fundamentalFreq) override    { fundamentals.push_back (Fundamental { time, fundamentalFreq }); }
+
+    struct Fundamental
+    {
+        int64_t time;                           // Last sample of the FFT window
+        float frequency;                        // -1 : silent
+    };
+
+    std::vector<int64_t> impulses;
+    std::vector<Fundamental> fundamentals;
+};
+
+//==============================================================================
+/**
+    A test signal and its truth : the onsets an impulse should be emitted
+    for, or the frequency of the fundamental at any time (0 : none)
+ */
+struct Scenario
+{
+    std::string name;
+    std::vector<float> samples;
+    std::vector<int64_t> onsets;
+    bool hasOnsets = true;                      // false : every impulse is a false positive (noise beds)
+    double (*fundamentalAt) (double seconds) = nullptr;
+};
+
+// Deterministic white noise in [-1, 1]
+class Noise
+{
+public:
+    explicit Noise (uint32_t seed) : state (seed * 2654435761u + 1) {}
+
+    float next()
+    {
+        state = state * 1664525u + 1013904223u;
+        return (float) ((state >> 8) / 8388608.0 - 1.0);
+    }
+
+private:
+    uint32_t state;
+};
+
+static void addNoiseBed (std::vector<float>& samples, float gain, uint32_t seed)
+{
+    Noise noise (seed);
+    for (size_t i = 0; i < samples.size(); ++i)
+        samples[i] += gain * noise.next();
+}
+
+static float decibelsToGain (double decibels)
+{
+    return (float) std::pow (10.0, decibels / 20.0);
+}
+
+//==============================================================================
+// Clicks of 5 ms of exponentially decaying noise, on every beat
+static Scenario makeClickTrack (double bpm, double seconds, double noiseDecibels)
+{
+    Scenario scenario;
+    scenario.name = "click/bpm=" + std::to_string ((int) bpm)
+                    + (noiseDecibels > -200 ? "/noise=" + std::to_string ((int) noiseDecibels) + "dB" : std::string());
+    scenario.samples.assign ((size_t) (seconds * options.sampleRate), 0.0f);
+
+    const double period = 60.0 / bpm * options.sampleRate;
+    const int clickLength = (int) (0.005 * options.sampleRate);
+    Noise noise (1);
+
+    // The first beat after one second : the average energy starts from silence
+    for (double onset = options.sampleRate; onset + clickLength < scenario.samples.size(); onset += period)
+    {
+        const int64_t start = (int64_t) onset;
+        scenario.onsets.push_back (start);
+
+        for (int i = 0; i < clickLength; ++i)
+            scenario.samples[(size_t) (start + i)] += 0.8f * noise.next() * std::exp (-5.0f * i / clickLength);
+    }
+
+    if (noiseDecibels > -200)
+        addNoiseBed (scenario.samples, decibelsToGain (noiseDecibels), 2);
+
+    return scenario;
+}
+
+/*  Four bars of kick, snare and closed hi-hat, looped : the kick on 1 and 3 (and the "and" of 3 in
+    the second bar), the snare on 2 and 4, hi-hats on the eighths. Every hit is an onset, the hi-hats
+    included, whose level is 18 dB below the kick's
+*/
+static Scenario makeDrumLoop (double bpm, int nbOfLoops)
+{
+    Scenario scenario;
+    scenario.name = "drums/bpm=" + std::to_string ((int) bpm);
+
+    const double eighth = 30.0 / bpm * options.sampleRate;
+    const int nbOfEighths = 4 * 8 * nbOfLoops;
+    scenario.samples.assign ((size_t) (options.sampleRate + (nbOfEighths + 4) * eighth), 0.0f);
+
+    Noise noise (3);
+    enum { kick = 1, snare = 2, hat = 4 };
+
+    for (int e = 0; e < nbOfEighths; ++e)
+    {
+        const int inBar = e % 8;
+        const int bar = (e / 8) % 4;
+        int hits = hat;
+
+        if (inBar == 0 || inBar == 4 || (bar == 1 && inBar == 5))
+            hits |= kick;
+        if (inBar == 2 || inBar == 6)
+            hits |= snare;
+
+        const int64_t start = (int64_t) (options.sampleRate + e * eighth);
+        scenario.onsets.push_back (start);
+
+        for (int i = 0; i < (int) (0.3 * options.sampleRate); ++i)
+        {
+            const double t = i / options.sampleRate;
+            float value = 0;
+
+            // Sine dropping from 150 to 50 Hz
+            if (hits & kick)
+                value += (float) (0.9 * std::exp (-t / 0.12) * std::sin (2 * M_PI * (50 * t + 100 * 0.03 * (1 - std::exp (-t / 0.03)))));
+
+            // Noise and a 190 Hz body
+            if (hits & snare)
+                value += (float) (std::exp (-t / 0.06) * (0.5 * noise.next() + 0.3 * std::sin (2 * M_PI * 190 * t)));
+
+            if (hits & hat)
+                value += (float) (0.12 * std::exp (-t / 0.015) * noise.next());
+
+            scenario.samples[(size_t) start + (size_t) i] += value;
+        }
+    }
+
+    return scenario;
+}
+
+// No onset at all : steady noise, then noise whose level slowly swells by 12 dB
+static Scenario makeNoiseBed (bool swelling, double seconds)
+{
+    Scenario scenario;
+    scenario.name = swelling ? "noise/swelling" : "noise/steady";
+    scenario.hasOnsets = false;
+    scenario.samples.assign ((size_t) (seconds * options.sampleRate), 0.0f);
+
+    Noise noise (4);
+    for (size_t i = 0; i < scenario.samples.size(); ++i)
+    {
+        const double position = i / (double) scenario.samples.size();
+        const double decibels = swelling ? -24 + 12 * 0.5 * (1 - std::cos (2 * M_PI * position * 4)) : -24;
+        scenario.samples[i] = decibelsToGain (decibels) * noise.next();
+    }
+
+    return scenario;
+}
+
+//==============================================================================
+// The fundamental of the tone scenarios : one note per second, A1 (55 Hz) to A6 (1760 Hz) by fifths
+static const double toneSeconds = 1.0;
+static const int nbOfTones = 11;
+
+static double toneFundamentalAt (double seconds)
+{
+    const int note = (int) (seconds / toneSeconds);
+    return note < nbOfTones ? 55.0 * std::pow (2.0, note * 7 / 12.0) : 0;
+}
+
+/*  secondHarmonicGain : above 1, the second harmonic is louder than the fundamental, as in many
+    brass and voice notes, where a peak picking detector finds the octave
+*/
+static Scenario makeTones (double secondHarmonicGain)
+{
+    Scenario scenario;
+    scenario.name = secondHarmonicGain > 1 ? "tones/strong-2nd-harmonic" : "tones/harmonic";
+    scenario.hasOnsets = false;
+    scenario.fundamentalAt = toneFundamentalAt;
+    scenario.samples.assign ((size_t) (nbOfTones * toneSeconds * options.sampleRate), 0.0f);
+
+    double phase = 0;
+    for (size_t i = 0; i < scenario.samples.size(); ++i)
+    {
+        const double frequency = toneFundamentalAt (i / options.sampleRate);
+        phase += 2 * M_PI * frequency / options.sampleRate;
+
+        // Five harmonics, in 1 / n
+        double value = 0;
+        for (int harmonic = 1; harmonic <= 5; ++harmonic)
+            value += (harmonic == 2 ? secondHarmonicGain : 1.0) / harmonic * std::sin (harmonic * phase);
+
+        scenario.samples[i] = (float) (0.3 * value);
+    }
+
+    addNoiseBed (scenario.samples, decibelsToGain (-40), 5);
+    return scenario;
+}
+
+// Exponential sweep from 40 Hz to 4 kHz in 20 seconds
+static const double sweepSeconds = 20, sweepStart = 40, sweepEnd = 4000;
+
+static double sweepFundamentalAt (double seconds)
+{
+    return seconds < sweepSeconds ? sweepStart * std::pow (sweepEnd / sweepStart, seconds / sweepSeconds) : 0;
+}
+
+static Scenario makeSweep()
+{
+    Scenario scenario;
+    scenario.name = "sweep/40Hz-4kHz";
+    scenario.hasOnsets = false;
+    scenario.fundamentalAt = sweepFundamentalAt;
+    scenario.samples.assign ((size_t) (sweepSeconds * options.sampleRate), 0.0f);
+
+    const double k = std::log (sweepEnd / sweepStart);
+    for (size_t i = 0; i < scenario.samples.size(); ++i)
+    {
+        const double t = i / options.sampleRate;
+        const double phase = 2 * M_PI * sweepStart * sweepSeconds / k * (std::exp (t / sweepSeconds * k) - 1);
+        scenario.samples[i] = (float) (0.5 * std::sin (phase));
+    }
+
+    return scenario;
+}
+
+//==============================================================================
+struct Result
+{
+    // Impulses
+    int nbOfOnsets = 0, nbOfImpulses = 0;
+    int truePositives = 0, falsePositives = 0, falseNegatives = 0;
+    std::vector<double> latenciesMs;
+
+    // Fundamental frequency
+    int nbOfEstimates = 0, nbOfSilentEstimates = 0, nbOfOctaveErrors = 0;
+    std::vector<double> absoluteCentErrors;
+};
+
+static double percentile (std::vector<double> values, double fraction)
+{
+    if (values.empty())
+        return 0;
+
+    std::sort (values.begin(), values.end());
+    const size_t index = std::min (values.size() - 1, (size_t) (fraction * (values.size() - 1) + 0.5));
+    return values[index];
+}
+
+/*  An impulse is emitted at the end of the block it was detected in (the sink is called by process()),
+    reported with the position of the block's first sample : the latency is measured from the onset to
+    the end of that block. Every onset is matched with the first unmatched impulse up to toleranceMs
+    after it; an impulse may precede its onset by less than a block, as the block holds the onset
+*/
+static Result evaluate (const Scenario& scenario, const AnalysisEngine::Settings& settings, int blockSize)
+{
+    AnalysisEngine engine;
+    engine.setSampleRate (options.sampleRate);
+    engine.settings = settings;
+    engine.settings.signalInstantValEnabled = false;
+    engine.settings.fftEnabled = (scenario.fundamentalAt != nullptr);
+    if (engine.settings.fftEnabled)
+        engine.prepareFFT();
+
+    CapturingSink sink;
+    for (size_t position = 0; position < scenario.samples.size(); position += (size_t) blockSize)
+    {
+        const float* channels[1] = { scenario.samples.data() + position };
+        engine.process (channels, 1, (int) std::min ((size_t) blockSize, scenario.samples.size() - position), sink);
+    }
+
+    Result result;
+    result.nbOfImpulses = (int) sink.impulses.size();
+
+    if (scenario.hasOnsets)
+    {
+        const int64_t tolerance = (int64_t) (options.toleranceMs * 0.001 * options.sampleRate);
+        std::vector<bool> matched (sink.impulses.size(), false);
+        result.nbOfOnsets = (int) scenario.onsets.size();
+
+        for (size_t o = 0; o < scenario.onsets.size(); ++o)
+        {
+            const int64_t onset = scenario.onsets[o];
+            const int64_t nextOnset = o + 1 < scenario.onsets.size() ? scenario.onsets[o + 1] : INT64_MAX;
+
+            for (size_t i = 0; i < sink.impulses.size(); ++i)
+            {
+                const int64_t emitted = sink.impulses[i] + blockSize;
+
+                if (matched[i] || emitted <= onset)
+                    continue;
+                if (emitted > onset + tolerance || sink.impulses[i] >= nextOnset)
+                    break;
+
+                matched[i] = true;
+                result.truePositives++;
+                result.latenciesMs.push_back ((emitted - onset) * 1000.0 / options.sampleRate);
+                break;
+            }
+        }
+
+        result.falseNegatives = result.nbOfOnsets - result.truePositives;
+        result.falsePositives = result.nbOfImpulses - result.truePositives;
+    }
+    else
+    {
+        result.falsePositives = result.nbOfImpulses;
+    }
+
+    // The truth at the middle of the FFT window, only where the fundamental does not change within the window
+    if (scenario.fundamentalAt != nullptr)
+    {
+        for (const CapturingSink::Fundamental& estimate : sink.fundamentals)
+        {
+            const double windowStart = (estimate.time + 1 - AnalysisEngine::fftSize) / options.sampleRate;
+            const double windowEnd = (estimate.time + 1) / options.sampleRate;
+            const double truth = scenario.fundamentalAt ((windowStart + windowEnd) / 2);
+
+            if (truth <= 0 || scenario.fundamentalAt (windowStart) <= 0 || scenario.fundamentalAt (windowEnd) <= 0
+                 || (scenario.fundamentalAt == toneFundamentalAt
+                      && toneFundamentalAt (windowStart) != toneFundamentalAt (windowEnd)))
+                continue;
+
+            result.nbOfEstimates++;
+
+            if (estimate.frequency <= 0)
+            {
+                result.nbOfSilentEstimates++;
+                continue;
+            }
+
+            const double cents = 1200 * std::log2 (estimate.frequency / truth);
+            result.absoluteCentErrors.push_back (std::abs (cents));
+
+            // Within a quarter tone of an octave (or more) above or below
+            const double octaves = std::abs (cents) / 1200;
+            if (octaves > 0.5 && std::abs (octaves - std::floor (octaves + 0.5)) < 50.0 / 1200)
+                result.nbOfOctaveErrors++;
+        }
+    }
+
+    return result;
+}
+
+//==============================================================================
+static void report (const Scenario& scenario, const AnalysisEngine::Settings& settings, int blockSize, const Result& result)
+{
+    const double seconds = scenario.samples.size() / options.sampleRate;
+    const double precision = result.nbOfImpulses > 0 ? result.truePositives / (double) result.nbOfImpulses : 0;
+    const double recall = result.nbOfOnsets > 0 ? result.truePositives / (double) result.nbOfOnsets : 0;
+    const double f1 = precision + recall > 0 ? 2 * precision * recall / (precision + recall) : 0;
+    const double falsePositivesPerMinute = result.falsePositives * 60 / seconds;
+
+    const double medianCents = percentile (result.absoluteCentErrors, 0.5);
+    const double p90Cents = percentile (result.absoluteCentErrors, 0.9);
+    const int within50Cents = (int) std::count_if (result.absoluteCentErrors.begin(), result.absoluteCentErrors.end(),
+                                                   [] (double cents) { return cents <= 50; });
+    const double accuracy = result.nbOfEstimates > 0 ? within50Cents / (double) result.nbOfEstimates : 0;
+
+    if (options.json)
+    {
+        std::printf ("{\"scenario\":\"%s\",\"blockSize\":%d,\"thresholdFactor\":%g,\"averageEnergyBufferSize\":%d,"
+                     "\"averagingBufferSize\":%d,\"onsets\":%d,\"impulses\":%d,\"truePositives\":%d,\"falsePositives\":%d,"
+                     "\"falseNegatives\":%d,\"precision\":%.4f,\"recall\":%.4f,\"f1\":%.4f,\"falsePositivesPerMinute\":%.2f,"
+                     "\"latencyMsP50\":%.3f,\"latencyMsP90\":%.3f,\"latencyMsMax\":%.3f,"
+                     "\"fundamentalEstimates\":%d,\"silentEstimates\":%d,\"octaveErrors\":%d,"
+                     "\"centErrorP50\":%.1f,\"centErrorP90\":%.1f,\"within50Cents\":%.4f}\n",
+                     scenario.name.c_str(), blockSize, settings.thresholdFactor, settings.averageEnergyBufferSize,
+                     settings.averagingBufferSize, result.nbOfOnsets, result.nbOfImpulses, result.truePositives,
+                     result.falsePositives, result.falseNegatives, precision, recall, f1, falsePositivesPerMinute,
+                     percentile (result.latenciesMs, 0.5), percentile (result.latenciesMs, 0.9),
+                     percentile (result.latenciesMs, 1), result.nbOfEstimates, result.nbOfSilentEstimates,
+                     result.nbOfOctaveErrors, medianCents, p90Cents, accuracy);
+        return;
+    }
+
+    std::printf ("%-28s %6d %5g %4d %6d", scenario.name.c_str(), blockSize, settings.thresholdFactor,
+                 settings.averageEnergyBufferSize, settings.averagingBufferSize);
+
+    if (scenario.hasOnsets)
+        std::printf ("  %5d %5d %5d  %6.3f %6.3f %6.3f  %7.2f %7.2f %7.2f", result.nbOfOnsets, result.truePositives,
+                     result.falsePositives, precision, recall, f1, percentile (result.latenciesMs, 0.5),
+                     percentile (result.latenciesMs, 0.9), percentile (result.latenciesMs, 1));
+    else
+        std::printf ("  %5s %5s %5d  %6s %6s %6s  %7s %7s %7s", "-", "-", result.falsePositives, "-", "-", "-", "-", "-", "-");
+
+    if (result.nbOfEstimates > 0)
+        std::printf ("  %5d %6.1f %6.1f %6.3f %4d %4d", result.nbOfEstimates, medianCents, p90Cents, accuracy,
+                     result.nbOfOctaveErrors, result.nbOfSilentEstimates);
+
+    std::printf ("\n");
+}
+
+//==============================================================================
+template <typename Type>
+static bool parseList (const std::string& text, std::vector<Type>& values)
+{
+    values.clear();
+
+    for (size_t start = 0; start <= text.size();)
+    {
+        size_t end = text.find (',', start);
+        if (end == std::string::npos)
+            end = text.size();
+
+        const double value = std::atof (text.substr (start, end - start).c_str());
+        if (value <= 0)
+            return false;
+
+        values.push_back ((Type) value);
+        start = end + 1;
+    }
+
+    return ! values.empty();
+}
+
+int main (int argc, char* argv[])
+{
+    bool valid = true;
+
+    for (int i = 1; i < argc && valid; ++i)
+    {
+        const std::string arg (argv[i]);
+        const size_t equal = arg.find ('=');
+        const std::string name (arg.substr (0, equal));
+        const std::string value (equal != std::string::npos ? arg.substr (equal + 1) : std::string());
+
+        if (arg == "--json")                            options.json = true;
+        else if (name == "--filter")                    options.filter = value;
+        else if (name == "--samplerate")                valid = (options.sampleRate = std::atof (value.c_str())) > 0;
+        else if (name == "--tolerance")                 valid = (options.toleranceMs = std::atof (value.c_str())) > 0;
+        else if (name == "--blocks")                    valid = parseList (value, options.blockSizes);
+        else if (name == "--threshold")                 valid = parseList (value, options.thresholdFactors);
+        else if (name == "--energy-blocks")             valid = parseList (value, options.averageEnergyBufferSizes);
+        else if (name == "--averaging")                 valid = parseList (value, options.averagingBufferSizes);
+        else                                            valid = false;
+    }
+
+    if (! valid)
+    {
+        std::fprintf (stderr, "usage: %s [--json] [--filter=text] [--samplerate=hz] [--tolerance=ms] [--blocks=64,512,...]\n"
+                              "       [--threshold=4,...] [--energy-blocks=8,...] [--averaging=2048,...]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<Scenario> scenarios;
+    scenarios.push_back (makeClickTrack (90, 30, -300));
+    scenarios.push_back (makeClickTrack (120, 30, -300));
+    scenarios.push_back (makeClickTrack (174, 30, -300));
+    scenarios.push_back (makeClickTrack (120, 30, -30));
+    scenarios.push_back (makeClickTrack (120, 30, -20));
+    scenarios.push_back (makeDrumLoop (100, 4));
+    scenarios.push_back (makeDrumLoop (140, 4));
+    scenarios.push_back (makeNoiseBed (false, 30));
+    scenarios.push_back (makeNoiseBed (true, 30));
+    scenarios.push_back (makeTones (1));
+    scenarios.push_back (makeTones (2.5));
+    scenarios.push_back (makeSweep());
+
+    if (! options.json)
+        std::printf ("%-28s %6s %5s %4s %6s  %5s %5s %5s  %6s %6s %6s  %7s %7s %7s  %5s %6s %6s %6s %4s %4s\n",
+                     "scenario", "block", "thr", "win", "avg", "onset", "tp", "fp", "prec", "recall", "f1",
+                     "lat50", "lat90", "latmax", "f0est", "c50", "c90", "<50c", "oct", "sil");
+
+    for (const Scenario& scenario : scenarios)
+    {
+        if (! options.filter.empty() && scenario.name.find (options.filter) == std::string::npos)
+            continue;
+
+        for (int blockSize : options.blockSizes)
+            for (float thresholdFactor : options.thresholdFactors)
+                for (int averageEnergyBufferSize : options.averageEnergyBufferSizes)
+                    for (int averagingBufferSize : options.averagingBufferSizes)
+                    {
+                        AnalysisEngine::Settings settings;
+                        settings.thresholdFactor = thresholdFactor;
+                        settings.averageEnergyBufferSize = averageEnergyBufferSize;
+                        settings.averagingBufferSize = averagingBufferSize;
+
+                        report (scenario, settings, blockSize, evaluate (scenario, settings, blockSize));
+                    }
+    }
+
+    return 0;
+}
@@ -0,0 +1,607 @@
+/*
+ ==============================================================================
+
+    MicroBenchmarks.cpp
+    PlayMe - SignalProcessor
+    The kernels and encoders of the analysis and transport hot paths, each
+    one in isolation, on synthetic signals : the FFT, the fundamental
+    frequency, the log bands, the engine's block processing, the Protobuf /
+    SignalWireFormat / OSC encoders, the sendto calls and the
+    instrumentation itself.
+
+    The results use the Go benchmark format (one line per benchmark, with
+    ns/op, MB/s, B/op and allocs/op), so two releases can be compared with
+    benchstat; --json writes one JSON object per line instead
+
+ ==============================================================================
+ */
+
+#include "AnalysisEngine.h"
+#include "OutputTransport.h"
+#include "PerformanceStats.h"
+#include "RealFFT.h"
+#include "SignalWireFormat.h"
+#include "TraceRecorder.h"
+#include "udp_client_server.h"
+#include "osc/OscOutboundPacketStream.h"
+
+#if SIGNALPROCESSOR_BENCHMARK_PROTOBUF
+ #include "SignalMessages.pb.h"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// Every allocation of the process is counted while a benchmark runs
+static std::atomic<bool> countingAllocations (false);
+static std::atomic<uint64_t> nbOfAllocations (0);
+static std::atomic<uint64_t> nbOfAllocatedBytes (0);
+
+static void* allocate (std::size_t size)
+{
+    if (countingAllocations.load (std::memory_order_relaxed))
+    {
+        nbOfAllocations.fetch_add (1, std::memory_order_relaxed);
+        nbOfAllocatedBytes.fetch_add (size, std::memory_order_relaxed);
+    }
+
+    if (void* p = std::malloc (size != 0 ? size : 1))
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void* operator new (std::size_t size)                                   { return allocate (size); }
+void* operator new[] (std::size_t size)                                 { return allocate (size); }
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept   { try { return allocate (size); } catch (...) { return nullptr; } }
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept { try { return allocate (size); } catch (...) { return nullptr; } }
+void operator delete (void* p) noexcept                                 { std::free (p); }
+void operator delete[] (void* p) noexcept                               { std::free (p); }
+void operator delete (void* p, std::size_t) noexcept                    { std::free (p); }
+void operator delete[] (void* p, std::size_t) noexcept                  { std::free (p); }
+
+//==============================================================================
+// Keeps the compiler from removing a computation whose result is not used
+template <typename Type>
+static void doNotOptimize (const Type& value)
+{
+    asm volatile ("" : : "r,m" (value) : "memory");
+}
+
+struct Options
+{
+    double minSeconds = 0.5;            // Per benchmark
+    std::string filter;                 // Only the benchmarks whose name contains it
+    bool json = false;
+    int port = 47101;                   // Local port the sendto benchmarks send to
+};
+
+static Options options;
+
+/*  The body runs the operation nbOfIterations times. The number of iterations grows until a run lasts
+    options.minSeconds, as Go's testing package does. bytesPerOp : the data the operation reads or writes,
+    reported as MB/s (0 : not reported)
+*/
+static void run (const std::string& name, int64_t bytesPerOp, const std::function<void (int64_t nbOfIterations)>& body)
+{
+    if (! options.filter.empty() && name.find (options.filter) == std::string::npos)
+        return;
+
+    body (1);   // Warm up : first touch of the buffers, lazily created setups
+
+    int64_t nbOfIterations = 1;
+    double seconds = 0;
+    uint64_t allocations = 0, allocatedBytes = 0;
+
+    for (;;)
+    {
+        nbOfAllocations.store (0);
+        nbOfAllocatedBytes.store (0);
+        countingAllocations.store (true);
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        body (nbOfIterations);
+        seconds = std::chrono::duration<double> (std::chrono::steady_clock::now() - start).count();
+
+        countingAllocations.store (false);
+        allocations = nbOfAllocations.load();
+        allocatedBytes = nbOfAllocatedBytes.load();
+
+        if (seconds >= options.minSeconds || nbOfIterations >= 1000000000)
+            break;
+
+        // Aim 20% above the target, growing at most 100 times per round
+        const double perOp = std::max (seconds, 1.0e-9) / nbOfIterations;
+        const double target = options.minSeconds * 1.2 / perOp;
+        nbOfIterations = (int64_t) std::max (std::min (target, nbOfIterations * 100.0), nbOfIterations + 1.0);
+    }
+
+    const double nsPerOp = seconds * 1.0e9 / nbOfIterations;
+    const double megabytesPerSecond = bytesPerOp > 0 ? bytesPerOp * nbOfIterations / seconds / 1.0e6 : 0;
+    const double bytesPerOpAllocated = (double) allocatedBytes / nbOfIterations;
+    const double allocationsPerOp = (double) allocations / nbOfIterations;
+
+    if (options.json)
+    {
+        std::printf ("{\"name\":\"%s\",\"iterations\":%lld,\"ns_per_op\":%.3f,\"mb_per_s\":%.2f,"
+                     "\"bytes_per_op\":%.1f,\"allocs_per_op\":%.3f}\n",
+                     name.c_str(), (long long) nbOfIterations, nsPerOp, megabytesPerSecond,
+                     bytesPerOpAllocated, allocationsPerOp);
+    }
+    else
+    {
+        std::printf ("Benchmark%-44s %12lld %14.1f ns/op", name.c_str(), (long long) nbOfIterations, nsPerOp);
+        if (bytesPerOp > 0)
+            std::printf (" %10.2f MB/s", megabytesPerSecond);
+        std::printf (" %10.0f B/op %8.0f allocs/op\n", bytesPerOpAllocated, allocationsPerOp);
+    }
+
+    std::fflush (stdout);
+}
+
+//==============================================================================
+// Music-like test signal : three partials and some noise, deterministic
+static std::vector<float> makeSignal (int nbOfSamples, double sampleRate, unsigned seed)
+{
+    std::vector<float> signal ((size_t) nbOfSamples);
+    uint32_t noise = 0x12345678u ^ seed;
+
+    for (int i = 0; i < nbOfSamples; ++i)
+    {
+        const double t = i / sampleRate;
+        noise = noise * 1664525u + 1013904223u;
+
+        signal[(size_t) i] = (float) (0.5 * std::sin (2 * M_PI * 220.0 * t)
+                                      + 0.25 * std::sin (2 * M_PI * 1375.0 * t)
+                                      + 0.1 * std::sin (2 * M_PI * 6000.0 * t)
+                                      + 0.05 * ((noise >> 8) / 8388608.0 - 1.0));
+    }
+
+    return signal;
+}
+
+static std::vector<float> makeSpectrum (int nbOfBins)
+{
+    const std::vector<float> signal (makeSignal (nbOfBins * 2, 44100, 1));
+    std::vector<float> real ((size_t) nbOfBins), imag ((size_t) nbOfBins);
+
+    unsigned int log2Size = 0;
+    while ((1 << log2Size) < nbOfBins * 2)
+        ++log2Size;
+
+    RealFFT fft (log2Size);
+    fft.perform (signal.data(), real.data(), imag.data());
+    return real;
+}
+
+// Counts the features, as a sink doing nothing would be removed by the compiler
+struct CountingSink  : public FeatureSink
+{
+    void signalLevelComputed (int, int64_t, float level) override                        { ++nbOfFeatures; doNotOptimize (level); }
+    void signalInstantValComputed (int, int64_t, float value) override                   { ++nbOfFeatures; doNotOptimize (value); }
+    void impulseDetected (int, int64_t) override                                         { ++nbOfFeatures; }
+    void logFFTComputed (int, int64_t, const float* bands, int, float) override          { ++nbOfFeatures; doNotOptimize (bands[0]); }
+    void linearFFTComputed (int, int64_t, const float* bins, int, float) override        { ++nbOfFeatures; doNotOptimize (bins[0]); }
+
+    int64_t nbOfFeatures = 0;
+};
+
+//==============================================================================
+static void benchmarkAnalysis()
+{
+    for (unsigned int log2Size : { 10u, 12u, 14u })
+    {
+        const int size = 1 << log2Size;
+        const std::vector<float> signal (makeSignal (size, 44100, log2Size));
+        std::vector<float> real ((size_t) size / 2), imag ((size_t) size / 2);
+        RealFFT fft (log2Size);
+
+        run ("RealFFT/size=" + std::to_string (size), size * (int64_t) sizeof (float), [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                fft.perform (signal.data(), real.data(), imag.data());
+                doNotOptimize (real[1]);
+            }
+        });
+    }
+
+    for (int nbOfBins : { 512, 2048, 8192 })
+    {
+        const std::vector<float> spectrum (makeSpectrum (nbOfBins));
+
+        run ("FindFundamentalFrequency/bins=" + std::to_string (nbOfBins), nbOfBins * (int64_t) sizeof (float), [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+                doNotOptimize (AnalysisEngine::findFundamentalFrequency (spectrum.data(), nbOfBins, 44100.0 / (2 * nbOfBins)));
+        });
+    }
+
+    for (int nbOfBands : { 10, 12, 14 })
+    {
+        const int nbOfBins = 1 << (nbOfBands - 1);
+        const std::vector<float> spectrum (makeSpectrum (nbOfBins));
+        std::vector<float> bands ((size_t) nbOfBands);
+
+        run ("ComputeLogBands/bands=" + std::to_string (nbOfBands), nbOfBins * (int64_t) sizeof (float), [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                AnalysisEngine::computeLogBands (spectrum.data(), bands.data(), nbOfBands);
+                doNotOptimize (bands[(size_t) nbOfBands - 1]);
+            }
+        });
+    }
+
+    // One 512 samples block, the FFT (4096 samples) being computed every 8 blocks
+    static const int blockSize = 512;
+    static const char* const fftModes[] = { "off", "log", "linear" };
+
+    for (int nbOfChannels : { 1, 2, 8 })
+    {
+        std::vector<std::vector<float> > signals;
+        std::vector<const float*> channels;
+        for (int c = 0; c < nbOfChannels; ++c)
+            signals.push_back (makeSignal (blockSize * 64, 44100, (unsigned) c));
+        for (int c = 0; c < nbOfChannels; ++c)
+            channels.push_back (signals[(size_t) c].data());
+
+        for (int mode = 0; mode < 3; ++mode)
+        {
+            AnalysisEngine engine;
+            engine.setSampleRate (44100);
+            engine.settings.fftEnabled = (mode != 0);
+            engine.settings.logarithmicFFT = (mode == 1);
+            engine.prepareFFT();
+            CountingSink sink;
+
+            const std::string name = "EngineProcess/channels=" + std::to_string (nbOfChannels) + "/fft=" + fftModes[mode];
+            run (name, (int64_t) nbOfChannels * blockSize * (int64_t) sizeof (float), [&] (int64_t n)
+            {
+                std::vector<const float*> block (channels);
+                for (int64_t i = 0; i < n; ++i)
+                {
+                    // Walk through the 64 blocks of the signal
+                    const int offset = (int) (i & 63) * blockSize;
+                    for (int c = 0; c < nbOfChannels; ++c)
+                        block[(size_t) c] = channels[(size_t) c] + offset;
+
+                    engine.process (block.data(), nbOfChannels, blockSize, sink);
+                }
+                doNotOptimize (sink.nbOfFeatures);
+            });
+        }
+    }
+
+    // A 16 channels stem bus, analysed as one group or channel by channel
+    {
+        static const int nbOfChannels = 16;
+        std::vector<std::vector<float> > signals;
+        for (int c = 0; c < nbOfChannels; ++c)
+            signals.push_back (makeSignal (blockSize * 64, 44100, (unsigned) c));
+
+        for (int channelsPerGroup : { nbOfChannels, 1 })
+        {
+            const int nbOfGroups = nbOfChannels / channelsPerGroup;
+            std::vector<AnalysisEngine::ChannelGroup> groups ((size_t) nbOfGroups);
+            for (int g = 0; g < nbOfGroups; ++g)
+            {
+                groups[(size_t) g].firstChannel = g * channelsPerGroup;
+                groups[(size_t) g].nbOfChannels = channelsPerGroup;
+            }
+
+            for (int mode = 0; mode < 2; ++mode)
+            {
+                AnalysisEngine engine;
+                engine.setSampleRate (44100);
+                engine.settings.fftEnabled = (mode != 0);
+                engine.prepareFFT();
+                CountingSink sink;
+
+                const std::string name = "EngineProcess/channels=" + std::to_string (nbOfChannels) + "/groups="
+                                       + std::to_string (nbOfGroups) + "/fft=" + fftModes[mode];
+                run (name, (int64_t) nbOfChannels * blockSize * (int64_t) sizeof (float), [&] (int64_t n)
+                {
+                    std::vector<const float*> block ((size_t) nbOfChannels);
+                    for (int64_t i = 0; i < n; ++i)
+                    {
+                        const int offset = (int) (i & 63) * blockSize;
+                        for (int c = 0; c < nbOfChannels; ++c)
+                            block[(size_t) c] = signals[(size_t) c].data() + offset;
+
+                        engine.process (block.data(), groups.data(), nbOfGroups, blockSize, sink);
+                    }
+                    doNotOptimize (sink.nbOfFeatures);
+                });
+            }
+        }
+    }
+}
+
+//==============================================================================
+static void benchmarkEncoders()
+{
+    const std::vector<float> spectrum (makeSpectrum (SignalWireFormat::maxNbOfLinearBins));
+    std::vector<char> buffer (64 * 1024);
+
+    {
+        SignalWireFormat::SignalLevelMessage message;
+        message.signalID = 1;
+        message.signalLevel = 0.25f;
+
+        run ("WireFormatEncode/SignalLevel", 0, [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                message.signalLevel += 1.0e-7f;
+                doNotOptimize (SignalWireFormat::encode (message, buffer.data(), (int) buffer.size()));
+            }
+        });
+    }
+
+    for (int nbOfValues : { SignalWireFormat::nbOfLogBands, 512, SignalWireFormat::maxNbOfLinearBins })
+    {
+        SignalWireFormat::FFTMessage message;
+        message.signalID = 1;
+        message.fundamentalFreq = 220;
+        message.isLinear = (nbOfValues != SignalWireFormat::nbOfLogBands);
+        message.nbOfValues = nbOfValues;
+        std::memcpy (message.values, spectrum.data(), sizeof (float) * (size_t) nbOfValues);
+
+        const std::string name = message.isLinear ? "WireFormatEncode/LinearFFT/bins=" + std::to_string (nbOfValues)
+                                                  : std::string ("WireFormatEncode/LogFFT/bands=12");
+        const int size = SignalWireFormat::encode (message, buffer.data(), (int) buffer.size());
+
+        run (name, size, [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+                doNotOptimize (SignalWireFormat::encode (message, buffer.data(), (int) buffer.size()));
+        });
+    }
+
+    // The messages the plugin builds in its FeatureSink functions
+    {
+        osc::OutboundPacketStream stream (buffer.data(), buffer.size());
+        float level = 0.25f;
+
+        run ("OscEncode/SignalLevel", 0, [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                stream.Clear();
+                stream << osc::BeginBundleImmediate << osc::BeginMessage ("SIGLVL") << 1 << "/" << level
+                       << osc::EndMessage << osc::EndBundle;
+                doNotOptimize (stream.Size());
+            }
+        });
+    }
+
+    for (int nbOfValues : { SignalWireFormat::nbOfLogBands, 512, SignalWireFormat::maxNbOfLinearBins })
+    {
+        osc::OutboundPacketStream stream (buffer.data(), buffer.size());
+        const std::string name = nbOfValues == SignalWireFormat::nbOfLogBands ? std::string ("OscEncode/LogFFT/bands=12")
+                                                                              : "OscEncode/LinearFFT/bins=" + std::to_string (nbOfValues);
+        const char* const address = nbOfValues == SignalWireFormat::nbOfLogBands ? "FFT" : "LinearFFT";
+
+        run (name, nbOfValues * (int64_t) sizeof (float), [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                stream.Clear();
+                stream << osc::BeginBundleImmediate << osc::BeginMessage (address) << 1 << 220.0f;
+                for (int v = 0; v < nbOfValues; ++v)
+                    stream << spectrum[(size_t) v];
+                stream << osc::EndMessage << osc::EndBundle;
+                doNotOptimize (stream.Size());
+            }
+        });
+    }
+
+#if SIGNALPROCESSOR_BENCHMARK_PROTOBUF
+    // The generated classes, as the plugin uses them : the same message object, serialized again and again
+    {
+        SignalLevel message;
+        message.set_signalid (1);
+        message.set_signallevel (0.25f);
+
+        run ("ProtobufSerialize/SignalLevel", 0, [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                message.set_signallevel (message.signallevel() + 1.0e-7f);
+                doNotOptimize (message.SerializeToArray (buffer.data(), message.ByteSize()));
+            }
+        });
+    }
+
+    {
+        LogFFT message;
+        message.set_signalid (1);
+
+        run ("ProtobufSerialize/LogFFT/bands=12", 0, [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                message.set_fundamentalfreq (220);
+                message.set_band1 (spectrum[0]);    message.set_band2 (spectrum[1]);    message.set_band3 (spectrum[2]);
+                message.set_band4 (spectrum[3]);    message.set_band5 (spectrum[4]);    message.set_band6 (spectrum[5]);
+                message.set_band7 (spectrum[6]);    message.set_band8 (spectrum[7]);    message.set_band9 (spectrum[8]);
+                message.set_band10 (spectrum[9]);   message.set_band11 (spectrum[10]);  message.set_band12 (spectrum[11]);
+                doNotOptimize (message.SerializeToArray (buffer.data(), message.ByteSize()));
+            }
+        });
+    }
+
+    for (int nbOfValues : { 512, SignalWireFormat::maxNbOfLinearBins })
+    {
+        LinearFFT message;
+        message.set_signalid (1);
+
+        run ("ProtobufSerialize/LinearFFT/bins=" + std::to_string (nbOfValues), nbOfValues * (int64_t) sizeof (float), [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                message.clear_data();
+                message.set_fundamentalfreq (220);
+                for (int v = 0; v < nbOfValues; ++v)
+                    message.add_data (spectrum[(size_t) v]);
+                doNotOptimize (message.SerializeToArray (buffer.data(), message.ByteSize()));
+            }
+        });
+    }
+#endif
+}
+
+//==============================================================================
+static void benchmarkTransport()
+{
+    // The datagrams are not read : once the receive buffer is full, the kernel drops them, as it does
+    // when a consumer is late
+    std::unique_ptr<udp_server> receiver;
+    std::unique_ptr<udp_client> client;
+    try
+    {
+        receiver.reset (new udp_server ("127.0.0.1", options.port));
+        client.reset (new udp_client ("127.0.0.1", options.port));
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::fprintf (stderr, "Sendto benchmarks skipped, port %d : %s\n", options.port, e.what());
+        return;
+    }
+
+    const std::vector<char> payload (64 * 1024, 1);
+
+    // Impulse, LogFFT, LinearFFT of 2048 bins
+    for (int size : { 4, 70, 8200 })
+    {
+        run ("Sendto/bytes=" + std::to_string (size), size, [&] (int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+                doNotOptimize (client->send (payload.data(), (size_t) size));
+        });
+    }
+
+    // What the plugin does for a LogFFT message, with its latency histogram and trace point
+    {
+        int ports[OutputTransport::totalNumDestinations];
+        for (int i = 0; i < OutputTransport::totalNumDestinations; ++i)
+            ports[i] = options.port;
+
+        OutputTransport transport ("127.0.0.1", ports, options.port);
+        LatencyHistogram histogram;
+        transport.setSendHistogram (&histogram);
+        transport.open();
+
+        for (int i = 0; i < 1000 && ! transport.isReady() && ! transport.hasFailed(); ++i)
+            std::this_thread::sleep_for (std::chrono::milliseconds (5));
+
+        SignalWireFormat::FFTMessage message;
+        message.nbOfValues = SignalWireFormat::nbOfLogBands;
+        std::vector<char> buffer (256);
+
+        if (transport.isReady())
+        {
+            run ("EncodeAndSend/LogFFT/bands=12", 0, [&] (int64_t n)
+            {
+                for (int64_t i = 0; i < n; ++i)
+                {
+                    message.values[0] = (float) (i & 255);
+                    const int size = SignalWireFormat::encode (message, buffer.data(), (int) buffer.size());
+                    transport.send (OutputTransport::fftDestination, buffer.data(), (size_t) size);
+                }
+            });
+        }
+    }
+}
+
+//==============================================================================
+// The cost the instrumentation adds to every timed stage
+static void benchmarkInstrumentation()
+{
+    LatencyHistogram histogram;
+
+    run ("MonotonicClock", 0, [&] (int64_t n)
+    {
+        for (int64_t i = 0; i < n; ++i)
+            doNotOptimize (getMonotonicNanoseconds());
+    });
+
+    run ("LatencyHistogramRecord", 0, [&] (int64_t n)
+    {
+        for (int64_t i = 0; i < n; ++i)
+            histogram.record ((uint64_t) (i & 0xffff) * 37);
+    });
+
+    run ("ScopedStageTimer", 0, [&] (int64_t n)
+    {
+        for (int64_t i = 0; i < n; ++i)
+        {
+            ScopedStageTimer timer (&histogram);
+        }
+    });
+
+#if SIGNALPROCESSOR_TRACING
+    TraceRecorder::enable();
+
+    run ("TraceScope", 0, [&] (int64_t n)
+    {
+        for (int64_t i = 0; i < n; ++i)
+        {
+            SIGNALPROCESSOR_TRACE_SCOPE ("benchmark", "iteration", (int32_t) i);
+        }
+    });
+#endif
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg (argv[i]);
+
+        if (arg == "--json")
+            options.json = true;
+        else if (arg.compare (0, 7, "--time=") == 0)
+            options.minSeconds = std::atof (arg.c_str() + 7);
+        else if (arg.compare (0, 9, "--filter=") == 0)
+            options.filter = arg.substr (9);
+        else if (arg.compare (0, 7, "--port=") == 0)
+            options.port = std::atoi (arg.c_str() + 7);
+        else
+        {
+            std::fprintf (stderr, "usage: %s [--json] [--time=seconds] [--filter=text] [--port=number]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (! options.json)
+    {
+       #if defined (__APPLE__)
+        std::printf ("goos: darwin\n");
+       #else
+        std::printf ("goos: linux\n");
+       #endif
+        std::printf ("pkg: SignalProcessor\n");
+    }
+
+    benchmarkAnalysis();
+    benchmarkEncoders();
+    benchmarkTransport();
+    benchmarkInstrumentation();
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ ==============================================================================
+
+    MultiplexerBenchmark.cpp
+    PlayMe - SignalProcessor
+    Measure the receive throughput of SocketReceiveMultiplexer : a sender thread
+    floods N local UDP sockets while the multiplexer drains them, then the
+    received packet rate, the loss and the receive CPU cost are printed.
+    Build it once per backend (see README.txt) to compare epoll and select()
+
+ ==============================================================================
+ */
+
+#include "ip/UdpSocket.h"
+#include "ip/PacketListener.h"
+#include "ip/TimerListener.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+#if (defined (OSCPACK_USE_EPOLL) && OSCPACK_USE_EPOLL == 0) || ! defined (__linux__)
+static const char* backendName = "select";
+#else
+static const char* backendName = "epoll";
+#endif
+
+//==============================================================================
+class CountingListener : public PacketListener
+{
+public:
+    void ProcessPacket (const char* /*data*/, int /*size*/, const IpEndpointName& /*remoteEndpoint*/) override
+    {
+        ++nbOfPackets;
+    }
+
+    long nbOfPackets = 0;
+};
+
+// Counts the ticks of a periodic timer, to check the timers are still honoured under load
+class TickListener : public TimerListener
+{
+public:
+    void TimerExpired() override    { ++nbOfTicks; }
+
+    long nbOfTicks = 0;
+};
+
+class StopListener : public TimerListener
+{
+public:
+    StopListener (SocketReceiveMultiplexer& m) : multiplexer (m) {}
+    void TimerExpired() override    { multiplexer.Break(); }
+
+private:
+    SocketReceiveMultiplexer& multiplexer;
+};
+
+static double threadCpuTimeSeconds()
+{
+    struct timespec t;
+    clock_gettime (CLOCK_THREAD_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+//==============================================================================
+// usage: MultiplexerBenchmark [nbOfSockets=64] [durationSeconds=5] [basePort=17000]
+int main (int argc, char* argv[])
+{
+    const int nbOfSockets     = (argc > 1) ? std::atoi (argv[1]) : 64;
+    const int durationSeconds = (argc > 2) ? std::atoi (argv[2]) : 5;
+    const int basePort        = (argc > 3) ? std::atoi (argv[3]) : 17000;
+    const int tickPeriodMs    = 10;
+    const int packetSize      = 64;            // about the size of a SignalLevel or LogFFT message
+
+    SocketReceiveMultiplexer multiplexer;
+    std::vector<UdpSocket*> receiveSockets;
+    std::vector<UdpTransmitSocket*> transmitSockets;
+    std::vector<CountingListener> listeners (nbOfSockets);
+
+    for (int i = 0; i < nbOfSockets; ++i)
+    {
+        IpEndpointName endpoint ("127.0.0.1", basePort + i);
+        receiveSockets.push_back (new UdpReceiveSocket (endpoint));
+        transmitSockets.push_back (new UdpTransmitSocket (endpoint));
+        multiplexer.AttachSocketListener (receiveSockets[i], &listeners[i]);
+    }
+
+    TickListener tickListener;
+    StopListener stopListener (multiplexer);
+    multiplexer.AttachPeriodicTimerListener (tickPeriodMs, &tickListener);
+    multiplexer.AttachPeriodicTimerListener (durationSeconds * 1000, &stopListener);
+
+    // Flood the sockets, round robin, until the multiplexer stops
+    std::atomic<bool> stopSending (false);
+    long nbOfPacketsSent = 0;
+    std::thread sender ([&]
+    {
+        char packet[packetSize] = { 0 };
+        while (! stopSending.load (std::memory_order_relaxed))
+        {
+            for (int i = 0; i < nbOfSockets; ++i)
+                transmitSockets[i]->Send (packet, sizeof (packet));
+            nbOfPacketsSent += nbOfSockets;
+        }
+    });
+
+    const double cpuStart = threadCpuTimeSeconds();
+    multiplexer.Run();
+    const double cpuSeconds = threadCpuTimeSeconds() - cpuStart;
+
+    stopSending = true;
+    sender.join();
+
+    long nbOfPacketsReceived = 0;
+    for (int i = 0; i < nbOfSockets; ++i)
+        nbOfPacketsReceived += listeners[i].nbOfPackets;
+
+    std::printf ("backend=%s sockets=%d seconds=%d sent=%ld received=%ld rate=%.0f pkt/s loss=%.2f%% cpu=%.1f ns/pkt ticks=%ld/%d\n",
+                 backendName, nbOfSockets, durationSeconds,
+                 nbOfPacketsSent, nbOfPacketsReceived,
+                 nbOfPacketsReceived / (double) durationSeconds,
+                 nbOfPacketsSent > 0 ? 100.0 * (nbOfPacketsSent - nbOfPacketsReceived) / nbOfPacketsSent : 0.0,
+                 nbOfPacketsReceived > 0 ? 1e9 * cpuSeconds / nbOfPacketsReceived : 0.0,
+                 tickListener.nbOfTicks, durationSeconds * 1000 / tickPeriodMs);
+
+    multiplexer.DetachPeriodicTimerListener (&stopListener);
+    multiplexer.DetachPeriodicTimerListener (&tickListener);
+    for (int i = 0; i < nbOfSockets; ++i)
+    {
+        multiplexer.DetachSocketListener (receiveSockets[i], &listeners[i]);
+        delete receiveSockets[i];
+        delete transmitSockets[i];
+    }
+
+    return 0;
+}
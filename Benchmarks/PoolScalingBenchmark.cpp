@@ -0,0 +1,367 @@
+/*
+ ==============================================================================
+
+    PoolScalingBenchmark.cpp
+    PlayMe - SignalProcessor
+    How the analysis of many channels scales with the worker threads of
+    AnalysisTaskPool : one AnalysisEngine analyses every channel of a
+    synthetic multichannel signal as its own group, with the FFT, on the
+    calling thread only (the staggered FFTs) and then with 0, 1, 3, 7...
+    workers.
+
+    offline : the blocks are processed back to back, as OfflineAnalyzer
+    does : the result is the speed, in times real time.
+    daemon : the blocks are paced at the block rate, as the audio device of
+    SignalProcessorDaemon calls the processor : the workers sleep between
+    the FFT hops. The result is the time of the blocks, and of the blocks
+    which computed FFTs.
+
+    The features emitted by every run are hashed : whatever the number of
+    workers, the engine must emit the same features in the same order
+
+ ==============================================================================
+ */
+
+#include "AnalysisEngine.h"
+#include "AnalysisTaskPool.h"
+#include "PerformanceStats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+struct Options
+{
+    int nbOfChannels = 16;
+    std::vector<int> workerCounts;              // Empty : 0, 1, 3, 7... up to the number of cores minus one
+    double offlineSeconds = 60;                 // Of audio
+    double daemonSeconds = 10;
+    int offlineBlockSize = 512;                 // OfflineAnalyzer's default
+    int daemonBlockSize = 64;                   // CaptureDaemon.xml's default
+    double sampleRate = 48000;
+    bool offline = true, daemon = true;
+    bool linearFFT = false;
+    bool json = false;
+};
+
+static Options options;
+
+//==============================================================================
+// FNV-1a of every feature, and the number of FFTs of the current block
+class HashingSink  : public FeatureSink
+{
+public:
+    uint64_t hash = 14695981039346656037ull;
+    int nbOfFFTs = 0;
+
+    void signalLevelComputed (int group, int64_t time, float level) override               { add (1, group, time, &level, 1); }
+    void signalInstantValComputed (int group, int64_t time, float value) override          { add (2, group, time, &value, 1); }
+    void impulseDetected (int group, int64_t time) override                                 { add (3, group, time, nullptr, 0); }
+
+    void logFFTComputed (int group, int64_t time, const float* bands, int nbOfBands, float fundamentalFreq) override
+    {
+        add (4, group, time, &fundamentalFreq, 1);
+        add (4, group, time, bands, nbOfBands);
+        ++nbOfFFTs;
+    }
+
+    void linearFFTComputed (int group, int64_t time, const float* bins, int nbOfBins, float fundamentalFreq) override
+    {
+        add (5, group, time, &fundamentalFreq, 1);
+        add (5, group, time, bins, nbOfBins);
+        ++nbOfFFTs;
+    }
+
+private:
+    void add (int feature, int group, int64_t time, const float* values, int nbOfValues)
+    {
+        mix (&feature, sizeof (feature));
+        mix (&group, sizeof (group));
+        mix (&time, sizeof (time));
+        mix (values, sizeof (float) * (size_t) nbOfValues);
+    }
+
+    void mix (const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*> (data);
+        for (size_t i = 0; i < size; ++i)
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+};
+
+//==============================================================================
+// 10 seconds, looped : partials at a different fundamental on every channel, noise, and drum hits at a
+// different tempo on every channel
+static std::vector<std::vector<float>> makeSignal()
+{
+    const int length = (int) (10 * options.sampleRate);
+    std::vector<std::vector<float>> channels ((size_t) options.nbOfChannels, std::vector<float> ((size_t) length));
+    uint32_t noise = 1;
+
+    for (int c = 0; c < options.nbOfChannels; ++c)
+    {
+        const double fundamental = 55.0 * std::pow (2.0, c / 4.0);
+        const double beatPeriod = 60.0 / (90 + 7 * c);
+
+        for (int i = 0; i < length; ++i)
+        {
+            const double t = i / options.sampleRate;
+            const double sinceBeat = std::fmod (t, beatPeriod);
+            noise = noise * 1664525u + 1013904223u;
+            const double white = (noise >> 8) / 8388608.0 - 1.0;
+
+            channels[(size_t) c][(size_t) i] = (float) (0.3 * std::sin (2 * M_PI * fundamental * t)
+                                                        + 0.1 * std::sin (2 * M_PI * fundamental * 3 * t)
+                                                        + 0.05 * white
+                                                        + (sinceBeat < 0.005 ? 0.8 * white * std::exp (-sinceBeat * 1000) : 0));
+        }
+    }
+
+    return channels;
+}
+
+//==============================================================================
+struct Result
+{
+    std::string mode;
+    int workers = -1;                           // -1 : no pool, the FFTs are staggered on the calling thread
+    int rtWorkers = 0;                          // Workers running with SCHED_FIFO
+    double audioSeconds = 0, elapsedSeconds = 0;
+    std::vector<uint64_t> blockTimes;           // Nanoseconds
+    std::vector<uint64_t> fftBlockTimes;        // The blocks which computed FFTs
+    uint64_t hash = 0;
+    int64_t nbOfFFTs = 0;
+};
+
+static uint64_t getPercentile (std::vector<uint64_t>& values, double percentile)
+{
+    if (values.empty())
+        return 0;
+
+    std::sort (values.begin(), values.end());
+    return values[std::min (values.size() - 1, (size_t) (percentile * values.size()))];
+}
+
+static Result run (const std::vector<std::vector<float>>& signal, bool paced, int nbOfWorkers)
+{
+    Result result;
+    result.mode = paced ? "daemon" : "offline";
+    result.workers = nbOfWorkers;
+
+    const int blockSize = paced ? options.daemonBlockSize : options.offlineBlockSize;
+    const double seconds = paced ? options.daemonSeconds : options.offlineSeconds;
+    const int64_t nbOfSamples = (int64_t) (seconds * options.sampleRate);
+    const int signalLength = (int) signal[0].size() / blockSize * blockSize;
+
+    std::unique_ptr<AnalysisTaskPool> pool (nbOfWorkers >= 0 ? new AnalysisTaskPool (nbOfWorkers) : nullptr);
+    AnalysisEngine engine;
+    engine.setTaskPool (pool.get());
+    engine.setSampleRate (options.sampleRate);
+    engine.settings.fftEnabled = true;
+    engine.settings.logarithmicFFT = ! options.linearFFT;
+    engine.prepareFFT();
+
+    if (pool != nullptr)
+        result.rtWorkers = pool->getNbOfRealTimeWorkers();
+
+    std::vector<AnalysisEngine::ChannelGroup> groups ((size_t) options.nbOfChannels);
+    for (int c = 0; c < options.nbOfChannels; ++c)
+        groups[(size_t) c] = AnalysisEngine::ChannelGroup { c, 1 };
+
+    std::vector<const float*> channels ((size_t) options.nbOfChannels);
+    HashingSink sink;
+
+    const std::chrono::nanoseconds period ((int64_t) (blockSize * 1.0e9 / options.sampleRate));
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now();
+    const uint64_t start = getMonotonicNanoseconds();
+
+    for (int64_t position = 0; position + blockSize <= nbOfSamples; position += blockSize)
+    {
+        if (paced)
+        {
+            deadline += period;
+            std::this_thread::sleep_until (deadline);
+        }
+
+        const int offset = (int) (position % signalLength);
+        for (int c = 0; c < options.nbOfChannels; ++c)
+            channels[(size_t) c] = signal[(size_t) c].data() + offset;
+
+        sink.nbOfFFTs = 0;
+        const uint64_t blockStart = getMonotonicNanoseconds();
+        engine.process (channels.data(), groups.data(), options.nbOfChannels, blockSize, sink);
+        const uint64_t blockTime = getMonotonicNanoseconds() - blockStart;
+
+        if (paced)
+        {
+            result.blockTimes.push_back (blockTime);
+            if (sink.nbOfFFTs > 0)
+                result.fftBlockTimes.push_back (blockTime);
+        }
+    }
+
+    result.elapsedSeconds = (getMonotonicNanoseconds() - start) / 1.0e9;
+    result.audioSeconds = engine.getSamplesProcessed() / options.sampleRate;
+    result.hash = sink.hash;
+    result.nbOfFFTs = engine.getNbOfFFTs();
+    return result;
+}
+
+//==============================================================================
+static void report (Result& result, const Result* reference)
+{
+    const std::string workerText (result.workers < 0 ? std::string ("none") : std::to_string (result.workers));
+
+    // The runs with a pool must emit the same features as the run with 0 workers
+    const char* const same = (result.workers < 0 || reference == nullptr) ? "-" : (result.hash == reference->hash ? "yes" : "NO");
+
+    if (result.mode == "offline")
+    {
+        const double speed = result.audioSeconds / result.elapsedSeconds;
+        const double speedup = reference != nullptr && result.workers >= 0
+                                   ? reference->elapsedSeconds / result.elapsedSeconds : 1.0;
+
+        if (options.json)
+            std::printf ("{\"mode\":\"offline\",\"channels\":%d,\"workers\":%d,\"rtWorkers\":%d,\"blockSize\":%d,\"ffts\":%lld,"
+                         "\"realTimeSpeed\":%.1f,\"speedup\":%.3f,\"identical\":%s}\n",
+                         options.nbOfChannels, result.workers, result.rtWorkers, options.offlineBlockSize, (long long) result.nbOfFFTs,
+                         speed, speedup, result.workers < 0 ? "null" : (result.hash == reference->hash ? "true" : "false"));
+        else
+            std::printf ("%-8s %7s %6d %8lld %10.1f %8.2f %9.2f %9s\n", "offline", workerText.c_str(), result.rtWorkers,
+                         (long long) result.nbOfFFTs, speed, speedup, result.workers >= 0 ? speedup / (result.workers + 1) : 1.0, same);
+        return;
+    }
+
+    const double periodMicroseconds = options.daemonBlockSize * 1.0e6 / options.sampleRate;
+    const double block50 = getPercentile (result.blockTimes, 0.5) / 1000.0;
+    const double block99 = getPercentile (result.blockTimes, 0.99) / 1000.0;
+    const double blockMax = getPercentile (result.blockTimes, 1) / 1000.0;
+    const double fft50 = getPercentile (result.fftBlockTimes, 0.5) / 1000.0;
+    const double fftMax = getPercentile (result.fftBlockTimes, 1) / 1000.0;
+
+    if (options.json)
+        std::printf ("{\"mode\":\"daemon\",\"channels\":%d,\"workers\":%d,\"rtWorkers\":%d,\"blockSize\":%d,\"ffts\":%lld,"
+                     "\"blockUsP50\":%.2f,\"blockUsP99\":%.2f,\"blockUsMax\":%.2f,\"fftBlocks\":%zu,\"fftBlockUsP50\":%.2f,"
+                     "\"fftBlockUsMax\":%.2f,\"deadlineUtilizationMax\":%.4f,\"identical\":%s}\n",
+                     options.nbOfChannels, result.workers, result.rtWorkers, options.daemonBlockSize, (long long) result.nbOfFFTs,
+                     block50, block99, blockMax, result.fftBlockTimes.size(), fft50, fftMax, blockMax / periodMicroseconds,
+                     result.workers < 0 ? "null" : (result.hash == reference->hash ? "true" : "false"));
+    else
+        std::printf ("%-8s %7s %6d %8lld %8.1f %8.1f %8.1f %8zu %8.1f %8.1f %7.3f %9s\n", "daemon", workerText.c_str(), result.rtWorkers,
+                     (long long) result.nbOfFFTs, block50, block99, blockMax, result.fftBlockTimes.size(), fft50, fftMax,
+                     blockMax / periodMicroseconds, same);
+}
+
+static void runMode (const std::vector<std::vector<float>>& signal, bool paced)
+{
+    if (! options.json)
+    {
+        if (paced)
+            std::printf ("\n%-8s %7s %6s %8s %8s %8s %8s %8s %8s %8s %7s %9s\n", "mode", "workers", "rt", "ffts",
+                         "blk50", "blk99", "blkmax", "fftblks", "fft50", "fftmax", "utilmax", "identical");
+        else
+            std::printf ("\n%-8s %7s %6s %8s %10s %8s %9s %9s\n", "mode", "workers", "rt", "ffts",
+                         "xrealtime", "speedup", "efficiency", "identical");
+    }
+
+    // The staggered FFTs, then the pool : the first pool run is the reference
+    Result serial = run (signal, paced, -1);
+    report (serial, nullptr);
+
+    std::unique_ptr<Result> reference;
+    for (int nbOfWorkers : options.workerCounts)
+    {
+        Result result = run (signal, paced, nbOfWorkers);
+        if (reference == nullptr)
+            reference.reset (new Result (result));
+
+        report (result, reference.get());
+    }
+}
+
+//==============================================================================
+static bool parseWorkerCounts (const std::string& text)
+{
+    options.workerCounts.clear();
+
+    for (size_t start = 0; start <= text.size();)
+    {
+        size_t end = text.find (',', start);
+        if (end == std::string::npos)
+            end = text.size();
+
+        const int count = std::atoi (text.substr (start, end - start).c_str());
+        if (count < 0 || count > AnalysisTaskPool::maxNbOfWorkers)
+            return false;
+
+        options.workerCounts.push_back (count);
+        start = end + 1;
+    }
+
+    return ! options.workerCounts.empty();
+}
+
+int main (int argc, char* argv[])
+{
+    bool valid = true;
+
+    for (int i = 1; i < argc && valid; ++i)
+    {
+        const std::string arg (argv[i]);
+        const size_t equal = arg.find ('=');
+        const std::string name (arg.substr (0, equal));
+        const std::string value (equal != std::string::npos ? arg.substr (equal + 1) : std::string());
+
+        if (arg == "--json")                            options.json = true;
+        else if (arg == "--linear")                     options.linearFFT = true;
+        else if (arg == "--offline")                    options.daemon = false;
+        else if (arg == "--daemon")                     options.offline = false;
+        else if (name == "--channels")                  options.nbOfChannels = std::atoi (value.c_str());
+        else if (name == "--workers")                   valid = parseWorkerCounts (value);
+        else if (name == "--seconds")                   options.offlineSeconds = std::atof (value.c_str());
+        else if (name == "--daemon-seconds")            options.daemonSeconds = std::atof (value.c_str());
+        else if (name == "--block")                     options.offlineBlockSize = std::atoi (value.c_str());
+        else if (name == "--daemon-block")              options.daemonBlockSize = std::atoi (value.c_str());
+        else if (name == "--samplerate")                options.sampleRate = std::atof (value.c_str());
+        else                                            valid = false;
+    }
+
+    valid = valid && options.nbOfChannels > 0 && options.nbOfChannels <= AnalysisEngine::maxNbOfGroups
+             && options.offlineSeconds > 0 && options.daemonSeconds > 0 && options.offlineBlockSize > 0
+             && options.daemonBlockSize > 0 && options.sampleRate > 0 && (options.offline || options.daemon);
+
+    if (! valid)
+    {
+        std::fprintf (stderr, "usage: %s [--offline | --daemon] [--channels=16] [--workers=0,1,3,7] [--linear] [--seconds=60]\n"
+                              "       [--daemon-seconds=10] [--block=512] [--daemon-block=64] [--samplerate=48000] [--json]\n", argv[0]);
+        return 1;
+    }
+
+    const int nbOfCores = AnalysisTaskPool::getNbOfCores();
+    if (options.workerCounts.empty())
+        for (int participants = 1; participants <= std::min (nbOfCores, (int) AnalysisTaskPool::maxNbOfWorkers + 1); participants *= 2)
+            options.workerCounts.push_back (participants - 1);
+
+    if (! options.json)
+        std::printf ("%d channels analysed one by one, %s FFT, %d cores, %g Hz\n", options.nbOfChannels,
+                     options.linearFFT ? "linear" : "log", nbOfCores, options.sampleRate);
+
+    const std::vector<std::vector<float>> signal (makeSignal());
+
+    if (options.offline)
+        runMode (signal, false);
+
+    if (options.daemon)
+        runMode (signal, true);
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ ==============================================================================
+
+    StartupBenchmark.cpp
+    PlayMe - SignalProcessor
+    Measure the transport cost of loading N plugin instances : the time spent
+    creating the sockets in the constructor (what the plugin used to do), and
+    the time spent with OutputTransport, where the constructor and open()
+    return immediately and the sockets are created in the background
+
+ ==============================================================================
+ */
+
+#include "OutputTransport.h"
+#include "ip/UdpSocket.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const int udpPorts[OutputTransport::totalNumDestinations] = { 7001, 7002, 7003, 7004, 7005, 7006, 7007 };
+static const int oscPort = 9000;
+
+static double millisecondsSince (std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now() - start).count();
+}
+
+//==============================================================================
+// The sockets of one instance, created the way the plugin's constructor used to create them
+struct EagerTransport
+{
+    EagerTransport (const std::string& address)
+        : oscSocket (IpEndpointName (address.c_str(), oscPort))
+    {
+        for (int i = 0; i < OutputTransport::totalNumDestinations; ++i)
+            clients[i] = new udp_client (address, udpPorts[i]);
+    }
+
+    ~EagerTransport()
+    {
+        for (int i = 0; i < OutputTransport::totalNumDestinations; ++i)
+            delete clients[i];
+    }
+
+    UdpTransmitSocket oscSocket;
+    udp_client* clients[OutputTransport::totalNumDestinations];
+};
+
+//==============================================================================
+// usage: StartupBenchmark [nbOfInstances=64] [address=127.0.0.1]
+int main (int argc, char* argv[])
+{
+    const int nbOfInstances   = (argc > 1) ? std::atoi (argv[1]) : 64;
+    const std::string address = (argc > 2) ? argv[2] : "127.0.0.1";
+
+    // Eager : every constructor resolves the address and creates its sockets
+    std::vector<EagerTransport*> eager;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nbOfInstances; ++i)
+        eager.push_back (new EagerTransport (address));
+    const double eagerMs = millisecondsSince (start);
+
+    for (size_t i = 0; i < eager.size(); ++i)
+        delete eager[i];
+
+    // Lazy : the constructors and open() return immediately, then wait until every instance can send
+    std::vector<OutputTransport*> lazy;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nbOfInstances; ++i)
+        lazy.push_back (new OutputTransport (address, udpPorts, oscPort));
+    const double constructMs = millisecondsSince (start);
+
+    for (int i = 0; i < nbOfInstances; ++i)
+        lazy[i]->open();
+    const double openMs = millisecondsSince (start) - constructMs;
+
+    int nbOfFailures = 0;
+    for (int i = 0; i < nbOfInstances; ++i)
+    {
+        while (! lazy[i]->isReady() && ! lazy[i]->hasFailed())
+            std::this_thread::yield();
+
+        nbOfFailures += lazy[i]->hasFailed() ? 1 : 0;
+    }
+    const double readyMs = millisecondsSince (start);
+
+    for (size_t i = 0; i < lazy.size(); ++i)
+        delete lazy[i];
+
+    std::printf ("instances=%d address=%s eager_ctor=%.3f ms lazy_ctor=%.3f ms lazy_open=%.3f ms lazy_all_ready=%.3f ms failures=%d\n",
+                 nbOfInstances, address.c_str(), eagerMs, constructMs, openMs, readyMs, nbOfFailures);
+
+    return nbOfFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+/*
+ ==============================================================================
+
+    LatencyProbe.h
+    PlayMe - SignalProcessor
+    Stamp the plugin adds to its Impulse and SignalLevel messages in latency
+    probe mode (/sp/<channel>/probe 1, or latencyProbe="1" in its state) :
+    when the block holding the feature entered processBlock, when the engine
+    handed the feature over, and when the message was sent. The times are
+    getMonotonicNanoseconds() values (Source/PerformanceStats.h) : a receiver
+    on the same machine reads the same clock, and splits the latency into
+    analysis (feature - block entry), queueing (send - feature) and network
+    (arrival - send) delays.
+
+    Protobuf packets carry the stamp as three fixed64 fields which are not
+    part of SignalMessages.proto, so the consumers skip them. OSC messages
+    carry it as three extra int64 arguments after the plugin's own ones.
+
+ ==============================================================================
+ */
+
+#ifndef LATENCYPROBE_H_INCLUDED
+#define LATENCYPROBE_H_INCLUDED
+
+#include "SignalWireFormat.h"
+#include "osc/OscOutboundPacketStream.h"
+#include "osc/OscReceivedElements.h"
+
+namespace LatencyProbe
+{
+    static const int blockEntryField    = 1010;     // fixed64, ns
+    static const int featureField       = 1011;     // fixed64, ns
+    static const int sendField          = 1012;     // fixed64, ns
+
+    static const int maxStampSize       = 3 * 10;   // Encoded size of the three fields
+
+    struct Stamp
+    {
+        Stamp (uint64_t b = 0, uint64_t f = 0, uint64_t s = 0)  : blockEntry (b), feature (f), send (s) {}
+
+        uint64_t blockEntry;
+        uint64_t feature;
+        uint64_t send;
+    };
+
+    //==============================================================================
+    // Returns the new size of the packet, or -1 if the buffer is too small
+    inline int append (const Stamp& stamp, char* buffer, int size, int capacity)
+    {
+        size = SignalWireFormat::appendFixed64Field (blockEntryField, stamp.blockEntry, buffer, size, capacity);
+        if (size >= 0)
+            size = SignalWireFormat::appendFixed64Field (featureField, stamp.feature, buffer, size, capacity);
+        if (size >= 0)
+            size = SignalWireFormat::appendFixed64Field (sendField, stamp.send, buffer, size, capacity);
+        return size;
+    }
+
+    inline bool find (const char* data, int size, Stamp& stamp)
+    {
+        return SignalWireFormat::findFixed64Field (data, size, blockEntryField, stamp.blockEntry)
+            && SignalWireFormat::findFixed64Field (data, size, featureField, stamp.feature)
+            && SignalWireFormat::findFixed64Field (data, size, sendField, stamp.send);
+    }
+
+    //==============================================================================
+    // Must be streamed before osc::EndMessage
+    inline osc::OutboundPacketStream& operator<< (osc::OutboundPacketStream& stream, const Stamp& stamp)
+    {
+        return stream << (osc::int64) stamp.blockEntry << (osc::int64) stamp.feature << (osc::int64) stamp.send;
+    }
+
+    // Looks for the stamp in the last three arguments of the message
+    inline bool find (const osc::ReceivedMessage& message, Stamp& stamp)
+    {
+        const int nbOfArguments = (int) message.ArgumentCount();
+        if (nbOfArguments < 3)
+            return false;
+
+        osc::ReceivedMessage::const_iterator argument = message.ArgumentsBegin();
+        for (int i = 0; i < nbOfArguments - 3; ++i)
+            ++argument;
+
+        // The iterator owns the argument it points to : copy them
+        const osc::ReceivedMessageArgument blockEntry = *argument++;
+        const osc::ReceivedMessageArgument feature = *argument++;
+        const osc::ReceivedMessageArgument send = *argument;
+
+        if (! blockEntry.IsInt64() || ! feature.IsInt64() || ! send.IsInt64())
+            return false;
+
+        stamp.blockEntry = (uint64_t) blockEntry.AsInt64Unchecked();
+        stamp.feature = (uint64_t) feature.AsInt64Unchecked();
+        stamp.send = (uint64_t) send.AsInt64Unchecked();
+        return true;
+    }
+}
+
+#endif  // LATENCYPROBE_H_INCLUDED
@@ -0,0 +1,77 @@
+/*
+ ==============================================================================
+
+    SeqLock.h
+    PlayMe - SignalProcessor client
+    Single writer / multiple readers sequence lock : the writer never waits,
+    a reader copies the state and retries if the writer modified it meanwhile
+
+ ==============================================================================
+ */
+
+#ifndef SEQLOCK_H_INCLUDED
+#define SEQLOCK_H_INCLUDED
+
+#include <atomic>
+#include <stdint.h>
+
+//==============================================================================
+/**
+    State must be trivially copyable. The writer updates it in place :
+
+        State& s = lock.beginWrite();
+        s.level = 0.5f;
+        lock.endWrite();
+
+    The copy made by read() may race with the writer : the sequence number is
+    what tells the reader to throw that copy away and read again
+ */
+template <typename State>
+class SeqLock
+{
+public:
+    SeqLock() : sequence (0), state() {}
+
+    // Writer thread only
+    State& beginWrite()
+    {
+        const uint32_t s = sequence.load (std::memory_order_relaxed);
+        sequence.store (s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence (std::memory_order_release);
+        return state;
+    }
+
+    void endWrite()
+    {
+        sequence.store (sequence.load (std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Any thread : returns the last complete state
+    void read (State& destination) const
+    {
+        for (;;)
+        {
+            const uint32_t before = sequence.load (std::memory_order_acquire);
+            if ((before & 1) == 0)
+            {
+                destination = state;
+                std::atomic_thread_fence (std::memory_order_acquire);
+
+                if (sequence.load (std::memory_order_relaxed) == before)
+                    return;
+            }
+        }
+    }
+
+    // Incremented twice per write : tells a reader if something changed since its last read
+    uint32_t getVersion() const         { return sequence.load (std::memory_order_acquire); }
+
+private:
+    std::atomic<uint32_t> sequence;
+    State state;
+
+    SeqLock (const SeqLock&) = delete;
+    SeqLock& operator= (const SeqLock&) = delete;
+};
+
+#endif  // SEQLOCK_H_INCLUDED
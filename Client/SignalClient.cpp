@@ -0,0 +1,278 @@
+/*
+ ==============================================================================
+
+    SignalClient.cpp
+    PlayMe - SignalProcessor client
+    Receive thread : decode the messages and publish the channels' state
+
+ ==============================================================================
+ */
+
+#include "SignalClient.h"
+#include <chrono>
+
+//==============================================================================
+SignalClient::SignalClient()
+    : SignalClient (Ports())
+{
+}
+
+SignalClient::SignalClient (const Ports& ports)
+    : channels (new SeqLock<ChannelState>[maxNbOfChannels]),
+      spectrums (new SeqLock<SpectrumState>[maxNbOfChannels]),
+      impulseCounts (new std::atomic<uint32_t>[maxNbOfChannels]),
+      takenImpulseCounts (new uint32_t[maxNbOfChannels]),
+      nbOfMessagesReceived (0),
+      nbOfMessagesRejected (0),
+      eventQueueRead (0),
+      eventQueueWrite (0),
+      eventQueueEnabled (false),
+      nbOfEventsDropped (0)
+{
+    portNumbers[signalLevelType]        = ports.signalLevel;
+    portNumbers[signalInstantValType]   = ports.signalInstantVal;
+    portNumbers[impulseType]            = ports.impulse;
+    portNumbers[timeInfoType]           = ports.timeInfo;
+    portNumbers[fftType]                = ports.fft;
+
+    for (int i = 0; i < totalNumMessageTypes; ++i)
+    {
+        sockets[i] = nullptr;
+        listeners[i].client = this;
+        listeners[i].type = (MessageType) i;
+    }
+
+    for (int i = 0; i < maxNbOfChannels; ++i)
+    {
+        impulseCounts[i].store (0, std::memory_order_relaxed);
+        takenImpulseCounts[i] = 0;
+    }
+}
+
+SignalClient::~SignalClient()
+{
+    stop();
+}
+
+//==============================================================================
+void SignalClient::start()
+{
+    if (isRunning())
+        return;
+
+    try
+    {
+        for (int i = 0; i < totalNumMessageTypes; ++i)
+        {
+            sockets[i] = new UdpReceiveSocket (IpEndpointName (IpEndpointName::ANY_ADDRESS, portNumbers[i]));
+            multiplexer.AttachSocketListener (sockets[i], &listeners[i]);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        stop();
+        throw;
+    }
+
+    receiveThread = std::thread ([this] { multiplexer.Run(); });
+}
+
+void SignalClient::stop()
+{
+    if (receiveThread.joinable())
+    {
+        multiplexer.AsynchronousBreak();
+        receiveThread.join();
+    }
+
+    for (int i = 0; i < totalNumMessageTypes; ++i)
+    {
+        if (sockets[i] != nullptr)
+        {
+            multiplexer.DetachSocketListener (sockets[i], &listeners[i]);
+            delete sockets[i];
+            sockets[i] = nullptr;
+        }
+    }
+}
+
+int64_t SignalClient::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//==============================================================================
+bool SignalClient::readChannel (int channel, ChannelState& state) const
+{
+    if (! isValidChannel (channel))
+        return false;
+
+    channels[channel - 1].read (state);
+    return true;
+}
+
+bool SignalClient::readSpectrum (int channel, SpectrumState& state) const
+{
+    if (! isValidChannel (channel))
+        return false;
+
+    spectrums[channel - 1].read (state);
+    return true;
+}
+
+void SignalClient::readTransport (TransportState& state) const
+{
+    transport.read (state);
+}
+
+int SignalClient::takeImpulses (int channel)
+{
+    if (! isValidChannel (channel))
+        return 0;
+
+    const uint32_t count = impulseCounts[channel - 1].load (std::memory_order_acquire);
+    const uint32_t nbOfNewImpulses = count - takenImpulseCounts[channel - 1];
+    takenImpulseCounts[channel - 1] = count;
+    return (int) nbOfNewImpulses;
+}
+
+//==============================================================================
+void SignalClient::PortListener::ProcessPacket (const char* data, int size, const IpEndpointName& /*remoteEndpoint*/)
+{
+    client->handlePacket (type, data, size);
+}
+
+void SignalClient::handlePacket (MessageType type, const char* data, int size)
+{
+    const int64_t time = now();
+    bool accepted = false;
+
+    switch (type)
+    {
+        case signalLevelType:
+            if (SignalWireFormat::decode (data, size, signalLevelMessage) && isValidChannel (signalLevelMessage.signalID))
+            {
+                ChannelState& state = channels[signalLevelMessage.signalID - 1].beginWrite();
+                state.signalLevel = signalLevelMessage.signalLevel;
+                state.signalLevelTime = time;
+                channels[signalLevelMessage.signalID - 1].endWrite();
+                pushEvent (Event::signalLevelEvent, signalLevelMessage.signalID, time, &signalLevelMessage.signalLevel, 1);
+                accepted = true;
+            }
+            break;
+
+        case signalInstantValType:
+            if (SignalWireFormat::decode (data, size, instantValMessage) && isValidChannel (instantValMessage.signalID))
+            {
+                ChannelState& state = channels[instantValMessage.signalID - 1].beginWrite();
+                state.signalInstantVal = instantValMessage.signalInstantVal;
+                state.instantValTime = time;
+                channels[instantValMessage.signalID - 1].endWrite();
+                pushEvent (Event::signalInstantValEvent, instantValMessage.signalID, time, &instantValMessage.signalInstantVal, 1);
+                accepted = true;
+            }
+            break;
+
+        case impulseType:
+            if (SignalWireFormat::decode (data, size, impulseMessage) && isValidChannel (impulseMessage.signalID))
+            {
+                impulseCounts[impulseMessage.signalID - 1].fetch_add (1, std::memory_order_release);
+                pushEvent (Event::impulseEvent, impulseMessage.signalID, time, nullptr, 0);
+                accepted = true;
+            }
+            break;
+
+        case timeInfoType:
+            if (SignalWireFormat::decode (data, size, timeInfoMessage))
+            {
+                TransportState& state = transport.beginWrite();
+                state.isPlaying = timeInfoMessage.isPlaying;
+                state.tempo = timeInfoMessage.tempo;
+                state.position = timeInfoMessage.position;
+                state.time = time;
+                transport.endWrite();
+
+                const float values[] = { timeInfoMessage.tempo, timeInfoMessage.position, timeInfoMessage.isPlaying ? 1.0f : 0.0f };
+                pushEvent (Event::timeInfoEvent, 0, time, values, 3);
+                accepted = true;
+            }
+            break;
+
+        case fftType:
+            accepted = handleFFT (data, size, time);
+            break;
+
+        default:
+            break;
+    }
+
+    if (accepted)
+        nbOfMessagesReceived.fetch_add (1, std::memory_order_relaxed);
+    else
+        nbOfMessagesRejected.fetch_add (1, std::memory_order_relaxed);
+}
+
+bool SignalClient::handleFFT (const char* data, int size, int64_t time)
+{
+    if (! SignalWireFormat::decode (data, size, fftMessage) || ! isValidChannel (fftMessage.signalID))
+        return false;
+
+    const int index = fftMessage.signalID - 1;
+
+    if (fftMessage.isLinear)
+    {
+        SpectrumState& state = spectrums[index].beginWrite();
+        state.fundamentalFreq = fftMessage.fundamentalFreq;
+        state.nbOfBins = fftMessage.nbOfValues;
+        for (int i = 0; i < fftMessage.nbOfValues; ++i)
+            state.bins[i] = fftMessage.values[i];
+        state.time = time;
+        spectrums[index].endWrite();
+    }
+    else
+    {
+        ChannelState& state = channels[index].beginWrite();
+        state.fundamentalFreq = fftMessage.fundamentalFreq;
+        for (int i = 0; i < SignalWireFormat::nbOfLogBands; ++i)
+            state.bands[i] = (i < fftMessage.nbOfValues) ? fftMessage.values[i] : 0;
+        state.bandsTime = time;
+        channels[index].endWrite();
+        pushEvent (Event::bandsEvent, fftMessage.signalID, time, state.bands, SignalWireFormat::nbOfLogBands);
+    }
+
+    return true;
+}
+
+//==============================================================================
+void SignalClient::pushEvent (Event::Type type, int channel, int64_t time, const float* values, int nbOfValues)
+{
+    if (! eventQueueEnabled.load (std::memory_order_relaxed))
+        return;
+
+    const uint32_t write = eventQueueWrite.load (std::memory_order_relaxed);
+    if (write - eventQueueRead.load (std::memory_order_acquire) >= eventQueueSize)
+    {
+        nbOfEventsDropped.fetch_add (1, std::memory_order_relaxed);
+        return;
+    }
+
+    Event& event = eventQueue[write & (eventQueueSize - 1)];
+    event.type = type;
+    event.channel = channel;
+    event.time = time;
+    for (int i = 0; i < nbOfValues; ++i)
+        event.values[i] = values[i];
+
+    eventQueueWrite.store (write + 1, std::memory_order_release);
+}
+
+bool SignalClient::popEvent (Event& event)
+{
+    const uint32_t read = eventQueueRead.load (std::memory_order_relaxed);
+    if (read == eventQueueWrite.load (std::memory_order_acquire))
+        return false;
+
+    event = eventQueue[read & (eventQueueSize - 1)];
+    eventQueueRead.store (read + 1, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,202 @@
+/*
+ ==============================================================================
+
+    SignalClient.h
+    PlayMe - SignalProcessor client
+    Receive the Protobuf messages sent by the plugin instances (ports 7001 to
+    7005), and keep the latest state of every channel. The render thread reads
+    that state without locks, at its own rate
+
+ ==============================================================================
+ */
+
+#ifndef SIGNALCLIENT_H_INCLUDED
+#define SIGNALCLIENT_H_INCLUDED
+
+#include "SignalWireFormat.h"
+#include "SeqLock.h"
+#include "ip/UdpSocket.h"
+#include "ip/PacketListener.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <stdint.h>
+#include <thread>
+
+//==============================================================================
+/**
+    Usage, from the render loop :
+
+        SignalClient client;
+        client.start();
+        ...
+        SignalClient::ChannelState state;
+        client.readChannel (1, state);
+        const int nbOfBeats = client.takeImpulses (1);
+
+    The receive thread decodes every message into preallocated structs :
+    once started, the client does not allocate
+ */
+class SignalClient
+{
+public:
+    // The "channels" of the client are the signal IDs : 1 to 16 for the channels of the plugin's editor, then
+    // the other channel groups and the sidechain of the instances (see SignalWireFormat::getSignalID)
+    static const int maxNbOfChannels = SignalWireFormat::maxNbOfSignalIDs;
+
+    // Continuous features of one channel. The times are the receive times, in steady_clock nanoseconds
+    struct ChannelState
+    {
+        float signalLevel       = 0;
+        float signalInstantVal  = 0;
+        float fundamentalFreq   = 0;
+        float bands[SignalWireFormat::nbOfLogBands] = {};    // LogFFT bands
+        int64_t signalLevelTime = 0;
+        int64_t instantValTime  = 0;
+        int64_t bandsTime       = 0;
+    };
+
+    // Linear FFT of one channel : kept apart, so that reading the small ChannelState stays cheap
+    struct SpectrumState
+    {
+        float fundamentalFreq   = 0;
+        int nbOfBins            = 0;
+        float bins[SignalWireFormat::maxNbOfLinearBins];
+        int64_t time            = 0;
+    };
+
+    struct TransportState
+    {
+        bool isPlaying          = false;
+        float tempo             = 0;
+        float position          = 0;                        // Pulses-per-quarter-note
+        int64_t time            = 0;
+    };
+
+    struct Ports
+    {
+        int signalLevel         = 7001;
+        int signalInstantVal    = 7002;
+        int impulse             = 7003;
+        int timeInfo            = 7004;
+        int fft                 = 7005;
+    };
+
+    SignalClient();
+    explicit SignalClient (const Ports& ports);
+    ~SignalClient();
+
+    // Bind the ports and start the receive thread. Throws std::runtime_error if a port cannot be bound
+    void start();
+    void stop();
+    bool isRunning() const              { return receiveThread.joinable(); }
+
+    // Any thread, lock-free. channel is 1 to maxNbOfChannels ; return false for another channel
+    bool readChannel (int channel, ChannelState& state) const;
+    bool readSpectrum (int channel, SpectrumState& state) const;
+    void readTransport (TransportState& state) const;
+
+    // Number of impulses received since the previous call. Only one thread should take the impulses
+    int takeImpulses (int channel);
+
+    // Total number of messages decoded / rejected (malformed, or for an unknown channel)
+    uint64_t getNbOfMessagesReceived() const    { return nbOfMessagesReceived.load (std::memory_order_relaxed); }
+    uint64_t getNbOfMessagesRejected() const    { return nbOfMessagesRejected.load (std::memory_order_relaxed); }
+
+    // Receive time base of the states above
+    static int64_t now();
+
+    //==============================================================================
+    // Every decoded message can also be queued, for the consumers which need all the values and not only
+    // the latest one (see SignalJitterBuffer). Disabled by default : nobody would empty the queue
+    struct Event
+    {
+        enum Type
+        {
+            signalLevelEvent = 0,
+            signalInstantValEvent,
+            impulseEvent,
+            timeInfoEvent,
+            bandsEvent
+        };
+
+        Type type;
+        int channel;                                        // 0 for timeInfoEvent
+        int64_t time;                                       // Receive time
+        float values[SignalWireFormat::nbOfLogBands];      // level / instant value in values[0], bands,
+                                                            // or tempo, position and isPlaying (1 or 0)
+    };
+
+    void setEventQueueEnabled (bool shouldBeEnabled)        { eventQueueEnabled.store (shouldBeEnabled); }
+
+    // Single consumer thread : returns false when the queue is empty
+    bool popEvent (Event& event);
+
+    // Events lost because the queue was full
+    uint64_t getNbOfEventsDropped() const       { return nbOfEventsDropped.load (std::memory_order_relaxed); }
+
+private:
+    enum MessageType
+    {
+        signalLevelType = 0,
+        signalInstantValType,
+        impulseType,
+        timeInfoType,
+        fftType,
+        totalNumMessageTypes
+    };
+
+    // One listener per port : the port tells the message type
+    class PortListener : public PacketListener
+    {
+    public:
+        SignalClient* client = nullptr;
+        MessageType type = signalLevelType;
+
+        void ProcessPacket (const char* data, int size, const IpEndpointName& remoteEndpoint) override;
+    };
+
+    void handlePacket (MessageType type, const char* data, int size);
+    bool handleFFT (const char* data, int size, int64_t time);
+    void pushEvent (Event::Type type, int channel, int64_t time, const float* values, int nbOfValues);
+    static bool isValidChannel (int channel)    { return channel >= 1 && channel <= maxNbOfChannels; }
+
+    int portNumbers[totalNumMessageTypes];
+    UdpSocket* sockets[totalNumMessageTypes];
+    PortListener listeners[totalNumMessageTypes];
+    SocketReceiveMultiplexer multiplexer;
+    std::thread receiveThread;
+
+    // maxNbOfChannels states each : allocated by the constructor, the spectrums alone would not fit on a stack
+    std::unique_ptr<SeqLock<ChannelState>[]> channels;
+    std::unique_ptr<SeqLock<SpectrumState>[]> spectrums;
+    SeqLock<TransportState> transport;
+
+    // Impulses are counted rather than stored in the state, so that none is lost between two frames
+    std::unique_ptr<std::atomic<uint32_t>[]> impulseCounts;
+    std::unique_ptr<uint32_t[]> takenImpulseCounts;
+
+    std::atomic<uint64_t> nbOfMessagesReceived;
+    std::atomic<uint64_t> nbOfMessagesRejected;
+
+    // Single producer / single consumer event queue
+    static const uint32_t eventQueueSize = 4096;           // Power of 2 : about 1 s of messages for 16 channels
+    Event eventQueue[eventQueueSize];
+    std::atomic<uint32_t> eventQueueRead;
+    std::atomic<uint32_t> eventQueueWrite;
+    std::atomic<bool> eventQueueEnabled;
+    std::atomic<uint64_t> nbOfEventsDropped;
+
+    // Decoding buffers, only used by the receive thread
+    SignalWireFormat::SignalLevelMessage signalLevelMessage;
+    SignalWireFormat::SignalInstantValMessage instantValMessage;
+    SignalWireFormat::ImpulseMessage impulseMessage;
+    SignalWireFormat::TimeInfoMessage timeInfoMessage;
+    SignalWireFormat::FFTMessage fftMessage;
+
+    SignalClient (const SignalClient&) = delete;
+    SignalClient& operator= (const SignalClient&) = delete;
+};
+
+#endif  // SIGNALCLIENT_H_INCLUDED
@@ -0,0 +1,137 @@
+/*
+ ==============================================================================
+
+    SignalJitterBuffer.cpp
+    PlayMe - SignalProcessor client
+    Fixed delay rendering of the features received by SignalClient
+
+ ==============================================================================
+ */
+
+#include "SignalJitterBuffer.h"
+
+//==============================================================================
+SignalJitterBuffer::SignalJitterBuffer (SignalClient& c, int64_t delayNanoseconds)
+    : client (c),
+      delay (delayNanoseconds),
+      levelTracks (new FeatureTrack<1, 256>[SignalClient::maxNbOfChannels]),
+      instantValTracks (new FeatureTrack<1, 256>[SignalClient::maxNbOfChannels]),
+      bandTracks (new FeatureTrack<SignalWireFormat::nbOfLogBands, 64>[SignalClient::maxNbOfChannels]),
+      pendingImpulses (new int64_t[SignalClient::maxNbOfChannels][maxNbOfPendingImpulses]),
+      nbOfPendingImpulses (new int[SignalClient::maxNbOfChannels])
+{
+    for (int i = 0; i < SignalClient::maxNbOfChannels; ++i)
+        nbOfPendingImpulses[i] = 0;
+
+    client.setEventQueueEnabled (true);
+}
+
+void SignalJitterBuffer::update()
+{
+    SignalClient::Event event;
+
+    while (client.popEvent (event))
+    {
+        const int index = event.channel - 1;
+
+        switch (event.type)
+        {
+            case SignalClient::Event::signalLevelEvent:
+                levelTracks[index].push (event.time, event.values, burstDuration);
+                break;
+
+            case SignalClient::Event::signalInstantValEvent:
+                instantValTracks[index].push (event.time, event.values, burstDuration);
+                break;
+
+            case SignalClient::Event::bandsEvent:
+                bandTracks[index].push (event.time, event.values, burstDuration);
+                break;
+
+            case SignalClient::Event::impulseEvent:
+                // Too many impulses within the delay : the newest ones are ignored
+                if (nbOfPendingImpulses[index] < maxNbOfPendingImpulses)
+                    pendingImpulses[index][nbOfPendingImpulses[index]++] = event.time;
+                break;
+
+            case SignalClient::Event::timeInfoEvent:
+                if (nbOfPendingTimeInfos == maxNbOfPendingTimeInfos)
+                {
+                    // Can only happen with a delay much longer than the TimeInfo period : apply the oldest one now
+                    lastTimeInfo = pendingTimeInfos[0];
+                    for (int i = 1; i < nbOfPendingTimeInfos; ++i)
+                        pendingTimeInfos[i - 1] = pendingTimeInfos[i];
+                    --nbOfPendingTimeInfos;
+                }
+
+                {
+                    TimeInfoPoint& point = pendingTimeInfos[nbOfPendingTimeInfos++];
+                    point.time = event.time;
+                    point.tempo = event.values[0];
+                    point.position = event.values[1];
+                    point.isPlaying = event.values[2] != 0;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+//==============================================================================
+bool SignalJitterBuffer::renderChannel (int channel, int64_t frameTime, RenderedChannel& rendered)
+{
+    if (channel < 1 || channel > SignalClient::maxNbOfChannels)
+        return false;
+
+    const int index = channel - 1;
+    const int64_t renderTime = frameTime - delay;
+
+    bool hasData = levelTracks[index].sampleAt (renderTime, &rendered.signalLevel);
+    hasData = instantValTracks[index].sampleAt (renderTime, &rendered.signalInstantVal) || hasData;
+    hasData = bandTracks[index].sampleAt (renderTime, rendered.bands) || hasData;
+
+    levelTracks[index].discardBefore (renderTime);
+    instantValTracks[index].discardBefore (renderTime);
+    bandTracks[index].discardBefore (renderTime);
+
+    // Impulses arrive in time order : the due ones are at the start of the list
+    int nbOfDueImpulses = 0;
+    while (nbOfDueImpulses < nbOfPendingImpulses[index] && pendingImpulses[index][nbOfDueImpulses] <= renderTime)
+        ++nbOfDueImpulses;
+
+    for (int i = nbOfDueImpulses; i < nbOfPendingImpulses[index]; ++i)
+        pendingImpulses[index][i - nbOfDueImpulses] = pendingImpulses[index][i];
+
+    nbOfPendingImpulses[index] -= nbOfDueImpulses;
+    rendered.nbOfImpulses = nbOfDueImpulses;
+
+    return hasData || nbOfDueImpulses > 0;
+}
+
+//==============================================================================
+void SignalJitterBuffer::applyDueTimeInfo (int64_t renderTime)
+{
+    int nbOfDue = 0;
+    while (nbOfDue < nbOfPendingTimeInfos && pendingTimeInfos[nbOfDue].time <= renderTime)
+        lastTimeInfo = pendingTimeInfos[nbOfDue++];
+
+    for (int i = nbOfDue; i < nbOfPendingTimeInfos; ++i)
+        pendingTimeInfos[i - nbOfDue] = pendingTimeInfos[i];
+
+    nbOfPendingTimeInfos -= nbOfDue;
+}
+
+double SignalJitterBuffer::getBeatPosition (int64_t frameTime)
+{
+    const int64_t renderTime = frameTime - delay;
+    applyDueTimeInfo (renderTime);
+
+    if (! lastTimeInfo.isPlaying || lastTimeInfo.position < 0)
+        return lastTimeInfo.position;
+
+    // Between two TimeInfo messages, the position moves forward at the last known tempo (quarter notes per minute)
+    const double elapsedMinutes = (renderTime - lastTimeInfo.time) / 60.0e9;
+    return lastTimeInfo.position + elapsedMinutes * lastTimeInfo.tempo;
+}
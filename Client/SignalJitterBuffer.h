@@ -0,0 +1,184 @@
+/*
+ ==============================================================================
+
+    SignalJitterBuffer.h
+    PlayMe - SignalProcessor client
+    Render the features with a fixed delay : the messages arrive in bursts (one
+    burst per DAW block) and carry no send time, so the jitter buffer smooths
+    them on their receive times. It interpolates the continuous features
+    between the bursts, at the display's frame time
+
+ ==============================================================================
+ */
+
+#ifndef SIGNALJITTERBUFFER_H_INCLUDED
+#define SIGNALJITTERBUFFER_H_INCLUDED
+
+#include "SignalClient.h"
+
+//==============================================================================
+/**
+    Samples of one continuous feature (a level, or the 12 bands), at their
+    receive times. The oldest samples are dropped when the track is full
+ */
+template <int NbOfValues, int Capacity>
+class FeatureTrack
+{
+public:
+    // The receive times only grow. The values of a burst (received within burstDuration of its first one) are
+    // computed on the same DAW block but have nearly the same receive time : interpolating between them would be
+    // meaningless, so the burst keeps one sample, with the latest values
+    void push (int64_t time, const float* values, int64_t burstDuration)
+    {
+        if (size > 0 && time - at (size - 1).time < burstDuration)
+        {
+            for (int v = 0; v < NbOfValues; ++v)
+                at (size - 1).values[v] = values[v];
+            return;
+        }
+
+        if (size == Capacity)
+            dropOldest();
+
+        Sample& sample = at (size++);
+        sample.time = time;
+        for (int v = 0; v < NbOfValues; ++v)
+            sample.values[v] = values[v];
+    }
+
+    // Linear interpolation between the bursts around time. Before the first one or after the last one, the
+    // nearest value is held. Returns false if the track is empty
+    bool sampleAt (int64_t time, float* values) const
+    {
+        if (size == 0)
+            return false;
+
+        int next = 0;
+        while (next < size && at (next).time <= time)
+            ++next;
+
+        if (next == 0 || next == size)
+        {
+            const Sample& nearest = at (next == 0 ? 0 : size - 1);
+            for (int v = 0; v < NbOfValues; ++v)
+                values[v] = nearest.values[v];
+            return true;
+        }
+
+        const Sample& a = at (next - 1);
+        const Sample& b = at (next);
+        const float ratio = (float) (time - a.time) / (float) (b.time - a.time);
+        for (int v = 0; v < NbOfValues; ++v)
+            values[v] = a.values[v] + (b.values[v] - a.values[v]) * ratio;
+        return true;
+    }
+
+    // Forget the samples which cannot be used anymore : only the last one before time is kept
+    void discardBefore (int64_t time)
+    {
+        while (size > 1 && at (1).time <= time)
+            dropOldest();
+    }
+
+    int getSize() const                 { return size; }
+
+private:
+    struct Sample
+    {
+        int64_t time;
+        float values[NbOfValues];
+    };
+
+    Sample& at (int i)                  { return samples[(first + i) % Capacity]; }
+    const Sample& at (int i) const      { return samples[(first + i) % Capacity]; }
+    void dropOldest()                   { first = (first + 1) % Capacity; --size; }
+
+    Sample samples[Capacity];
+    int first = 0;
+    int size = 0;
+};
+
+//==============================================================================
+/**
+    Render thread only. At every frame :
+
+        jitterBuffer.update();                          // Take the new messages from the client
+        const int64_t frameTime = SignalClient::now();
+        jitterBuffer.renderChannel (1, frameTime, rendered);
+        const double beat = jitterBuffer.getBeatPosition (frameTime);
+
+    Everything is rendered as it was received delay nanoseconds before
+    frameTime : the delay must be longer than the interval between two bursts
+    (the DAW's block duration, a few milliseconds, plus the network jitter).
+    This is a receive-time smoother : the protocol has no send time nor
+    sequence number, so the network jitter shows in the rendered times, and the
+    order of the messages is their arrival order
+ */
+class SignalJitterBuffer
+{
+public:
+    // Enables the client's event queue
+    SignalJitterBuffer (SignalClient& client, int64_t delayNanoseconds);
+
+    void setDelay (int64_t delayNanoseconds)    { delay = delayNanoseconds; }
+    int64_t getDelay() const                    { return delay; }
+
+    // Move the messages received since the previous call into the tracks
+    void update();
+
+    struct RenderedChannel
+    {
+        float signalLevel       = 0;
+        float signalInstantVal  = 0;
+        float bands[SignalWireFormat::nbOfLogBands] = {};
+        int nbOfImpulses        = 0;        // Impulses which became due since the previous renderChannel
+    };
+
+    // Returns false if nothing was received for this channel yet
+    bool renderChannel (int channel, int64_t frameTime, RenderedChannel& rendered);
+
+    // Position in pulses-per-quarter-note at frameTime - delay, extrapolated from the last TimeInfo message
+    // using its tempo. Returns the last position while the host is stopped, and -1 before the first TimeInfo
+    double getBeatPosition (int64_t frameTime);
+    float getTempo() const                      { return lastTimeInfo.tempo; }
+    bool isPlaying() const                      { return lastTimeInfo.isPlaying; }
+
+private:
+    struct TimeInfoPoint
+    {
+        int64_t time        = 0;
+        float tempo         = 0;
+        double position     = -1;
+        bool isPlaying      = false;
+    };
+
+    void applyDueTimeInfo (int64_t renderTime);
+
+    SignalClient& client;
+    int64_t delay;
+
+    // Messages received closer than this are one burst (see FeatureTrack::push)
+    static const int64_t burstDuration = 1000 * 1000;
+
+    // About 1 s of bursts per channel, more for the slower features.
+    // SignalClient::maxNbOfChannels tracks each, allocated by the constructor
+    std::unique_ptr<FeatureTrack<1, 256>[]> levelTracks;
+    std::unique_ptr<FeatureTrack<1, 256>[]> instantValTracks;
+    std::unique_ptr<FeatureTrack<SignalWireFormat::nbOfLogBands, 64>[]> bandTracks;
+
+    // Impulse times, waiting to become due
+    static const int maxNbOfPendingImpulses = 64;
+    std::unique_ptr<int64_t[][maxNbOfPendingImpulses]> pendingImpulses;
+    std::unique_ptr<int[]> nbOfPendingImpulses;
+
+    // TimeInfo messages waiting to become due, and the last one which did
+    static const int maxNbOfPendingTimeInfos = 32;
+    TimeInfoPoint pendingTimeInfos[maxNbOfPendingTimeInfos];
+    int nbOfPendingTimeInfos = 0;
+    TimeInfoPoint lastTimeInfo;
+
+    SignalJitterBuffer (const SignalJitterBuffer&) = delete;
+    SignalJitterBuffer& operator= (const SignalJitterBuffer&) = delete;
+};
+
+#endif  // SIGNALJITTERBUFFER_H_INCLUDED
@@ -0,0 +1,80 @@
+/*
+ ==============================================================================
+
+    SignalMonitor.cpp
+    PlayMe - SignalProcessor client
+    Example of a SignalClient consumer : reads the state at the rate of a
+    144 Hz render loop, and prints it once per second
+
+ ==============================================================================
+ */
+
+#include "SignalClient.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+// usage: SignalMonitor [durationSeconds=10]
+int main (int argc, char* argv[])
+{
+    const int durationSeconds = (argc > 1) ? std::atoi (argv[1]) : 10;
+    const int framesPerSecond = 144;
+
+    SignalClient client;
+    try
+    {
+        client.start();
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::fprintf (stderr, "Could not bind the plugin's ports : %s\n", e.what());
+        return 1;
+    }
+
+    int impulses[SignalClient::maxNbOfChannels + 1] = {};
+    const auto framePeriod = std::chrono::microseconds (1000000 / framesPerSecond);
+    auto nextFrame = std::chrono::steady_clock::now();
+
+    for (int frame = 1; frame <= durationSeconds * framesPerSecond; ++frame)
+    {
+        // What a render loop would do at every frame
+        for (int channel = 1; channel <= SignalClient::maxNbOfChannels; ++channel)
+            impulses[channel] += client.takeImpulses (channel);
+
+        if (frame % framesPerSecond == 0)
+        {
+            SignalClient::TransportState transport;
+            client.readTransport (transport);
+            std::printf ("t=%ds received=%llu rejected=%llu playing=%d tempo=%.1f position=%.2f\n",
+                         frame / framesPerSecond,
+                         (unsigned long long) client.getNbOfMessagesReceived(),
+                         (unsigned long long) client.getNbOfMessagesRejected(),
+                         transport.isPlaying ? 1 : 0, transport.tempo, transport.position);
+
+            for (int channel = 1; channel <= SignalClient::maxNbOfChannels; ++channel)
+            {
+                SignalClient::ChannelState state;
+                client.readChannel (channel, state);
+
+                if (state.signalLevelTime == 0 && state.bandsTime == 0 && impulses[channel] == 0)
+                    continue;
+
+                std::printf ("  channel %3d level=%.4f instant=%+.4f f0=%.1f impulses=%d bands=",
+                             channel, state.signalLevel, state.signalInstantVal, state.fundamentalFreq, impulses[channel]);
+                for (int i = 0; i < SignalWireFormat::nbOfLogBands; ++i)
+                    std::printf ("%.2f ", state.bands[i]);
+                std::printf ("\n");
+
+                impulses[channel] = 0;
+            }
+        }
+
+        nextFrame += framePeriod;
+        std::this_thread::sleep_until (nextFrame);
+    }
+
+    client.stop();
+    return 0;
+}
@@ -0,0 +1,853 @@
+/*
+ ==============================================================================
+
+    SignalWireFormat.cpp
+    PlayMe - SignalProcessor client
+    Minimal Protobuf wire format reader and writer : varints, fixed32,
+    fixed64 and length-delimited fields are all the SignalMessages use
+
+ ==============================================================================
+ */
+
+#include "SignalWireFormat.h"
+#include <cstring>
+
+namespace SignalWireFormat
+{
+    enum WireType
+    {
+        varintType          = 0,
+        fixed64Type         = 1,
+        lengthDelimitedType = 2,
+        fixed32Type         = 5
+    };
+
+    //==============================================================================
+    class Reader
+    {
+    public:
+        Reader (const char* d, int size)
+            : data ((const uint8_t*) d), end ((const uint8_t*) d + size) {}
+
+        bool atEnd() const          { return data == end; }
+
+        bool readVarint (uint64_t& value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64 && data < end; shift += 7)
+            {
+                const uint8_t byte = *data++;
+                value |= (uint64_t) (byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+            return false;
+        }
+
+        bool readTag (int& fieldNumber, int& wireType)
+        {
+            uint64_t tag;
+            if (! readVarint (tag))
+                return false;
+
+            fieldNumber = (int) (tag >> 3);
+            wireType = (int) (tag & 7);
+            return fieldNumber > 0;
+        }
+
+        // Floats are sent little-endian, as are all the platforms the plugin and its clients run on
+        bool readFloat (float& value)
+        {
+            if (end - data < 4)
+                return false;
+
+            std::memcpy (&value, data, 4);
+            data += 4;
+            return true;
+        }
+
+        bool readDouble (double& value)
+        {
+            if (end - data < 8)
+                return false;
+
+            std::memcpy (&value, data, 8);
+            data += 8;
+            return true;
+        }
+
+        bool readLength (int& length)
+        {
+            uint64_t value;
+            if (! readVarint (value) || value > (uint64_t) (end - data))
+                return false;
+
+            length = (int) value;
+            return true;
+        }
+
+        bool skip (int wireType)
+        {
+            uint64_t value;
+            int length;
+
+            switch (wireType)
+            {
+                case varintType:            return readVarint (value);
+                case fixed64Type:           return advance (8);
+                case lengthDelimitedType:   return readLength (length) && advance (length);
+                case fixed32Type:           return advance (4);
+                default:                    return false;
+            }
+        }
+
+        const uint8_t* position() const     { return data; }
+        bool advance (int nbOfBytes)
+        {
+            if (end - data < nbOfBytes)
+                return false;
+
+            data += nbOfBytes;
+            return true;
+        }
+
+    private:
+        const uint8_t* data;
+        const uint8_t* const end;
+    };
+
+    static bool readInt32 (Reader& reader, int wireType, int32_t& value)
+    {
+        uint64_t raw;
+        if (wireType != varintType || ! reader.readVarint (raw))
+            return false;
+
+        value = (int32_t) raw;
+        return true;
+    }
+
+    static bool readFloat (Reader& reader, int wireType, float& value)
+    {
+        return wireType == fixed32Type && reader.readFloat (value);
+    }
+
+    static bool readUInt32 (Reader& reader, int wireType, uint32_t& value)
+    {
+        uint64_t raw;
+        if (wireType != varintType || ! reader.readVarint (raw))
+            return false;
+
+        value = (uint32_t) raw;
+        return true;
+    }
+
+    static bool readUInt64 (Reader& reader, int wireType, uint64_t& value)
+    {
+        return wireType == varintType && reader.readVarint (value);
+    }
+
+    static bool readInt64 (Reader& reader, int wireType, int64_t& value)
+    {
+        uint64_t raw;
+        if (wireType != varintType || ! reader.readVarint (raw))
+            return false;
+
+        value = (int64_t) raw;
+        return true;
+    }
+
+    static bool readDouble (Reader& reader, int wireType, double& value)
+    {
+        return wireType == fixed64Type && reader.readDouble (value);
+    }
+
+    //==============================================================================
+    bool decode (const char* data, int size, SignalLevelMessage& message)
+    {
+        Reader reader (data, size);
+        bool hasLevel = false;
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            switch (field)
+            {
+                case 1:     ok = readInt32 (reader, wireType, message.signalID); break;
+                case 2:     ok = hasLevel = readFloat (reader, wireType, message.signalLevel); break;
+                default:    ok = reader.skip (wireType); break;
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return hasLevel;
+    }
+
+    bool decode (const char* data, int size, SignalInstantValMessage& message)
+    {
+        Reader reader (data, size);
+        bool hasValue = false;
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            switch (field)
+            {
+                case 1:     ok = readInt32 (reader, wireType, message.signalID); break;
+                case 2:     ok = hasValue = readFloat (reader, wireType, message.signalInstantVal); break;
+                default:    ok = reader.skip (wireType); break;
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return hasValue;
+    }
+
+    bool decode (const char* data, int size, ImpulseMessage& message)
+    {
+        Reader reader (data, size);
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            const bool ok = (field == 1) ? readInt32 (reader, wireType, message.signalID)
+                                         : reader.skip (wireType);
+            if (! ok)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool decode (const char* data, int size, TimeInfoMessage& message)
+    {
+        Reader reader (data, size);
+        int field, wireType;
+        int32_t isPlaying = 0;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            switch (field)
+            {
+                case 1:     ok = readInt32 (reader, wireType, isPlaying); break;
+                case 2:     ok = readFloat (reader, wireType, message.tempo); break;
+                case 3:     ok = readFloat (reader, wireType, message.position); break;
+                default:    ok = reader.skip (wireType); break;
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        message.isPlaying = (isPlaying != 0);
+        return true;
+    }
+
+    bool decode (const char* data, int size, FFTMessage& message)
+    {
+        Reader reader (data, size);
+        int field, wireType;
+
+        message.isLinear = false;
+        message.nbOfValues = 0;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            if (field == 1)
+            {
+                ok = readInt32 (reader, wireType, message.signalID);
+            }
+            else if (field == 2)
+            {
+                ok = readFloat (reader, wireType, message.fundamentalFreq);
+            }
+            else if (field == 3 && wireType == lengthDelimitedType)
+            {
+                // LinearFFT : packed array of floats
+                int length;
+                ok = reader.readLength (length) && (length % 4) == 0 && length / 4 <= maxNbOfLinearBins;
+                if (ok)
+                {
+                    message.isLinear = true;
+                    message.nbOfValues = length / 4;
+                    std::memcpy (message.values, reader.position(), (size_t) length);
+                    reader.advance (length);
+                }
+            }
+            else if (field >= 3 && field < 3 + nbOfLogBands)
+            {
+                // LogFFT : band1 to band12
+                const int band = field - 3;
+                ok = ! message.isLinear && readFloat (reader, wireType, message.values[band]);
+                if (ok && band >= message.nbOfValues)
+                {
+                    for (int i = message.nbOfValues; i < band; ++i)
+                        message.values[i] = 0;
+
+                    message.nbOfValues = band + 1;
+                }
+            }
+            else
+            {
+                ok = reader.skip (wireType);
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return true;
+    }
+
+    static bool decode (const char* data, int size, StageLatency& stage)
+    {
+        Reader reader (data, size);
+        bool hasStage = false;
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            switch (field)
+            {
+                case 1:     ok = hasStage = readInt32 (reader, wireType, stage.stage); break;
+                case 2:     ok = readUInt32 (reader, wireType, stage.count); break;
+                case 3:     ok = readFloat (reader, wireType, stage.p50); break;
+                case 4:     ok = readFloat (reader, wireType, stage.p99); break;
+                case 5:     ok = readFloat (reader, wireType, stage.max); break;
+                default:    ok = reader.skip (wireType); break;
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return hasStage;
+    }
+
+    static bool decode (const char* data, int size, TransportCounters& counters)
+    {
+        Reader reader (data, size);
+        bool hasDestination = false;
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            switch (field)
+            {
+                case 1:     ok = hasDestination = readInt32 (reader, wireType, counters.destination); break;
+                case 2:     ok = readUInt64 (reader, wireType, counters.packets); break;
+                case 3:     ok = readUInt64 (reader, wireType, counters.bytes); break;
+                case 4:     ok = readUInt64 (reader, wireType, counters.notReadyDrops); break;
+                case 5:     ok = readUInt64 (reader, wireType, counters.oversizedDrops); break;
+                case 6:     ok = readUInt64 (reader, wireType, counters.partialSends); break;
+                case 7:     ok = readUInt64 (reader, wireType, counters.wouldBlockErrors); break;
+                case 8:     ok = readUInt64 (reader, wireType, counters.noBufferErrors); break;
+                case 9:     ok = readUInt64 (reader, wireType, counters.refusedErrors); break;
+                case 10:    ok = readUInt64 (reader, wireType, counters.unreachableErrors); break;
+                case 11:    ok = readUInt64 (reader, wireType, counters.messageSizeErrors); break;
+                case 12:    ok = readUInt64 (reader, wireType, counters.otherErrors); break;
+                case 13:    ok = readUInt32 (reader, wireType, counters.queueHighWater); break;
+                case 14:    ok = readInt32 (reader, wireType, counters.lastErrno); break;
+                default:    ok = reader.skip (wireType); break;
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return hasDestination;
+    }
+
+    static bool decode (const char* data, int size, StreamCounters& counters)
+    {
+        Reader reader (data, size);
+        bool hasStream = false;
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            switch (field)
+            {
+                case 1:     ok = hasStream = readInt32 (reader, wireType, counters.stream); break;
+                case 2:     ok = readUInt64 (reader, wireType, counters.sent); break;
+                case 3:     ok = readUInt64 (reader, wireType, counters.suppressed); break;
+                default:    ok = reader.skip (wireType); break;
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return hasStream;
+    }
+
+    static bool decode (const char* data, int size, MidiEvent& event)
+    {
+        Reader reader (data, size);
+        bool hasData = false;
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            if (field == 4 && wireType == lengthDelimitedType)
+            {
+                ok = hasData = reader.readLength (event.size);
+                event.data = reader.position();
+                ok = ok && reader.advance (event.size);
+            }
+            else
+            {
+                switch (field)
+                {
+                    case 1:     ok = readInt32 (reader, wireType, event.sampleOffset); break;
+                    case 2:     ok = readInt64 (reader, wireType, event.timeInSamples); break;
+                    case 3:     ok = event.hasPpqPosition = readDouble (reader, wireType, event.ppqPosition); break;
+                    default:    ok = reader.skip (wireType); break;
+                }
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return hasData;
+    }
+
+    // Decodes the embedded message at the reader's position into items[count]. The items beyond
+    // maxCount (added by a newer plugin) are skipped
+    template <typename Item>
+    static bool readRepeated (Reader& reader, Item* items, int& count, int maxCount)
+    {
+        int length;
+        if (! reader.readLength (length))
+            return false;
+
+        if (count < maxCount)
+        {
+            items[count] = Item();
+            if (! decode ((const char*) reader.position(), length, items[count]))
+                return false;
+
+            ++count;
+        }
+
+        return reader.advance (length);
+    }
+
+    bool decode (const char* data, int size, StatsMessage& message)
+    {
+        Reader reader (data, size);
+        int field, wireType;
+
+        message.nbOfStages = 0;
+        message.nbOfTransports = 0;
+        message.nbOfStreams = 0;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            if (field == 2 && wireType == lengthDelimitedType)
+                ok = readRepeated (reader, message.stages, message.nbOfStages, StatsMessage::maxNbOfStages);
+            else if (field == 7 && wireType == lengthDelimitedType)
+                ok = readRepeated (reader, message.transports, message.nbOfTransports, StatsMessage::maxNbOfTransports);
+            else if (field == 8 && wireType == lengthDelimitedType)
+                ok = readRepeated (reader, message.streams, message.nbOfStreams, StatsMessage::maxNbOfStreams);
+            else
+            {
+                switch (field)
+                {
+                    case 1:     ok = readInt32 (reader, wireType, message.signalID); break;
+                    case 3:     ok = readFloat (reader, wireType, message.deadlineUtilization); break;
+                    case 4:     ok = readFloat (reader, wireType, message.maxDeadlineUtilization); break;
+                    case 5:     ok = readUInt32 (reader, wireType, message.xrunRiskCount); break;
+                    case 6:     ok = readUInt32 (reader, wireType, message.nbOfBlocks); break;
+                    default:    ok = reader.skip (wireType); break;
+                }
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool decode (const char* data, int size, MidiEventMessage& message)
+    {
+        Reader reader (data, size);
+        int field, wireType;
+
+        message.nbOfEvents = 0;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            bool ok;
+            if (field == 3 && wireType == lengthDelimitedType)
+            {
+                ok = readRepeated (reader, message.events, message.nbOfEvents, MidiEventMessage::maxNbOfEvents);
+            }
+            else if (field == 2)
+            {
+                int32_t isPlaying = 0;
+                ok = readInt32 (reader, wireType, isPlaying);
+                message.isPlaying = (isPlaying != 0);
+            }
+            else
+            {
+                ok = (field == 1) ? readInt32 (reader, wireType, message.signalID)
+                                  : reader.skip (wireType);
+            }
+
+            if (! ok)
+                return false;
+        }
+
+        return true;
+    }
+
+    //==============================================================================
+    class Writer
+    {
+    public:
+        Writer (char* d, int c) : data ((uint8_t*) d), size (0), capacity (c), overflow (false) {}
+
+        void writeVarint (uint64_t value)
+        {
+            do
+            {
+                uint8_t byte = value & 0x7f;
+                value >>= 7;
+                if (value != 0)
+                    byte |= 0x80;
+                writeByte (byte);
+            }
+            while (value != 0);
+        }
+
+        void writeTag (int fieldNumber, int wireType)       { writeVarint ((uint64_t) ((fieldNumber << 3) | wireType)); }
+
+        // Negative int32 are sign-extended to 10 bytes, as Protobuf does
+        void writeInt32 (int fieldNumber, int32_t value)    { writeTag (fieldNumber, varintType); writeVarint ((uint64_t) (int64_t) value); }
+        void writeUInt32 (int fieldNumber, uint32_t value)  { writeTag (fieldNumber, varintType); writeVarint (value); }
+        void writeUInt64 (int fieldNumber, uint64_t value)  { writeTag (fieldNumber, varintType); writeVarint (value); }
+        void writeInt64 (int fieldNumber, int64_t value)    { writeTag (fieldNumber, varintType); writeVarint ((uint64_t) value); }
+        void writeBool (int fieldNumber, bool value)        { writeTag (fieldNumber, varintType); writeVarint (value ? 1 : 0); }
+        void writeFloat (int fieldNumber, float value)      { writeTag (fieldNumber, fixed32Type); writeRaw (&value, 4); }
+        void writeDouble (int fieldNumber, double value)    { writeTag (fieldNumber, fixed64Type); writeRaw (&value, 8); }
+
+        void writeFixed64 (int fieldNumber, uint64_t value)
+        {
+            writeTag (fieldNumber, fixed64Type);
+            for (int i = 0; i < 8; ++i)
+                writeByte ((uint8_t) (value >> (8 * i)));
+        }
+
+        void writePackedFloats (int fieldNumber, const float* values, int nbOfValues)
+        {
+            if (nbOfValues == 0)
+                return;
+
+            writeTag (fieldNumber, lengthDelimitedType);
+            writeVarint ((uint64_t) nbOfValues * 4);
+            writeRaw (values, nbOfValues * 4);
+        }
+
+        // Embedded message, already encoded, or bytes
+        void writeMessage (int fieldNumber, const void* bytes, int nbOfBytes)
+        {
+            writeTag (fieldNumber, lengthDelimitedType);
+            writeVarint ((uint64_t) nbOfBytes);
+            writeRaw (bytes, nbOfBytes);
+        }
+
+        // Size of the varint, for the length of an embedded message which is written in place
+        static int getVarintSize (uint64_t value)
+        {
+            int size = 1;
+            for (; value >= 0x80; value >>= 7)
+                ++size;
+            return size;
+        }
+
+        int getResult() const       { return overflow ? -1 : size; }
+        void setSize (int s)        { size = s; }
+
+    private:
+        void writeByte (uint8_t byte)
+        {
+            if (size < capacity)
+                data[size++] = byte;
+            else
+                overflow = true;
+        }
+
+        void writeRaw (const void* source, int nbOfBytes)
+        {
+            if (capacity - size < nbOfBytes)
+            {
+                overflow = true;
+                return;
+            }
+
+            std::memcpy (data + size, source, (size_t) nbOfBytes);
+            size += nbOfBytes;
+        }
+
+        uint8_t* data;
+        int size;
+        const int capacity;
+        bool overflow;
+    };
+
+    //==============================================================================
+    int encode (const SignalLevelMessage& message, char* buffer, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.writeInt32 (1, message.signalID);
+        writer.writeFloat (2, message.signalLevel);
+        return writer.getResult();
+    }
+
+    int encode (const SignalInstantValMessage& message, char* buffer, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.writeInt32 (1, message.signalID);
+        writer.writeFloat (2, message.signalInstantVal);
+        return writer.getResult();
+    }
+
+    int encode (const ImpulseMessage& message, char* buffer, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.writeInt32 (1, message.signalID);
+        return writer.getResult();
+    }
+
+    int encode (const TimeInfoMessage& message, char* buffer, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.writeBool (1, message.isPlaying);
+        writer.writeFloat (2, message.tempo);
+        writer.writeFloat (3, message.position);
+        return writer.getResult();
+    }
+
+    int encode (const FFTMessage& message, char* buffer, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.writeInt32 (1, message.signalID);
+        writer.writeFloat (2, message.fundamentalFreq);
+
+        if (message.isLinear)
+        {
+            writer.writePackedFloats (3, message.values, message.nbOfValues);
+        }
+        else
+        {
+            for (int i = 0; i < message.nbOfValues && i < nbOfLogBands; ++i)
+                writer.writeFloat (3 + i, message.values[i]);
+        }
+
+        return writer.getResult();
+    }
+
+    int encode (const StatsMessage& message, char* buffer, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.writeInt32 (1, message.signalID);
+
+        for (int i = 0; i < message.nbOfStages && i < StatsMessage::maxNbOfStages; ++i)
+        {
+            const StageLatency& stage = message.stages[i];
+
+            // At most 11 + 6 + 3 * 5 bytes (a negative stage takes 10 bytes)
+            char stageBuffer[32];
+            Writer stageWriter (stageBuffer, sizeof (stageBuffer));
+            stageWriter.writeInt32 (1, stage.stage);
+            stageWriter.writeUInt32 (2, stage.count);
+            stageWriter.writeFloat (3, stage.p50);
+            stageWriter.writeFloat (4, stage.p99);
+            stageWriter.writeFloat (5, stage.max);
+
+            writer.writeMessage (2, stageBuffer, stageWriter.getResult());
+        }
+
+        writer.writeFloat (3, message.deadlineUtilization);
+        writer.writeFloat (4, message.maxDeadlineUtilization);
+        writer.writeUInt32 (5, message.xrunRiskCount);
+        writer.writeUInt32 (6, message.nbOfBlocks);
+
+        for (int i = 0; i < message.nbOfTransports && i < StatsMessage::maxNbOfTransports; ++i)
+        {
+            const TransportCounters& counters = message.transports[i];
+
+            // At most 2 * 11 + 11 * 11 + 6 bytes
+            char countersBuffer[160];
+            Writer countersWriter (countersBuffer, sizeof (countersBuffer));
+            countersWriter.writeInt32 (1, counters.destination);
+            countersWriter.writeUInt64 (2, counters.packets);
+            countersWriter.writeUInt64 (3, counters.bytes);
+            countersWriter.writeUInt64 (4, counters.notReadyDrops);
+            countersWriter.writeUInt64 (5, counters.oversizedDrops);
+            countersWriter.writeUInt64 (6, counters.partialSends);
+            countersWriter.writeUInt64 (7, counters.wouldBlockErrors);
+            countersWriter.writeUInt64 (8, counters.noBufferErrors);
+            countersWriter.writeUInt64 (9, counters.refusedErrors);
+            countersWriter.writeUInt64 (10, counters.unreachableErrors);
+            countersWriter.writeUInt64 (11, counters.messageSizeErrors);
+            countersWriter.writeUInt64 (12, counters.otherErrors);
+            countersWriter.writeUInt32 (13, counters.queueHighWater);
+            countersWriter.writeInt32 (14, counters.lastErrno);
+
+            writer.writeMessage (7, countersBuffer, countersWriter.getResult());
+        }
+
+        for (int i = 0; i < message.nbOfStreams && i < StatsMessage::maxNbOfStreams; ++i)
+        {
+            const StreamCounters& counters = message.streams[i];
+
+            // At most 11 + 2 * 11 bytes
+            char countersBuffer[40];
+            Writer countersWriter (countersBuffer, sizeof (countersBuffer));
+            countersWriter.writeInt32 (1, counters.stream);
+            countersWriter.writeUInt64 (2, counters.sent);
+            countersWriter.writeUInt64 (3, counters.suppressed);
+
+            writer.writeMessage (8, countersBuffer, countersWriter.getResult());
+        }
+
+        return writer.getResult();
+    }
+
+    int encode (const MidiEventMessage& message, char* buffer, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.writeInt32 (1, message.signalID);
+        writer.writeBool (2, message.isPlaying);
+
+        for (int i = 0; i < message.nbOfEvents && i < MidiEventMessage::maxNbOfEvents; ++i)
+        {
+            const MidiEvent& event = message.events[i];
+
+            // The MIDI data may be long (SysEx) : the event is written in place, after its length
+            const int eventSize = 1 + Writer::getVarintSize ((uint64_t) (int64_t) event.sampleOffset)
+                                + 1 + Writer::getVarintSize ((uint64_t) event.timeInSamples)
+                                + (event.hasPpqPosition ? 9 : 0)
+                                + 1 + Writer::getVarintSize ((uint64_t) event.size) + event.size;
+
+            writer.writeTag (3, lengthDelimitedType);
+            writer.writeVarint ((uint64_t) eventSize);
+            writer.writeInt32 (1, event.sampleOffset);
+            writer.writeInt64 (2, event.timeInSamples);
+            if (event.hasPpqPosition)
+                writer.writeDouble (3, event.ppqPosition);
+            writer.writeMessage (4, event.data, event.size);
+        }
+
+        return writer.getResult();
+    }
+
+    //==============================================================================
+    int appendVarintField (int fieldNumber, uint64_t value, char* buffer, int size, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.setSize (size);
+        writer.writeTag (fieldNumber, varintType);
+        writer.writeVarint (value);
+        return writer.getResult();
+    }
+
+    int appendFixed64Field (int fieldNumber, uint64_t value, char* buffer, int size, int capacity)
+    {
+        Writer writer (buffer, capacity);
+        writer.setSize (size);
+        writer.writeFixed64 (fieldNumber, value);
+        return writer.getResult();
+    }
+
+    static bool findField (const char* data, int size, int fieldNumber, int expectedWireType, uint64_t& value)
+    {
+        Reader reader (data, size);
+        int field, wireType;
+
+        while (! reader.atEnd())
+        {
+            if (! reader.readTag (field, wireType))
+                return false;
+
+            if (field == fieldNumber && wireType == expectedWireType)
+            {
+                if (wireType == varintType)
+                    return reader.readVarint (value);
+
+                const uint8_t* bytes = reader.position();
+                if (! reader.advance (8))
+                    return false;
+
+                value = 0;
+                for (int i = 0; i < 8; ++i)
+                    value |= (uint64_t) bytes[i] << (8 * i);
+                return true;
+            }
+
+            if (! reader.skip (wireType))
+                return false;
+        }
+
+        return false;
+    }
+
+    bool findVarintField (const char* data, int size, int fieldNumber, uint64_t& value)
+    {
+        return findField (data, size, fieldNumber, varintType, value);
+    }
+
+    bool findFixed64Field (const char* data, int size, int fieldNumber, uint64_t& value)
+    {
+        return findField (data, size, fieldNumber, fixed64Type, value);
+    }
+}
@@ -0,0 +1,215 @@
+/*
+ ==============================================================================
+
+    SignalWireFormat.h
+    PlayMe - SignalProcessor client
+    Decode the Protobuf messages sent by the plugin (see Source/SignalMessages.proto)
+    into plain structs, and encode them back, without allocating and without the
+    Protobuf runtime.
+    The field numbers below must follow SignalMessages.proto
+
+ ==============================================================================
+ */
+
+#ifndef SIGNALWIREFORMAT_H_INCLUDED
+#define SIGNALWIREFORMAT_H_INCLUDED
+
+#include <stdint.h>
+
+namespace SignalWireFormat
+{
+    static const int nbOfLogBands       = 12;       // LogFFT : band1 to band12
+    static const int maxNbOfLinearBins  = 2048;     // LinearFFT : N/2 values
+
+    // Signal IDs. A plugin instance on channel c (1 to maxNbOfChannels) sends the features of its channel
+    // group g with the signal ID c + g * maxNbOfChannels : group 0 keeps the channel number, so a stereo
+    // instance sends what it always sent, and the groups of two instances never share an ID. The sidechain
+    // is always sent as the last group, however many main groups there are
+    static const int maxNbOfChannels    = 16;
+    static const int maxNbOfGroups      = 17;       // The 16 channels of a stem bus, and a sidechain
+    static const int sidechainGroup     = maxNbOfGroups - 1;
+    static const int maxNbOfSignalIDs   = maxNbOfChannels * maxNbOfGroups;     // Signal IDs 1 to 272
+
+    inline int32_t getSignalID (int channel, int group)     { return channel + group * maxNbOfChannels; }
+    inline int getChannel (int32_t signalID)                 { return (signalID - 1) % maxNbOfChannels + 1; }
+    inline int getGroup (int32_t signalID)                   { return (signalID - 1) / maxNbOfChannels; }
+
+    struct SignalLevelMessage
+    {
+        int32_t signalID        = 1;
+        float signalLevel       = 0;
+    };
+
+    struct SignalInstantValMessage
+    {
+        int32_t signalID        = 1;
+        float signalInstantVal  = 0;
+    };
+
+    struct ImpulseMessage
+    {
+        int32_t signalID        = 1;
+    };
+
+    struct TimeInfoMessage
+    {
+        bool isPlaying          = false;
+        float tempo             = 0;
+        float position          = 0;            // Pulses-per-quarter-note
+    };
+
+    // LogFFT and LinearFFT are both sent on the FFT port : isLinear tells which one was received
+    struct FFTMessage
+    {
+        int32_t signalID        = 1;
+        float fundamentalFreq   = 0;
+        bool isLinear           = false;
+        int nbOfValues          = 0;            // nbOfLogBands for a LogFFT
+        float values[maxNbOfLinearBins];        // Log bands or linear bins
+    };
+
+    // MIDI events of one host block, sent on the MIDI port. The data of an event is not copied : the
+    // encoder reads it where the caller keeps it, and the decoder points into the packet it decodes
+    struct MidiEvent
+    {
+        int32_t sampleOffset    = 0;            // In the block
+        int64_t timeInSamples   = 0;            // Host timeline position
+        double ppqPosition      = 0;
+        bool hasPpqPosition     = false;        // The host gave a musical position
+        const uint8_t* data     = nullptr;      // Status byte first
+        int size                = 0;
+    };
+
+    struct MidiEventMessage
+    {
+        static const int maxNbOfEvents      = 64;
+
+        // Bytes an event adds to the encoded message besides its MIDI data, at most : an encoder which keeps
+        // this much room per event never overflows
+        static const int maxEventOverhead   = 40;
+        static const int maxHeaderSize      = 13;
+
+        int32_t signalID        = 1;
+        bool isPlaying          = false;
+        int nbOfEvents          = 0;
+        MidiEvent events[maxNbOfEvents];
+    };
+
+    // Latency of the plugin's stages, sent once per second on the stats port. The durations are in
+    // microseconds, over the last interval
+    struct StageLatency
+    {
+        enum Stage
+        {
+            processBlock = 0,
+            fft,
+            serialization,
+            send
+        };
+
+        int32_t stage           = processBlock;
+        uint32_t count          = 0;
+        float p50               = 0;
+        float p99               = 0;
+        float max               = 0;
+    };
+
+    // Counters of one of the plugin's sockets, since the plugin was loaded. queueHighWater is the largest
+    // occupancy of the socket's send queue seen during the last interval
+    struct TransportCounters
+    {
+        enum Destination
+        {
+            signalLevel = 0,
+            signalInstantVal,
+            impulse,
+            timeInfo,
+            fft,
+            stats,
+            osc,
+            midiEvent
+        };
+
+        int32_t destination         = signalLevel;
+        uint64_t packets            = 0;
+        uint64_t bytes              = 0;
+        uint64_t notReadyDrops      = 0;        // Before the sockets were open
+        uint64_t oversizedDrops     = 0;        // Larger than the plugin's buffer
+        uint64_t partialSends       = 0;
+        uint64_t wouldBlockErrors   = 0;        // EAGAIN, EWOULDBLOCK
+        uint64_t noBufferErrors     = 0;        // ENOBUFS
+        uint64_t refusedErrors      = 0;        // ECONNREFUSED
+        uint64_t unreachableErrors  = 0;        // ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+        uint64_t messageSizeErrors  = 0;        // EMSGSIZE
+        uint64_t otherErrors        = 0;
+        uint32_t queueHighWater     = 0;        // Bytes
+        int32_t lastErrno           = 0;
+    };
+
+    // Messages of one continuous stream let through / suppressed by its output policy, since the plugin
+    // was loaded
+    struct StreamCounters
+    {
+        enum Stream
+        {
+            signalLevel = 0,
+            signalInstantVal,
+            fft
+        };
+
+        int32_t stream              = signalLevel;
+        uint64_t sent               = 0;
+        uint64_t suppressed         = 0;
+    };
+
+    struct StatsMessage
+    {
+        static const int maxNbOfStages      = 8;
+        static const int maxNbOfTransports  = 8;
+        static const int maxNbOfStreams     = 4;
+
+        int32_t signalID                = 1;
+        int nbOfStages                  = 0;
+        StageLatency stages[maxNbOfStages];
+        float deadlineUtilization       = 0;    // processBlock duration / block duration, of the last block
+        float maxDeadlineUtilization    = 0;    // Of the interval
+        uint32_t xrunRiskCount          = 0;    // Blocks of the interval above the plugin's risk threshold
+        uint32_t nbOfBlocks             = 0;
+        int nbOfTransports              = 0;
+        TransportCounters transports[maxNbOfTransports];
+        int nbOfStreams                 = 0;
+        StreamCounters streams[maxNbOfStreams];
+    };
+
+    // All the decoders return false if the packet is malformed or a required field is missing.
+    // Unknown fields are skipped, so newer plugins can add fields without breaking the clients
+    bool decode (const char* data, int size, SignalLevelMessage& message);
+    bool decode (const char* data, int size, SignalInstantValMessage& message);
+    bool decode (const char* data, int size, ImpulseMessage& message);
+    bool decode (const char* data, int size, TimeInfoMessage& message);
+    bool decode (const char* data, int size, FFTMessage& message);
+    bool decode (const char* data, int size, StatsMessage& message);
+    bool decode (const char* data, int size, MidiEventMessage& message);
+
+    // The encoders produce the same bytes as the generated SignalMessages classes. They return the
+    // encoded size, or -1 if the buffer is too small. An FFTMessage is encoded as a LinearFFT if isLinear
+    // is set, as a LogFFT otherwise
+    int encode (const SignalLevelMessage& message, char* buffer, int capacity);
+    int encode (const SignalInstantValMessage& message, char* buffer, int capacity);
+    int encode (const ImpulseMessage& message, char* buffer, int capacity);
+    int encode (const TimeInfoMessage& message, char* buffer, int capacity);
+    int encode (const FFTMessage& message, char* buffer, int capacity);
+    int encode (const StatsMessage& message, char* buffer, int capacity);
+    int encode (const MidiEventMessage& message, char* buffer, int capacity);
+
+    // Append a field which is not part of SignalMessages.proto : the decoders above (and the generated
+    // classes) skip it. Used by the test tools to tag their packets. Return the new size, or -1
+    int appendVarintField (int fieldNumber, uint64_t value, char* buffer, int size, int capacity);
+    int appendFixed64Field (int fieldNumber, uint64_t value, char* buffer, int size, int capacity);
+
+    // Find such a field in a packet. Returns false if the packet does not contain it
+    bool findVarintField (const char* data, int size, int fieldNumber, uint64_t& value);
+    bool findFixed64Field (const char* data, int size, int fieldNumber, uint64_t& value);
+}
+
+#endif  // SIGNALWIREFORMAT_H_INCLUDED
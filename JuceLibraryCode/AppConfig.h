@@ -236,13 +236,13 @@
  #define JucePlugin_PluginCode             'Plug'
 #endif
 #ifndef  JucePlugin_MaxNumInputChannels
- #define JucePlugin_MaxNumInputChannels    2
+ #define JucePlugin_MaxNumInputChannels    18
 #endif
 #ifndef  JucePlugin_MaxNumOutputChannels
- #define JucePlugin_MaxNumOutputChannels   2
+ #define JucePlugin_MaxNumOutputChannels   16
 #endif
 #ifndef  JucePlugin_PreferredChannelConfigurations
- #define JucePlugin_PreferredChannelConfigurations  {1, 1}, {2, 2}
+ #define JucePlugin_PreferredChannelConfigurations  {1, 1}, {2, 2}, {4, 2}, {8, 8}, {16, 16}, {18, 16}
 #endif
 #ifndef  JucePlugin_IsSynth
  #define JucePlugin_IsSynth                0
@@ -0,0 +1,425 @@
+/*
+ ==============================================================================
+
+    AnalysisEngine.cpp
+    PlayMe - SignalProcessor
+    The signal analysis of the plugin, without JUCE
+
+ ==============================================================================
+ */
+
+#include "AnalysisEngine.h"
+#include "AnalysisTaskPool.h"
+#include "TraceRecorder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+//==============================================================================
+AnalysisEngine::AnalysisEngine()
+    : fftReady (false)
+{
+    std::fill (energyDivisor, energyDivisor + groupStride, 1.0f);
+
+    for (int group = 0; group < groupStride; group++)
+        resetGroup (group);
+}
+
+AnalysisEngine::~AnalysisEngine()
+{
+    free (fftBuffers);
+    free (fftWindow);
+    free (observed);
+    free (magnitudes);
+    free (taskWindows);
+    free (taskMagnitudes);
+}
+
+void AnalysisEngine::prepareFFT()
+{
+    if (isFFTReady())
+        return;
+
+    // Use the DFT setup shared by all the engines
+    fft.reset (new RealFFT (log2FFTSize));
+
+    // Malloc is more appropriated in this case because it ensures the data is contiguous
+    fftBuffers      = (float*) calloc (maxNbOfGroups * fftSize, sizeof (float));
+    fftWindow       = (float*) malloc (sizeof (float) * fftSize);
+    observed        = (float*) calloc (maxNbOfGroups * fftSize, sizeof (float));     // Half to reals and half to imaginaries
+    magnitudes      = (float*) malloc (sizeof (float) * fftSize / 2);
+
+    // With a pool, every group has its own window and linear FFT, every participant its own transform
+    if (taskPool != nullptr)
+    {
+        for (int participant = 0; participant < taskPool->getNbOfParticipants(); participant++)
+            participantFFTs.push_back (std::unique_ptr<RealFFT> (new RealFFT (log2FFTSize)));
+
+        taskWindows     = (float*) malloc (sizeof (float) * maxNbOfGroups * fftSize);
+        taskMagnitudes  = (float*) malloc (sizeof (float) * maxNbOfGroups * fftSize / 2);
+        fftTasksReady   = true;
+    }
+
+    // The audio thread can now use the buffers
+    fftReady.store (true, std::memory_order_release);
+}
+
+void AnalysisEngine::reset()
+{
+    samplesProcessed = 0;
+    nbBufValProcessed = 0;
+    instantSigValNbOfSamplesSkipped = 0;
+    fftBufferIndex = 0;
+
+    for (int group = 0; group < groupStride; group++)
+        resetGroup (group);
+}
+
+void AnalysisEngine::resetGroup (int group)
+{
+    signalSum[group] = 0;
+    signalAverageEnergy[group] = 0;
+    signalInstantEnergy[group] = 0;
+    beatDetected[group] = 0;
+
+    if (group < maxNbOfGroups)
+    {
+        std::fill (averagedBands[group], averagedBands[group] + nbOfLogBands, 0.0f);
+        lastFundamentalFreq[group] = -1;
+        fftBufferFill[group] = 0;
+    }
+}
+
+//==============================================================================
+void AnalysisEngine::process (const float* const* channels, int nbOfChannels, int nbOfSamples, FeatureSink& sink)
+{
+    const ChannelGroup allChannels = { 0, nbOfChannels };
+    process (channels, &allChannels, nbOfChannels > 0 ? 1 : 0, nbOfSamples, sink);
+}
+
+void AnalysisEngine::process (const float* const* channels, const ChannelGroup* newGroups, int nbOfNewGroups, int nbOfSamples,
+                              FeatureSink& sink)
+{
+    nbOfNewGroups = std::min (nbOfNewGroups, (int) maxNbOfGroups);
+
+    // The groups that changed forget the channels they analysed before, the groups that disappeared are cleared
+    // so that the padding of the arrays stays neutral
+    for (int group = 0; group < std::max (nbOfGroups, nbOfNewGroups); group++)
+    {
+        if (group >= nbOfNewGroups || group >= nbOfGroups
+            || newGroups[group].firstChannel != groups[group].firstChannel
+            || newGroups[group].nbOfChannels != groups[group].nbOfChannels)
+        {
+            resetGroup (group);
+            energyDivisor[group] = 1.0f;
+        }
+
+        if (group < nbOfNewGroups)
+            groups[group] = newGroups[group];
+    }
+    nbOfGroups = nbOfNewGroups;
+
+    for (int group = 0; group < nbOfGroups; group++)
+    {
+        const ChannelGroup& channelGroup = groups[group];
+
+        // Signal average: The objective is to get an average of the signal's amplitude -> use the absolute value
+        float sum = signalSum[group];
+        for (int channel = channelGroup.firstChannel; channel < channelGroup.firstChannel + channelGroup.nbOfChannels; channel++)
+        {
+            const float* channelData = channels[channel];
+            for (int i = 0; i < nbOfSamples; i += nbOfSamplesToSkip)
+                sum += std::abs (channelData[i]);
+        }
+        signalSum[group] = sum;
+
+        energyDivisor[group] = (float) (settings.averagingBufferSize * std::max (channelGroup.nbOfChannels, 1));
+    }
+
+    // Instant signal value : the average of the channels of every group
+    if (settings.signalInstantValEnabled)
+    {
+        for (int i = 0; i < nbOfSamples; i++)
+        {
+            if (instantSigValNbOfSamplesSkipped >= settings.instantValNbOfSamplesToSkip)
+            {
+                for (int group = 0; group < nbOfGroups; group++)
+                {
+                    const ChannelGroup& channelGroup = groups[group];
+                    float value = channels[channelGroup.firstChannel][i];
+                    for (int channel = channelGroup.firstChannel + 1; channel < channelGroup.firstChannel + channelGroup.nbOfChannels; channel++)
+                        value += channels[channel][i];
+                    if (channelGroup.nbOfChannels > 1)
+                        value /= channelGroup.nbOfChannels;
+
+                    sink.signalInstantValComputed (group, samplesProcessed + i, settings.instantValGain * value);
+                }
+                instantSigValNbOfSamplesSkipped = 0;
+            }
+            else
+            {
+                instantSigValNbOfSamplesSkipped += 1;
+            }
+        }
+    }
+
+    nbBufValProcessed += nbOfSamples;
+
+    // For the FFT, only check the first channel of every group (the left one), it's not very useful to do the work twice
+    if (settings.fftEnabled && isFFTReady() && nbOfGroups > 0)
+    {
+        int i = 0;
+        while (i < nbOfSamples)
+        {
+            // Up to the start of the next slot
+            const int nbOfSamplesToCopy = std::min (nbOfSamples - i, fftSlotSize - fftBufferIndex % fftSlotSize);
+            for (int group = 0; group < nbOfGroups; group++)
+            {
+                std::memcpy (fftBuffers + group * fftSize + fftBufferIndex, channels[groups[group].firstChannel] + i,
+                             sizeof (float) * nbOfSamplesToCopy);
+                fftBufferFill[group] = std::min (fftBufferFill[group] + nbOfSamplesToCopy, (int) fftSize);
+            }
+            fftBufferIndex += nbOfSamplesToCopy;
+            i += nbOfSamplesToCopy;
+
+            // Start writing the temp data back from the start of the table
+            if (fftBufferIndex >= fftSize)
+                fftBufferIndex = 0;
+
+            if (fftBufferIndex % fftSlotSize == 0)
+            {
+                const int slot = fftBufferIndex / fftSlotSize;
+                for (int group = 0; group < nbOfGroups; group++)
+                {
+                    if (getFFTSlot (group) != slot || fftBufferFill[group] < fftSize)
+                        continue;
+
+                    if (fftTasksReady)
+                        addFFTTask (group, samplesProcessed + i - 1, i < nbOfSamples, sink);
+                    else
+                        computeFFT (group, slot, samplesProcessed + i - 1, sink);
+                }
+            }
+        }
+
+        // Joined before the other features of the block are handed to the sink, as when they run one by one
+        if (nbOfFFTTasks > 0)
+            runFFTTasks (sink);
+    }
+
+    // Must be calculated before the instant signal, or else the beat effect will be minimized.
+    // If the instant signal energy is thresholdFactor times greater than the average energy, consider that a beat
+    // is detected, and set the new signal Average Energy to the value of the instant energy, to avoid having bursts
+    // of false beat detections. No branch : all the groups are updated at once
+    const float window = (float) settings.averageEnergyBufferSize;
+    const float thresholdFactor = settings.thresholdFactor;
+    for (int group = 0; group < groupStride; group++)
+    {
+        const float averageEnergy = denormalize (((signalAverageEnergy[group] * (window - 1)) + signalInstantEnergy[group]) / window);
+        const float instantEnergy = signalSum[group] / energyDivisor[group];
+        const int beat = instantEnergy > averageEnergy * thresholdFactor;
+
+        signalAverageEnergy[group] = beat ? instantEnergy : averageEnergy;
+        signalInstantEnergy[group] = instantEnergy;
+        beatDetected[group] = beat;
+    }
+
+    if (settings.impulseEnabled)
+    {
+        for (int group = 0; group < nbOfGroups; group++)
+            if (beatDetected[group])
+                sink.impulseDetected (group, samplesProcessed);
+    }
+
+    if (nbBufValProcessed >= settings.averagingBufferSize)
+    {
+        if (settings.signalLevelEnabled)
+        {
+            for (int group = 0; group < nbOfGroups; group++)
+                sink.signalLevelComputed (group, samplesProcessed, denormalize (settings.inputSensitivity * signalInstantEnergy[group]));
+        }
+
+        nbBufValProcessed = 0;
+        std::fill (signalSum, signalSum + groupStride, 0.0f);
+    }
+
+    samplesProcessed += nbOfSamples;
+}
+
+//==============================================================================
+void AnalysisEngine::computeFFT (int group, int slot, int64_t time, FeatureSink& sink)
+{
+    // The window starts at the slot in the ring
+    const float* input = fftBuffers + group * fftSize;
+    if (slot != 0)
+    {
+        const int start = slot * fftSlotSize;
+        std::memcpy (fftWindow, input + start, sizeof (float) * (fftSize - start));
+        std::memcpy (fftWindow + fftSize - start, input, sizeof (float) * start);
+        input = fftWindow;
+    }
+
+    float fundamentalFreq;
+
+    // The sink's work (serialization and sending) is not part of the FFT's time
+    {
+        SIGNALPROCESSOR_TRACE_SCOPE ("fft", "logarithmic", settings.logarithmicFFT ? 1 : 0);
+        ScopedStageTimer timer (fftHistogram);
+
+        fundamentalFreq = analyseWindow (group, input, *fft, magnitudes);
+        ++nbOfFFTs;
+    }
+
+    emitFFT (group, time, fundamentalFreq, magnitudes, sink);
+}
+
+// Transform, fundamental frequency, and log bands or linear FFT (into bins) of a group. Only writes the
+// state of the group : the tasks of the pool run it concurrently for different groups
+float AnalysisEngine::analyseWindow (int group, const float* input, RealFFT& transform, float* bins)
+{
+    float* const observedReal = observed + group * fftSize;
+    float* const observedImag = observedReal + fftSize / 2;
+
+    transform.perform (input, observedReal, observedImag);
+    const float fundamentalFreq = findFundamentalFrequency (observedReal, fftSize / 2, sampleRate / fftSize);
+    lastFundamentalFreq[group] = fundamentalFreq;
+
+    if (settings.logarithmicFFT)
+    {
+        float logFFTResult[nbOfLogBands];
+        computeLogBands (observedReal, logFFTResult, nbOfLogBands);
+
+        float* const bands = averagedBands[group];
+        const float window = settings.fftAveragingWindow;
+        for (int i = 0; i < nbOfLogBands; i++)
+            bands[i] = (bands[i] * (window - 1) + logFFTResult[i]) / window;
+    }
+    else
+    {
+        for (int i = 0; i < fftSize / 2; i++)
+            bins[i] = std::abs (observedReal[i]);
+    }
+
+    return fundamentalFreq;
+}
+
+void AnalysisEngine::emitFFT (int group, int64_t time, float fundamentalFreq, const float* bins, FeatureSink& sink)
+{
+    if (settings.logarithmicFFT)
+        sink.logFFTComputed (group, time, averagedBands[group], nbOfLogBands, fundamentalFreq);
+    else
+        sink.linearFFTComputed (group, time, bins, fftSize / 2, fundamentalFreq);
+}
+
+//==============================================================================
+// With a pool, the windows of all the groups end at slot 0 : the ring of a group is its window, in order. It is
+// copied when the block goes on after the hop, since the next samples overwrite the ring before the batch runs
+void AnalysisEngine::addFFTTask (int group, int64_t time, bool copyWindow, FeatureSink& sink)
+{
+    // A block longer than the hop reaches the hop of a group twice : the first batch runs first
+    for (int task = 0; task < nbOfFFTTasks; task++)
+    {
+        if (fftTasks[task].group == group)
+        {
+            runFFTTasks (sink);
+            break;
+        }
+    }
+
+    const float* input = fftBuffers + group * fftSize;
+    if (copyWindow)
+    {
+        float* const window = taskWindows + group * fftSize;
+        std::memcpy (window, input, sizeof (float) * fftSize);
+        input = window;
+    }
+
+    FFTTask& task = fftTasks[nbOfFFTTasks++];
+    task.group = group;
+    task.time = time;
+    task.input = input;
+}
+
+void AnalysisEngine::runFFTTasks (FeatureSink& sink)
+{
+    {
+        SIGNALPROCESSOR_TRACE_SCOPE ("fft batch", "tasks", nbOfFFTTasks);
+        taskPool->run (&AnalysisEngine::runFFTTask, this, nbOfFFTTasks);
+    }
+
+    // Joined : the features are handed over in the order of the groups, whichever thread computed them
+    for (int i = 0; i < nbOfFFTTasks; i++)
+    {
+        const FFTTask& task = fftTasks[i];
+        ++nbOfFFTs;
+        if (fftHistogram != nullptr)
+            fftHistogram->record (task.duration);
+
+        emitFFT (task.group, task.time, task.fundamentalFreq, taskMagnitudes + task.group * fftSize / 2, sink);
+    }
+
+    nbOfFFTTasks = 0;
+}
+
+void AnalysisEngine::runFFTTask (void* context, int taskIndex, int participant)
+{
+    AnalysisEngine& engine = *static_cast<AnalysisEngine*> (context);
+    FFTTask& task = engine.fftTasks[taskIndex];
+
+    SIGNALPROCESSOR_TRACE_SCOPE ("fft", "group", task.group);
+    const uint64_t start = engine.fftHistogram != nullptr ? getMonotonicNanoseconds() : 0;
+
+    task.fundamentalFreq = engine.analyseWindow (task.group, task.input, *engine.participantFFTs[participant],
+                                                 engine.taskMagnitudes + task.group * fftSize / 2);
+
+    task.duration = engine.fftHistogram != nullptr ? getMonotonicNanoseconds() - start : 0;
+}
+
+float AnalysisEngine::findFundamentalFrequency (const float* spectrum, int nbOfBins, double binWidth)
+{
+    float maxVal = 0;
+    int maxValPos = 0;
+    for (int i = 0; i < nbOfBins; i++)
+    {
+        // This function aims to find the approximate fundamental. The algorithm could be improved
+        if (maxVal < spectrum[i])
+        {
+            maxVal = spectrum[i];
+            maxValPos = i;
+        }
+    }
+
+    if (maxVal < 0.1)
+    {
+        // No real frequency could be found (the source is silent)
+        return -1;
+    }
+
+    // Weighted average of the peak and its highest neighbour
+    const int lower = std::max (maxValPos - 1, 0);
+    const int upper = std::min (maxValPos + 1, nbOfBins - 1);
+    const int neighbour = (std::abs (spectrum[lower]) > std::abs (spectrum[upper])) ? lower : upper;
+
+    return (float) binWidth *
+        (std::abs (maxValPos * spectrum[maxValPos]) + std::abs (neighbour * spectrum[neighbour])) /
+        (std::abs (spectrum[neighbour]) + std::abs (spectrum[maxValPos]));
+}
+
+// Calculate the intensity of the octave bands
+void AnalysisEngine::computeLogBands (const float* spectrum, float* bands, int nbOfBands)
+{
+    // Every element of the spectrum contains the energy for a frequency band with (sampleRate / fftSize) Hz width
+    // (10.76Hz at a 44100Hz sample rate, for 12 bands : 0 to 11 Hz, 11 to 22 Hz, 22 to 43 Hz, ..., 11025 to 22050 Hz)
+    bands[0] = std::abs (spectrum[0]);
+    bands[1] = std::abs (spectrum[1]);
+
+    for (int band = 2; band < nbOfBands; band++)
+    {
+        float sum = 0;
+        for (int i = 1 << (band - 1); i < 1 << band; i++)
+            sum += std::abs (spectrum[i]);
+
+        bands[band] = sum;
+    }
+}
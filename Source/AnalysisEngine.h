@@ -0,0 +1,222 @@
+/*
+ ==============================================================================
+
+    AnalysisEngine.h
+    PlayMe - SignalProcessor
+    The signal analysis of the plugin : averaged signal level, instant signal
+    value, beat detection, FFT (linear or 12 logarithmic bands) and
+    fundamental frequency, for one or several groups of channels (the
+    channels of a stem bus one by one, a sidechain). It does not depend on JUCE : it reads raw float
+    buffers and hands the features to a FeatureSink, so it can be used
+    without the plugin wrapper (tools, benchmarks, tests)
+
+ ==============================================================================
+ */
+
+#ifndef ANALYSISENGINE_H_INCLUDED
+#define ANALYSISENGINE_H_INCLUDED
+
+#include "RealFFT.h"
+#include "PerformanceStats.h"
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+class AnalysisTaskPool;
+
+//==============================================================================
+/**
+    Receives the features computed by AnalysisEngine::process, on the thread
+    calling it (the audio thread for the plugin) : the implementations must
+    not block. group is the index of the group of channels the feature was
+    computed on, time the position of the feature, in samples since the
+    engine was created or reset
+ */
+class FeatureSink
+{
+public:
+    virtual ~FeatureSink() {}
+
+    virtual void signalLevelComputed (int group, int64_t time, float level) = 0;
+    virtual void signalInstantValComputed (int group, int64_t time, float value) = 0;
+    virtual void impulseDetected (int group, int64_t time) = 0;
+    virtual void logFFTComputed (int group, int64_t time, const float* bands, int nbOfBands, float fundamentalFreq) = 0;
+    virtual void linearFFTComputed (int group, int64_t time, const float* bins, int nbOfBins, float fundamentalFreq) = 0;
+};
+
+//==============================================================================
+/**
+    One engine per analysed track. process() does not allocate nor lock once
+    prepareFFT was called (with a task pool, it only locks to wake its
+    sleeping workers)
+ */
+class AnalysisEngine
+{
+public:
+    static const unsigned int log2FFTSize   = 12;
+    static const int fftSize                = 1 << log2FFTSize;    // 4096
+    static const int nbOfLogBands           = 12;
+    static const int maxNbOfGroups          = 17;                   // The 16 channels of a stem bus, and a sidechain
+
+    // Channels analysed together, as one signal
+    struct ChannelGroup
+    {
+        int firstChannel;
+        int nbOfChannels;
+    };
+
+    // Analysis parameters, read at every process() call
+    struct Settings
+    {
+        int averagingBufferSize             = 2048;     // Number of samples averaged by a signal level
+        float fftAveragingWindow            = 8;        // Number of FFTs averaged by the log bands
+        float inputSensitivity              = 1.0;      // Gain of the signal level
+        int averageEnergyBufferSize         = 8;        // Beat detection window, in blocks
+        float thresholdFactor               = 4;        // Beat : instant energy above thresholdFactor times the average
+        float instantValGain                = 1.0;
+        int instantValNbOfSamplesToSkip     = 192;
+        bool logarithmicFFT                 = true;
+
+        // Disabled features are not handed to the sink. The instant value and the FFT are not computed at all
+        bool signalLevelEnabled             = true;
+        bool signalInstantValEnabled        = true;
+        bool impulseEnabled                 = true;
+        bool fftEnabled                     = false;
+    };
+
+    AnalysisEngine();
+    ~AnalysisEngine();
+
+    Settings settings;
+
+    // Used by the fundamental frequency
+    void setSampleRate (double newSampleRate)       { sampleRate = newSampleRate; }
+    double getSampleRate() const                    { return sampleRate; }
+
+    // Run the FFTs of the groups on a task pool, shared by the engines analysed on the same thread, or nullptr.
+    // With a pool, the windows of all the groups end at the same sample instead of being staggered : the FFTs of
+    // a hop are one batch, joined before the features are handed to the sink, in the order of the groups.
+    // Before prepareFFT : the pool is ignored by an engine whose FFT is already prepared
+    void setTaskPool (AnalysisTaskPool* pool)       { taskPool = pool; }
+
+    // Allocate the FFT buffers : not real-time safe. Until it was called, fftEnabled is ignored
+    void prepareFFT();
+    bool isFFTReady() const                         { return fftReady.load (std::memory_order_acquire); }
+
+    // Forget the analysis state (averages, partially filled FFT buffer, time)
+    void reset();
+
+    // Analyse one block, every group on its own (up to maxNbOfGroups). The beat detection and the signal level
+    // consider all the channels of a group, the instant value their average, the FFT and the fundamental
+    // frequency only the first one. A group whose channels changed since the previous block starts from a
+    // reset state
+    void process (const float* const* channels, const ChannelGroup* groups, int nbOfGroups, int nbOfSamples,
+                  FeatureSink& sink);
+
+    // Analyse one block, all the channels being one group
+    void process (const float* const* channels, int nbOfChannels, int nbOfSamples, FeatureSink& sink);
+
+    int64_t getSamplesProcessed() const             { return samplesProcessed; }
+
+    // Result of the last FFT of a group, for displays : the spectrum handed to the kernels (fftSize / 2 bins) and
+    // its fundamental frequency. Only valid if getNbOfFFTs() > 0 and the group was analysed, until the next
+    // process() call
+    int64_t getNbOfFFTs() const                             { return nbOfFFTs; }
+    const float* getLastSpectrum (int group = 0) const      { return observed + group * fftSize; }
+    float getLastFundamentalFrequency (int group = 0) const { return lastFundamentalFreq[group]; }
+
+    // Histogram of the duration of the FFTs (transform, bands and fundamental frequency), or nullptr
+    void setFFTHistogram (LatencyHistogram* histogram)  { fftHistogram = histogram; }
+
+    //==============================================================================
+    // Kernels of the FFT path, also used by the benchmarks. spectrum : the real parts of a RealFFT result
+
+    // Approximate fundamental : the highest bin, weighted with its highest neighbour. -1 if the source is silent
+    static float findFundamentalFrequency (const float* spectrum, int nbOfBins, double binWidth);
+
+    // Energy of the octave bands : bands 0 and 1 are single bins, then every band is twice as wide as the
+    // previous one. The last band ends at bin 1 << (nbOfBands - 1), which must not exceed nbOfBins
+    static void computeLogBands (const float* spectrum, float* bands, int nbOfBands);
+
+private:
+    void computeFFT (int group, int slot, int64_t time, FeatureSink& sink);
+    float analyseWindow (int group, const float* input, RealFFT& transform, float* bins);
+    void emitFFT (int group, int64_t time, float fundamentalFreq, const float* bins, FeatureSink& sink);
+    void resetGroup (int group);
+
+    int getFFTSlot (int group) const                { return fftTasksReady ? 0 : group * nbOfFFTSlots / nbOfGroups; }
+    void addFFTTask (int group, int64_t time, bool copyWindow, FeatureSink& sink);
+    void runFFTTasks (FeatureSink& sink);
+    static void runFFTTask (void* engine, int task, int participant);
+
+    static float denormalize (float input)          { return (input + 1.0f) - 1.0f; }
+
+    double sampleRate = 44100;
+    int64_t samplesProcessed = 0;
+
+    // The groups of the previous block
+    ChannelGroup groups[maxNbOfGroups];
+    int nbOfGroups = 0;
+
+    // The state of the groups is a structure of arrays, padded to a multiple of the SIMD width : the block rate
+    // updates are branch-free loops across the groups, which the compiler vectorizes
+    static const int groupStride = (maxNbOfGroups + 3) & ~3;
+
+    // Used by the signal average value
+    static const int nbOfSamplesToSkip = 6;         // Only read one value out of nbOfSamplesToSkip, it's faster this way
+    int nbBufValProcessed = 0;
+    float signalSum[groupStride];
+
+    // Used by the instant signal value, the same for all the groups
+    int instantSigValNbOfSamplesSkipped = 0;
+
+    // Used for beat detection
+    float signalAverageEnergy[groupStride];
+    float signalInstantEnergy[groupStride];
+    float energyDivisor[groupStride];               // averagingBufferSize times the number of channels of the group
+    int beatDetected[groupStride];
+
+    // Used by FFT computations : one input buffer and one result per group. The windows of the groups are
+    // staggered over nbOfFFTSlots points of the hop, so that their FFTs do not all fall in the same block :
+    // the input buffers are rings, and the window of a group ends at the start of its slot
+    static const int nbOfFFTSlots = 16;
+    static const int fftSlotSize = fftSize / nbOfFFTSlots;
+    std::unique_ptr<RealFFT> fft;
+    std::atomic<bool> fftReady;
+    float* fftBuffers = nullptr;                    // Buffers used to store any incoming input data
+    int fftBufferIndex = 0;                         // Index where the data should be written in the fftBuffers
+    int fftBufferFill[maxNbOfGroups];               // Samples written in the buffer of a group, up to fftSize
+    float* fftWindow = nullptr;                     // The window of a group whose slot is not 0, in order
+    float* observed = nullptr;                      // Results of the DFTs : fftSize / 2 reals, then fftSize / 2 imaginaries
+    float* magnitudes = nullptr;                    // Linear FFT sent to the sink
+    float averagedBands[maxNbOfGroups][nbOfLogBands];   // Log bands averaged over fftAveragingWindow FFTs
+    float lastFundamentalFreq[maxNbOfGroups];
+    int64_t nbOfFFTs = 0;
+    LatencyHistogram* fftHistogram = nullptr;
+
+    // The FFTs of the current hop, when they run on the task pool. A task only writes the state of its group and
+    // its own slot : the windows it copied, its linear FFT, and its result below. The histogram and the sink are
+    // only used by the calling thread, after the join
+    struct FFTTask
+    {
+        int group;
+        int64_t time;
+        const float* input;
+        float fundamentalFreq;
+        uint64_t duration;
+    };
+
+    AnalysisTaskPool* taskPool = nullptr;
+    bool fftTasksReady = false;                     // prepareFFT found a pool : the following are allocated
+    std::vector<std::unique_ptr<RealFFT>> participantFFTs;      // RealFFT has work buffers : one per participant
+    float* taskWindows = nullptr;                   // The windows of the groups, when the block goes on after their hop
+    float* taskMagnitudes = nullptr;                // The linear FFTs of the groups
+    FFTTask fftTasks[maxNbOfGroups];
+    int nbOfFFTTasks = 0;
+
+    AnalysisEngine (const AnalysisEngine&) = delete;
+    AnalysisEngine& operator= (const AnalysisEngine&) = delete;
+};
+
+#endif  // ANALYSISENGINE_H_INCLUDED
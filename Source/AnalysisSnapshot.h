@@ -0,0 +1,40 @@
+/*
+ ==============================================================================
+
+    AnalysisSnapshot.h
+    PlayMe - SignalProcessor
+    What the editor displays : the last samples of the first channel, the
+    spectrum of the last FFT and the state of the analysis. The processor
+    publishes one every scopeSize samples, through a TripleBuffer
+
+ ==============================================================================
+ */
+
+#ifndef ANALYSISSNAPSHOT_H_INCLUDED
+#define ANALYSISSNAPSHOT_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "AnalysisEngine.h"
+#include "TripleBuffer.h"
+
+//==============================================================================
+struct AnalysisSnapshot
+{
+    static const int scopeSize      = 1024;                             // Also the publication hop, in samples
+    static const int nbOfBins       = AnalysisEngine::fftSize / 2;
+    static const int nbOfBands      = AnalysisEngine::nbOfLogBands;
+
+    float scope[scopeSize];                                             // First channel, oldest sample first
+    float spectrum[nbOfBins];                                           // Magnitudes of the last FFT
+    float bands[nbOfBands];                                             // Octave bands of the last FFT
+    bool hasSpectrum                = false;                            // The FFT is enabled and ran at least once
+    float fundamentalFrequency      = -1;                               // -1 if the source was silent
+    float signalLevel               = 0;                                // Last signal level computed
+    float beatIntensity             = 0;                                // 1 right after a beat, then fading to 0.1
+    double sampleRate               = 44100;
+    AudioPlayHead::CurrentPositionInfo position;                        // Of the host, if the time info is sent
+};
+
+typedef TripleBuffer<AnalysisSnapshot> AnalysisSnapshotBuffer;
+
+#endif  // ANALYSISSNAPSHOT_H_INCLUDED
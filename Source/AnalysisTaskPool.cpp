@@ -0,0 +1,210 @@
+/*
+ ==============================================================================
+
+    AnalysisTaskPool.cpp
+    PlayMe - SignalProcessor
+    Work-stealing pool of the analysis, without JUCE
+
+ ==============================================================================
+ */
+
+#include "AnalysisTaskPool.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined (__linux__)
+ #include <pthread.h>
+ #include <sched.h>
+#endif
+
+// Tells the core the thread is spinning (hyper-threading sibling, power)
+static inline void spinPause()
+{
+   #if defined (__x86_64__) || defined (__i386__)
+    __builtin_ia32_pause();
+   #elif defined (__aarch64__) || defined (__arm__)
+    asm volatile ("yield");
+   #endif
+}
+
+//==============================================================================
+AnalysisTaskPool::AnalysisTaskPool (int nbOfWorkersWanted)
+    : nbOfWorkers (std::max (0, std::min (nbOfWorkersWanted, (int) maxNbOfWorkers))),
+      generation (0),
+      stopping (false),
+      nbOfSleepingWorkers (0),
+      nbOfRealTimeWorkers (0)
+{
+    for (int b = 0; b < 2; b++)
+    {
+        batches[b].remaining.store (0);
+        batches[b].nbOfWorkersInside.store (0);
+
+        for (int p = 0; p <= maxNbOfWorkers; p++)
+        {
+            batches[b].shares[p].next.store (0);
+            batches[b].shares[p].end = 0;
+        }
+    }
+
+    for (int i = 0; i < nbOfWorkers; i++)
+    {
+        const int participant = i + 1;
+        workers[i] = std::thread ([this, participant] { workerLoop (participant); });
+
+       #if defined (__linux__)
+        // Without the rtprio limit, the workers keep the ordinary policy
+        sched_param parameters;
+        parameters.sched_priority = workerPriority;
+
+        if (pthread_setschedparam (workers[i].native_handle(), SCHED_FIFO, &parameters) == 0)
+            nbOfRealTimeWorkers.fetch_add (1);
+
+        pthread_setname_np (workers[i].native_handle(), "AnalysisWorker");
+       #endif
+    }
+}
+
+AnalysisTaskPool::~AnalysisTaskPool()
+{
+    {
+        std::lock_guard<std::mutex> lock (sleepLock);
+        stopping.store (true);
+    }
+    wakeUp.notify_all();
+
+    for (int i = 0; i < nbOfWorkers; i++)
+        workers[i].join();
+}
+
+int AnalysisTaskPool::getNbOfCores()
+{
+    return std::max (1, (int) std::thread::hardware_concurrency());
+}
+
+//==============================================================================
+void AnalysisTaskPool::run (TaskFunction function, void* context, int nbOfTasks)
+{
+    nbOfTasks = std::min (nbOfTasks, (int) maxNbOfTasks);
+
+    // Nothing to share
+    if (nbOfWorkers == 0 || nbOfTasks <= 1)
+    {
+        for (int task = 0; task < nbOfTasks; task++)
+            function (context, task, 0);
+
+        return;
+    }
+
+    const unsigned int next = generation.load (std::memory_order_relaxed) + 1;
+    Batch& batch = batches[next & 1];
+
+    // A worker which was late for the batch before the previous one may still be reading this one : rather than
+    // waiting for a thread which may not even be scheduled, the calling thread runs this batch alone
+    if (batch.nbOfWorkersInside.load() != 0)
+    {
+        for (int task = 0; task < nbOfTasks; task++)
+            function (context, task, 0);
+
+        return;
+    }
+
+    batch.function = function;
+    batch.context = context;
+
+    const int nbOfParticipants = getNbOfParticipants();
+    for (int p = 0; p < nbOfParticipants; p++)
+    {
+        batch.shares[p].next.store (p * nbOfTasks / nbOfParticipants, std::memory_order_relaxed);
+        batch.shares[p].end = (p + 1) * nbOfTasks / nbOfParticipants;
+    }
+    batch.remaining.store (nbOfTasks, std::memory_order_relaxed);
+
+    // Publish the batch. A worker which is about to sleep either sees the new generation, or is counted
+    generation.store (next);
+    if (nbOfSleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock (sleepLock);
+        wakeUp.notify_all();
+    }
+
+    // The calling thread claims every task left, those of the workers which have not started included
+    work (batch, 0);
+
+    // Join : only the tasks the workers claimed, and are running, are left. Their results are visible once
+    // remaining is 0. No yield : for a SCHED_FIFO caller, it would not let a worker of a lower priority run
+    while (batch.remaining.load (std::memory_order_acquire) != 0)
+        spinPause();
+}
+
+// Own share first, then the shares of the next participants. A claim is a fetch_add on the share : the owner
+// and the thieves never run the same task
+void AnalysisTaskPool::work (Batch& batch, int participant)
+{
+    const int nbOfParticipants = getNbOfParticipants();
+
+    for (int i = 0; i < nbOfParticipants; i++)
+    {
+        Share& share = batch.shares[(participant + i) % nbOfParticipants];
+
+        for (int task; (task = share.next.fetch_add (1, std::memory_order_relaxed)) < share.end;)
+        {
+            batch.function (batch.context, task, participant);
+            batch.remaining.fetch_sub (1, std::memory_order_release);
+        }
+    }
+}
+
+//==============================================================================
+void AnalysisTaskPool::workerLoop (int participant)
+{
+    unsigned int seen = 0;
+
+    while (waitForBatch (seen))
+    {
+        Batch& batch = batches[seen & 1];
+
+        // Only work on the batch if it is still the last one : once the next one is published, this one may be
+        // rewritten as soon as the workers inside it have left
+        batch.nbOfWorkersInside.fetch_add (1);
+        if (generation.load() == seen)
+            work (batch, participant);
+        batch.nbOfWorkersInside.fetch_sub (1);
+    }
+}
+
+// Spin for a while, the next batch usually comes soon (the next FFT hop), then sleep. Returns false when the
+// pool is destroyed
+bool AnalysisTaskPool::waitForBatch (unsigned int& seen)
+{
+    const std::chrono::steady_clock::time_point spinEnd = std::chrono::steady_clock::now() + std::chrono::microseconds (spinMicroseconds);
+
+    for (int spins = 1;; spins++)
+    {
+        if (stopping.load (std::memory_order_relaxed))
+            return false;
+
+        const unsigned int current = generation.load();
+        if (current != seen)
+        {
+            seen = current;
+            return true;
+        }
+
+        if ((spins & 63) == 0 && std::chrono::steady_clock::now() >= spinEnd)
+            break;
+
+        spinPause();
+    }
+
+    std::unique_lock<std::mutex> lock (sleepLock);
+    nbOfSleepingWorkers.fetch_add (1);
+    wakeUp.wait (lock, [this, seen] { return stopping.load() || generation.load() != seen; });
+    nbOfSleepingWorkers.fetch_sub (1);
+
+    if (stopping.load())
+        return false;
+
+    seen = generation.load();
+    return true;
+}
@@ -0,0 +1,126 @@
+/*
+ ==============================================================================
+
+    AnalysisTaskPool.h
+    PlayMe - SignalProcessor
+    Work-stealing pool running the independent jobs of an analysis hop (the
+    FFTs of the groups of channels) on real-time worker threads, and joining
+    them before the features are emitted
+
+ ==============================================================================
+ */
+
+#ifndef ANALYSISTASKPOOL_H_INCLUDED
+#define ANALYSISTASKPOOL_H_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+//==============================================================================
+/**
+    run() hands a batch of tasks to the workers and to the calling thread,
+    and returns once all of them have finished. Every participant starts
+    with its own contiguous share of the batch, then steals the tasks left in
+    the shares of the others : a slow or preempted worker does not delay the
+    join. The tasks write their results into slots of their own, so what the
+    caller reads after the join does not depend on which thread ran which
+    task.
+
+    The batches are bounded (maxNbOfTasks) and the pool owns all its state :
+    run() does not allocate. The workers spin for a while after a batch, then
+    sleep : run() only takes a lock to wake sleeping workers.
+
+    The calling thread, usually the audio thread, never waits for a worker
+    which has not started : it runs every task nobody claimed yet itself, and
+    only spins for the tasks already running on a worker. If a worker late for
+    an older batch still holds the batch slot, run() executes the whole batch
+    on the calling thread instead of waiting for it. So that a running task is
+    not held up by ordinary threads, the workers ask for SCHED_FIFO on Linux
+    (workerPriority, granted when the rtprio limit allows it). They are not
+    pinned : a worker pinned to the core of the spinning caller could not
+    finish its task, the scheduler moves them to another core instead.
+
+    A single thread calls run() (the thread of the engine using the pool).
+    This class does not depend on JUCE
+ */
+class AnalysisTaskPool
+{
+public:
+    static const int maxNbOfWorkers     = 31;
+    static const int maxNbOfTasks       = 64;
+
+    // task : index in the batch. participant : 0 for the calling thread, 1 to getNbOfWorkers() for the workers,
+    // so that every participant can use its own scratch buffers
+    typedef void (*TaskFunction) (void* context, int task, int participant);
+
+    // Starts the workers : not real-time safe. 0 workers : run() executes the tasks on the calling thread
+    explicit AnalysisTaskPool (int nbOfWorkers);
+    ~AnalysisTaskPool();
+
+    int getNbOfWorkers() const                      { return nbOfWorkers; }
+    int getNbOfParticipants() const                 { return nbOfWorkers + 1; }
+
+    // Number of workers actually running with the real-time policy
+    int getNbOfRealTimeWorkers() const              { return nbOfRealTimeWorkers.load(); }
+
+    // SCHED_FIFO priority of the workers : below the audio threads of the hosts (JACK and the ScalingHost use 70),
+    // above every ordinary thread
+    static const int workerPriority     = 60;
+
+    // Runs the tasks 0 to nbOfTasks - 1 (at most maxNbOfTasks) and waits for all of them
+    void run (TaskFunction function, void* context, int nbOfTasks);
+
+    // The number of cores, for a default number of workers
+    static int getNbOfCores();
+
+private:
+    // The counters written by several threads are padded to their own cache line. Padding rather than alignas :
+    // the pool is allocated with new, which does not honour over-aligned types before C++17
+    static const int cacheLineSize = 64;
+
+    // The tasks a participant has not started yet : [next, end). The owner and the thieves claim them the same way
+    struct Share
+    {
+        std::atomic<int> next;
+        int end;
+        char padding[cacheLineSize - sizeof (std::atomic<int>) - sizeof (int)];
+    };
+
+    // Two batches alternate : a worker late for a batch can still be reading it while the next one is set up
+    struct Batch
+    {
+        TaskFunction function = nullptr;
+        void* context = nullptr;
+        char padding1[cacheLineSize];
+        Share shares[maxNbOfWorkers + 1];
+        std::atomic<int> remaining;                             // Tasks not finished
+        char padding2[cacheLineSize];
+        std::atomic<int> nbOfWorkersInside;                     // Workers which may still read the batch
+        char padding3[cacheLineSize];
+    };
+
+    void workerLoop (int participant);
+    void work (Batch& batch, int participant);
+    bool waitForBatch (unsigned int& seen);
+
+    const int nbOfWorkers;
+    Batch batches[2];
+    std::atomic<unsigned int> generation;                       // Number of batches started : batches[generation & 1] is the last
+    std::atomic<bool> stopping;
+
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+    std::atomic<int> nbOfSleepingWorkers;
+    std::atomic<int> nbOfRealTimeWorkers;
+
+    std::thread workers[maxNbOfWorkers];
+
+    static const int spinMicroseconds = 50;                     // Polling after a batch, before sleeping
+
+    AnalysisTaskPool (const AnalysisTaskPool&) = delete;
+    AnalysisTaskPool& operator= (const AnalysisTaskPool&) = delete;
+};
+
+#endif  // ANALYSISTASKPOOL_H_INCLUDED
@@ -0,0 +1,231 @@
+/*
+ ==============================================================================
+
+    AnalysisView.cpp
+    PlayMe - SignalProcessor
+    Live display of the analysis : spectrum, octave band meters and
+    oscilloscope
+
+ ==============================================================================
+ */
+
+#include "AnalysisView.h"
+
+const float AnalysisView::minDecibels           = -90.0f;
+const float AnalysisView::maxDecibels           = 0.0f;
+const float AnalysisView::peakFallPerSnapshot   = 1.5f;
+
+//==============================================================================
+AnalysisView::AnalysisView()
+{
+    setOpaque (true);
+
+    for (int i = 0; i < AnalysisSnapshot::nbOfBands; ++i)
+        bandPeaks[i] = minDecibels;
+
+   #if SIGNALPROCESSOR_OPENGL_VIEW
+    // The context paints the component with JUCE's OpenGL renderer, once the view is on screen
+    openGLContext.attachTo (*this);
+    startTimer (openGLCheckInterval);
+   #endif
+}
+
+AnalysisView::~AnalysisView()
+{
+   #if SIGNALPROCESSOR_OPENGL_VIEW
+    openGLContext.detach();
+   #endif
+}
+
+void AnalysisView::setSnapshot (const AnalysisSnapshot& newSnapshot)
+{
+    snapshot = &newSnapshot;
+
+    for (int i = 0; i < AnalysisSnapshot::nbOfBands; ++i)
+    {
+        const float level = newSnapshot.hasSpectrum ? magnitudeToDecibels (newSnapshot.bands[i]) : minDecibels;
+        bandPeaks[i] = jmax (level, bandPeaks[i] - peakFallPerSnapshot);
+    }
+
+    repaint();
+}
+
+void AnalysisView::timerCallback()
+{
+   #if SIGNALPROCESSOR_OPENGL_VIEW
+    if (! isShowing())
+    {
+        shownMilliseconds = 0;
+        return;
+    }
+
+    if (openGLContext.getRawContext() != nullptr)
+    {
+        stopTimer();
+        return;
+    }
+
+    // No GPU, or no OpenGL driver : the attached context would leave the view blank
+    shownMilliseconds += openGLCheckInterval;
+    if (shownMilliseconds >= openGLTimeout)
+    {
+        openGLContext.detach();
+        stopTimer();
+        repaint();
+    }
+   #endif
+}
+
+//==============================================================================
+// A sine at full scale gives a magnitude of fftSize / 2 in its bin
+float AnalysisView::magnitudeToDecibels (float magnitude)
+{
+    const float decibels = Decibels::gainToDecibels (magnitude / (float) AnalysisSnapshot::nbOfBins, minDecibels);
+    return jlimit (minDecibels, maxDecibels, decibels);
+}
+
+void AnalysisView::paint (Graphics& g)
+{
+    g.fillAll (Colours::black);
+
+    Rectangle<float> area (getLocalBounds().toFloat());
+    const float width = area.getWidth();
+    const Rectangle<float> spectrumArea (area.removeFromLeft (width * 0.45f).reduced (2.0f));
+    const Rectangle<float> bandsArea (area.removeFromLeft (width * 0.2f).reduced (2.0f));
+    const Rectangle<float> scopeArea (area.reduced (2.0f));
+
+    paintSpectrum (g, spectrumArea);
+    paintBands (g, bandsArea);
+    paintScope (g, scopeArea);
+
+    // The renderer actually used : OpenGL when painted by the context's render thread
+    g.setColour (Colours::grey);
+    g.setFont (10.0f);
+    g.drawText (OpenGLContext::getCurrentContext() != nullptr ? "OpenGL" : "Software",
+                scopeArea.reduced (3.0f), Justification::bottomRight, false);
+}
+
+void AnalysisView::paintSpectrum (Graphics& g, const Rectangle<float>& area)
+{
+    g.setColour (Colours::white.withAlpha (0.4f));
+    g.drawRect (area, 1.0f);
+
+    g.setFont (10.0f);
+    g.setColour (Colours::white);
+    g.drawText ("Spectrum", area.reduced (3.0f), Justification::topLeft, false);
+
+    if (snapshot == nullptr || ! snapshot->hasSpectrum)
+    {
+        g.setColour (Colours::grey);
+        g.drawText ("FFT off", area, Justification::centred, false);
+        return;
+    }
+
+    // Logarithmic frequency axis, from 20 Hz to the Nyquist frequency. Every column shows the highest
+    // bin of its frequency range
+    const double nyquist = snapshot->sampleRate / 2.0;
+    const double binWidth = nyquist / AnalysisSnapshot::nbOfBins;
+    const double minFrequency = 20.0;
+    const int nbOfColumns = jmax (1, (int) area.getWidth());
+    const float decibelRange = maxDecibels - minDecibels;
+
+    Path path;
+    path.startNewSubPath (area.getX(), area.getBottom());
+
+    for (int column = 0; column < nbOfColumns; ++column)
+    {
+        const double lowFrequency = minFrequency * std::pow (nyquist / minFrequency, column / (double) nbOfColumns);
+        const double highFrequency = minFrequency * std::pow (nyquist / minFrequency, (column + 1) / (double) nbOfColumns);
+        const int firstBin = jlimit (0, AnalysisSnapshot::nbOfBins - 1, (int) (lowFrequency / binWidth));
+        const int endBin = jlimit (firstBin + 1, AnalysisSnapshot::nbOfBins, (int) std::ceil (highFrequency / binWidth));
+
+        float magnitude = 0;
+        for (int bin = firstBin; bin < endBin; ++bin)
+            magnitude = jmax (magnitude, snapshot->spectrum[bin]);
+
+        const float level = (magnitudeToDecibels (magnitude) - minDecibels) / decibelRange;
+        path.lineTo (area.getX() + column, area.getBottom() - level * area.getHeight());
+    }
+
+    path.lineTo (area.getRight(), area.getBottom());
+    path.closeSubPath();
+
+    g.setColour (Colours::white.withAlpha (0.3f));
+    g.fillPath (path);
+    g.setColour (Colours::white);
+    g.strokePath (path, PathStrokeType (1.0f));
+
+    if (snapshot->fundamentalFrequency > 0)
+    {
+        g.setColour (Colours::white);
+        g.drawText ("f0 " + String (snapshot->fundamentalFrequency, 0) + " Hz", area.reduced (3.0f),
+                    Justification::topRight, false);
+    }
+}
+
+void AnalysisView::paintBands (Graphics& g, const Rectangle<float>& area)
+{
+    g.setColour (Colours::white.withAlpha (0.4f));
+    g.drawRect (area, 1.0f);
+
+    const float decibelRange = maxDecibels - minDecibels;
+    const float barWidth = area.getWidth() / AnalysisSnapshot::nbOfBands;
+
+    for (int i = 0; i < AnalysisSnapshot::nbOfBands; ++i)
+    {
+        const float x = area.getX() + i * barWidth;
+
+        if (snapshot != nullptr && snapshot->hasSpectrum)
+        {
+            const float level = (magnitudeToDecibels (snapshot->bands[i]) - minDecibels) / decibelRange;
+            g.setColour (Colours::white.withAlpha (0.8f));
+            g.fillRect (x + 1.0f, area.getBottom() - level * area.getHeight(), barWidth - 2.0f, level * area.getHeight());
+        }
+
+        const float peak = (bandPeaks[i] - minDecibels) / decibelRange;
+        if (peak > 0)
+        {
+            g.setColour (Colours::red);
+            g.fillRect (x + 1.0f, area.getBottom() - peak * area.getHeight(), barWidth - 2.0f, 2.0f);
+        }
+    }
+}
+
+void AnalysisView::paintScope (Graphics& g, const Rectangle<float>& area)
+{
+    // The frame flashes with the beats
+    const float beatIntensity = snapshot != nullptr ? snapshot->beatIntensity : 0.0f;
+    g.setColour (Colours::white.withAlpha (0.4f).interpolatedWith (Colours::red, jlimit (0.0f, 1.0f, beatIntensity)));
+    g.drawRect (area, 1.0f);
+
+    g.setFont (10.0f);
+    g.setColour (Colours::white);
+    g.drawText ("Scope", area.reduced (3.0f), Justification::topLeft, false);
+
+    if (snapshot == nullptr)
+        return;
+
+    // Minimum and maximum of the samples of every column
+    const int nbOfColumns = jmax (1, (int) area.getWidth());
+    const float centre = area.getCentreY();
+    const float halfHeight = area.getHeight() / 2.0f;
+
+    g.setColour (Colours::white);
+    for (int column = 0; column < nbOfColumns; ++column)
+    {
+        const int first = column * AnalysisSnapshot::scopeSize / nbOfColumns;
+        const int end = jmax (first + 1, (column + 1) * AnalysisSnapshot::scopeSize / nbOfColumns);
+
+        float minimum = snapshot->scope[first];
+        float maximum = minimum;
+        for (int i = first + 1; i < end; ++i)
+        {
+            minimum = jmin (minimum, snapshot->scope[i]);
+            maximum = jmax (maximum, snapshot->scope[i]);
+        }
+
+        const float top = centre - jlimit (-1.0f, 1.0f, maximum) * halfHeight;
+        const float bottom = centre - jlimit (-1.0f, 1.0f, minimum) * halfHeight;
+        g.fillRect (area.getX() + column, top, 1.0f, jmax (1.0f, bottom - top));
+    }
+}
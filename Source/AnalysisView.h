@@ -0,0 +1,74 @@
+/*
+ ==============================================================================
+
+    AnalysisView.h
+    PlayMe - SignalProcessor
+    Live display of the analysis : spectrum, octave band meters and
+    oscilloscope. The view is rendered through an OpenGLContext, and through
+    JUCE's software renderer where no OpenGL context can be created
+
+ ==============================================================================
+ */
+
+#ifndef ANALYSISVIEW_H_INCLUDED
+#define ANALYSISVIEW_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "AnalysisSnapshot.h"
+
+// Define SIGNALPROCESSOR_OPENGL_VIEW to 0 to always use the software renderer
+#if ! defined (SIGNALPROCESSOR_OPENGL_VIEW)
+ #define SIGNALPROCESSOR_OPENGL_VIEW 1
+#endif
+
+//==============================================================================
+/**
+    Message thread only. The view does not copy the snapshots : it keeps a
+    reference to the reader's buffer of the processor's AnalysisSnapshotBuffer,
+    which does not change until the owner calls read() again. The owner must
+    call setSnapshot() after every successful read().
+    With OpenGL, JUCE paints the view on its render thread while holding the
+    message manager lock, so paint() never runs during a read()
+ */
+class AnalysisView  : public Component,
+                      private Timer
+{
+public:
+    AnalysisView();
+    ~AnalysisView();
+
+    void setSnapshot (const AnalysisSnapshot& newSnapshot);
+
+    void paint (Graphics&) override;
+
+private:
+    void timerCallback() override;
+
+    void paintSpectrum (Graphics&, const Rectangle<float>& area);
+    void paintBands (Graphics&, const Rectangle<float>& area);
+    void paintScope (Graphics&, const Rectangle<float>& area);
+
+    static float magnitudeToDecibels (float magnitude);
+
+    const AnalysisSnapshot* snapshot = nullptr;
+
+    // Peak hold of the band meters, in dB, falling by peakFallPerSnapshot every snapshot
+    float bandPeaks[AnalysisSnapshot::nbOfBands];
+
+    static const float minDecibels;
+    static const float maxDecibels;
+    static const float peakFallPerSnapshot;
+
+   #if SIGNALPROCESSOR_OPENGL_VIEW
+    // Checked by the timer : a context without a native one after openGLTimeout milliseconds of being
+    // shown is detached, and the view falls back to the software renderer
+    OpenGLContext openGLContext;
+    int shownMilliseconds = 0;
+    static const int openGLTimeout = 1000;
+    static const int openGLCheckInterval = 250;
+   #endif
+
+    JUCE_DECLARE_NON_COPYABLE (AnalysisView)
+};
+
+#endif  // ANALYSISVIEW_H_INCLUDED
@@ -0,0 +1,396 @@
+/*
+ ==============================================================================
+
+    OscControlServer.cpp
+    PlayMe - SignalProcessor
+    Receive OSC messages from a remote console, and turn them into parameter
+    changes for the processor
+
+ ==============================================================================
+ */
+
+#include "OscControlServer.h"
+#include "PluginProcessor.h"
+#include "osc/OscPacketListener.h"
+#include "ip/UdpSocket.h"                   // used to receive OSC
+#include <cstring>
+#include <cstdlib>
+
+//==============================================================================
+// Names accepted in the /sp/<channel>/param/<name> address. They are the same
+// as the attributes used to save the plugin's state
+static const struct
+{
+    const char* name;
+    int index;
+}
+remoteParameters[] =
+{
+    { "averagingBufferSize",            SignalProcessorAudioProcessor::averagingBufferSizeParam },
+    { "fftAveragingWindow",             SignalProcessorAudioProcessor::fftAveragingWindowParam },
+    { "inputSensitivity",               SignalProcessorAudioProcessor::inputSensitivityParam },
+    { "sendTimeInfo",                   SignalProcessorAudioProcessor::sendTimeInfoParam },
+    { "sendSignalLevel",                SignalProcessorAudioProcessor::sendSignalLevelParam },
+    { "sendSignalInstantVal",           SignalProcessorAudioProcessor::sendSignalInstantValParam },
+    { "sendImpulse",                    SignalProcessorAudioProcessor::sendImpulseParam },
+    { "sendFFT",                        SignalProcessorAudioProcessor::sendFFTParam },
+    { "monoStereo",                     SignalProcessorAudioProcessor::monoStereoParam },
+    { "logarithmicFFT",                 SignalProcessorAudioProcessor::logarithmicFFTParam },
+    { "averageEnergyBufferSize",        SignalProcessorAudioProcessor::averageEnergyBufferSizeParam },
+    { "sendOSC",                        SignalProcessorAudioProcessor::sendOSCParam },
+    { "sendBinaryUDP",                  SignalProcessorAudioProcessor::sendBinaryUDPParam },
+    { "instantSigValGain",              SignalProcessorAudioProcessor::instValGainParam },
+    { "instantSigValNbOfSamplesToSkip", SignalProcessorAudioProcessor::instValNbOfSamplesToSkipParam },
+    { "channelsPerGroup",               SignalProcessorAudioProcessor::channelsPerGroupParam },
+    { "sendMidi",                       SignalProcessorAudioProcessor::sendMidiParam },
+    { "analyseSidechain",               SignalProcessorAudioProcessor::analyseSidechainParam }
+};
+
+//==============================================================================
+/**
+    Several instances are usually loaded in the same session, all controlled
+    on the same port. A unicast datagram sent to a port bound by several
+    sockets (SO_REUSEADDR) is only delivered to one of them : the port is
+    bound once, by this listener, which dispatches every message to the
+    servers of the channel in its address.
+    It is created by the first server started, and destroyed with the last
+    one. An instance in another process cannot bind the port : remote control
+    is then unavailable for it
+ */
+class OscControlListener  : public osc::OscPacketListener,
+                            private Thread
+{
+public:
+    // Returns false if the port could not be bound
+    static bool add (OscControlServer* server, int port)
+    {
+        const ScopedLock lock (instanceLock);
+
+        if (instance == nullptr)
+        {
+            try
+            {
+                instance = new OscControlListener (port);
+            }
+            catch (const std::runtime_error&)
+            {
+                return false;
+            }
+        }
+
+        // Every instance of the plugin uses the same control port
+        jassert (instance->portNumber == port);
+
+        const ScopedLock serversLock (instance->serversLock);
+        instance->servers.add (server);
+        return true;
+    }
+
+    // When it returns, the listener does not call the server anymore
+    static void remove (OscControlServer* server)
+    {
+        const ScopedLock lock (instanceLock);
+
+        if (instance == nullptr)
+            return;
+
+        {
+            const ScopedLock serversLock (instance->serversLock);
+            instance->servers.removeFirstMatchingValue (server);
+
+            if (instance->servers.size() > 0)
+                return;
+        }
+
+        // Not deleteAndZero : the destructor is private
+        delete instance;
+        instance = nullptr;
+    }
+
+    void ProcessPacket (const char* data, int size, const IpEndpointName& remoteEndpoint) override
+    {
+        // A malformed packet must not stop the receive thread
+        try
+        {
+            osc::OscPacketListener::ProcessPacket (data, size, remoteEndpoint);
+        }
+        catch (const osc::Exception&)
+        {
+        }
+    }
+
+protected:
+    void ProcessMessage (const osc::ReceivedMessage& m, const IpEndpointName& /*remoteEndpoint*/) override
+    {
+        int addressChannel;
+        if (OscControlServer::parseChannel (m.AddressPattern(), "/", addressChannel) == nullptr)
+            return;
+
+        // Held while the message is handled : a server being removed waits for it
+        const ScopedLock lock (serversLock);
+
+        for (int i = 0; i < servers.size(); ++i)
+            if (servers.getUnchecked (i)->channel.load (std::memory_order_relaxed) == addressChannel)
+                servers.getUnchecked (i)->handleMessage (m);
+    }
+
+private:
+    explicit OscControlListener (int port)
+        : Thread ("SignalProcessor OSC control"),
+          portNumber (port)
+    {
+        // Throws if the port is already bound, by another process
+        socket.Bind (IpEndpointName (IpEndpointName::ANY_ADDRESS, portNumber));
+        multiplexer.AttachSocketListener (&socket, this);
+        startThread();
+    }
+
+    ~OscControlListener()
+    {
+        multiplexer.AsynchronousBreak();
+        stopThread (1000);
+        multiplexer.DetachSocketListener (&socket, this);
+    }
+
+    void run() override
+    {
+        // Blocks until AsynchronousBreak() is called by the destructor
+        multiplexer.Run();
+    }
+
+    const int portNumber;
+    UdpSocket socket;
+    SocketReceiveMultiplexer multiplexer;
+
+    CriticalSection serversLock;
+    Array<OscControlServer*> servers;
+
+    // Not held by the receive thread : the destructor can wait for it
+    static CriticalSection instanceLock;
+    static OscControlListener* instance;
+
+    JUCE_DECLARE_NON_COPYABLE (OscControlListener)
+};
+
+CriticalSection OscControlListener::instanceLock;
+OscControlListener* OscControlListener::instance = nullptr;
+
+//==============================================================================
+OscControlServer::OscControlServer (SignalProcessorAudioProcessor& owner, int port)
+    : processor (owner),
+      portNumber (port),
+      channel (0),
+      audioFifo (queueSize),
+      hostFifo (queueSize),
+      pendingTraceDump (0)
+{
+}
+
+OscControlServer::~OscControlServer()
+{
+    if (listening)
+        OscControlListener::remove (this);
+
+    cancelPendingUpdate();
+}
+
+//==============================================================================
+void OscControlServer::start()
+{
+    if (started)
+        return;
+
+    started = true;
+
+    // If the port could not be bound, remote control is simply unavailable for this instance
+    listening = OscControlListener::add (this, portNumber);
+}
+
+// The listener only hands over the messages addressed to this instance's channel
+void OscControlServer::handleMessage (const osc::ReceivedMessage& m)
+{
+    int addressChannel, stream;
+    if (parsePolicyAddress (m.AddressPattern(), addressChannel, stream))
+    {
+        applyPolicy (m, stream);
+        return;
+    }
+
+    if (parseTraceDumpAddress (m.AddressPattern(), addressChannel))
+    {
+        float seconds = (float) processor.defaultTraceDumpSeconds;
+        if (m.ArgumentCount() >= 1 && (! readArgument (m.ArgumentsBegin(), seconds) || seconds <= 0))
+            return;
+
+        // The file is written by the message thread
+        pendingTraceDump.store (seconds);
+        triggerAsyncUpdate();
+        return;
+    }
+
+    if (parseProbeAddress (m.AddressPattern(), addressChannel))
+    {
+        float enabled;
+        if (m.ArgumentCount() >= 1 && readArgument (m.ArgumentsBegin(), enabled))
+            processor.latencyProbe.store (enabled != 0);
+        return;
+    }
+
+    int parameterIndex;
+    if (! parseAddress (m.AddressPattern(), addressChannel, parameterIndex) || m.ArgumentCount() < 1)
+        return;
+
+    ParameterChange change;
+    change.index = parameterIndex;
+
+    if (! readArgument (m.ArgumentsBegin(), change.value))
+        return;
+
+    // If the audio thread is not running, the oldest changes stay in the queue : drop the new one
+    if (pushChange (audioFifo, audioQueue, change))
+    {
+        pushChange (hostFifo, hostQueue, change);
+        triggerAsyncUpdate();
+    }
+}
+
+bool OscControlServer::readArgument (osc::ReceivedMessage::const_iterator arg, float& value)
+{
+    if      (arg->IsFloat())    value = arg->AsFloatUnchecked();
+    else if (arg->IsInt32())    value = (float) arg->AsInt32Unchecked();
+    else if (arg->IsDouble())   value = (float) arg->AsDoubleUnchecked();
+    else if (arg->IsBool())     value = arg->AsBoolUnchecked() ? 1.0f : 0.0f;
+    else                        return false;
+
+    return true;
+}
+
+void OscControlServer::applyPolicy (const osc::ReceivedMessage& m, int stream)
+{
+    // Arguments : maxRateHz absoluteDeadband relativeDeadband keepAliveSeconds
+    float values[4];
+    if ((int) m.ArgumentCount() < numElementsInArray (values))
+        return;
+
+    osc::ReceivedMessage::const_iterator arg = m.ArgumentsBegin();
+    for (int i = 0; i < numElementsInArray (values); ++i, ++arg)
+        if (! readArgument (arg, values[i]) || values[i] < 0)
+            return;
+
+    // Every setting is atomic, read by the audio thread at every message
+    OutputPolicy& policy = processor.outputGates[stream].policy;
+    policy.maxRateHz.store (values[0]);
+    policy.absoluteDeadband.store (values[1]);
+    policy.relativeDeadband.store (values[2]);
+    policy.keepAliveSeconds.store (values[3]);
+}
+
+const char* OscControlServer::parseChannel (const char* address, const char* separator, int& addressChannel)
+{
+    static const char prefix[] = "/sp/";
+
+    if (std::strncmp (address, prefix, sizeof (prefix) - 1) != 0)
+        return nullptr;
+
+    const char* channelStart = address + sizeof (prefix) - 1;
+    char* channelEnd = nullptr;
+    addressChannel = (int) std::strtol (channelStart, &channelEnd, 10);
+
+    const size_t separatorLength = std::strlen (separator);
+    if (channelEnd == channelStart || std::strncmp (channelEnd, separator, separatorLength) != 0)
+        return nullptr;
+
+    return channelEnd + separatorLength;
+}
+
+bool OscControlServer::parsePolicyAddress (const char* address, int& addressChannel, int& stream)
+{
+    const char* name = parseChannel (address, "/policy/", addressChannel);
+    if (name == nullptr)
+        return false;
+
+    for (int i = 0; i < SignalProcessorAudioProcessor::totalNumOutputStreams; ++i)
+    {
+        if (std::strcmp (name, SignalProcessorAudioProcessor::getOutputStreamName (i)) == 0)
+        {
+            stream = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool OscControlServer::parseTraceDumpAddress (const char* address, int& addressChannel)
+{
+    const char* name = parseChannel (address, "/trace/", addressChannel);
+    return name != nullptr && std::strcmp (name, "dump") == 0;
+}
+
+bool OscControlServer::parseProbeAddress (const char* address, int& addressChannel)
+{
+    const char* rest = parseChannel (address, "/probe", addressChannel);
+    return rest != nullptr && *rest == 0;
+}
+
+bool OscControlServer::parseAddress (const char* address, int& addressChannel, int& parameterIndex)
+{
+    const char* name = parseChannel (address, "/param/", addressChannel);
+    if (name == nullptr)
+        return false;
+
+    for (int i = 0; i < numElementsInArray (remoteParameters); ++i)
+    {
+        if (std::strcmp (name, remoteParameters[i].name) == 0)
+        {
+            parameterIndex = remoteParameters[i].index;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+bool OscControlServer::popPendingChange (ParameterChange& change)
+{
+    return popChange (audioFifo, audioQueue, change);
+}
+
+void OscControlServer::handleAsyncUpdate()
+{
+    // Message thread : tell the host about the values the audio thread is applying
+    ParameterChange change;
+    while (popChange (hostFifo, hostQueue, change))
+        processor.notifyHostOfParameterChange (change.index, change.value);
+
+    const float traceDumpSeconds = pendingTraceDump.exchange (0);
+    if (traceDumpSeconds > 0)
+        processor.dumpTrace (traceDumpSeconds);
+}
+
+bool OscControlServer::pushChange (AbstractFifo& fifo, ParameterChange* queue, const ParameterChange& change)
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    queue[size1 > 0 ? start1 : start2] = change;
+    fifo.finishedWrite (1);
+    return true;
+}
+
+bool OscControlServer::popChange (AbstractFifo& fifo, const ParameterChange* queue, ParameterChange& change)
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead (1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    change = queue[size1 > 0 ? start1 : start2];
+    fifo.finishedRead (1);
+    return true;
+}
@@ -0,0 +1,113 @@
+/*
+ ==============================================================================
+
+    OscControlServer.h
+    PlayMe - SignalProcessor
+    Receive OSC messages from a remote console, and turn them into parameter
+    changes for the processor. Messages are expected to follow the pattern
+    /sp/<channel>/param/<name>, <name> being the parameter's state identifier
+    (ex: /sp/1/param/inputSensitivity 2.5)
+    Output policies are set with /sp/<channel>/policy/<stream>, followed by
+    maxRateHz absoluteDeadband relativeDeadband keepAliveSeconds
+    (ex: /sp/1/policy/signalLevel 30 0.001 0 1)
+    /sp/<channel>/trace/dump, optionally followed by a number of seconds,
+    writes the last trace events as a Chrome trace (ex: /sp/1/trace/dump 5)
+    /sp/<channel>/probe 1 stamps the impulse and signal level messages for
+    the latency probe, /sp/<channel>/probe 0 stops it (see LatencyProbe.h)
+
+ ==============================================================================
+ */
+
+#ifndef OSCCONTROLSERVER_H_INCLUDED
+#define OSCCONTROLSERVER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "osc/OscReceivedElements.h"        // used to parse the incoming OSC packets
+#include "osc/OscException.h"
+#include <atomic>
+
+class SignalProcessorAudioProcessor;
+class OscControlListener;
+
+//==============================================================================
+/**
+    The control port is bound once per process, by a listener shared by all
+    the instances : it receives the messages on its own thread and hands each
+    of them to the instances of the channel in its address. Every accepted
+    message is pushed in two lock-free queues :
+    - one read by the audio thread at the start of processBlock, where the
+      change is actually applied
+    - one read by the message thread, used to notify the host (and thus the
+      automation lanes / editor) of the new value
+ */
+class OscControlServer  : private AsyncUpdater
+{
+public:
+    OscControlServer (SignalProcessorAudioProcessor& owner, int portNumber);
+    ~OscControlServer();
+
+    // Register with the listener, which binds the port and starts its receive thread if it is the first
+    // instance. Called by prepareToPlay : only the first call does something
+    void start();
+
+    struct ParameterChange
+    {
+        int index;
+        float value;
+    };
+
+    // Called by the audio thread : returns false when no change is pending
+    bool popPendingChange (ParameterChange& change);
+
+    bool isListening() const                        { return listening; }
+
+    // The processor's channel, which the addresses are matched against. Called every time the channel changes,
+    // by any thread : the listener's thread reads this copy rather than the processor's
+    void setChannel (int newChannel)                { channel.store (newChannel, std::memory_order_relaxed); }
+
+private:
+    friend class OscControlListener;
+
+    // Called by the listener's thread, for the messages addressed to this instance's channel
+    void handleMessage (const osc::ReceivedMessage& m);
+    void handleAsyncUpdate() override;
+
+    static bool pushChange (AbstractFifo& fifo, ParameterChange* queue, const ParameterChange& change);
+    static bool popChange (AbstractFifo& fifo, const ParameterChange* queue, ParameterChange& change);
+
+    // Extract the channel and parameter index from an /sp/<channel>/param/<name> address
+    static bool parseAddress (const char* address, int& addressChannel, int& parameterIndex);
+    // Extract the channel and output stream from an /sp/<channel>/policy/<stream> address
+    static bool parsePolicyAddress (const char* address, int& addressChannel, int& stream);
+    // Returns what follows /sp/<channel><separator>, or nullptr if the address does not match
+    static const char* parseChannel (const char* address, const char* separator, int& addressChannel);
+
+    // Is the address /sp/<channel>/trace/dump
+    static bool parseTraceDumpAddress (const char* address, int& addressChannel);
+    // Is the address /sp/<channel>/probe
+    static bool parseProbeAddress (const char* address, int& addressChannel);
+
+    static bool readArgument (osc::ReceivedMessage::const_iterator arg, float& value);
+    void applyPolicy (const osc::ReceivedMessage& m, int stream);
+
+    SignalProcessorAudioProcessor& processor;
+
+    const int portNumber;
+    std::atomic<int> channel;
+    bool started = false;
+    bool listening = false;
+
+    // The console is not expected to send more than a few messages per block : 64 is plenty
+    static const int queueSize = 64;
+    AbstractFifo audioFifo;
+    AbstractFifo hostFifo;
+    ParameterChange audioQueue[queueSize];
+    ParameterChange hostQueue[queueSize];
+
+    // Trace dump requested by the console, in seconds (0 : none). The message thread writes the file
+    std::atomic<float> pendingTraceDump;
+
+    JUCE_DECLARE_NON_COPYABLE (OscControlServer)
+};
+
+#endif  // OSCCONTROLSERVER_H_INCLUDED
@@ -0,0 +1,142 @@
+/*
+ ==============================================================================
+
+    OutputPolicy.h
+    PlayMe - SignalProcessor
+    Per-stream output policy : limit the message rate, drop the messages whose
+    value did not change enough (deadband), and still send a message from time
+    to time so the receivers know the plugin is alive (keep-alive)
+    The policy is evaluated before the message is serialized, so a suppressed
+    message costs a few comparisons
+
+ ==============================================================================
+ */
+
+#ifndef OUTPUTPOLICY_H_INCLUDED
+#define OUTPUTPOLICY_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
+
+//==============================================================================
+/** The settings of one stream. 0 disables the corresponding rule, so a default
+    policy lets every message through
+    Written by the OSC control server and the message thread while the audio
+    thread reads them : every setting is atomic. For one message, the audio
+    thread may see a mix of the previous and new settings
+ */
+struct OutputPolicy
+{
+    std::atomic<float> maxRateHz        { 0 };  // Maximum number of messages per second
+    std::atomic<float> absoluteDeadband { 0 };  // Minimum change, in the stream's unit, since the last sent value
+    std::atomic<float> relativeDeadband { 0 };  // Minimum change, as a fraction of the last sent value (0.05 -> 5%)
+    std::atomic<float> keepAliveSeconds { 0 };  // Send a message at least this often, even if the value did not change
+};
+
+//==============================================================================
+/** Output state of one stream : the policy, the last value sent by every
+    signal (group of channels), and the sent / suppressed counters of all the
+    signals. Only used by the audio thread, except for the policy (written by
+    the OSC control server and setStateInformation) and the counters (read by
+    the message thread)
+ */
+class StreamOutputGate
+{
+public:
+    StreamOutputGate()
+        : nbOfMessagesSent (0),
+          nbOfMessagesSuppressed (0)
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        for (int signal = 0; signal < maxNbOfSignals; ++signal)
+        {
+            hasSent[signal] = false;
+            lastSentTime[signal] = 0;
+            for (int i = 0; i < maxNbOfValues; ++i)
+                lastSentValues[signal][i] = 0;
+        }
+    }
+
+    // Single value streams (signal level, instant value)
+    bool shouldSend (int signal, float value, int64 timeInSamples, double sampleRate)
+    {
+        return shouldSend (signal, &value, 1, timeInSamples, sampleRate);
+    }
+
+    // Multiple values streams (FFT bands) : the message is sent as soon as one band is out of the deadband.
+    // Above maxNbOfValues values (linear FFT), only the rate and keep-alive rules are applied.
+    // The rules apply to every signal on its own
+    bool shouldSend (int signal, const float* values, int nbOfValues, int64 timeInSamples, double sampleRate)
+    {
+        if (! hasSent[signal] || sampleRate <= 0)
+            return accept (signal, values, nbOfValues, timeInSamples);
+
+        const int64 elapsed = timeInSamples - lastSentTime[signal];
+
+        const float maxRateHz = policy.maxRateHz.load (std::memory_order_relaxed);
+        if (maxRateHz > 0 && elapsed < (int64) (sampleRate / maxRateHz))
+            return reject();
+
+        const float keepAliveSeconds = policy.keepAliveSeconds.load (std::memory_order_relaxed);
+        if (keepAliveSeconds > 0 && elapsed >= (int64) (sampleRate * keepAliveSeconds))
+            return accept (signal, values, nbOfValues, timeInSamples);
+
+        const float absoluteDeadband = policy.absoluteDeadband.load (std::memory_order_relaxed);
+        const float relativeDeadband = policy.relativeDeadband.load (std::memory_order_relaxed);
+        if (absoluteDeadband <= 0 && relativeDeadband <= 0)
+            return accept (signal, values, nbOfValues, timeInSamples);
+
+        if (nbOfValues > maxNbOfValues)
+            return accept (signal, values, nbOfValues, timeInSamples);
+
+        const float* const lastValues = lastSentValues[signal];
+        for (int i = 0; i < nbOfValues; ++i)
+        {
+            const float change = std::abs (values[i] - lastValues[i]);
+            if (change > absoluteDeadband
+                && change > relativeDeadband * std::abs (lastValues[i]))
+                return accept (signal, values, nbOfValues, timeInSamples);
+        }
+
+        return reject();
+    }
+
+    OutputPolicy policy;
+
+    // Number of messages sent / suppressed since the plugin was loaded. Only the audio thread writes
+    // them, so they are incremented with a relaxed load and store
+    std::atomic<uint64> nbOfMessagesSent;
+    std::atomic<uint64> nbOfMessagesSuppressed;
+
+    static const int maxNbOfValues  = 12;       // One per LogFFT band
+    static const int maxNbOfSignals = 17;       // One per group of channels analysed by the engine
+
+private:
+    bool accept (int signal, const float* values, int nbOfValues, int64 timeInSamples)
+    {
+        if (nbOfValues <= maxNbOfValues)
+            for (int i = 0; i < nbOfValues; ++i)
+                lastSentValues[signal][i] = values[i];
+
+        lastSentTime[signal] = timeInSamples;
+        hasSent[signal] = true;
+        nbOfMessagesSent.store (nbOfMessagesSent.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool reject()
+    {
+        nbOfMessagesSuppressed.store (nbOfMessagesSuppressed.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool hasSent[maxNbOfSignals];
+    int64 lastSentTime[maxNbOfSignals];
+    float lastSentValues[maxNbOfSignals][maxNbOfValues];
+};
+
+#endif  // OUTPUTPOLICY_H_INCLUDED
@@ -0,0 +1,322 @@
+/*
+ ==============================================================================
+
+    OutputTransport.cpp
+    PlayMe - SignalProcessor
+    Sockets used to send the messages, created on a background thread
+
+ ==============================================================================
+ */
+
+#include "OutputTransport.h"
+#include "TraceRecorder.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+#if defined (__linux__)
+ #include <linux/sockios.h>
+#endif
+
+//==============================================================================
+// The counters have a single writer : a relaxed load and store is enough, and cheaper than fetch_add
+template <typename Type>
+static inline void increment (std::atomic<Type>& counter, Type amount = 1)
+{
+    counter.store (counter.load (std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+// Bytes waiting in the socket's send queue, or 0 where the platform does not tell
+static uint32_t getSendQueueSize (int socket)
+{
+    int size = 0;
+   #if defined (SIOCOUTQ)
+    if (ioctl (socket, SIOCOUTQ, &size) != 0)
+        size = 0;
+   #elif defined (SO_NWRITE)
+    socklen_t length = sizeof (size);
+    if (getsockopt (socket, SOL_SOCKET, SO_NWRITE, &size, &length) != 0)
+        size = 0;
+   #endif
+    return size > 0 ? (uint32_t) size : 0;
+}
+
+static OutputTransport::SendError getSendError (int error)
+{
+    switch (error)
+    {
+        case EAGAIN:
+       #if EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+       #endif
+                            return OutputTransport::wouldBlockError;
+        case ENOBUFS:       return OutputTransport::noBufferError;
+        case ECONNREFUSED:  return OutputTransport::refusedError;
+        case ENETDOWN:
+        case ENETUNREACH:
+        case EHOSTDOWN:
+        case EHOSTUNREACH:  return OutputTransport::unreachableError;
+        case EMSGSIZE:      return OutputTransport::messageSizeError;
+        default:            return OutputTransport::otherError;
+    }
+}
+
+//==============================================================================
+/**
+    Creates the sockets of the transports waiting in its queue, one after the
+    other. The thread is started when a transport is queued and stops as soon
+    as the queue is empty : nothing is left running when no instance needs it
+ */
+class TransportOpener
+{
+public:
+    static TransportOpener& getInstance()
+    {
+        static TransportOpener instance;
+        return instance;
+    }
+
+    void add (OutputTransport* transport)
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        pending.push_back (transport);
+
+        if (! running)
+        {
+            running = true;
+            std::thread (&TransportOpener::run, this).detach();
+        }
+    }
+
+    // Called by the transport's destructor : when it returns, the opener does not use the transport anymore
+    void remove (OutputTransport* transport)
+    {
+        std::unique_lock<std::mutex> lock (mutex);
+        pending.erase (std::remove (pending.begin(), pending.end(), transport), pending.end());
+        transportRemoved.wait (lock, [&] { return current != transport; });
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock (mutex);
+
+        while (! pending.empty())
+        {
+            current = pending.front();
+            pending.pop_front();
+
+            lock.unlock();
+            current->createSockets();
+            lock.lock();
+
+            current = nullptr;
+            transportRemoved.notify_all();
+        }
+
+        running = false;
+    }
+
+    std::mutex mutex;
+    std::condition_variable transportRemoved;
+    std::deque<OutputTransport*> pending;
+    OutputTransport* current = nullptr;
+    bool running = false;
+};
+
+//==============================================================================
+OutputTransport::OutputTransport (const std::string& addr, const int* udpPorts, int osc)
+    : address (addr),
+      oscPort (osc),
+      opening (false),
+      ready (false),
+      failed (false)
+{
+    for (int i = 0; i < totalNumDestinations; ++i)
+    {
+        ports[i] = udpPorts[i];
+        clients[i] = nullptr;
+    }
+
+    for (int i = 0; i < totalNumCounters; ++i)
+    {
+        AtomicCounters& c = counters[i];
+        c.packets = 0;
+        c.bytes = 0;
+        c.notReadyDrops = 0;
+        c.oversizedDrops = 0;
+        c.partialSends = 0;
+        for (int j = 0; j < totalNumSendErrors; ++j)
+            c.errors[j] = 0;
+        c.queueHighWater = 0;
+        c.lastErrno = 0;
+    }
+}
+
+OutputTransport::~OutputTransport()
+{
+    if (isOpening())
+        TransportOpener::getInstance().remove (this);
+
+    for (int i = 0; i < totalNumDestinations; ++i)
+        delete clients[i];
+
+    delete oscSocket;
+}
+
+//==============================================================================
+void OutputTransport::open()
+{
+    bool expected = false;
+    if (opening.compare_exchange_strong (expected, true))
+        TransportOpener::getInstance().add (this);
+}
+
+void OutputTransport::createSockets()
+{
+    // Resolving the address may block (the address could be a host name) : this is why it is done here
+    try
+    {
+        for (int i = 0; i < totalNumDestinations; ++i)
+            clients[i] = new udp_client (address, ports[i]);
+
+        // A plain UDP client rather than an oscpack socket, whose Send() does not return the result
+        oscSocket = new udp_client (address, oscPort);
+    }
+    catch (const std::runtime_error&)
+    {
+        // The plugin keeps working without output, as it would with every output disabled
+        failed.store (true, std::memory_order_release);
+        return;
+    }
+
+    ready.store (true, std::memory_order_release);
+}
+
+//==============================================================================
+void OutputTransport::send (Destination destination, const char* data, size_t size)
+{
+    if (isReady())
+    {
+        SIGNALPROCESSOR_TRACE_SCOPE ("sendto", "bytes", (int32_t) size);
+        int result, error;
+        {
+            ScopedStageTimer timer (destination != statsDestination ? sendHistogram : nullptr);
+            result = clients[destination]->send (data, size);
+            error = result < 0 ? errno : 0;
+        }
+        recordSend (counters[destination], *clients[destination], result, error, size);
+    }
+    else
+    {
+        increment (counters[destination].notReadyDrops);
+    }
+}
+
+void OutputTransport::sendOSC (const char* data, size_t size)
+{
+    if (isReady())
+    {
+        SIGNALPROCESSOR_TRACE_SCOPE ("sendOSC", "bytes", (int32_t) size);
+        int result, error;
+        {
+            ScopedStageTimer timer (sendHistogram);
+            result = oscSocket->send (data, size);
+            error = result < 0 ? errno : 0;
+        }
+        recordSend (counters[oscCounters], *oscSocket, result, error, size);
+    }
+    else
+    {
+        increment (counters[oscCounters].notReadyDrops);
+    }
+}
+
+void OutputTransport::messageTooLarge (int counterIndex)
+{
+    increment (counters[counterIndex].oversizedDrops);
+}
+
+void OutputTransport::recordSend (AtomicCounters& c, const udp_client& client, int result, int error, size_t size)
+{
+    if (result == (int) size)
+    {
+        increment (c.packets);
+        increment (c.bytes, (uint64_t) size);
+
+        // The queue size costs a system call : only sample it
+        if (c.packets.load (std::memory_order_relaxed) % queueSampleInterval != 0)
+            return;
+    }
+    else if (result >= 0)
+    {
+        increment (c.partialSends);
+        increment (c.bytes, (uint64_t) result);
+    }
+    else
+    {
+        increment (c.errors[getSendError (error)]);
+        c.lastErrno.store (error, std::memory_order_relaxed);
+    }
+
+    const uint32_t queueSize = getSendQueueSize (client.get_socket());
+    uint32_t highWater = c.queueHighWater.load (std::memory_order_relaxed);
+    while (queueSize > highWater
+           && ! c.queueHighWater.compare_exchange_weak (highWater, queueSize, std::memory_order_relaxed))
+    {
+    }
+}
+
+//==============================================================================
+void OutputTransport::collectCounters (Counters* result)
+{
+    for (int i = 0; i < totalNumCounters; ++i)
+    {
+        AtomicCounters& c = counters[i];
+        Counters& r = result[i];
+        r.packets           = c.packets.load (std::memory_order_relaxed);
+        r.bytes             = c.bytes.load (std::memory_order_relaxed);
+        r.notReadyDrops     = c.notReadyDrops.load (std::memory_order_relaxed);
+        r.oversizedDrops    = c.oversizedDrops.load (std::memory_order_relaxed);
+        r.partialSends      = c.partialSends.load (std::memory_order_relaxed);
+        for (int j = 0; j < totalNumSendErrors; ++j)
+            r.errors[j]     = c.errors[j].load (std::memory_order_relaxed);
+        r.queueHighWater    = c.queueHighWater.exchange (0, std::memory_order_relaxed);
+        r.lastErrno         = c.lastErrno.load (std::memory_order_relaxed);
+    }
+}
+
+const char* OutputTransport::getCountersName (int counterIndex)
+{
+    switch (counterIndex)
+    {
+        case signalLevelDestination:        return "SignalLevel";
+        case signalInstantValDestination:   return "SignalInstantVal";
+        case impulseDestination:            return "Impulse";
+        case timeInfoDestination:           return "TimeInfo";
+        case fftDestination:                return "FFT";
+        case statsDestination:              return "Stats";
+        case midiEventDestination:          return "MidiEvent";
+        case oscCounters:                   return "OSC";
+        default:                            return "";
+    }
+}
+
+const char* OutputTransport::getSendErrorName (int error)
+{
+    switch (error)
+    {
+        case wouldBlockError:       return "EAGAIN";
+        case noBufferError:         return "ENOBUFS";
+        case refusedError:          return "ECONNREFUSED";
+        case unreachableError:      return "EHOSTUNREACH";
+        case messageSizeError:      return "EMSGSIZE";
+        case otherError:            return "other";
+        default:                    return "";
+    }
+}
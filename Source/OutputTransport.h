@@ -0,0 +1,147 @@
+/*
+ ==============================================================================
+
+    OutputTransport.h
+    PlayMe - SignalProcessor
+    Sockets used to send the messages : one UDP client per Protobuf message
+    type, and the OSC socket. They are created on a background thread the
+    first time an output is needed, so that loading the plugin never waits
+    for address resolution or socket creation. A single background thread
+    serves all the instances loaded in the process
+    The result of every send is counted per socket : packets, bytes, errors
+    by errno, and the occupancy of the socket's send queue
+
+ ==============================================================================
+ */
+
+#ifndef OUTPUTTRANSPORT_H_INCLUDED
+#define OUTPUTTRANSPORT_H_INCLUDED
+
+#include "udp_client_server.h"              // used to output Protobuf binary and OSC
+#include "PerformanceStats.h"               // used to time the sendto calls
+#include <atomic>
+#include <string>
+#include <stdint.h>
+
+//==============================================================================
+/**
+    Until the sockets are ready, the messages are silently dropped : the audio
+    thread never waits for the transport.
+    This class does not depend on JUCE, so it can be used by the benchmarks
+ */
+class OutputTransport
+{
+public:
+    enum Destination
+    {
+        signalLevelDestination = 0,
+        signalInstantValDestination,
+        impulseDestination,
+        timeInfoDestination,
+        fftDestination,
+        statsDestination,
+        midiEventDestination,
+        totalNumDestinations
+    };
+
+    // Index of the OSC socket's counters, after the Protobuf destinations
+    static const int oscCounters        = totalNumDestinations;
+    static const int totalNumCounters   = totalNumDestinations + 1;
+
+    // Why a send failed. The errno values are grouped : EAGAIN / EWOULDBLOCK, ENOBUFS (the interface
+    // queue is full : the usual sign of saturation), ECONNREFUSED, unreachable network or host,
+    // EMSGSIZE (datagram too large), and everything else
+    enum SendError
+    {
+        wouldBlockError = 0,
+        noBufferError,
+        refusedError,
+        unreachableError,
+        messageSizeError,
+        otherError,
+        totalNumSendErrors
+    };
+
+    // Counters of one socket, totals since the transport was created. queueHighWater is the largest
+    // send queue occupancy seen since the previous collectCounters() : it is sampled every
+    // queueSampleInterval packets and after every error
+    struct Counters
+    {
+        uint64_t packets;                           // Sent entirely
+        uint64_t bytes;
+        uint64_t notReadyDrops;                     // Dropped because the sockets were not open yet
+        uint64_t oversizedDrops;                    // Dropped because the message did not fit in its buffer
+        uint64_t partialSends;                      // sendto sent less than the message
+        uint64_t errors[totalNumSendErrors];
+        uint32_t queueHighWater;                    // Bytes
+        int lastErrno;                              // 0 until the first error
+    };
+
+    static const int queueSampleInterval = 16;
+
+    // udpPorts : one port per Destination
+    OutputTransport (const std::string& address, const int* udpPorts, int oscPort);
+    ~OutputTransport();
+
+    // Start creating the sockets in the background. Only the first call does something
+    void open();
+
+    bool isOpening() const      { return opening.load (std::memory_order_relaxed); }
+    bool isReady() const        { return ready.load (std::memory_order_acquire); }
+    bool hasFailed() const      { return failed.load (std::memory_order_acquire); }
+
+    // Called by the audio thread : do nothing until the sockets are ready
+    void send (Destination destination, const char* data, size_t size);
+    void sendOSC (const char* data, size_t size);
+
+    // Called by the thread which sends to the destination, when a message could not be serialized
+    void messageTooLarge (int counterIndex);
+
+    // Copies the counters of the totalNumCounters sockets. Called by the message thread : the counters
+    // only have one writer each (the audio thread, or the message thread for the stats destination),
+    // which updates them with relaxed atomic operations
+    void collectCounters (Counters* counters);
+
+    static const char* getCountersName (int counterIndex);
+    static const char* getSendErrorName (int error);
+
+    // Histogram of the duration of the sendto calls, or nullptr. Only the audio thread's calls are
+    // recorded : the stats, sent by the message thread, are not timed (the histogram has a single writer)
+    void setSendHistogram (LatencyHistogram* histogram)     { sendHistogram = histogram; }
+
+private:
+    friend class TransportOpener;
+    void createSockets();
+
+    struct AtomicCounters
+    {
+        std::atomic<uint64_t> packets;
+        std::atomic<uint64_t> bytes;
+        std::atomic<uint64_t> notReadyDrops;
+        std::atomic<uint64_t> oversizedDrops;
+        std::atomic<uint64_t> partialSends;
+        std::atomic<uint64_t> errors[totalNumSendErrors];
+        std::atomic<uint32_t> queueHighWater;
+        std::atomic<int> lastErrno;
+    };
+
+    void recordSend (AtomicCounters& counters, const udp_client& client, int result, int error, size_t size);
+
+    const std::string address;
+    int ports[totalNumDestinations];
+    const int oscPort;
+
+    udp_client* clients[totalNumDestinations];
+    udp_client* oscSocket = nullptr;
+    LatencyHistogram* sendHistogram = nullptr;
+    AtomicCounters counters[totalNumCounters];
+
+    std::atomic<bool> opening;
+    std::atomic<bool> ready;
+    std::atomic<bool> failed;
+
+    OutputTransport (const OutputTransport&) = delete;
+    OutputTransport& operator= (const OutputTransport&) = delete;
+};
+
+#endif  // OUTPUTTRANSPORT_H_INCLUDED
@@ -0,0 +1,138 @@
+/*
+ ==============================================================================
+
+    PerformanceStats.cpp
+    PlayMe - SignalProcessor
+    Lock-free latency histograms of the audio thread's stages
+
+ ==============================================================================
+ */
+
+#include "PerformanceStats.h"
+#include <algorithm>
+
+//==============================================================================
+LatencyHistogram::LatencyHistogram()
+    : intervalMax (0)
+{
+    for (int i = 0; i < nbOfBuckets; ++i)
+        counts[i].store (0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::copyCounts (uint32_t* destination) const
+{
+    for (int i = 0; i < nbOfBuckets; ++i)
+        destination[i] = counts[i].load (std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getBucketLowerBound (int bucket)
+{
+    if (bucket < 2 * nbOfSubBuckets)
+        return (uint64_t) bucket;
+
+    const int exponent = bucket / nbOfSubBuckets + subBucketBits - 1;
+    const int subBucket = bucket % nbOfSubBuckets;
+    return (uint64_t) (nbOfSubBuckets + subBucket) << (exponent - subBucketBits);
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound (int bucket)
+{
+    return bucket + 1 < nbOfBuckets ? getBucketLowerBound (bucket + 1) : getBucketLowerBound (bucket) * 2;
+}
+
+//==============================================================================
+const char* PerformanceStats::getStageName (int stage)
+{
+    switch (stage)
+    {
+        case processBlockStage:     return "processBlock";
+        case fftStage:              return "fft";
+        case serializationStage:    return "serialization";
+        case sendStage:             return "send";
+        default:                    return "";
+    }
+}
+
+PerformanceStats::PerformanceStats()
+    : lastUtilization (0), maxUtilization (0), xrunRiskCount (0), nbOfBlocks (0)
+{
+    for (int stage = 0; stage < totalNumStages; ++stage)
+        std::fill (previousCounts[stage], previousCounts[stage] + LatencyHistogram::nbOfBuckets, 0);
+}
+
+void PerformanceStats::blockProcessed (uint64_t nanoseconds, int nbOfSamples, double sampleRate)
+{
+    stages[processBlockStage].record (nanoseconds);
+
+    if (nbOfSamples <= 0 || sampleRate <= 0)
+        return;
+
+    const double utilization = nanoseconds * 1.0e-9 * sampleRate / nbOfSamples;
+    const uint32_t partsPerMillion = (uint32_t) std::min (utilization * 1.0e6, 4.0e9);
+
+    lastUtilization.store (partsPerMillion, std::memory_order_relaxed);
+    if (partsPerMillion > maxUtilization.load (std::memory_order_relaxed))
+        maxUtilization.store (partsPerMillion, std::memory_order_relaxed);
+
+    if (utilization > riskThreshold)
+        xrunRiskCount.store (xrunRiskCount.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    nbOfBlocks.store (nbOfBlocks.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+//==============================================================================
+PerformanceStats::Summary PerformanceStats::collect()
+{
+    Summary summary;
+    uint32_t counts[LatencyHistogram::nbOfBuckets];
+
+    for (int stage = 0; stage < totalNumStages; ++stage)
+    {
+        LatencyHistogram& histogram = stages[stage];
+        histogram.copyCounts (counts);
+
+        // Counts of the interval. The subtraction is right even when a count wrapped
+        uint32_t total = 0;
+        for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+        {
+            const uint32_t count = counts[i] - previousCounts[stage][i];
+            previousCounts[stage][i] = counts[i];
+            counts[i] = count;
+            total += count;
+        }
+
+        StageSummary& result = summary.stages[stage];
+        result.count = total;
+        result.max = histogram.takeIntervalMax() / 1000.0f;
+
+        if (total == 0)
+            continue;
+
+        // Middle of the bucket holding the percentile
+        const uint64_t ranks[2] = { (total + 1) / 2, total - total / 100 };
+        float* const values[2] = { &result.p50, &result.p99 };
+        uint64_t cumulated = 0;
+        int percentile = 0;
+
+        for (int i = 0; i < LatencyHistogram::nbOfBuckets && percentile < 2; ++i)
+        {
+            cumulated += counts[i];
+            while (percentile < 2 && cumulated >= ranks[percentile])
+            {
+                const uint64_t middle = (LatencyHistogram::getBucketLowerBound (i) + LatencyHistogram::getBucketUpperBound (i)) / 2;
+                *values[percentile++] = std::min (middle / 1000.0f, result.max);
+            }
+        }
+    }
+
+    const uint32_t risks = xrunRiskCount.load (std::memory_order_relaxed);
+    const uint32_t blocks = nbOfBlocks.load (std::memory_order_relaxed);
+    summary.xrunRiskCount = risks - previousXrunRiskCount;
+    summary.nbOfBlocks = blocks - previousNbOfBlocks;
+    previousXrunRiskCount = risks;
+    previousNbOfBlocks = blocks;
+
+    summary.deadlineUtilization = lastUtilization.load (std::memory_order_relaxed) * 1.0e-6f;
+    summary.maxDeadlineUtilization = maxUtilization.exchange (0, std::memory_order_relaxed) * 1.0e-6f;
+    return summary;
+}
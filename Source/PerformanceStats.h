@@ -0,0 +1,178 @@
+/*
+ ==============================================================================
+
+    PerformanceStats.h
+    PlayMe - SignalProcessor
+    Latency of the stages of the audio thread (processBlock, FFT,
+    serialization, sendto), measured in production : lock-free histograms
+    written by the audio thread, summarized by the message thread
+
+ ==============================================================================
+ */
+
+#ifndef PERFORMANCESTATS_H_INCLUDED
+#define PERFORMANCESTATS_H_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+
+//==============================================================================
+/**
+    Log-linear histogram of durations in nanoseconds : 8 buckets per power of
+    two (12.5% resolution), exact below 16 ns, up to 2^40 ns.
+    A single thread records (the audio thread) : record() only does relaxed
+    loads and stores, it never blocks nor allocates. Any other thread can read
+    the counts at the same time
+ */
+class LatencyHistogram
+{
+public:
+    static const int subBucketBits  = 3;
+    static const int nbOfSubBuckets = 1 << subBucketBits;
+    static const int maxExponent    = 40;
+    static const int nbOfBuckets    = (maxExponent - subBucketBits + 2) * nbOfSubBuckets;
+
+    LatencyHistogram();
+
+    void record (uint64_t nanoseconds)
+    {
+        std::atomic<uint32_t>& count = counts[getBucket (nanoseconds)];
+        count.store (count.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        uint64_t currentMax = intervalMax.load (std::memory_order_relaxed);
+        while (nanoseconds > currentMax
+               && ! intervalMax.compare_exchange_weak (currentMax, nanoseconds, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // Counts since the creation (they wrap after 2^32 values : use the difference between two copies)
+    void copyCounts (uint32_t* destination) const;
+
+    // Maximum since the previous call. Only one thread may call it
+    uint64_t takeIntervalMax()              { return intervalMax.exchange (0, std::memory_order_relaxed); }
+
+    // Below 2 * nbOfSubBuckets, one bucket per value. Above, the highest bit gives the power of two,
+    // and the next subBucketBits bits the bucket inside it
+    static int getBucket (uint64_t nanoseconds)
+    {
+        if (nanoseconds < 2 * nbOfSubBuckets)
+            return (int) nanoseconds;
+
+        const int exponent = 63 - __builtin_clzll (nanoseconds);
+        if (exponent > maxExponent)
+            return nbOfBuckets - 1;
+
+        const int subBucket = (int) (nanoseconds >> (exponent - subBucketBits)) & (nbOfSubBuckets - 1);
+        return (exponent - subBucketBits + 1) * nbOfSubBuckets + subBucket;
+    }
+
+    static uint64_t getBucketLowerBound (int bucket);
+    static uint64_t getBucketUpperBound (int bucket);     // Excluded
+
+private:
+    std::atomic<uint32_t> counts[nbOfBuckets];
+    std::atomic<uint64_t> intervalMax;
+
+    LatencyHistogram (const LatencyHistogram&) = delete;
+    LatencyHistogram& operator= (const LatencyHistogram&) = delete;
+};
+
+//==============================================================================
+// steady_clock : a vDSO call on Linux, mach_absolute_time on OS X, about 20 ns. The TSC would be cheaper,
+// but needs a calibration and is not monotonic across cores on every machine the plugin runs on
+inline uint64_t getMonotonicNanoseconds()
+{
+    return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds> (
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Records the duration of its scope. A null histogram disables it
+class ScopedStageTimer
+{
+public:
+    explicit ScopedStageTimer (LatencyHistogram* h)
+        : histogram (h), start (h != nullptr ? getMonotonicNanoseconds() : 0) {}
+
+    ~ScopedStageTimer()
+    {
+        if (histogram != nullptr)
+            histogram->record (getMonotonicNanoseconds() - start);
+    }
+
+private:
+    LatencyHistogram* const histogram;
+    const uint64_t start;
+
+    ScopedStageTimer (const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator= (const ScopedStageTimer&) = delete;
+};
+
+//==============================================================================
+/**
+    The stages of one plugin instance, and the deadline utilization of its
+    blocks : the processBlock duration divided by the duration of the audio
+    of the block. Above 1, the block was late; above riskThreshold, the host
+    has little time left for the other plugins and an xrun is likely
+ */
+class PerformanceStats
+{
+public:
+    enum Stage
+    {
+        processBlockStage = 0,
+        fftStage,
+        serializationStage,
+        sendStage,
+        totalNumStages
+    };
+
+    static const char* getStageName (int stage);
+
+    static constexpr float riskThreshold = 0.5f;
+
+    PerformanceStats();
+
+    LatencyHistogram& getHistogram (Stage stage)        { return stages[stage]; }
+
+    // Called by the audio thread at the end of processBlock, with the duration of the whole block
+    void blockProcessed (uint64_t nanoseconds, int nbOfSamples, double sampleRate);
+
+    //==============================================================================
+    struct StageSummary
+    {
+        uint32_t count = 0;
+        float p50 = 0, p99 = 0, max = 0;                // Microseconds
+    };
+
+    struct Summary
+    {
+        StageSummary stages[totalNumStages];
+        float deadlineUtilization = 0;                  // Last block
+        float maxDeadlineUtilization = 0;               // Of the interval
+        uint32_t xrunRiskCount = 0;                     // Blocks above riskThreshold
+        uint32_t nbOfBlocks = 0;
+    };
+
+    // Summary of the interval since the previous call. Only one thread may call it (the message thread)
+    Summary collect();
+
+private:
+    LatencyHistogram stages[totalNumStages];
+
+    std::atomic<uint32_t> lastUtilization;              // Parts per million
+    std::atomic<uint32_t> maxUtilization;
+    std::atomic<uint32_t> xrunRiskCount;
+    std::atomic<uint32_t> nbOfBlocks;
+
+    // Used by collect() only
+    uint32_t previousCounts[totalNumStages][LatencyHistogram::nbOfBuckets];
+    uint32_t previousXrunRiskCount = 0;
+    uint32_t previousNbOfBlocks = 0;
+
+    PerformanceStats (const PerformanceStats&) = delete;
+    PerformanceStats& operator= (const PerformanceStats&) = delete;
+};
+
+#endif  // PERFORMANCESTATS_H_INCLUDED
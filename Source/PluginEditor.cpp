@@ -37,8 +37,10 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
       sendFFTButton("Send Signal FFT"),
       monoStereoButton ("Stereo Processing"),
       logarithmicFFTButton("Logarithmic FFT"),
+      sendMidiButton("Send MIDI"),
       sendOSCButton("Send OSC Data"),
       sendBinaryUDPButton("Send UDP Data"),
+      analyseSidechainButton("Analyse Sidechain"),
       sendTimeInfoButtonLabel ("", "Send Time Info"),
       sendSignalLevelButtonLabel ("", "Send Signal Level"),
       sendSignalInstantValButtonLabel ("", "Send Signal Instant Value"),
@@ -46,17 +48,22 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
       sendFFTButtonLabel ("", "Send Signal FFT "),
       monoStereoButtonLabel ("", "Stereo Processing"),
       logarithmicFFTButtonLabel("", "Logarithmic FFT"),
+      sendMidiButtonLabel ("", "Send MIDI"),
       sendOSCButtonLabel ("", "Send Data Using OSC"),
       sendBinaryUDPButtonLabel ("", "Send Data Using UDP"),
+      analyseSidechainButtonLabel ("", "Analyse Sidechain"),
       logoButton("PlayMe Signal Processor"),
+      dumpTraceButton("Dump Trace"),
       channelComboBox ("channel"),
+      channelsPerGroupComboBox ("channelsPerGroup"),
+      channelsPerGroupLabel ("", "Channels Per Group"),
       bigFont("standard 07_57", 45.0f, 0),
       pluginFont("standard 07_57", 25.0f, 0),
       smallFont("standard 07_57", 15.0f, 0)
 {
     
     // This is where our plugin's editor size is set.
-    setSize (500, 444);
+    setSize (500, 674);
     
     slaf = new SquareLookAndFeel();
     setupSquareLookAndFeelColours (*slaf);
@@ -176,11 +183,20 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
     logarithmicFFTButton.setButtonText("");
     logarithmicFFTButton.setTooltip("Check this to reorganize the FFT in a logarithmic way, as well as normalize its values (the frequency band with the max intensity will have its intensity equal to 1). If unchecked, the message contains all 2048 bands. If checked, the message contains 12 bands :\n11025 to 22050 Hz\n5512 to 11025 Hz\n2756 to 5512 Hz\n1378 to 2756 Hz\n689 to 1378 Hz\n344 to 689 Hz\n172 to 344 Hz\n86 to 172 Hz\n43 to 86 Hz\n22 to 43 Hz\n11 to 22 Hz\n0 to 11 Hz");
     
+    addAndMakeVisible (sendMidiButton);
+    sendMidiButton.setLookAndFeel(slaf);
+    sendMidiButton.addListener (this);
+    sendMidiButton.changeWidthToFitText();
+    sendMidiButton.setBounds (getWidth() - 50, 324, 18, 18);
+    sendMidiButton.setColour (Label::textColourId, Colours::white);
+    sendMidiButton.setButtonText("");
+    sendMidiButton.setTooltip("Check this to forward the MIDI events of this track (ex: lighting cues), with their position in the block and on the DAW's timeline. The events of a block are sent together, just before the analysis of the same block. Port " + String(getProcessor().portNumberMidiEvent) + ", or the OSC MIDI message");
+    
     addAndMakeVisible (sendOSCButton);
     sendOSCButton.setLookAndFeel(slaf);
     sendOSCButton.addListener (this);
     sendOSCButton.changeWidthToFitText();
-    sendOSCButton.setBounds (getWidth() - 50, 352, 18, 18);
+    sendOSCButton.setBounds (getWidth() - 50, 374, 18, 18);
     sendOSCButton.setColour (Label::textColourId, Colours::white);
     sendOSCButton.setButtonText("");
     sendOSCButton.setTooltip("Check this to consider the input source as a stereo source for the signal level analysis. To use less resources, the default behaviour only checks the left input. Considering your source stereo is only useful if you have very agressive left/right panning effects");
@@ -189,11 +205,19 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
     sendBinaryUDPButton.setLookAndFeel(slaf);
     sendBinaryUDPButton.addListener (this);
     sendBinaryUDPButton.changeWidthToFitText();
-    sendBinaryUDPButton.setBounds (getWidth() - 50, 374, 18, 18);
+    sendBinaryUDPButton.setBounds (getWidth() - 50, 396, 18, 18);
     sendBinaryUDPButton.setColour (Label::textColourId, Colours::white);
     sendBinaryUDPButton.setButtonText("");
-    sendBinaryUDPButton.setTooltip("Send data using raw binary UDP. This is the most effective way to use this plugin. The following ports are used by this plugin :\nSignal level: " + String(getProcessor().portNumberSignalLevel) + ". Signal instant value: " + String(getProcessor().portNumberSignalInstantVal) + ". Impulse: " + String(getProcessor().portNumberImpulse) + ". TimeInfo: " + String(getProcessor().portNumberTimeInfo) + ". FFT Data: " + String(getProcessor().portNumberFFT));
+    sendBinaryUDPButton.setTooltip("Send data using raw binary UDP. This is the most effective way to use this plugin. The following ports are used by this plugin :\nSignal level: " + String(getProcessor().portNumberSignalLevel) + ". Signal instant value: " + String(getProcessor().portNumberSignalInstantVal) + ". Impulse: " + String(getProcessor().portNumberImpulse) + ". TimeInfo: " + String(getProcessor().portNumberTimeInfo) + ". FFT Data: " + String(getProcessor().portNumberFFT) + ". Stats: " + String(getProcessor().portNumberStats) + ". MIDI events: " + String(getProcessor().portNumberMidiEvent));
 
+    addAndMakeVisible (analyseSidechainButton);
+    analyseSidechainButton.setLookAndFeel(slaf);
+    analyseSidechainButton.addListener (this);
+    analyseSidechainButton.changeWidthToFitText();
+    analyseSidechainButton.setBounds (150, 418, 18, 18);
+    analyseSidechainButton.setColour (Label::textColourId, Colours::white);
+    analyseSidechainButton.setButtonText("");
+    analyseSidechainButton.setTooltip("Check this to also analyse the sidechain input, if the host connects one, as one more group. Its features are sent with the signal ID Channel Number + 256, whatever Channels Per Group");
     
     sendTimeInfoButton.setToggleState(getProcessor().sendTimeInfo, dontSendNotification);
     sendSignalLevelButton.setToggleState(getProcessor().sendSignalLevel, dontSendNotification);
@@ -202,8 +226,10 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
     sendFFTButton.setToggleState(getProcessor().sendFFT, dontSendNotification);
     monoStereoButton.setToggleState(getProcessor().monoStereo, dontSendNotification);
     logarithmicFFTButton.setToggleState(getProcessor().logarithmicFFT, dontSendNotification);
+    sendMidiButton.setToggleState(getProcessor().sendMidi, dontSendNotification);
     sendOSCButton.setToggleState(getProcessor().sendOSC, dontSendNotification);
     sendBinaryUDPButton.setToggleState(getProcessor().sendBinaryUDP, dontSendNotification);
+    analyseSidechainButton.setToggleState(getProcessor().analyseSidechain, dontSendNotification);
 
     sendTimeInfoButtonLabel.attachToComponent (&sendTimeInfoButton, true);
     sendTimeInfoButtonLabel.setFont(smallFont);
@@ -226,12 +252,18 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
     logarithmicFFTButtonLabel.attachToComponent (&logarithmicFFTButton, true);
     logarithmicFFTButtonLabel.setFont(smallFont);
     logarithmicFFTButtonLabel.setColour(Label::textColourId, Colours::white);
+    sendMidiButtonLabel.attachToComponent (&sendMidiButton, true);
+    sendMidiButtonLabel.setFont(smallFont);
+    sendMidiButtonLabel.setColour(Label::textColourId, Colours::white);
     sendOSCButtonLabel.attachToComponent (&sendOSCButton, true);
     sendOSCButtonLabel.setFont(smallFont);
     sendOSCButtonLabel.setColour(Label::textColourId, Colours::white);
     sendBinaryUDPButtonLabel.attachToComponent (&sendBinaryUDPButton, true);
     sendBinaryUDPButtonLabel.setFont(smallFont);
     sendBinaryUDPButtonLabel.setColour(Label::textColourId, Colours::white);
+    analyseSidechainButtonLabel.attachToComponent (&analyseSidechainButton, true);
+    analyseSidechainButtonLabel.setFont(smallFont);
+    analyseSidechainButtonLabel.setColour(Label::textColourId, Colours::white);
     
     addAndMakeVisible(channelComboBox);
     channelComboBox.setBounds (20, 185, 150, 20);
@@ -244,6 +276,22 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
     channelComboBox.addListener (this);
     channelComboBox.setLookAndFeel(slaf);
     
+    // Item 1 : the main input is one signal, item n + 1 : every n channels are one signal
+    addAndMakeVisible(channelsPerGroupComboBox);
+    channelsPerGroupComboBox.setBounds (getWidth() - 92, 348, 60, 18);
+    channelsPerGroupComboBox.setEditableText (false);
+    channelsPerGroupComboBox.setJustificationType (Justification::centred);
+    channelsPerGroupComboBox.addItem ("Off", 1);
+    for (int i = 1; i <= getProcessor().maxChannelsPerGroup; ++i)
+        channelsPerGroupComboBox.addItem (String (i), i + 1);
+    channelsPerGroupComboBox.setSelectedId (getProcessor().channelsPerGroup + 1, dontSendNotification);
+    channelsPerGroupComboBox.addListener (this);
+    channelsPerGroupComboBox.setLookAndFeel(slaf);
+    channelsPerGroupComboBox.setTooltip("Analyse the channels of a multichannel input (a stem bus) in groups of this size, every group being sent with its own signal IDs : Channel Number for the first group, then Channel Number + 16, Channel Number + 32, and so on. Off : the input is analysed as one signal, see Stereo Processing. See Analyse Sidechain for a sidechain input");
+    channelsPerGroupLabel.attachToComponent (&channelsPerGroupComboBox, true);
+    channelsPerGroupLabel.setFont(smallFont);
+    channelsPerGroupLabel.setColour(Label::textColourId, Colours::white);
+    
     // add some labels for the sliders..
     averagingBufferLabel.attachToComponent (&averagingBufferSlider, false);
     averagingBufferLabel.setFont(smallFont);
@@ -298,17 +346,62 @@ SignalProcessorAudioProcessorEditor::SignalProcessorAudioProcessorEditor (Signal
     infoLabel.setFont(smallFont);
     infoLabel.setCentrePosition(getWidth()/2, getHeight() - 40);
     
-    startTimer (20);
+    // the last seconds of trace events, written as a Chrome trace
+    addAndMakeVisible (dumpTraceButton);
+    dumpTraceButton.addListener (this);
+    dumpTraceButton.setBounds (getWidth() - 130, 418, 110, 18);
+    dumpTraceButton.setTooltip("Write the last " + String(getProcessor().defaultTraceDumpSeconds, 0) + " seconds of processing (processBlock, FFT, sends) in Documents/SignalProcessor Traces, to be opened with chrome://tracing or ui.perfetto.dev");
+    
+    // the spectrum, band meters and scope, updated with every analysis snapshot
+    addAndMakeVisible (analysisView);
+    analysisView.setBounds (20, 442, getWidth() - 40, 150);
+    
+    // add a label that will display the latency of the processing stages and the transport counters, updated once per second
+    addAndMakeVisible (statsLabel);
+    statsLabel.setColour (Label::textColourId, Colours::white);
+    statsLabel.setFont(smallFont);
+    statsLabel.setJustificationType(Justification::centred);
+    statsLabel.setBounds (20, getHeight() - 78, getWidth() - 40, 48);
+    
+    // The background is cached in an image : the editor paints everything under its bounds
+    setOpaque (true);
+    
+    // The controls are only updated when the processor flags a parameter change, and the stats label when
+    // it notifies new stats
+    getProcessor().statsChanges.addChangeListener (this);
+    updateTimer();
     
 }
 
 SignalProcessorAudioProcessorEditor::~SignalProcessorAudioProcessorEditor()
 {
+    getProcessor().statsChanges.removeChangeListener (this);
     delete(slaf);
 }
 
 //==============================================================================
 void SignalProcessorAudioProcessorEditor::paint (Graphics& g)
+{
+    const float scale = (float) Desktop::getInstance().getDisplays().getDisplayContaining (getScreenBounds().getCentre()).scale;
+    
+    if (background.isNull() || scale != backgroundScale
+        || background.getWidth() != roundToInt (getWidth() * scale) || background.getHeight() != roundToInt (getHeight() * scale))
+    {
+        // Rendered at the resolution of the display, so that the text stays sharp on high density screens
+        backgroundScale = scale;
+        background = Image (Image::RGB, roundToInt (getWidth() * scale), roundToInt (getHeight() * scale), false);
+        Graphics backgroundGraphics (background);
+        backgroundGraphics.addTransform (AffineTransform::scale (scale));
+        paintBackground (backgroundGraphics);
+    }
+    
+    g.drawImageTransformed (background, AffineTransform::scale (1.0f / backgroundScale));
+    
+    g.setColour(Colours::red);
+    g.fillEllipse(getWidth()/2 + (1.0 - lastDisplayedBeatIntensity)*20, beatIndicatorY + (1.0 - lastDisplayedBeatIntensity)*20, lastDisplayedBeatIntensity*40, lastDisplayedBeatIntensity*40);
+}
+
+void SignalProcessorAudioProcessorEditor::paintBackground (Graphics& g)
 {
     
     g.setGradientFill (ColourGradient (Colours::grey, 0, 0,
@@ -328,9 +421,6 @@ void SignalProcessorAudioProcessorEditor::paint (Graphics& g)
     g.drawFittedText ("This plugin is to be used together with Strobot",
                       0, getHeight()/2 - 20, getWidth(), getHeight(),
                       Justification::centred, 1);
-    
-    g.setColour(Colours::red);
-    g.fillEllipse(getWidth()/2 + (1.0 - lastDisplayedBeatIntensity)*20, getHeight()/2 + 30 + (1.0 - lastDisplayedBeatIntensity)*20, lastDisplayedBeatIntensity*40, lastDisplayedBeatIntensity*40);
 
 }
 
@@ -339,25 +429,109 @@ void SignalProcessorAudioProcessorEditor::paint (Graphics& g)
 // This timer periodically checks whether any of the filter's parameters have changed...
 void SignalProcessorAudioProcessorEditor::timerCallback()
 {
+    updateTimer();
+    if (! isShowing())
+        return;
+    
     SignalProcessorAudioProcessor& ourProcessor = getProcessor();
     
-    AudioPlayHead::CurrentPositionInfo newPos (ourProcessor.lastPosInfo);
+    if (ourProcessor.parametersChanged.exchange (false, std::memory_order_acquire))
+        displayParameters();
     
-    if (lastDisplayedPosition != newPos)
-        displayPositionInfo (newPos);
+    // The position and the beat intensity come from the snapshots the audio thread publishes :
+    // reading the processor's own variables would race with it
+    if (ourProcessor.analysisSnapshots.read())
+    {
+        const AnalysisSnapshot& snapshot = ourProcessor.analysisSnapshots.getReadBuffer();
+        analysisView.setSnapshot (snapshot);
+        
+        if (lastDisplayedPosition != snapshot.position)
+            displayPositionInfo (snapshot.position);
+        
+        if (lastDisplayedBeatIntensity != snapshot.beatIntensity) {
+            lastDisplayedBeatIntensity = snapshot.beatIntensity;
+            repaint (getWidth()/2, beatIndicatorY, 41, 41);
+        }
+    }
+}
+
+// Hidden editors (closed, minimized or in a hidden tab of the host) keep their timer at hiddenCheckInterval,
+// and only do the updates they missed when they are shown again
+void SignalProcessorAudioProcessorEditor::updateTimer()
+{
+    if (isShowing())
+    {
+        if (getTimerInterval() != frameInterval)
+        {
+            startTimer (frameInterval);
+            applyPendingChanges();
+        }
+    }
+    else if (getTimerInterval() != hiddenCheckInterval)
+    {
+        startTimer (hiddenCheckInterval);
+    }
+}
+
+void SignalProcessorAudioProcessorEditor::visibilityChanged()
+{
+    updateTimer();
+}
+
+void SignalProcessorAudioProcessorEditor::parentHierarchyChanged()
+{
+    updateTimer();
+}
+
+void SignalProcessorAudioProcessorEditor::changeListenerCallback (ChangeBroadcaster* source)
+{
+    if (source == &getProcessor().statsChanges)
+        statsChanged = true;
     
-    //To be set later, to update any parameter !!!
-    averagingBufferSlider.setValue (ourProcessor.averagingBufferSize, dontSendNotification);
-    inputSensitivitySlider.setValue (ourProcessor.inputSensitivity, dontSendNotification);
-    fftAveragingWindowSlider.setValue (ourProcessor.fftAveragingWindow, dontSendNotification);
+    if (isShowing())
+        applyPendingChanges();
+}
+
+void SignalProcessorAudioProcessorEditor::applyPendingChanges()
+{
+    if (getProcessor().parametersChanged.exchange (false, std::memory_order_acquire))
+        displayParameters();
     
-    float newBeatIntensity = ourProcessor.beatIntensity;
-    if (lastDisplayedBeatIntensity != newBeatIntensity) {
-        lastDisplayedBeatIntensity = newBeatIntensity;
-        repaint();
+    if (statsChanged)
+    {
+        statsChanged = false;
+        displayStats (getProcessor().lastStats);
     }
 }
 
+// The parameters can be changed by the host's automation, the remote console or a restored state
+void SignalProcessorAudioProcessorEditor::displayParameters()
+{
+    const SignalProcessorAudioProcessor& ourProcessor = getProcessor();
+    
+    averagingBufferSlider.setValue (ourProcessor.averagingBufferSize, dontSendNotification);
+    fftAveragingWindowSlider.setValue (ourProcessor.fftAveragingWindow, dontSendNotification);
+    inputSensitivitySlider.setValue (ourProcessor.inputSensitivity, dontSendNotification);
+    beatDetectionWindowSlider.setValue (ourProcessor.averageEnergyBufferSize, dontSendNotification);
+    instantSigValGainSlider.setValue (ourProcessor.instantSigValGain, dontSendNotification);
+    instantSigValNbOfSamplesToSkipSlider.setValue (ourProcessor.instantSigValNbOfSamplesToSkip, dontSendNotification);
+    
+    sendTimeInfoButton.setToggleState (ourProcessor.sendTimeInfo, dontSendNotification);
+    sendSignalLevelButton.setToggleState (ourProcessor.sendSignalLevel, dontSendNotification);
+    sendSignalInstantValButton.setToggleState (ourProcessor.sendSignalInstantVal, dontSendNotification);
+    sendImpulseButton.setToggleState (ourProcessor.sendImpulse, dontSendNotification);
+    sendFFTButton.setToggleState (ourProcessor.sendFFT, dontSendNotification);
+    monoStereoButton.setToggleState (ourProcessor.monoStereo, dontSendNotification);
+    logarithmicFFTButton.setToggleState (ourProcessor.logarithmicFFT, dontSendNotification);
+    sendMidiButton.setToggleState (ourProcessor.sendMidi, dontSendNotification);
+    sendOSCButton.setToggleState (ourProcessor.sendOSC, dontSendNotification);
+    sendBinaryUDPButton.setToggleState (ourProcessor.sendBinaryUDP, dontSendNotification);
+    analyseSidechainButton.setToggleState (ourProcessor.analyseSidechain, dontSendNotification);
+    
+    channelComboBox.setSelectedId (ourProcessor.channel, dontSendNotification);
+    channelsPerGroupComboBox.setSelectedId (ourProcessor.channelsPerGroup + 1, dontSendNotification);
+}
+
 // This is our Slider::Listener callback, when the user drags a slider.
 void SignalProcessorAudioProcessorEditor::sliderValueChanged (Slider* slider)
 {
@@ -435,6 +609,11 @@ void SignalProcessorAudioProcessorEditor::buttonClicked (Button* button)
         getProcessor().setParameterNotifyingHost (SignalProcessorAudioProcessor::sendFFTParam,
                                                   button->getToggleState());
     }
+    else if (button == &sendMidiButton)
+    {
+        getProcessor().setParameterNotifyingHost (SignalProcessorAudioProcessor::sendMidiParam,
+                                                  button->getToggleState());
+    }
     else if (button == &sendOSCButton)
     {
         getProcessor().setParameterNotifyingHost (SignalProcessorAudioProcessor::sendOSCParam,
@@ -445,6 +624,19 @@ void SignalProcessorAudioProcessorEditor::buttonClicked (Button* button)
         getProcessor().setParameterNotifyingHost (SignalProcessorAudioProcessor::sendBinaryUDPParam,
                                                   button->getToggleState());
     }
+    else if (button == &analyseSidechainButton)
+    {
+        getProcessor().setParameterNotifyingHost (SignalProcessorAudioProcessor::analyseSidechainParam,
+                                                  button->getToggleState());
+    }
+    else if (button == &dumpTraceButton)
+    {
+        const File trace (getProcessor().dumpTrace (getProcessor().defaultTraceDumpSeconds));
+        if (trace.exists())
+            AlertWindow::showMessageBoxAsync (AlertWindow::InfoIcon, "Trace", "The trace was written to " + trace.getFullPathName());
+        else
+            AlertWindow::showMessageBoxAsync (AlertWindow::WarningIcon, "Trace", "The trace could not be written");
+    }
 }
 
 void SignalProcessorAudioProcessorEditor::comboBoxChanged (ComboBox* comboBox)
@@ -454,6 +646,10 @@ void SignalProcessorAudioProcessorEditor::comboBoxChanged (ComboBox* comboBox)
     {
         getProcessor().setParameterNotifyingHost (SignalProcessorAudioProcessor::channelParam, comboBox-> getSelectedId());
     }
+    else if (comboBox == &channelsPerGroupComboBox)
+    {
+        getProcessor().setParameterNotifyingHost (SignalProcessorAudioProcessor::channelsPerGroupParam, comboBox->getSelectedId() - 1);
+    }
     
 }
 
@@ -565,5 +761,64 @@ void SignalProcessorAudioProcessorEditor::displayPositionInfo (const AudioPlayHe
     infoLabel.setText ("[" + SystemStats::getJUCEVersion() + "]   " + displayText, dontSendNotification);
 }
 
+// Updates the text in our stats label : p50/p99/max of every stage, then the deadline utilization,
+// then what the sockets did during the last interval
+void SignalProcessorAudioProcessorEditor::displayStats (const PerformanceStats::Summary& stats)
+{
+    const SignalProcessorAudioProcessor& ourProcessor = getProcessor();
+    String displayText;
+    displayText.preallocateBytes (256);
+    
+    for (int i = 0; i < PerformanceStats::totalNumStages; ++i)
+    {
+        const PerformanceStats::StageSummary& stage = stats.stages[i];
+        displayText << PerformanceStats::getStageName (i) << " "
+        << String (stage.p50, 0) << "/" << String (stage.p99, 0) << "/" << String (stage.max, 0) << "  ";
+    }
+    
+    displayText << "us\n"
+    << "Deadline " << String (stats.deadlineUtilization * 100.0f, 1) << "% (max "
+    << String (stats.maxDeadlineUtilization * 100.0f, 1) << "%)  -  "
+    << (int) stats.xrunRiskCount << " of " << (int) stats.nbOfBlocks << " blocks at risk";
+    
+    // Differences with the previous collection, summed over the sockets
+    const SignalProcessorAudioProcessor::OutputCounters& current = ourProcessor.outputCounters;
+    const SignalProcessorAudioProcessor::OutputCounters& previous = ourProcessor.previousOutputCounters;
+    uint64 packets = 0, bytes = 0, drops = 0, suppressed = 0, queueHighWater = 0;
+    uint64 errors[OutputTransport::totalNumSendErrors] = {};
+    for (int i = 0; i < OutputTransport::totalNumCounters; ++i)
+    {
+        const OutputTransport::Counters& c = current.transports[i];
+        const OutputTransport::Counters& p = previous.transports[i];
+        packets += c.packets - p.packets;
+        bytes   += c.bytes - p.bytes;
+        drops   += (c.notReadyDrops - p.notReadyDrops) + (c.oversizedDrops - p.oversizedDrops)
+                 + (c.partialSends - p.partialSends);
+        for (int j = 0; j < OutputTransport::totalNumSendErrors; ++j)
+            errors[j] += c.errors[j] - p.errors[j];
+        queueHighWater = jmax (queueHighWater, (uint64) c.queueHighWater);
+    }
+    for (int i = 0; i < SignalProcessorAudioProcessor::totalNumOutputStreams; ++i)
+        suppressed += current.suppressed[i] - previous.suppressed[i];
+    
+    uint64 nbOfErrors = 0;
+    int mostFrequentError = 0;
+    for (int j = 0; j < OutputTransport::totalNumSendErrors; ++j)
+    {
+        nbOfErrors += errors[j];
+        if (errors[j] > errors[mostFrequentError])
+            mostFrequentError = j;
+    }
+    
+    displayText << "\nSent " << (int64) packets << " msgs, " << String (bytes / 1024.0, 1) << " kB  -  "
+    << (int64) nbOfErrors << " errors";
+    if (nbOfErrors > 0)
+        displayText << " (" << OutputTransport::getSendErrorName (mostFrequentError) << ")";
+    displayText << "  -  " << (int64) drops << " dropped, " << (int64) suppressed << " suppressed  -  "
+    << "queue max " << (int64) queueHighWater << " B";
+    
+    statsLabel.setText (displayText, dontSendNotification);
+}
+
                                          
                                          
@@ -13,6 +13,7 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "PluginProcessor.h"
+#include "AnalysisView.h"
 
 #include <fstream>
 
@@ -26,6 +27,7 @@ class SignalProcessorAudioProcessorEditor  : public AudioProcessorEditor,
                                              public ComboBoxListener,
                                              public ButtonListener,
                                              public TextEditor::Listener,
+                                             public ChangeListener,
                                              public Timer
 {
 public:
@@ -35,6 +37,9 @@ public:
     
     //==============================================================================
     void timerCallback() override;
+    void changeListenerCallback (ChangeBroadcaster* source) override;
+    void visibilityChanged() override;
+    void parentHierarchyChanged() override;
     void paint (Graphics&) override;
     //void resized() override;
     void sliderValueChanged (Slider*) override;
@@ -52,16 +57,36 @@ private:
     Label infoLabel, averagingBufferLabel, fftAveragingWindowLabel, inputSensitivityLabel, beatDetectionWindowLabel, channelLabel, instantSigValGainLabel, instantSigValNbOfSamplesToSkipLabel;
     Slider averagingBufferSlider, fftAveragingWindowSlider, inputSensitivitySlider, beatDetectionWindowSlider, instantSigValGainSlider, instantSigValNbOfSamplesToSkipSlider;
     ToggleButton sendTimeInfoButton, sendSignalLevelButton, sendSignalInstantValButton, sendImpulseButton, sendFFTButton, monoStereoButton, logarithmicFFTButton;
-    ToggleButton sendOSCButton, sendBinaryUDPButton;
+    ToggleButton sendMidiButton, sendOSCButton, sendBinaryUDPButton, analyseSidechainButton;
     Label sendTimeInfoButtonLabel, sendSignalLevelButtonLabel, sendSignalInstantValButtonLabel, sendImpulseButtonLabel, sendFFTButtonLabel, monoStereoButtonLabel, logarithmicFFTButtonLabel;
-    Label sendOSCButtonLabel, sendBinaryUDPButtonLabel;
+    Label sendMidiButtonLabel, sendOSCButtonLabel, sendBinaryUDPButtonLabel, analyseSidechainButtonLabel;
+    Label statsLabel;
+    AnalysisView analysisView;
     ImageButton logoButton;
-    ComboBox channelComboBox;
+    TextButton dumpTraceButton;
+    ComboBox channelComboBox, channelsPerGroupComboBox;
+    Label channelsPerGroupLabel;
     ScopedPointer<ResizableCornerComponent> resizer;
     ComponentBoundsConstrainer resizeLimits;
     
     AudioPlayHead::CurrentPositionInfo lastDisplayedPosition;
     float lastDisplayedBeatIntensity = 0.0;
+    const int beatIndicatorY = 270;                 // Top of the beat indicator's 40 x 40 area
+    
+    // Set by the stats change messages of the processor, and applied when the editor is showing. Parameter
+    // changes are flagged by the processor itself (parametersChanged), and polled by the timer
+    bool statsChanged = false;
+    
+    // The timer reads the analysis snapshots every frameInterval while the editor is showing, and only checks
+    // whether it is showing again every hiddenCheckInterval otherwise
+    const int frameInterval = 20;                   // Milliseconds
+    const int hiddenCheckInterval = 500;
+    void updateTimer();
+    
+    // Everything but the beat indicator, rendered when the size or the display scale of the editor changes
+    Image background;
+    float backgroundScale = 1.0f;
+    void paintBackground (Graphics& g);
     
     SignalProcessorAudioProcessor& getProcessor() const
     {
@@ -69,6 +94,9 @@ private:
     }
     
     void displayPositionInfo (const AudioPlayHead::CurrentPositionInfo& pos);
+    void displayStats (const PerformanceStats::Summary& stats);
+    void displayParameters();
+    void applyPendingChanges();
     void setupSquareLookAndFeelColours (LookAndFeel& laf);
     
     Font bigFont;
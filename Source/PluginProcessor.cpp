@@ -12,12 +12,19 @@
  */
 
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+// Every group analysed by the engine has its own state in the output gates, and its own range of signal IDs.
+// static_assert : JUCE's static_jassert is a statement, it cannot be used out of a function
+static_assert (AnalysisEngine::maxNbOfGroups <= StreamOutputGate::maxNbOfSignals, "A group without output gate state");
+static_assert (AnalysisEngine::maxNbOfGroups == SignalWireFormat::maxNbOfGroups, "A group without signal IDs");
+
 //==============================================================================
-SignalProcessorAudioProcessor::SignalProcessorAudioProcessor()
+SignalProcessorAudioProcessor::SignalProcessorAudioProcessor (const String& destinationAddress)
 : channel(defaultChannel),
   averagingBufferSize(defaultAveragingBufferSize),
   fftAveragingWindow(defaultfftAveragingWindow),
@@ -27,54 +34,59 @@ SignalProcessorAudioProcessor::SignalProcessorAudioProcessor()
   averageEnergyBufferSize(defaultAverageEnergyBufferSize),
   instantSigValNbOfSamplesToSkip(defaultInstValNbOfSamplesToSkip),
   instantSigValGain(defaultInstValGain),
-  oscTransmissionSocket( IpEndpointName( "127.0.0.1", portNumberOSC )),
-  udpClientTimeInfo("127.0.0.1", portNumberTimeInfo),
-  udpClientSignalLevel("127.0.0.1", portNumberSignalLevel),
-  udpClientSignalInstantVal("127.0.0.1", portNumberSignalInstantVal),
-  udpClientImpulse("127.0.0.1", portNumberImpulse),
-  udpClientFFT("127.0.0.1", portNumberFFT)
+  channelsPerGroup(defaultChannelsPerGroup),
+  parametersChanged(false),
+  serializationHistogram(&performanceStats.getHistogram(PerformanceStats::serializationStage)),
+  latencyProbe(false),
+  udpIpAddress(destinationAddress),
+  oscControlServer(*this, portNumberOSCControl),
+  outputTransport(udpIpAddress.toStdString(), udpPortNumbers, portNumberOSC)
 {
-    // FFT-related initialization
-    // Initialize the FFT data buffer - used to store the input data provided by the DAW
-    fftBuffer           = (float *) malloc(sizeof(float) * N);
-
-    // Setup the DFT routines
-    zop_Setup = vDSP_DFT_zop_CreateSetup(0, N, vDSP_DFT_FORWARD);
-    zrop_Setup = vDSP_DFT_zrop_CreateSetup(zop_Setup, N, vDSP_DFT_FORWARD);
-    
-    // Allocate memory for the arrays. Malloc is more appropriated in this case because it ensures the data is contiguous
-    float *BufferMemory     = (float *) malloc(N * sizeof *BufferMemory);
-    float *ObservedMemory   = (float *) malloc(N * sizeof *ObservedMemory);
-    
-    // Assign half of BufferMemory to reals and half to imaginaries.
-    Buffer = { BufferMemory, BufferMemory + N/2 };
-    
-    // Assign half of ObservedMemory to reals and half to imaginaries.
-    Observed = { ObservedMemory, ObservedMemory + N/2 };
-    
-    // Allocate memory for the FFT log buffer
-    logFFTResult      = (float *) malloc(sizeof(float) * logFFTNbOfBands);
+    // The FFT buffers are allocated by createNeededResources, the first time the FFT is needed
+    dataArrayLinearFFT  = nullptr;
     
     //Initialize the OSC output buffer
     oscOutputBuffer   = new char[oscOutputBufferSize];
     oscOutputStream   = new osc::OutboundPacketStream(oscOutputBuffer, oscOutputBufferSize);
+    oscMidiOutputBuffer = new char[midiEventPacketSize];
+    oscMidiOutputStream = new osc::OutboundPacketStream(oscMidiOutputBuffer, midiEventPacketSize);
     
     //Build the default Signal Messages, and preallocate the char* which will receive their serialized data
     defineDefaultSignalMessages();
     
-    dataArrayImpulse        = new char[impulse.ByteSize()];
-    dataArrayLevel          = new char[signal.ByteSize()];
-    dataArrayInstantVal     = new char[instantVal.ByteSize()];
+    // Sized for the largest signal ID, the sidechain group of the last channel, then set back to the channel
+    jassert (SignalWireFormat::getSignalID (SignalWireFormat::maxNbOfChannels, SignalWireFormat::sidechainGroup) == SignalWireFormat::maxNbOfSignalIDs);
+    setSignalMessagesID(SignalWireFormat::maxNbOfSignalIDs);
+    impulseBufferSize       = impulse.ByteSize();
+    levelBufferSize         = signal.ByteSize();
+    instantValBufferSize    = instantVal.ByteSize();
+    logFFTBufferSize        = logFft.ByteSize();
+    linearFFTBufferSize     = 0;
+    
+    dataArrayImpulse        = new char[impulseBufferSize];
+    dataArrayLevel          = new char[levelBufferSize];
+    dataArrayInstantVal     = new char[instantValBufferSize];
     dataArrayTimeInfo       = new char[timeInfo.ByteSize()];
-    dataArrayLogFFT         = new char[logFft.ByteSize()];
-    dataArrayLinearFFT      = new char[linearFft.ByteSize()];
+    dataArrayLogFFT         = new char[logFFTBufferSize];
+    dataArrayMidiEvent      = new char[midiEventPacketSize];
+    
+    defineSignalMessagesChannel();
     
     lastPosInfo.resetToDefault();
-
+    
+    // Time the stages, send their statistics, and keep their last trace events
+#if SIGNALPROCESSOR_TRACING
+    TraceRecorder::enable();
+#endif
+    engine.setFFTHistogram(&performanceStats.getHistogram(PerformanceStats::fftStage));
+    outputTransport.setSendHistogram(&performanceStats.getHistogram(PerformanceStats::sendStage));
+    startTimer(statsInterval);
 }
 
 SignalProcessorAudioProcessor::~SignalProcessorAudioProcessor()
 {
+    stopTimer();
+    
     // Release all allocated memory
     delete [] dataArrayImpulse;
     delete [] dataArrayLevel;
@@ -82,13 +94,11 @@ SignalProcessorAudioProcessor::~SignalProcessorAudioProcessor()
     delete [] dataArrayTimeInfo;
     delete [] dataArrayLogFFT;
     delete [] dataArrayLinearFFT;
+    delete [] dataArrayMidiEvent;
     delete [] oscOutputBuffer;
     delete oscOutputStream;
-    
-    free(fftBuffer);
-    free(logFFTResult);
-	vDSP_DFT_DestroySetup(zop_Setup);
-	vDSP_DFT_DestroySetup(zrop_Setup);
+    delete [] oscMidiOutputBuffer;
+    delete oscMidiOutputStream;
 }
 
 
@@ -128,7 +138,10 @@ float SignalProcessorAudioProcessor::getParameter (int index)
         case sendOSCParam:                  return sendOSC;
         case sendBinaryUDPParam:            return sendBinaryUDP;
         case instValGainParam:              return instantSigValGain;
-        case instValNbOfSamplesToSkipParam: return instantSigValNbOfSamplesSkipped;
+        case instValNbOfSamplesToSkipParam: return instantSigValNbOfSamplesToSkip;
+        case channelsPerGroupParam:         return channelsPerGroup;
+        case sendMidiParam:                 return sendMidi;
+        case analyseSidechainParam:         return analyseSidechain;
         default:                            return 0.0f;
     }
 }
@@ -153,6 +166,9 @@ float SignalProcessorAudioProcessor::getParameterDefaultValue (int index)
         case sendBinaryUDPParam:            return defaultSendBinaryUDP;
         case instValGainParam:              return defaultInstValGain;
         case instValNbOfSamplesToSkipParam: return defaultInstValNbOfSamplesToSkip;
+        case channelsPerGroupParam:         return defaultChannelsPerGroup;
+        case sendMidiParam:                 return defaultSendMidi;
+        case analyseSidechainParam:         return defaultAnalyseSidechain;
         default:                            break;
     }
     
@@ -182,8 +198,13 @@ void SignalProcessorAudioProcessor::setParameter (int index, float newValue)
         case sendBinaryUDPParam:            sendBinaryUDP                   = newValue;  break;
         case instValGainParam:              instantSigValGain               = newValue;  break;
         case instValNbOfSamplesToSkipParam: instantSigValNbOfSamplesToSkip  = newValue;  break;
+        case channelsPerGroupParam:         channelsPerGroup                = jlimit (0, maxChannelsPerGroup, (int) newValue);  break;
+        case sendMidiParam:                 sendMidi                        = newValue;  break;
+        case analyseSidechainParam:         analyseSidechain                = newValue;  break;
         default:                            break;
     }
+    
+    parametersChanged.store (true, std::memory_order_release);
 }
 
 const String SignalProcessorAudioProcessor::getParameterName (int index)
@@ -206,6 +227,9 @@ const String SignalProcessorAudioProcessor::getParameterName (int index)
         case sendBinaryUDPParam:            return "Send Data Using UDP";                  break;
         case instValGainParam:              return "Instant Signal Value Gain";            break;
         case instValNbOfSamplesToSkipParam: return "Instant Signal Value Samples To Skip"; break;
+        case channelsPerGroupParam:         return "Channels Per Group";                   break;
+        case sendMidiParam:                 return "Send MIDI";                            break;
+        case analyseSidechainParam:         return "Analyse Sidechain";                    break;
         default:                            break;
     }
     return String::empty;
@@ -292,7 +316,54 @@ void SignalProcessorAudioProcessor::prepareToPlay (double sampleRate, int sample
 {
     // Use this method as the place to do any pre-playback
     // initialisation that you need..
+    oscControlServer.start();
+    engine.setSampleRate(sampleRate);
+    createNeededResources();
+}
 
+bool SignalProcessorAudioProcessor::isAnyOutputEnabled() const
+{
+    return (sendBinaryUDP || sendOSC)
+        && (sendTimeInfo || sendSignalLevel || sendSignalInstantVal || sendImpulse || sendFFT || sendMidi);
+}
+
+void SignalProcessorAudioProcessor::setAnalysisWorkers (int nbOfWorkers)
+{
+    // The engine ignores a pool set once its FFT buffers are allocated
+    jassert (! engine.isFFTReady());
+    
+    engine.setTaskPool(nullptr);
+    analysisTaskPool = nbOfWorkers > 0 ? new AnalysisTaskPool(nbOfWorkers) : nullptr;
+    engine.setTaskPool(analysisTaskPool);
+}
+
+void SignalProcessorAudioProcessor::createNeededResources()
+{
+    // Returns immediately : the sockets are created in the background, messages are dropped until they are ready
+    if (isAnyOutputEnabled()) {
+        outputTransport.open();
+    }
+    
+    if (sendFFT && ! engine.isFFTReady()) {
+        // The audio thread only touches the linear FFT message and its buffer once the engine is ready :
+        // isFFTReady() is set by prepareFFT, after them, so they are complete when it first sees them.
+        // Fill the message with its maximum number of values, to get the size of the serialization buffer
+        linearFft.set_signalid(std::numeric_limits<int32>::max());
+        linearFft.set_fundamentalfreq(0.0);
+        for (int i=0; i<AnalysisEngine::fftSize/2; i++) {
+            linearFft.add_data(0.0);
+        }
+        linearFFTBufferSize = linearFft.ByteSize();
+        dataArrayLinearFFT = new char[linearFFTBufferSize];
+        
+        // The audio thread starts computing FFTs once the engine is ready
+        engine.prepareFFT();
+    }
+}
+
+void SignalProcessorAudioProcessor::handleAsyncUpdate()
+{
+    createNeededResources();
 }
 
 void SignalProcessorAudioProcessor::releaseResources()
@@ -304,63 +375,31 @@ void SignalProcessorAudioProcessor::releaseResources()
 
 void SignalProcessorAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer& midiMessages)
 {
+    const uint64_t blockStart = getMonotonicNanoseconds();
+    blockEntryTime = blockStart;
+    SIGNALPROCESSOR_TRACE_SCOPE("processBlock", "samples", buffer.getNumSamples());
 
     //////////////////////////////////////////////////////////////////
-    // MIDI processing takes place here !
-
-    
-    //////////////////////////////////////////////////////////////////
-    // Audio processing takes place here !
-    
-    // If the signal is defined by the user as mono, no need to check the second channel
-    int numberOfChannels = (monoStereo==false) ? 1 : getNumInputChannels();
-    for (int channel = 0; channel < numberOfChannels; channel++)
-    {
-        const float* channelData = buffer.getReadPointer (channel);
-
-        //Only read one value out of nbOfSamplesToSkip, it's faster this way
-        for (int i=0; i<buffer.getNumSamples(); i+=nbOfSamplesToSkip) {
-            
-            // Signal average: The objective is to get an average of the signal's amplitude -> use the absolute value
-            signalSum += std::abs(channelData[i]);
-            // Note: Possible optimization to be done using the mean square of the vector.
-            // extern void vDSP_measqv
-            
-        }
-
-        // Instant signal value
-        if (sendSignalInstantVal == true) {
-            for (int i=0; i<buffer.getNumSamples(); i+=1) {
-                if (instantSigValNbOfSamplesSkipped >= instantSigValNbOfSamplesToSkip) {
-                    sendSignalInstantValMsg(channelData[i]);
-                    instantSigValNbOfSamplesSkipped = 0;
-                }
-                else {
-                    instantSigValNbOfSamplesSkipped += 1;
-                }
-            }
-        }
+    // Apply the parameter changes received from the remote console since the last block
+    OscControlServer::ParameterChange remoteChange;
+    while (oscControlServer.popPendingChange (remoteChange)) {
+        setParameter (remoteChange.index, remoteChange.value);
     }
     
-    nbBufValProcessed += buffer.getNumSamples();
-    samplesSinceLastTimeInfoTransmission += buffer.getNumSamples();
+    // An output was enabled since prepareToPlay : let the message thread create what it needs
+    if ((isAnyOutputEnabled() && ! outputTransport.isOpening()) || (sendFFT && ! engine.isFFTReady())) {
+        triggerAsyncUpdate();
+    }
     
-    if (sendFFT == true) {
-        // For the FFT, only check the left channel (mono), it's not very useful the work twice. This could be changed in the future if a case where this is needed were to appear
-        for (int i=0; i<buffer.getNumSamples(); i+=1) {
-            // Move the available buffer in the processed data buffer (for FFT)
-            *(fftBuffer + fftBufferIndex) = *(buffer.getReadPointer(0) + i);
-            fftBufferIndex += 1;
-            if (fftBufferIndex >= N) {
-                computeFFT();
-            }
-        }
+    //////////////////////////////////////////////////////////////////
+    // MIDI processing takes place here !
+    if (sendMidi && ! midiMessages.isEmpty()) {
+        sendMidiEvents(midiMessages);
     }
     
-    //Must be calculated before the instant signal, or else the beat effect will be minimized
-    signalAverageEnergy = denormalize(((signalAverageEnergy * (averageEnergyBufferSize-1)) + signalInstantEnergy) / averageEnergyBufferSize);
-    signalInstantEnergy = signalSum / (averagingBufferSize * numberOfChannels);
-
+    //////////////////////////////////////////////////////////////////
+    // Audio processing takes place here !
+    
     if (sendImpulse == true) {
         
         // Fade the beat detection image (variable used by the editor)
@@ -376,27 +415,12 @@ void SignalProcessorAudioProcessor::processBlock (AudioSampleBuffer& buffer, Mid
         beatIntensity = 0;
     }
     
-    // If the instant signal energy is thresholdFactor times greater than the average energy, consider that a beat is detected
-    if (signalInstantEnergy > signalAverageEnergy*thresholdFactor) {
-        
-        //Set the new signal Average Energy to the value of the instant energy, to avoid having bursts of false beat detections
-        signalAverageEnergy = signalInstantEnergy;
-        
-        if (sendImpulse == true) {
-            //Send the impulse message (which was pre-generated earlier)
-            sendImpulseMsg();
-        }
-    }
-    
-    if (nbBufValProcessed >= averagingBufferSize) {
-        if (sendSignalLevel == true) {
-            sendSignalLevelMsg();
-        }
-        
-        nbBufValProcessed = 0;
-        signalSum = 0;
-    }
+    // The engine calls the FeatureSink functions below for every feature computed in this block, on every group
+    updateEngineSettings();
+    const int nbOfGroups = updateAnalysisGroups(jmin(getNumInputChannels(), buffer.getNumChannels()), getNumOutputChannels());
+    engine.process(buffer.getArrayOfReadPointers(), analysisGroups, nbOfGroups, buffer.getNumSamples(), *this);
     
+    samplesSinceLastTimeInfoTransmission += buffer.getNumSamples();
     if (samplesSinceLastTimeInfoTransmission >= timeInfoCycle) {
         // Ask the host for the current time
         if (sendTimeInfo == true) {
@@ -408,90 +432,206 @@ void SignalProcessorAudioProcessor::processBlock (AudioSampleBuffer& buffer, Mid
         }
         samplesSinceLastTimeInfoTransmission = 0;
     }
+    
+    if (buffer.getNumChannels() > 0) {
+        writeAnalysisSnapshots(buffer.getReadPointer(0), buffer.getNumSamples());
+    }
+    
+    performanceStats.blockProcessed(getMonotonicNanoseconds() - blockStart, buffer.getNumSamples(), getSampleRate());
 }
 
-
-float SignalProcessorAudioProcessor::denormalize(float input) {
-    float temp = input + 1.0f;
-    return temp - 1.0f;
+void SignalProcessorAudioProcessor::writeAnalysisSnapshots (const float* samples, int nbOfSamples)
+{
+    int i = 0;
+    while (i < nbOfSamples) {
+        AnalysisSnapshot& snapshot = analysisSnapshots.getWriteBuffer();
+        const int nbOfSamplesToCopy = std::min (nbOfSamples - i, AnalysisSnapshot::scopeSize - scopeIndex);
+        std::memcpy (snapshot.scope + scopeIndex, samples + i, sizeof (float) * nbOfSamplesToCopy);
+        scopeIndex += nbOfSamplesToCopy;
+        i += nbOfSamplesToCopy;
+        
+        if (scopeIndex < AnalysisSnapshot::scopeSize) {
+            break;
+        }
+        
+        // The write buffer holds an older snapshot : every field is written again. The engine's spectrum
+        // stays valid until its next FFT
+        snapshot.hasSpectrum = sendFFT && engine.getNbOfFFTs() > 0;
+        if (snapshot.hasSpectrum) {
+            const float* spectrum = engine.getLastSpectrum();
+            for (int bin = 0; bin < AnalysisSnapshot::nbOfBins; bin++) {
+                snapshot.spectrum[bin] = std::abs (spectrum[bin]);
+            }
+            AnalysisEngine::computeLogBands (snapshot.spectrum, snapshot.bands, AnalysisSnapshot::nbOfBands);
+            snapshot.fundamentalFrequency = engine.getLastFundamentalFrequency();
+        }
+        else {
+            snapshot.fundamentalFrequency = -1;
+        }
+        snapshot.signalLevel    = lastSignalLevel;
+        snapshot.beatIntensity  = beatIntensity;
+        snapshot.sampleRate     = getSampleRate() > 0 ? getSampleRate() : 44100.0;
+        snapshot.position       = lastPosInfo;
+        
+        analysisSnapshots.publish();
+        scopeIndex = 0;
+    }
 }
 
-//==============================================================================
-// FFT Functions
-
-void SignalProcessorAudioProcessor::computeFFT() {
-    
-    // Reinterpret the signal in fftBuffer as an interleaved-data complex vector and use vDSP_ctoz to move the data to a separated-data complex vector. The stride is equal to 2 because the imaginary elements are skipped
-    vDSP_ctoz((DSPComplex *) fftBuffer, 2*Stride, &Buffer, 1, N/2);
+int SignalProcessorAudioProcessor::updateAnalysisGroups (int nbOfInputChannels, int nbOfOutputChannels)
+{
+    // Hosts connect a sidechain to the input channels which have no output channel
+    const int nbOfMainChannels = (nbOfOutputChannels > 0) ? jmin(nbOfInputChannels, nbOfOutputChannels) : nbOfInputChannels;
+    const int maxNbOfMainGroups = AnalysisEngine::maxNbOfGroups - 1;
+    int nbOfGroups = 0;
+    sidechainGroupIndex = -1;
     
-    // Perform a real-to-complex DFT.
-    vDSP_DFT_Execute(zrop_Setup,
-                     Buffer.realp, Buffer.imagp,
-                     Observed.realp, Observed.imagp);
-
-    // If the FFT is set to logarithmic, transform the linear result array in a new log one
-    if (logarithmicFFT) {
-        computeLogFFT();
+    if (nbOfMainChannels > 0) {
+        if (channelsPerGroup <= 0) {
+            // If the signal is defined by the user as mono, no need to check the second channel
+            analysisGroups[nbOfGroups].firstChannel = 0;
+            analysisGroups[nbOfGroups].nbOfChannels = (monoStereo==false) ? 1 : nbOfMainChannels;
+            nbOfGroups++;
+        }
+        else {
+            for (int first = 0; first < nbOfMainChannels && nbOfGroups < maxNbOfMainGroups; first += channelsPerGroup) {
+                analysisGroups[nbOfGroups].firstChannel = first;
+                analysisGroups[nbOfGroups].nbOfChannels = jmin(channelsPerGroup, nbOfMainChannels - first);
+                nbOfGroups++;
+            }
+        }
     }
     
-    // Send the FFT message over the network
-    sendFFTMsg();
-    
-    // Reinitialize fftBufferIndex to start writing the temp data back from the start of the table
-    fftBufferIndex = 0;
+    if (analyseSidechain && nbOfInputChannels > nbOfMainChannels) {
+        sidechainGroupIndex = nbOfGroups;
+        analysisGroups[nbOfGroups].firstChannel = nbOfMainChannels;
+        analysisGroups[nbOfGroups].nbOfChannels = nbOfInputChannels - nbOfMainChannels;
+        nbOfGroups++;
+    }
     
+    return nbOfGroups;
+}
+
+void SignalProcessorAudioProcessor::updateEngineSettings()
+{
+    AnalysisEngine::Settings& settings = engine.settings;
+    settings.averagingBufferSize            = averagingBufferSize;
+    settings.fftAveragingWindow             = fftAveragingWindow;
+    settings.inputSensitivity               = inputSensitivity;
+    settings.averageEnergyBufferSize        = averageEnergyBufferSize;
+    settings.instantValGain                 = instantSigValGain;
+    settings.instantValNbOfSamplesToSkip    = instantSigValNbOfSamplesToSkip;
+    settings.logarithmicFFT                 = logarithmicFFT;
+    settings.signalLevelEnabled             = sendSignalLevel;
+    settings.signalInstantValEnabled        = sendSignalInstantVal;
+    settings.impulseEnabled                 = sendImpulse;
+    settings.fftEnabled                     = sendFFT;
 }
 
-float SignalProcessorAudioProcessor::findSignalFrequency() {
+
+//==============================================================================
+// Called once per second on the message thread
+void SignalProcessorAudioProcessor::timerCallback()
+{
+    lastStats = performanceStats.collect();
+    previousOutputCounters = outputCounters;
+    outputTransport.collectCounters(outputCounters.transports);
+    for (int i = 0; i < totalNumOutputStreams; i++) {
+        outputCounters.sent[i]          = outputGates[i].nbOfMessagesSent.load(std::memory_order_relaxed);
+        outputCounters.suppressed[i]    = outputGates[i].nbOfMessagesSuppressed.load(std::memory_order_relaxed);
+    }
+    statsChanges.sendChangeMessage();
     
-    float maxVal = 0;
-    int maxValPos = 0;
-    for (int i=0; i < N/2; i += 1) {
-        if (maxVal < *(Observed.realp + i)) {
-            maxVal = *(Observed.realp + i);
-            maxValPos = i;
-        }
-        else {
-            // This function aims to find the approximate fundamental
-            // The algorithm could be improved
-        }
+    if (! sendBinaryUDP) {
+        return;
     }
     
-    if (maxVal < 0.1) {
-        // No real frequency could be found (the source is silent)
-        return -1;
+    SIGNALPROCESSOR_TRACE_SCOPE("sendStats", "channel", channel);
+    SignalWireFormat::StatsMessage message;
+    message.signalID = channel;
+    message.nbOfStages = PerformanceStats::totalNumStages;
+    for (int i = 0; i < PerformanceStats::totalNumStages; i++) {
+        const PerformanceStats::StageSummary& stage = lastStats.stages[i];
+        message.stages[i].stage = i;                // Same order as Stats.Stage
+        message.stages[i].count = stage.count;
+        message.stages[i].p50   = stage.p50;
+        message.stages[i].p99   = stage.p99;
+        message.stages[i].max   = stage.max;
     }
-    else if (abs(*(Observed.realp + maxValPos - 1)) > abs(*(Observed.realp + maxValPos + 1))) {
-        return (getSampleRate() / N) *
-        (abs(maxValPos*(*(Observed.realp + maxValPos))) + abs((maxValPos-1)*(*(Observed.realp + maxValPos-1)))) /
-        (abs(*(Observed.realp + maxValPos - 1)) + abs(*(Observed.realp + maxValPos))) ;            }
-    else {
-        return (getSampleRate() / N) *
-        (abs(maxValPos*(*(Observed.realp + maxValPos))) + abs((maxValPos+1)*(*(Observed.realp + maxValPos+1)))) /
-        (abs(*(Observed.realp + maxValPos + 1)) + abs(*(Observed.realp + maxValPos))) ;
+    message.deadlineUtilization     = lastStats.deadlineUtilization;
+    message.maxDeadlineUtilization  = lastStats.maxDeadlineUtilization;
+    message.xrunRiskCount           = lastStats.xrunRiskCount;
+    message.nbOfBlocks              = lastStats.nbOfBlocks;
+    
+    message.nbOfTransports = OutputTransport::totalNumCounters;
+    for (int i = 0; i < OutputTransport::totalNumCounters; i++) {
+        const OutputTransport::Counters& counters = outputCounters.transports[i];
+        SignalWireFormat::TransportCounters& transport = message.transports[i];
+        transport.destination       = getStatsDestination(i);
+        transport.packets           = counters.packets;
+        transport.bytes             = counters.bytes;
+        transport.notReadyDrops     = counters.notReadyDrops;
+        transport.oversizedDrops    = counters.oversizedDrops;
+        transport.partialSends      = counters.partialSends;
+        transport.wouldBlockErrors  = counters.errors[OutputTransport::wouldBlockError];
+        transport.noBufferErrors    = counters.errors[OutputTransport::noBufferError];
+        transport.refusedErrors     = counters.errors[OutputTransport::refusedError];
+        transport.unreachableErrors = counters.errors[OutputTransport::unreachableError];
+        transport.messageSizeErrors = counters.errors[OutputTransport::messageSizeError];
+        transport.otherErrors       = counters.errors[OutputTransport::otherError];
+        transport.queueHighWater    = counters.queueHighWater;
+        transport.lastErrno         = counters.lastErrno;
+    }
+    
+    message.nbOfStreams = totalNumOutputStreams;
+    for (int i = 0; i < totalNumOutputStreams; i++) {
+        message.streams[i].stream       = i;        // Same order as Stats.Stream
+        message.streams[i].sent         = outputCounters.sent[i];
+        message.streams[i].suppressed   = outputCounters.suppressed[i];
+    }
+    
+    char data[2048];
+    const int size = SignalWireFormat::encode(message, data, sizeof(data));
+    if (size > 0) {
+        outputTransport.send(OutputTransport::statsDestination, data, size);
     }
 }
 
-// Calculate a normalized intensity for the 12 frequency bands
-void SignalProcessorAudioProcessor::computeLogFFT() {
+File SignalProcessorAudioProcessor::dumpTrace (double seconds)
+{
+    const File folder (File::getSpecialLocation (File::userDocumentsDirectory).getChildFile ("SignalProcessor Traces"));
+    const File file (folder.getNonexistentChildFile ("trace-" + Time::getCurrentTime().formatted ("%Y%m%d-%H%M%S"), ".json", false));
     
-    //First, reinitialize the array
-    for (int i= 0; i<logFFTNbOfBands; i++)  { *(logFFTResult + i) = 0; }
+    if (! folder.createDirectory()) {
+        return File::nonexistent;
+    }
     
-    //Every element inside Observed.realp contains the energy for a frequency band with (getSampleRate() / N) Hz width (10.76Hz at a 44100Hz sample rate)
-    *(logFFTResult + 0)         = abs(*(Observed.realp + 0));                                  //Energy in the 0 to 11 Hz band
-    *(logFFTResult + 1)         = abs(*(Observed.realp + 1));                                  //Energy in the 11 to 22 Hz band
-    for (int i=2;i<4;i++)       { *(logFFTResult + 2) += abs(*(Observed.realp + i)); }         //Energy in the 22 to 43 Hz band
-    for (int i=4;i<8;i++)       { *(logFFTResult + 3) += abs(*(Observed.realp + i)); }         //Energy in the 43 to 86 Hz band
-    for (int i=8;i<16;i++)      { *(logFFTResult + 4) += abs(*(Observed.realp + i)); }         //Energy in the 86 to 172 Hz band
-    for (int i=16;i<32;i++)     { *(logFFTResult + 5) += abs(*(Observed.realp + i)); }         //Energy in the 172 to 344 Hz band
-    for (int i=32;i<64;i++)     { *(logFFTResult + 6) += abs(*(Observed.realp + i)); }         //Energy in the 344 to 689 Hz band
-    for (int i=64;i<128;i++)    { *(logFFTResult + 7) += abs(*(Observed.realp + i)); }         //Energy in the 689 to 1378 Hz band
-    for (int i=128;i<256;i++)   { *(logFFTResult + 8) += abs(*(Observed.realp + i)); }         //Energy in the 1378 to 2756 Hz band
-    for (int i=256;i<512;i++)   { *(logFFTResult + 9) += abs(*(Observed.realp + i)); }         //Energy in the 2756 to 5512 Hz band
-    for (int i=512;i<1024;i++)  { *(logFFTResult + 10) += abs(*(Observed.realp + i)); }        //Energy in the 5512 to 11025 Hz band
-    for (int i=1024;i<2048;i++) { *(logFFTResult + 11) += abs(*(Observed.realp + i)); }        //Energy in the 11025 to 22050 Hz band
+    std::ofstream output (file.getFullPathName().toRawUTF8());
+    TraceRecorder::writeChromeTrace (output, seconds);
+    output.close();
     
+    return output.fail() ? File::nonexistent : file;
+}
+
+const char* SignalProcessorAudioProcessor::getOutputStreamName (int stream)
+{
+    switch (stream)
+    {
+        case signalLevelStream:         return "signalLevel";
+        case signalInstantValStream:    return "signalInstantVal";
+        case fftStream:                 return "fft";
+        default:                        return "";
+    }
+}
+
+int SignalProcessorAudioProcessor::getStatsDestination (int counterIndex)
+{
+    switch (counterIndex)
+    {
+        case OutputTransport::midiEventDestination: return SignalWireFormat::TransportCounters::midiEvent;
+        case OutputTransport::oscCounters:          return SignalWireFormat::TransportCounters::osc;
+        default:                                    return counterIndex;    // Same order as Stats.Destination
+    }
 }
 
 //==============================================================================
@@ -506,8 +646,8 @@ void SignalProcessorAudioProcessor::defineDefaultSignalMessages() {
     instantVal.set_signalid(channel);
     instantVal.set_signalinstantval(0.0);
     
+    // Serialized by defineSignalMessagesChannel, once its buffer is allocated
     impulse.set_signalid(channel);
-    impulse.SerializeToArray(dataArrayImpulse, impulse.GetCachedSize());
     
     timeInfo.set_isplaying(false);
     timeInfo.set_position(0.0);
@@ -528,79 +668,171 @@ void SignalProcessorAudioProcessor::defineDefaultSignalMessages() {
     logFft.set_band11(0.0);
     logFft.set_band12(0.0);
     
-    linearFft.set_signalid(channel);
-    linearFft.set_fundamentalfreq(0.0);
-    for (int i=0; i<N/2; i++) {             //Initialize the char array with the max size
-        linearFft.add_data(0.0);
-    }
+    // The linear FFT message is filled by createNeededResources, then only used by the audio thread
 }
 
 void SignalProcessorAudioProcessor::defineSignalMessagesChannel() {
     
-    signal.set_signalid(channel);
-    instantVal.set_signalid(channel);
-    logFft.set_signalid(channel);
-    linearFft.set_signalid(channel);
+    setSignalMessagesID(channel);
+    oscControlServer.setChannel(channel);
     
     //It is possible to pre-serialize impulse messages here, as the message will never change
-    impulse.set_signalid(channel);
-    impulse.SerializeToArray(dataArrayImpulse, impulse.GetCachedSize());
+    impulse.SerializeToArray(dataArrayImpulse, impulseBufferSize);
     
 }
 
+void SignalProcessorAudioProcessor::setSignalMessagesID(int signalID) {
+    signal.set_signalid(signalID);
+    instantVal.set_signalid(signalID);
+    impulse.set_signalid(signalID);
+    logFft.set_signalid(signalID);
+}
+
 //==============================================================================
-void SignalProcessorAudioProcessor::sendImpulseMsg() {
+void SignalProcessorAudioProcessor::sendProbed (OutputTransport::Destination destination, const char* data, int size, uint64_t featureTime)
+{
+    char probed[64];
+    if (size + LatencyProbe::maxStampSize > (int) sizeof (probed)) {
+        outputTransport.messageTooLarge (destination);
+        return;
+    }
+    
+    std::memcpy (probed, data, size);
+    const LatencyProbe::Stamp stamp (blockEntryTime, featureTime, getMonotonicNanoseconds());
+    outputTransport.send (destination, probed, LatencyProbe::append (stamp, probed, size, sizeof (probed)));
+}
+
+void SignalProcessorAudioProcessor::impulseDetected(int group, int64_t time) {
+    // 0 : not probing
+    const uint64_t featureTime = latencyProbe.load(std::memory_order_relaxed) ? getMonotonicNanoseconds() : 0;
     beatIntensity = 1.0f;
+    const int signalID = getSignalID(group);
+    SIGNALPROCESSOR_TRACE_SCOPE("sendImpulse", "channel", signalID);
     if (sendBinaryUDP) {
-        udpClientImpulse.send(dataArrayImpulse, impulse.GetCachedSize());
+        // The impulse message is pre-serialized : only serialize it again when the group changes. SerializeToArray
+        // checks that the message fits in its buffer, and then writes exactly GetCachedSize() bytes
+        bool fits = true;
+        if (impulse.signalid() != signalID) {
+            impulse.set_signalid(signalID);
+            fits = impulse.SerializeToArray(dataArrayImpulse, impulseBufferSize);
+            if (! fits) {
+                impulse.set_signalid(0);        // Serialized again next time
+            }
+        }
+        if (! fits) {
+            outputTransport.messageTooLarge(OutputTransport::impulseDestination);
+        }
+        else if (featureTime != 0) {
+            sendProbed(OutputTransport::impulseDestination, dataArrayImpulse, impulse.GetCachedSize(), featureTime);
+        }
+        else {
+            outputTransport.send(OutputTransport::impulseDestination, dataArrayImpulse, impulse.GetCachedSize());
+        }
     }
     if (sendOSC) {
-        oscOutputStream->Clear();
-        *oscOutputStream << osc::BeginBundleImmediate
-        << osc::BeginMessage( "IMPLS" )
-        << channel << osc::EndMessage
-        << osc::EndBundle;
-        oscTransmissionSocket.Send( oscOutputStream->Data(), oscOutputStream->Size() );
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            oscOutputStream->Clear();
+            *oscOutputStream << osc::BeginBundleImmediate
+            << osc::BeginMessage( "IMPLS" )
+            << signalID;
+            if (featureTime != 0) {
+                *oscOutputStream << LatencyProbe::Stamp(blockEntryTime, featureTime, getMonotonicNanoseconds());
+            }
+            *oscOutputStream << osc::EndMessage
+            << osc::EndBundle;
+        }
+        outputTransport.sendOSC( oscOutputStream->Data(), oscOutputStream->Size() );
     }
 }
 
-void SignalProcessorAudioProcessor::sendSignalLevelMsg() {
+void SignalProcessorAudioProcessor::signalLevelComputed(int group, int64_t time, float level) {
+    if (group == 0) {
+        lastSignalLevel = level;
+    }
+    const uint64_t featureTime = latencyProbe.load(std::memory_order_relaxed) ? getMonotonicNanoseconds() : 0;
+    if (! outputGates[signalLevelStream].shouldSend(group, level, time, getSampleRate())) {
+        return;
+    }
+    const int signalID = getSignalID(group);
+    SIGNALPROCESSOR_TRACE_SCOPE("sendSignalLevel", "channel", signalID);
+    
     if (sendBinaryUDP) {
-        signal.set_signallevel(denormalize(inputSensitivity * signalInstantEnergy));
-        signal.SerializeToArray(dataArrayLevel, signal.GetCachedSize());
-        udpClientSignalLevel.send(dataArrayLevel, signal.GetCachedSize());
+        bool fits;
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            signal.set_signalid(signalID);
+            signal.set_signallevel(level);
+            fits = signal.SerializeToArray(dataArrayLevel, levelBufferSize);
+        }
+        if (! fits) {
+            outputTransport.messageTooLarge(OutputTransport::signalLevelDestination);
+        }
+        else if (featureTime != 0) {
+            sendProbed(OutputTransport::signalLevelDestination, dataArrayLevel, signal.GetCachedSize(), featureTime);
+        }
+        else {
+            outputTransport.send(OutputTransport::signalLevelDestination, dataArrayLevel, signal.GetCachedSize());
+        }
     }
     if (sendOSC) {
         //Example of an OSC signal level message : SIGLVL1/0.23245
-        oscOutputStream->Clear();
-        *oscOutputStream << osc::BeginBundleImmediate
-        << osc::BeginMessage( "SIGLVL" )
-        << channel << "/"
-        << denormalize(inputSensitivity * signalInstantEnergy) << osc::EndMessage
-        << osc::EndBundle;
-        oscTransmissionSocket.Send( oscOutputStream->Data(), oscOutputStream->Size() );
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            oscOutputStream->Clear();
+            *oscOutputStream << osc::BeginBundleImmediate
+            << osc::BeginMessage( "SIGLVL" )
+            << signalID << "/"
+            << level;
+            if (featureTime != 0) {
+                *oscOutputStream << LatencyProbe::Stamp(blockEntryTime, featureTime, getMonotonicNanoseconds());
+            }
+            *oscOutputStream << osc::EndMessage
+            << osc::EndBundle;
+        }
+        outputTransport.sendOSC( oscOutputStream->Data(), oscOutputStream->Size() );
     }
 }
 
-void SignalProcessorAudioProcessor::sendSignalInstantValMsg(float val) {
+void SignalProcessorAudioProcessor::signalInstantValComputed(int group, int64_t time, float value) {
+    if (! outputGates[signalInstantValStream].shouldSend(group, value, time, getSampleRate())) {
+        return;
+    }
+    const int signalID = getSignalID(group);
+    SIGNALPROCESSOR_TRACE_SCOPE("sendSignalInstantVal", "channel", signalID);
+    
     if (sendBinaryUDP) {
-        instantVal.set_signalinstantval(instantSigValGain * val);
-        instantVal.SerializeToArray(dataArrayInstantVal, instantVal.GetCachedSize());
-        udpClientSignalInstantVal.send(dataArrayInstantVal, instantVal.GetCachedSize());
+        bool fits;
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            instantVal.set_signalid(signalID);
+            instantVal.set_signalinstantval(value);
+            fits = instantVal.SerializeToArray(dataArrayInstantVal, instantValBufferSize);
+        }
+        if (fits) {
+            outputTransport.send(OutputTransport::signalInstantValDestination, dataArrayInstantVal, instantVal.GetCachedSize());
+        }
+        else {
+            outputTransport.messageTooLarge(OutputTransport::signalInstantValDestination);
+        }
     }
     if (sendOSC) {
         //Example of an OSC signal level message : SIGINSTVAL1/0.23245
-        oscOutputStream->Clear();
-        *oscOutputStream << osc::BeginBundleImmediate
-        << osc::BeginMessage( "SIGINSTVAL" )
-        << channel << "/"
-        << denormalize(inputSensitivity * val) << osc::EndMessage
-        << osc::EndBundle;
-        oscTransmissionSocket.Send( oscOutputStream->Data(), oscOutputStream->Size() );
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            oscOutputStream->Clear();
+            *oscOutputStream << osc::BeginBundleImmediate
+            << osc::BeginMessage( "SIGINSTVAL" )
+            << signalID << "/"
+            << value << osc::EndMessage
+            << osc::EndBundle;
+        }
+        outputTransport.sendOSC( oscOutputStream->Data(), oscOutputStream->Size() );
     }
 }
 
 void SignalProcessorAudioProcessor::sendTimeinfoMsg() {
+    SIGNALPROCESSOR_TRACE_SCOPE("sendTimeInfo", "channel", channel);
     AudioPlayHead::CurrentPositionInfo currentTime;
     if (getPlayHead() != nullptr && getPlayHead()->getCurrentPosition (currentTime))
     {
@@ -609,103 +841,256 @@ void SignalProcessorAudioProcessor::sendTimeinfoMsg() {
         
         // Successfully got the current time from the host, set the pulses-per-quarter-note value inside the timeInfo message
         if (sendBinaryUDP) {
-            timeInfo.set_position((float)currentTime.ppqPosition);
-            timeInfo.set_isplaying(currentTime.isPlaying);
-            timeInfo.set_tempo((float)currentTime.bpm);
-            timeInfo.SerializeToArray(dataArrayTimeInfo, timeInfo.GetCachedSize());
-            udpClientTimeInfo.send(dataArrayTimeInfo, timeInfo.GetCachedSize());
+            {
+                ScopedStageTimer timer(serializationHistogram);
+                timeInfo.set_position((float)currentTime.ppqPosition);
+                timeInfo.set_isplaying(currentTime.isPlaying);
+                timeInfo.set_tempo((float)currentTime.bpm);
+                timeInfo.SerializeToArray(dataArrayTimeInfo, timeInfo.GetCachedSize());
+            }
+            outputTransport.send(OutputTransport::timeInfoDestination, dataArrayTimeInfo, timeInfo.GetCachedSize());
         }
         if (sendOSC) {
-            oscOutputStream->Clear();
-            *oscOutputStream << osc::BeginBundleImmediate
-            << osc::BeginMessage( "TIME" )
-            << ((float)currentTime.ppqPosition) << osc::EndMessage
-            << osc::BeginMessage( "BPM" )
-            << ((float)currentTime.bpm) << osc::EndMessage
-            << osc::EndBundle;
-            oscTransmissionSocket.Send( oscOutputStream->Data(), oscOutputStream->Size() );
+            {
+                ScopedStageTimer timer(serializationHistogram);
+                oscOutputStream->Clear();
+                *oscOutputStream << osc::BeginBundleImmediate
+                << osc::BeginMessage( "TIME" )
+                << ((float)currentTime.ppqPosition) << osc::EndMessage
+                << osc::BeginMessage( "BPM" )
+                << ((float)currentTime.bpm) << osc::EndMessage
+                << osc::EndBundle;
+            }
+            outputTransport.sendOSC( oscOutputStream->Data(), oscOutputStream->Size() );
         }
     }
 }
 
-void SignalProcessorAudioProcessor::sendFFTMsg() {
-
-    if (logarithmicFFT) {
+void SignalProcessorAudioProcessor::sendMidiEvents(const MidiBuffer& midiMessages) {
+    SIGNALPROCESSOR_TRACE_SCOPE("sendMidiEvents", "events", midiMessages.getNumEvents());
+    
+    // Position of the block's first sample on the host's timeline. Without a transport, on the timeline of the
+    // features : the samples the engine has analysed (this block is analysed after its events are sent)
+    AudioPlayHead::CurrentPositionInfo position;
+    const bool hasPosition = getPlayHead() != nullptr && getPlayHead()->getCurrentPosition(position);
+    const int64 blockTime = hasPosition ? position.timeInSamples : engine.getSamplesProcessed();
+    const double ppqPerSample = (hasPosition && getSampleRate() > 0) ? position.bpm / (60.0 * getSampleRate()) : 0.0;
+    
+    midiEventMessage.signalID   = channel;
+    midiEventMessage.isPlaying  = hasPosition && position.isPlaying;
+    midiEventMessage.nbOfEvents = 0;
+    
+    // The same events go in the Protobuf and in the OSC packet
+    const int headerSize    = jmax ((int) SignalWireFormat::MidiEventMessage::maxHeaderSize, (int) maxOscMidiHeaderSize);
+    const int eventOverhead = jmax ((int) SignalWireFormat::MidiEventMessage::maxEventOverhead, (int) maxOscMidiEventOverhead);
+    int packetSize = headerSize;
+    
+    MidiBuffer::Iterator iterator(midiMessages);
+    const uint8* data;
+    int size, sampleOffset;
+    while (iterator.getNextEvent(data, size, sampleOffset)) {
+        // The events which may not fit in the packet go in the next one
+        const int eventSize = eventOverhead + size;
+        if (midiEventMessage.nbOfEvents == SignalWireFormat::MidiEventMessage::maxNbOfEvents
+            || (midiEventMessage.nbOfEvents > 0 && packetSize + eventSize > midiEventPacketSize)) {
+            sendMidiEventPacket();
+            midiEventMessage.nbOfEvents = 0;
+            packetSize = headerSize;
+        }
         
-        logFft.set_band1((logFft.band1()*(fftAveragingWindow - 1) + *(logFFTResult + 0)) / fftAveragingWindow);
-        logFft.set_band2((logFft.band2()*(fftAveragingWindow - 1) + *(logFFTResult + 1)) / fftAveragingWindow);
-        logFft.set_band3((logFft.band3()*(fftAveragingWindow - 1) + *(logFFTResult + 2)) / fftAveragingWindow);
-        logFft.set_band4((logFft.band4()*(fftAveragingWindow - 1) + *(logFFTResult + 3)) / fftAveragingWindow);
-        logFft.set_band5((logFft.band5()*(fftAveragingWindow - 1) + *(logFFTResult + 4)) / fftAveragingWindow);
-        logFft.set_band6((logFft.band6()*(fftAveragingWindow - 1) + *(logFFTResult + 5)) / fftAveragingWindow);
-        logFft.set_band7((logFft.band7()*(fftAveragingWindow - 1) + *(logFFTResult + 6)) / fftAveragingWindow);
-        logFft.set_band8((logFft.band8()*(fftAveragingWindow - 1) + *(logFFTResult + 7)) / fftAveragingWindow);
-        logFft.set_band9((logFft.band9()*(fftAveragingWindow - 1) + *(logFFTResult + 8)) / fftAveragingWindow);
-        logFft.set_band10((logFft.band10()*(fftAveragingWindow - 1) + *(logFFTResult + 9)) / fftAveragingWindow);
-        logFft.set_band11((logFft.band11()*(fftAveragingWindow - 1) + *(logFFTResult + 10)) / fftAveragingWindow);
-        logFft.set_band12((logFft.band12()*(fftAveragingWindow - 1) + *(logFFTResult + 11)) / fftAveragingWindow);
+        SignalWireFormat::MidiEvent& event = midiEventMessage.events[midiEventMessage.nbOfEvents++];
+        event.sampleOffset      = sampleOffset;
+        event.timeInSamples     = blockTime + sampleOffset;
+        event.ppqPosition       = hasPosition ? position.ppqPosition + sampleOffset * ppqPerSample : 0.0;
+        event.hasPpqPosition    = hasPosition;
+        event.data              = data;
+        event.size              = size;
+        packetSize += eventSize;
+    }
+    
+    if (midiEventMessage.nbOfEvents > 0) {
+        sendMidiEventPacket();
+    }
+}
+
+void SignalProcessorAudioProcessor::sendMidiEventPacket() {
+    if (sendBinaryUDP) {
+        int size;
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            size = SignalWireFormat::encode(midiEventMessage, dataArrayMidiEvent, midiEventPacketSize);
+        }
+        if (size > 0) {
+            outputTransport.send(OutputTransport::midiEventDestination, dataArrayMidiEvent, size);
+        }
+        else {
+            // A single event larger than the packet (a long SysEx) : it cannot be split
+            outputTransport.messageTooLarge(OutputTransport::midiEventDestination);
+        }
+    }
+    if (sendOSC) {
+        //Example of an OSC MIDI message : MIDI 1 0 88200 [0 0x90 60 100] 256 88456 [0 0x80 60 0]
+        //Every event is its sample offset, its host time and the OSC MIDI argument, or a blob for a SysEx
+        bool fits = true;
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            try {
+                oscMidiOutputStream->Clear();
+                *oscMidiOutputStream << osc::BeginBundleImmediate
+                << osc::BeginMessage( "MIDI" )
+                << midiEventMessage.signalID;
+                
+                for (int i=0; i<midiEventMessage.nbOfEvents; i++) {
+                    const SignalWireFormat::MidiEvent& event = midiEventMessage.events[i];
+                    *oscMidiOutputStream << event.sampleOffset
+                    << (osc::int64) event.timeInSamples;
+                    
+                    if (event.size <= 3) {
+                        // Port, status byte and two data bytes, most significant byte first
+                        osc::uint32 value = 0;
+                        for (int j=0; j<event.size; j++) {
+                            value |= (osc::uint32) event.data[j] << (16 - 8 * j);
+                        }
+                        *oscMidiOutputStream << osc::MidiMessage(value);
+                    }
+                    else {
+                        *oscMidiOutputStream << osc::Blob(event.data, (osc::osc_bundle_element_size_t) event.size);
+                    }
+                }
+                
+                *oscMidiOutputStream << osc::EndMessage
+                << osc::EndBundle;
+            }
+            catch (const osc::OutOfBufferMemoryException&) {
+                fits = false;
+            }
+        }
+        if (fits) {
+            outputTransport.sendOSC( oscMidiOutputStream->Data(), oscMidiOutputStream->Size() );
+        }
+        else {
+            outputTransport.messageTooLarge(OutputTransport::oscCounters);
+        }
+    }
+}
+
+void SignalProcessorAudioProcessor::logFFTComputed(int group, int64_t time, const float* bands, int nbOfBands, float fundamentalFreq) {
+    
+    // The bands are averaged by the engine, even when the message is suppressed
+    if (! outputGates[fftStream].shouldSend(group, bands, nbOfBands, time, getSampleRate())) {
+        return;
+    }
+    const int signalID = getSignalID(group);
+    SIGNALPROCESSOR_TRACE_SCOPE("sendLogFFT", "channel", signalID);
+    
+    if (sendBinaryUDP) {
+        bool fits;
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            logFft.set_signalid(signalID);
+            logFft.set_fundamentalfreq(fundamentalFreq);
+            logFft.set_band1(bands[0]);
+            logFft.set_band2(bands[1]);
+            logFft.set_band3(bands[2]);
+            logFft.set_band4(bands[3]);
+            logFft.set_band5(bands[4]);
+            logFft.set_band6(bands[5]);
+            logFft.set_band7(bands[6]);
+            logFft.set_band8(bands[7]);
+            logFft.set_band9(bands[8]);
+            logFft.set_band10(bands[9]);
+            logFft.set_band11(bands[10]);
+            logFft.set_band12(bands[11]);
+            fits = logFft.SerializeToArray(dataArrayLogFFT, logFFTBufferSize);
+        }
         
-        if (sendBinaryUDP) {
-            logFft.set_signalid(channel);
-            logFft.set_fundamentalfreq(findSignalFrequency());
-            logFft.SerializeToArray(dataArrayLogFFT, logFft.GetCachedSize());
-            
-            udpClientFFT.send(dataArrayLogFFT, logFft.GetCachedSize());
+        if (fits) {
+            outputTransport.send(OutputTransport::fftDestination, dataArrayLogFFT, logFft.GetCachedSize());
         }
-        if (sendOSC) {
+        else {
+            outputTransport.messageTooLarge(OutputTransport::fftDestination);
+        }
+    }
+    if (sendOSC) {
+        {
+            ScopedStageTimer timer(serializationHistogram);
             oscOutputStream->Clear();
             *oscOutputStream << osc::BeginBundleImmediate
             << osc::BeginMessage( "FFT" )
-            << channel
-            << findSignalFrequency()
-            << logFft.band1()
-            << logFft.band2()
-            << logFft.band3()
-            << logFft.band4()
-            << logFft.band5()
-            << logFft.band6()
-            << logFft.band7()
-            << logFft.band8()
-            << logFft.band9()
-            << logFft.band10()
-            << logFft.band11()
-            << logFft.band12()
-            << osc::EndMessage
+            << signalID
+            << fundamentalFreq;
+            for (int i=0; i<nbOfBands; i++) {
+                *oscOutputStream << bands[i];
+            }
+            *oscOutputStream << osc::EndMessage
             << osc::EndBundle;
-            oscTransmissionSocket.Send( oscOutputStream->Data(), oscOutputStream->Size() );
         }
+        outputTransport.sendOSC( oscOutputStream->Data(), oscOutputStream->Size() );
     }
+}
+
+void SignalProcessorAudioProcessor::linearFFTComputed(int group, int64_t time, const float* bins, int nbOfBins, float fundamentalFreq) {
     
-    // Linear FFT
-    else {
-        if (sendBinaryUDP) {
+    // Too many values for a deadband : only the rate limit and keep-alive apply
+    if (! outputGates[fftStream].shouldSend(group, nullptr, nbOfBins, time, getSampleRate())) {
+        return;
+    }
+    const int signalID = getSignalID(group);
+    SIGNALPROCESSOR_TRACE_SCOPE("sendLinearFFT", "channel", signalID);
+    
+    if (sendBinaryUDP) {
+        bool fits;
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            
             // Fill in the new data
             linearFft.clear_data();
-            linearFft.set_signalid(channel);
-            linearFft.set_fundamentalfreq(findSignalFrequency());
-            for (int i=0; i<N/2; i++) {
-                linearFft.add_data(abs(*(Observed.realp + i)));
+            linearFft.set_signalid(signalID);
+            linearFft.set_fundamentalfreq(fundamentalFreq);
+            for (int i=0; i<nbOfBins; i++) {
+                linearFft.add_data(bins[i]);
             }
             
-            // Serialize the data and send it
-            linearFft.SerializeToArray(dataArrayLinearFFT, linearFft.GetCachedSize());
-            udpClientFFT.send(dataArrayLinearFFT, linearFft.GetCachedSize());
+            // Serialize the data
+            fits = linearFft.SerializeToArray(dataArrayLinearFFT, linearFFTBufferSize);
         }
-        
-        if (sendOSC) {
-            oscOutputStream->Clear();
-            *oscOutputStream << osc::BeginBundleImmediate
-            << osc::BeginMessage( "LinearFFT" )
-            << channel
-            << findSignalFrequency();
-            
-            // Put all the available data in the OSC message
-            for (int i=0; i<N/2; i++) {
-                *oscOutputStream << abs(*(Observed.realp + i));
+        if (fits) {
+            outputTransport.send(OutputTransport::fftDestination, dataArrayLinearFFT, linearFft.GetCachedSize());
+        }
+        else {
+            outputTransport.messageTooLarge(OutputTransport::fftDestination);
+        }
+    }
+    
+    if (sendOSC) {
+        // The bins may not fit in the OSC buffer : the message is then dropped, and counted by the transport
+        bool fits = true;
+        {
+            ScopedStageTimer timer(serializationHistogram);
+            try {
+                oscOutputStream->Clear();
+                *oscOutputStream << osc::BeginBundleImmediate
+                << osc::BeginMessage( "LinearFFT" )
+                << signalID
+                << fundamentalFreq;
+                
+                // Put all the available data in the OSC message
+                for (int i=0; i<nbOfBins; i++) {
+                    *oscOutputStream << bins[i];
+                }
+                
+                *oscOutputStream << osc::EndMessage
+                << osc::EndBundle;
             }
-            
-            *oscOutputStream << osc::EndMessage
-            << osc::EndBundle;
+            catch (const osc::OutOfBufferMemoryException&) {
+                fits = false;
+            }
+        }
+        if (fits) {
+            outputTransport.sendOSC( oscOutputStream->Data(), oscOutputStream->Size() );
+        }
+        else {
+            outputTransport.messageTooLarge(OutputTransport::oscCounters);
         }
     }
 }
@@ -742,7 +1127,22 @@ void SignalProcessorAudioProcessor::getStateInformation (MemoryBlock& destData)
     xml.setAttribute ("sendOSC", sendOSC);
     xml.setAttribute ("sendBinaryUDP", sendBinaryUDP);
     xml.setAttribute ("instantSigValGain", instantSigValGain);
-    xml.setAttribute ("instantSigValNbOfSamplesSkipped", instantSigValNbOfSamplesSkipped);
+    xml.setAttribute ("instantSigValNbOfSamplesToSkip", instantSigValNbOfSamplesToSkip);
+    xml.setAttribute ("channelsPerGroup", channelsPerGroup);
+    xml.setAttribute ("sendMidi", sendMidi);
+    xml.setAttribute ("analyseSidechain", analyseSidechain);
+    xml.setAttribute ("latencyProbe", latencyProbe.load());
+    
+    // One child element per output policy
+    for (int i = 0; i < totalNumOutputStreams; i++) {
+        const OutputPolicy& policy = outputGates[i].policy;
+        XmlElement* policyXml = xml.createNewChildElement ("OUTPUTPOLICY");
+        policyXml->setAttribute ("stream", getOutputStreamName (i));
+        policyXml->setAttribute ("maxRateHz", policy.maxRateHz.load());
+        policyXml->setAttribute ("absoluteDeadband", policy.absoluteDeadband.load());
+        policyXml->setAttribute ("relativeDeadband", policy.relativeDeadband.load());
+        policyXml->setAttribute ("keepAliveSeconds", policy.keepAliveSeconds.load());
+    }
     
     // then use this helper function to stuff it into the binary blob and return it..
     copyXmlToBinary (xml, destData);
@@ -776,12 +1176,32 @@ void SignalProcessorAudioProcessor::setStateInformation (const void* data, int s
             sendOSC                 = xmlState->getBoolAttribute ("sendOSC", sendOSC);
             sendBinaryUDP           = xmlState->getBoolAttribute ("sendBinaryUDP", sendBinaryUDP);
             instantSigValGain       = (float) xmlState->getDoubleAttribute ("instantSigValGain", instantSigValGain);
-            instantSigValNbOfSamplesSkipped = (float) xmlState->getDoubleAttribute ("instantSigValNbOfSamplesSkipped", instantSigValNbOfSamplesSkipped);
+            instantSigValNbOfSamplesToSkip = xmlState->getIntAttribute ("instantSigValNbOfSamplesToSkip", instantSigValNbOfSamplesToSkip);
+            channelsPerGroup        = jlimit (0, maxChannelsPerGroup, xmlState->getIntAttribute ("channelsPerGroup", channelsPerGroup));
+            sendMidi                = xmlState->getBoolAttribute ("sendMidi", sendMidi);
+            analyseSidechain        = xmlState->getBoolAttribute ("analyseSidechain", analyseSidechain);
+            latencyProbe.store (xmlState->getBoolAttribute ("latencyProbe", latencyProbe.load()));
+            
+            forEachXmlChildElementWithTagName (*xmlState, policyXml, "OUTPUTPOLICY")
+            {
+                for (int i = 0; i < totalNumOutputStreams; i++) {
+                    if (policyXml->getStringAttribute ("stream") == getOutputStreamName (i)) {
+                        OutputPolicy& policy = outputGates[i].policy;
+                        policy.maxRateHz.store ((float) policyXml->getDoubleAttribute ("maxRateHz", policy.maxRateHz.load()));
+                        policy.absoluteDeadband.store ((float) policyXml->getDoubleAttribute ("absoluteDeadband", policy.absoluteDeadband.load()));
+                        policy.relativeDeadband.store ((float) policyXml->getDoubleAttribute ("relativeDeadband", policy.relativeDeadband.load()));
+                        policy.keepAliveSeconds.store ((float) policyXml->getDoubleAttribute ("keepAliveSeconds", policy.keepAliveSeconds.load()));
+                    }
+                }
+            }
         }
     }
     
-    //Build the default Signal Messages, and preallocate the char* which will receive their serialized data
+    //Build the default Signal Messages, on the restored channel
     defineDefaultSignalMessages();
+    defineSignalMessagesChannel();
+    
+    parametersChanged.store (true, std::memory_order_release);
 }
 
 
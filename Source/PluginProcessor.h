@@ -22,24 +22,35 @@
 #include <sys/stat.h>
 #include "osc/OscOutboundPacketStream.h"    // used to output OSC
 #include "ip/UdpSocket.h"                   // used to output OSC
-#include "udp_client_server.h"              // used to output Protobuf binary
+#include "OutputTransport.h"                // used to output Protobuf binary and OSC
 #include "SignalMessages.pb.h"              // protobuf messages definition
+#include "OscControlServer.h"               // used to receive parameter changes from a remote console
+#include "OutputPolicy.h"                   // used to limit the rate of the continuous messages
+#include "AnalysisEngine.h"                 // the signal analysis itself
+#include "AnalysisTaskPool.h"               // worker threads of the analysis
+#include "PerformanceStats.h"               // latency of the processing stages
+#include "AnalysisSnapshot.h"               // what the editor displays
+#include "TraceRecorder.h"                  // trace points, exported as Chrome traces
+#include "../Client/SignalWireFormat.h"     // used to encode the stats and MIDI event messages
+#include "../Client/LatencyProbe.h"         // used to stamp the messages in latency probe mode
 #include "math.h"
-#include <time.h>                           // used to create random FFT-related functions
-#include <Accelerate/Accelerate.h>          // the Accelerate headers are needed to use vDSP
 
 
-#define Log2N	12u		// Base-two logarithm of number of elements.
-#define	N	(1u<<Log2N)	// Number of elements (4096 for Log2N=12)
-
 //==============================================================================
 /**
+    Adapter between the host and the AnalysisEngine : parameters, state,
+    editor, and the FeatureSink sending the features as messages
  */
-class SignalProcessorAudioProcessor  : public AudioProcessor
+class SignalProcessorAudioProcessor  : public AudioProcessor,
+                                       private AsyncUpdater,
+                                       private Timer,
+                                       private FeatureSink
 {
 public:
     //==============================================================================
-    SignalProcessorAudioProcessor();
+    // The messages are sent to destinationAddress : the plugin's host sends them to the local consumers,
+    // the headless capture daemon to the address of its configuration file
+    SignalProcessorAudioProcessor (const String& destinationAddress = "127.0.0.1");
     ~SignalProcessorAudioProcessor();
     
     //==============================================================================
@@ -48,8 +59,6 @@ public:
     
     void processBlock (AudioSampleBuffer& buffer, MidiBuffer& midiMessages);
     
-    void calculateFFT ();
-    
     //==============================================================================
     AudioProcessorEditor* createEditor();
     bool hasEditor() const;
@@ -89,12 +98,32 @@ public:
     
     void defineDefaultSignalMessages();
     void defineSignalMessagesChannel();
+    void setSignalMessagesID (int signalID);        // Of the messages sent per group : not the time info
+    
+    // Tell the host a parameter was changed by something else than the host itself (ex: the OSC control server)
+    void notifyHostOfParameterChange (int index, float newValue)    { sendParamChangeMessageToListeners (index, newValue); }
+    
+    // Compute the FFTs of the groups of channels on nbOfWorkers threads besides the audio thread, which waits for
+    // them before sending the messages : for the headless daemon analysing many channels, not for a DAW's audio
+    // thread. Before prepareToPlay. 0 : everything on the audio thread (the default)
+    void setAnalysisWorkers (int nbOfWorkers);
+    
+    //==============================================================================
+    // The sockets and the FFT resources are not created by the constructor, so that loading the plugin
+    // stays fast : they are created by prepareToPlay, or when an output is enabled while playing
+    // (the audio thread then asks the message thread to create them, see handleAsyncUpdate)
+    void createNeededResources();
+    bool isAnyOutputEnabled() const;
+    void handleAsyncUpdate() override;
 
     //==============================================================================
-    // Utility functions and variables
-    float denormalize(float input);
+    // Host position of the last time info message. Audio thread only : the editor reads it from the snapshots
     AudioPlayHead::CurrentPositionInfo lastPosInfo;
     
+    // What the editor displays, published every AnalysisSnapshot::scopeSize samples by the audio thread
+    // and read by the editor's timer
+    AnalysisSnapshotBuffer analysisSnapshots;
+    
     //==============================================================================
     // Default parameter values
     const int defaultAveragingBufferSize        = 2048;
@@ -108,11 +137,15 @@ public:
     const bool defaultLogarithmicFFT            = true;
     const bool defaultSendBinaryUDP             = true;
     const bool defaultSendOSC                   = false;
+    const bool defaultSendMidi                  = true;
+    const bool defaultAnalyseSidechain          = false;
     const float defaultInputSensitivity         = 1.0;
     const float defaultInstValGain              = 1.0;
     const float defaultInstValNbOfSamplesToSkip = 192;
     const int defaultChannel                    = 1;
     const int defaultAverageEnergyBufferSize    = 8.0;
+    const int defaultChannelsPerGroup           = 0;
+    const int maxChannelsPerGroup               = 16;
     
     //==============================================================================
     enum Parameters
@@ -133,6 +166,9 @@ public:
         sendBinaryUDPParam,
         instValGainParam,
         instValNbOfSamplesToSkipParam,
+        channelsPerGroupParam,
+        sendMidiParam,
+        analyseSidechainParam,
         totalNumParams
     };
     
@@ -149,51 +185,125 @@ public:
     bool sendSignalInstantVal = true;
     bool sendImpulse          = true;
     bool sendFFT              = false;
+    bool sendMidi             = true;
+    bool analyseSidechain     = false;     // Analyse the sidechain input (if the host connects one) as one more group
     bool monoStereo           = false;         //false -> mono
     bool logarithmicFFT       = true;
     int averageEnergyBufferSize;
     
-    //==============================================================================
-    // Variables used by the audio algorithm
-    // Used by the signal average value
-    int nbBufValProcessed = 0;
-    float signalSum = 0;
     // Used by the instant signal value
     int instantSigValNbOfSamplesToSkip;
     float instantSigValGain;
-    int instantSigValNbOfSamplesSkipped = 0;
-    // Used for beat detection
-    float signalAverageEnergy = 0;
-    float signalInstantEnergy = 0;
-    const int thresholdFactor = 4;
+    
+    // 0 : the main input is analysed as one signal (its first channel, or all of them if monoStereo is set).
+    // Otherwise, every channelsPerGroup channels of the main input are analysed as one signal
+    int channelsPerGroup;
+    
+    // Set every time a parameter is set : by the host, the editor, the remote console or a restored state.
+    // setParameter may be called on the audio thread, where nothing may allocate or lock, so the editor's
+    // timer polls and clears this flag instead of receiving a change message
+    std::atomic<bool> parametersChanged;
+    
+    //==============================================================================
+    // The signal analysis. Its settings are copied from the parameters above at the start of every block
+    ScopedPointer<AnalysisTaskPool> analysisTaskPool;   // Before the engine, which uses it
+    AnalysisEngine engine;
+    void updateEngineSettings();
+    
+    // Groups of channels of the current block : the main input (the channels also found in the output), split
+    // according to channelsPerGroup and monoStereo, then, if analyseSidechain is set, the sidechain (the remaining
+    // input channels) as one more group. Every group has its own range of signal IDs (see SignalWireFormat.h) :
+    // the sidechain is sent as the last group of the range, whatever the number of main groups
+    AnalysisEngine::ChannelGroup analysisGroups[AnalysisEngine::maxNbOfGroups];
+    int sidechainGroupIndex = -1;                       // In analysisGroups, -1 without a sidechain group
+    int updateAnalysisGroups (int nbOfInputChannels, int nbOfOutputChannels);
+    int getSignalID (int group) const
+    {
+        return SignalWireFormat::getSignalID (channel, group == sidechainGroupIndex ? SignalWireFormat::sidechainGroup : group);
+    }
+    
     int samplesSinceLastTimeInfoTransmission = 0;                   //The time message is to be sent every timeInfoCycle (if active)
 
     // Set to 1.0f when a beat is detected
     float beatIntensity = 0.1f;
     
-    // Used by FFT computations
-    //--------------------------
-    void computeFFT();                              // Execute the FFT computation sequence
-    void computeLogFFT();
-    float findSignalFrequency();                    // Extract the signal's fundamental frequency
-    
-    float* fftBuffer;                               // Buffer used to store any incoming input data
-    int fftBufferIndex = 0;                         // Index where the data should be written in the temp fftBuffer
-    const vDSP_Stride Stride = 1;                   // All the samples are to be processed -> stride = 1
-    float *logFFTResult;                            // Array to hold the log result of the computed FFT
-    const int logFFTNbOfBands = 12;                 // Number of bands to have in the logFFTResult
-    DSPSplitComplex Buffer;
-    DSPSplitComplex Observed;
-    vDSP_DFT_Setup zop_Setup;
-    vDSP_DFT_Setup zrop_Setup;
-
+    // Fill the scope of the snapshot being written, and publish it when it is full
+    void writeAnalysisSnapshots (const float* samples, int nbOfSamples);
+    int scopeIndex = 0;                                 // Samples already in the scope of the snapshot being written
+    float lastSignalLevel = 0;
+    
+    //==============================================================================
+    // Latency of processBlock, of the FFT, of the serialization and of the sendto calls, recorded by the
+    // audio thread. Once per second (statsInterval), the message thread summarizes them into lastStats,
+    // displayed by the editor, and sends them on the stats port
+    PerformanceStats performanceStats;
+    LatencyHistogram* const serializationHistogram;
+    
+    const int statsInterval = 1000;                     // Milliseconds
+    PerformanceStats::Summary lastStats;
+    ChangeBroadcaster statsChanges;                     // Notified every time lastStats is updated
+    void timerCallback() override;
+    
+    // Write the trace events of the last seconds as a Chrome trace (chrome://tracing, Perfetto), in
+    // Documents/SignalProcessor Traces. Message thread only. Returns the file, or File::nonexistent
+    // if it could not be written
+    const double defaultTraceDumpSeconds = 10;
+    File dumpTrace (double seconds);
+    
+    // Latency probe mode : the impulse and signal level messages (Protobuf and OSC) carry the time their
+    // block entered processBlock, the time the engine handed the feature over, and their send time (see
+    // Client/LatencyProbe.h). Set by the OSC control server (/sp/<channel>/probe 1) and the saved state
+    std::atomic<bool> latencyProbe;
+    uint64_t blockEntryTime = 0;                        // Of the block being processed
+    
+    // Copy a serialized message, stamp it and send it
+    void sendProbed (OutputTransport::Destination destination, const char* data, int size, uint64_t featureTime);
+    
+    //==============================================================================
+    // FeatureSink : called by the engine, on the audio thread
+    void signalLevelComputed (int group, int64_t time, float level) override;
+    void signalInstantValComputed (int group, int64_t time, float value) override;
+    void impulseDetected (int group, int64_t time) override;
+    void logFFTComputed (int group, int64_t time, const float* bands, int nbOfBands, float fundamentalFreq) override;
+    void linearFFTComputed (int group, int64_t time, const float* bins, int nbOfBins, float fundamentalFreq) override;
+    
     //==============================================================================
     // Functions used to output the different available messages
-    void sendImpulseMsg();
-    void sendSignalLevelMsg();
-    void sendSignalInstantValMsg(float val);
     void sendTimeinfoMsg();
-    void sendFFTMsg();
+    
+    // Forward the MIDI events of the block, before the features computed on it : one MidiEvent message and one
+    // OSC MIDI message with all the events, or several when they do not fit in midiEventPacketSize bytes
+    void sendMidiEvents (const MidiBuffer& midiMessages);
+    void sendMidiEventPacket();
+    SignalWireFormat::MidiEventMessage midiEventMessage;
+    
+    //==============================================================================
+    // Output policies (rate limit, deadband, keep-alive) of the continuous streams.
+    // Impulses and time info are events : they are always sent
+    enum OutputStreams
+    {
+        signalLevelStream = 0,
+        signalInstantValStream,
+        fftStream,
+        totalNumOutputStreams
+    };
+    
+    static const char* getOutputStreamName (int stream);    // Name used in the saved state and by the OSC control server
+    StreamOutputGate outputGates[totalNumOutputStreams];
+    
+    // Totals of the transport's sockets and of the output policies, collected with lastStats and sent in the
+    // stats message. The previous collection is kept, so the editor can display the last interval
+    struct OutputCounters
+    {
+        OutputTransport::Counters transports[OutputTransport::totalNumCounters];
+        uint64 sent[totalNumOutputStreams];
+        uint64 suppressed[totalNumOutputStreams];
+    };
+    OutputCounters outputCounters {};
+    OutputCounters previousOutputCounters {};
+    
+    // Stats.Destination of the counters of a socket : the MIDI event port was added after the OSC port
+    static int getStatsDestination (int counterIndex);
     
     //==============================================================================
     // Socket used to forward data to the Processing application, and the variables associated with it
@@ -202,9 +312,16 @@ public:
     const int portNumberImpulse          = 7003;
     const int portNumberTimeInfo         = 7004;
     const int portNumberFFT              = 7005;
+    const int portNumberStats            = 7006;
+    const int portNumberMidiEvent        = 7007;
     const int nbOfSamplesToSkip          = 6;
     const int timeInfoCycle              = 1024;         // Send the time info message every 2048 samples, that's about 25ms
-    const String udpIpAddress            = "127.0.0.1";
+    const String udpIpAddress;
+    const int udpPortNumbers[OutputTransport::totalNumDestinations] =      // In the OutputTransport::Destination order
+    {
+        portNumberSignalLevel, portNumberSignalInstantVal, portNumberImpulse, portNumberTimeInfo, portNumberFFT, portNumberStats,
+        portNumberMidiEvent
+    };
     
     //==============================================================================
     // OSC Functions
@@ -215,11 +332,19 @@ public:
     void sendOSC_Impulse();
     void sendOSC_FFT();
     
-    // OSC socket and output buffer
+    // OSC output buffer (the OSC socket belongs to outputTransport)
     const int portNumberOSC           = 9000;
     const int oscOutputBufferSize     = 384;            //Should be enough
     char* oscOutputBuffer;
-    UdpTransmitSocket oscTransmissionSocket;
+    
+    // The MIDI events of a block are sent in a single OSC packet : they have their own, larger buffer
+    osc::OutboundPacketStream* oscMidiOutputStream;
+    char* oscMidiOutputBuffer;
+    
+    // OSC control server : remote parameter changes, ex: /sp/1/param/inputSensitivity 2.5
+    // and output policies, ex: /sp/1/policy/signalLevel 30 0.001 0 1
+    const int portNumberOSCControl    = 9001;
+    OscControlServer oscControlServer;
     
     // Messages used for OSC transmission
     const char* fftOSCString               = "FFT";
@@ -228,11 +353,8 @@ public:
     const char* impulseOSCString           = "IMPULSE";
     const char* timeInfoOSCString          = "TIMEINFO";
     
-    udp_client udpClientTimeInfo;
-    udp_client udpClientSignalLevel;
-    udp_client udpClientSignalInstantVal;
-    udp_client udpClientImpulse;
-    udp_client udpClientFFT;
+    // Protobuf and OSC sockets, created in the background the first time an output is needed
+    OutputTransport outputTransport;
     
     char* dataArrayTimeInfo;
     char* dataArrayImpulse;
@@ -240,6 +362,18 @@ public:
     char* dataArrayInstantVal;
     char* dataArrayLogFFT;
     char* dataArrayLinearFFT;
+    char* dataArrayMidiEvent;
+    
+    // The groups are sent with signal IDs up to SignalWireFormat::maxNbOfSignalIDs : the buffers of their messages
+    // are sized for the largest one, which takes one more varint byte than a channel number
+    int impulseBufferSize, levelBufferSize, instantValBufferSize, logFFTBufferSize, linearFFTBufferSize;
+    const int midiEventPacketSize       = 4096;     // Protobuf and OSC
+    
+    // Bytes an OSC MIDI message takes, at most, besides the MIDI data : its bundle, address, type tags and signal ID,
+    // then per event. The OSC header is larger than the Protobuf one, so sendMidiEvents splits the events with the
+    // larger bounds of the two encodings : both then fit in midiEventPacketSize, but an event too large on its own
+    static const int maxOscMidiHeaderSize       = 40;
+    static const int maxOscMidiEventOverhead    = 24;
     
     //==============================================================================
     // Small optimisation : always use the same SignalMessages objects, it saves allocating a new one every time
@@ -0,0 +1,188 @@
+/*
+ ==============================================================================
+
+    RealFFT.cpp
+    PlayMe - SignalProcessor
+    Forward real-to-complex DFT, vDSP or portable
+
+ ==============================================================================
+ */
+
+#include "RealFFT.h"
+#include <cmath>
+#include <map>
+#include <mutex>
+
+#ifdef __APPLE__
+ #include <Accelerate/Accelerate.h>         // the Accelerate headers are needed to use vDSP
+#endif
+
+//==============================================================================
+#ifdef __APPLE__
+
+struct RealFFT::Setup
+{
+    Setup (int size)
+    {
+        zop_Setup = vDSP_DFT_zop_CreateSetup(0, size, vDSP_DFT_FORWARD);
+        zrop_Setup = vDSP_DFT_zrop_CreateSetup(zop_Setup, size, vDSP_DFT_FORWARD);
+    }
+
+    ~Setup()
+    {
+        vDSP_DFT_DestroySetup(zrop_Setup);
+        vDSP_DFT_DestroySetup(zop_Setup);
+    }
+
+    vDSP_DFT_Setup zop_Setup;
+    vDSP_DFT_Setup zrop_Setup;
+};
+
+#else
+
+// The N real samples are transformed as N/2 complex ones (even samples as the real parts, odd samples as
+// the imaginary parts), then the N/2 + 1 values of the real DFT are separated from the complex result
+struct RealFFT::Setup
+{
+    Setup (int size)
+        : halfSize (size / 2), bitReversed (size / 2),
+          cosines (size / 4), sines (size / 4), splitCosines (size / 2), splitSines (size / 2)
+    {
+        const double pi = 3.14159265358979323846;
+
+        int nbOfBits = 0;
+        while ((1 << nbOfBits) < halfSize)
+            ++nbOfBits;
+
+        for (int i = 0; i < halfSize; ++i)
+        {
+            int reversed = 0;
+            for (int bit = 0; bit < nbOfBits; ++bit)
+                reversed |= ((i >> bit) & 1) << (nbOfBits - 1 - bit);
+            bitReversed[i] = reversed;
+        }
+
+        // Twiddles of the N/2 complex DFT
+        for (int i = 0; i < halfSize / 2; ++i)
+        {
+            cosines[i] = (float) std::cos (2 * pi * i / halfSize);
+            sines[i]   = (float) std::sin (2 * pi * i / halfSize);
+        }
+
+        // Twiddles of the real DFT split
+        for (int i = 0; i < halfSize; ++i)
+        {
+            splitCosines[i] = (float) std::cos (2 * pi * i / size);
+            splitSines[i]   = (float) std::sin (2 * pi * i / size);
+        }
+    }
+
+    const int halfSize;
+    std::vector<int> bitReversed;
+    std::vector<float> cosines, sines;
+    std::vector<float> splitCosines, splitSines;
+};
+
+#endif
+
+//==============================================================================
+static std::shared_ptr<const RealFFT::Setup> getSharedSetup (int size)
+{
+    static std::mutex mutex;
+    static std::map<int, std::weak_ptr<const RealFFT::Setup> > setups;
+
+    std::lock_guard<std::mutex> lock (mutex);
+    std::shared_ptr<const RealFFT::Setup> setup = setups[size].lock();
+    if (setup == nullptr)
+    {
+        setup = std::make_shared<const RealFFT::Setup> (size);
+        setups[size] = setup;
+    }
+
+    return setup;
+}
+
+RealFFT::RealFFT (unsigned int log2Size)
+    : size (1 << log2Size), setup (getSharedSetup (1 << log2Size)),
+      workReal (size / 2), workImag (size / 2)
+{
+}
+
+RealFFT::~RealFFT()
+{
+}
+
+//==============================================================================
+#ifdef __APPLE__
+
+void RealFFT::perform (const float* input, float* realp, float* imagp)
+{
+    // Reinterpret the signal as an interleaved-data complex vector and use vDSP_ctoz to move the data to a
+    // separated-data complex vector. The stride is equal to 2 because the imaginary elements are skipped
+    DSPSplitComplex buffer = { workReal.data(), workImag.data() };
+    vDSP_ctoz((const DSPComplex *) input, 2, &buffer, 1, size / 2);
+
+    vDSP_DFT_Execute(setup->zrop_Setup, buffer.realp, buffer.imagp, realp, imagp);
+}
+
+#else
+
+void RealFFT::perform (const float* input, float* realp, float* imagp)
+{
+    const int halfSize = setup->halfSize;
+    float* const re = workReal.data();
+    float* const im = workImag.data();
+
+    // Even and odd samples, in bit-reversed order
+    for (int i = 0; i < halfSize; ++i)
+    {
+        const int j = setup->bitReversed[i];
+        re[j] = input[2 * i];
+        im[j] = input[2 * i + 1];
+    }
+
+    // Iterative radix-2 complex DFT of halfSize values
+    for (int length = 2; length <= halfSize; length <<= 1)
+    {
+        const int half = length / 2;
+        const int step = halfSize / length;
+
+        for (int start = 0; start < halfSize; start += length)
+        {
+            for (int k = 0; k < half; ++k)
+            {
+                const float wr =  setup->cosines[k * step];
+                const float wi = -setup->sines[k * step];
+                const int a = start + k;
+                const int b = a + half;
+
+                const float tr = re[b] * wr - im[b] * wi;
+                const float ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+
+    // Split : X[k] = E[k] + W^k O[k], with E and O the DFTs of the even and odd samples, scaled by 2 as vDSP
+    realp[0] = 2 * (re[0] + im[0]);
+    imagp[0] = 2 * (re[0] - im[0]);
+
+    for (int k = 1; k < halfSize; ++k)
+    {
+        const float zr = re[k],            zi = im[k];
+        const float cr = re[halfSize - k], ci = -im[halfSize - k];      // conj (Z[N/2 - k])
+
+        const float er = (zr + cr) * 0.5f, ei = (zi + ci) * 0.5f;
+        const float orr = (zi - ci) * 0.5f, oi = -(zr - cr) * 0.5f;
+
+        const float wr = setup->splitCosines[k], wi = -setup->splitSines[k];
+
+        realp[k] = 2 * (er + wr * orr - wi * oi);
+        imagp[k] = 2 * (ei + wr * oi + wi * orr);
+    }
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ ==============================================================================
+
+    RealFFT.h
+    PlayMe - SignalProcessor
+    Forward real-to-complex DFT. Uses vDSP (Accelerate) on Apple platforms,
+    and a portable radix-2 implementation everywhere else, with the same
+    output layout and scale as vDSP_DFT_zrop_CreateSetup
+
+ ==============================================================================
+ */
+
+#ifndef REALFFT_H_INCLUDED
+#define REALFFT_H_INCLUDED
+
+#include <memory>
+#include <vector>
+
+//==============================================================================
+/**
+    The setup only depends on the size : a single one is shared by all the
+    RealFFT objects of the same size (the plugin's instances), it is created
+    with the first of them and destroyed with the last one.
+    perform() does not allocate : it can be called by the audio thread
+ */
+class RealFFT
+{
+public:
+    // size = 1 << log2Size
+    explicit RealFFT (unsigned int log2Size);
+    ~RealFFT();
+
+    int getSize() const         { return size; }
+
+    // input : getSize() samples. realp and imagp : getSize() / 2 values each.
+    // realp[0] holds the DC component and imagp[0] the Nyquist one, every value is twice the
+    // mathematical DFT, as vDSP does
+    void perform (const float* input, float* realp, float* imagp);
+
+    struct Setup;
+
+private:
+    const int size;
+    std::shared_ptr<const Setup> setup;
+    std::vector<float> workReal, workImag;
+
+    RealFFT (const RealFFT&) = delete;
+    RealFFT& operator= (const RealFFT&) = delete;
+};
+
+#endif  // REALFFT_H_INCLUDED
@@ -4664,6 +4664,7170 @@ public final class SignalMessages {
     // @@protoc_insertion_point(class_scope:TimeInfo)
   }
 
+  public interface MidiEventOrBuilder
+      extends com.google.protobuf.MessageOrBuilder {
+
+    // required int32 signalID = 1 [default = 1];
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    boolean hasSignalID();
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    int getSignalID();
+
+    // required bool isPlaying = 2 [default = false];
+    /**
+     * <code>required bool isPlaying = 2 [default = false];</code>
+     */
+    boolean hasIsPlaying();
+    /**
+     * <code>required bool isPlaying = 2 [default = false];</code>
+     */
+    boolean getIsPlaying();
+
+    // repeated .MidiEvent.Event events = 3;
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    java.util.List<SignalMessages.MidiEvent.Event> 
+        getEventsList();
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    SignalMessages.MidiEvent.Event getEvents(int index);
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    int getEventsCount();
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    java.util.List<? extends SignalMessages.MidiEvent.EventOrBuilder> 
+        getEventsOrBuilderList();
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    SignalMessages.MidiEvent.EventOrBuilder getEventsOrBuilder(
+        int index);
+  }
+  /**
+   * Protobuf type {@code MidiEvent}
+   *
+   * <pre>
+   * MIDI events the host passed to one processBlock call, all sent in one packet (several if they do not fit in
+   * one), right before the features computed on the same block. When the host has no transport, timeInSamples
+   * counts the samples the plugin has processed, and ppqPosition is not set
+   * </pre>
+   */
+  public static final class MidiEvent extends
+      com.google.protobuf.GeneratedMessage
+      implements MidiEventOrBuilder {
+    // Use MidiEvent.newBuilder() to construct.
+    private MidiEvent(com.google.protobuf.GeneratedMessage.Builder<?> builder) {
+      super(builder);
+      this.unknownFields = builder.getUnknownFields();
+    }
+    private MidiEvent(boolean noInit) { this.unknownFields = com.google.protobuf.UnknownFieldSet.getDefaultInstance(); }
+
+    private static final MidiEvent defaultInstance;
+    public static MidiEvent getDefaultInstance() {
+      return defaultInstance;
+    }
+
+    public MidiEvent getDefaultInstanceForType() {
+      return defaultInstance;
+    }
+
+    private final com.google.protobuf.UnknownFieldSet unknownFields;
+    @java.lang.Override
+    public final com.google.protobuf.UnknownFieldSet
+        getUnknownFields() {
+      return this.unknownFields;
+    }
+    private MidiEvent(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      initFields();
+      int mutable_bitField0_ = 0;
+      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
+          com.google.protobuf.UnknownFieldSet.newBuilder();
+      try {
+        boolean done = false;
+        while (!done) {
+          int tag = input.readTag();
+          switch (tag) {
+            case 0:
+              done = true;
+              break;
+            default: {
+              if (!parseUnknownField(input, unknownFields,
+                                     extensionRegistry, tag)) {
+                done = true;
+              }
+              break;
+            }
+            case 8: {
+              bitField0_ |= 0x00000001;
+              signalID_ = input.readInt32();
+              break;
+            }
+            case 16: {
+              bitField0_ |= 0x00000002;
+              isPlaying_ = input.readBool();
+              break;
+            }
+            case 26: {
+              if (!((mutable_bitField0_ & 0x00000004) == 0x00000004)) {
+                events_ = new java.util.ArrayList<SignalMessages.MidiEvent.Event>();
+                mutable_bitField0_ |= 0x00000004;
+              }
+              events_.add(input.readMessage(SignalMessages.MidiEvent.Event.PARSER, extensionRegistry));
+              break;
+            }
+          }
+        }
+      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+        throw e.setUnfinishedMessage(this);
+      } catch (java.io.IOException e) {
+        throw new com.google.protobuf.InvalidProtocolBufferException(
+            e.getMessage()).setUnfinishedMessage(this);
+      } finally {
+        if (((mutable_bitField0_ & 0x00000004) == 0x00000004)) {
+          events_ = java.util.Collections.unmodifiableList(events_);
+        }
+        this.unknownFields = unknownFields.build();
+        makeExtensionsImmutable();
+      }
+    }
+    public static final com.google.protobuf.Descriptors.Descriptor
+        getDescriptor() {
+      return SignalMessages.internal_static_MidiEvent_descriptor;
+    }
+
+    protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+        internalGetFieldAccessorTable() {
+      return SignalMessages.internal_static_MidiEvent_fieldAccessorTable
+          .ensureFieldAccessorsInitialized(
+              SignalMessages.MidiEvent.class, SignalMessages.MidiEvent.Builder.class);
+    }
+
+    public static com.google.protobuf.Parser<MidiEvent> PARSER =
+        new com.google.protobuf.AbstractParser<MidiEvent>() {
+      public MidiEvent parsePartialFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return new MidiEvent(input, extensionRegistry);
+      }
+    };
+
+    @java.lang.Override
+    public com.google.protobuf.Parser<MidiEvent> getParserForType() {
+      return PARSER;
+    }
+
+    public interface EventOrBuilder
+        extends com.google.protobuf.MessageOrBuilder {
+
+      // required int32 sampleOffset = 1;
+      /**
+       * <code>required int32 sampleOffset = 1;</code>
+       *
+       * <pre>
+       *Position of the event in its block, in samples
+       * </pre>
+       */
+      boolean hasSampleOffset();
+      /**
+       * <code>required int32 sampleOffset = 1;</code>
+       *
+       * <pre>
+       *Position of the event in its block, in samples
+       * </pre>
+       */
+      int getSampleOffset();
+
+      // required int64 timeInSamples = 2;
+      /**
+       * <code>required int64 timeInSamples = 2;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in samples
+       * </pre>
+       */
+      boolean hasTimeInSamples();
+      /**
+       * <code>required int64 timeInSamples = 2;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in samples
+       * </pre>
+       */
+      long getTimeInSamples();
+
+      // optional double ppqPosition = 3;
+      /**
+       * <code>optional double ppqPosition = 3;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in pulses-per-quarter-note
+       * </pre>
+       */
+      boolean hasPpqPosition();
+      /**
+       * <code>optional double ppqPosition = 3;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in pulses-per-quarter-note
+       * </pre>
+       */
+      double getPpqPosition();
+
+      // required bytes data = 4;
+      /**
+       * <code>required bytes data = 4;</code>
+       *
+       * <pre>
+       *MIDI message : status byte, then its data bytes
+       * </pre>
+       */
+      boolean hasData();
+      /**
+       * <code>required bytes data = 4;</code>
+       *
+       * <pre>
+       *MIDI message : status byte, then its data bytes
+       * </pre>
+       */
+      com.google.protobuf.ByteString getData();
+    }
+    /**
+     * Protobuf type {@code MidiEvent.Event}
+     */
+    public static final class Event extends
+        com.google.protobuf.GeneratedMessage
+        implements EventOrBuilder {
+      // Use Event.newBuilder() to construct.
+      private Event(com.google.protobuf.GeneratedMessage.Builder<?> builder) {
+        super(builder);
+        this.unknownFields = builder.getUnknownFields();
+      }
+      private Event(boolean noInit) { this.unknownFields = com.google.protobuf.UnknownFieldSet.getDefaultInstance(); }
+
+      private static final Event defaultInstance;
+      public static Event getDefaultInstance() {
+        return defaultInstance;
+      }
+
+      public Event getDefaultInstanceForType() {
+        return defaultInstance;
+      }
+
+      private final com.google.protobuf.UnknownFieldSet unknownFields;
+      @java.lang.Override
+      public final com.google.protobuf.UnknownFieldSet
+          getUnknownFields() {
+        return this.unknownFields;
+      }
+      private Event(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        initFields();
+        int mutable_bitField0_ = 0;
+        com.google.protobuf.UnknownFieldSet.Builder unknownFields =
+            com.google.protobuf.UnknownFieldSet.newBuilder();
+        try {
+          boolean done = false;
+          while (!done) {
+            int tag = input.readTag();
+            switch (tag) {
+              case 0:
+                done = true;
+                break;
+              default: {
+                if (!parseUnknownField(input, unknownFields,
+                                       extensionRegistry, tag)) {
+                  done = true;
+                }
+                break;
+              }
+              case 8: {
+                bitField0_ |= 0x00000001;
+                sampleOffset_ = input.readInt32();
+                break;
+              }
+              case 16: {
+                bitField0_ |= 0x00000002;
+                timeInSamples_ = input.readInt64();
+                break;
+              }
+              case 25: {
+                bitField0_ |= 0x00000004;
+                ppqPosition_ = input.readDouble();
+                break;
+              }
+              case 34: {
+                bitField0_ |= 0x00000008;
+                data_ = input.readBytes();
+                break;
+              }
+            }
+          }
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          throw e.setUnfinishedMessage(this);
+        } catch (java.io.IOException e) {
+          throw new com.google.protobuf.InvalidProtocolBufferException(
+              e.getMessage()).setUnfinishedMessage(this);
+        } finally {
+          this.unknownFields = unknownFields.build();
+          makeExtensionsImmutable();
+        }
+      }
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return SignalMessages.internal_static_MidiEvent_Event_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return SignalMessages.internal_static_MidiEvent_Event_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                SignalMessages.MidiEvent.Event.class, SignalMessages.MidiEvent.Event.Builder.class);
+      }
+
+      public static com.google.protobuf.Parser<Event> PARSER =
+          new com.google.protobuf.AbstractParser<Event>() {
+        public Event parsePartialFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws com.google.protobuf.InvalidProtocolBufferException {
+          return new Event(input, extensionRegistry);
+        }
+      };
+
+      @java.lang.Override
+      public com.google.protobuf.Parser<Event> getParserForType() {
+        return PARSER;
+      }
+
+      private int bitField0_;
+      // required int32 sampleOffset = 1;
+      public static final int SAMPLEOFFSET_FIELD_NUMBER = 1;
+      private int sampleOffset_;
+      /**
+       * <code>required int32 sampleOffset = 1;</code>
+       *
+       * <pre>
+       *Position of the event in its block, in samples
+       * </pre>
+       */
+      public boolean hasSampleOffset() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required int32 sampleOffset = 1;</code>
+       *
+       * <pre>
+       *Position of the event in its block, in samples
+       * </pre>
+       */
+      public int getSampleOffset() {
+        return sampleOffset_;
+      }
+
+      // required int64 timeInSamples = 2;
+      public static final int TIMEINSAMPLES_FIELD_NUMBER = 2;
+      private long timeInSamples_;
+      /**
+       * <code>required int64 timeInSamples = 2;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in samples
+       * </pre>
+       */
+      public boolean hasTimeInSamples() {
+        return ((bitField0_ & 0x00000002) == 0x00000002);
+      }
+      /**
+       * <code>required int64 timeInSamples = 2;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in samples
+       * </pre>
+       */
+      public long getTimeInSamples() {
+        return timeInSamples_;
+      }
+
+      // optional double ppqPosition = 3;
+      public static final int PPQPOSITION_FIELD_NUMBER = 3;
+      private double ppqPosition_;
+      /**
+       * <code>optional double ppqPosition = 3;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in pulses-per-quarter-note
+       * </pre>
+       */
+      public boolean hasPpqPosition() {
+        return ((bitField0_ & 0x00000004) == 0x00000004);
+      }
+      /**
+       * <code>optional double ppqPosition = 3;</code>
+       *
+       * <pre>
+       *Host timeline position of the event, in pulses-per-quarter-note
+       * </pre>
+       */
+      public double getPpqPosition() {
+        return ppqPosition_;
+      }
+
+      // required bytes data = 4;
+      public static final int DATA_FIELD_NUMBER = 4;
+      private com.google.protobuf.ByteString data_;
+      /**
+       * <code>required bytes data = 4;</code>
+       *
+       * <pre>
+       *MIDI message : status byte, then its data bytes
+       * </pre>
+       */
+      public boolean hasData() {
+        return ((bitField0_ & 0x00000008) == 0x00000008);
+      }
+      /**
+       * <code>required bytes data = 4;</code>
+       *
+       * <pre>
+       *MIDI message : status byte, then its data bytes
+       * </pre>
+       */
+      public com.google.protobuf.ByteString getData() {
+        return data_;
+      }
+
+      private void initFields() {
+        sampleOffset_ = 0;
+        timeInSamples_ = 0L;
+        ppqPosition_ = 0D;
+        data_ = com.google.protobuf.ByteString.EMPTY;
+      }
+      private byte memoizedIsInitialized = -1;
+      public final boolean isInitialized() {
+        byte isInitialized = memoizedIsInitialized;
+        if (isInitialized != -1) return isInitialized == 1;
+
+        if (!hasSampleOffset()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasTimeInSamples()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasData()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        memoizedIsInitialized = 1;
+        return true;
+      }
+
+      public void writeTo(com.google.protobuf.CodedOutputStream output)
+                          throws java.io.IOException {
+        getSerializedSize();
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          output.writeInt32(1, sampleOffset_);
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          output.writeInt64(2, timeInSamples_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          output.writeDouble(3, ppqPosition_);
+        }
+        if (((bitField0_ & 0x00000008) == 0x00000008)) {
+          output.writeBytes(4, data_);
+        }
+        getUnknownFields().writeTo(output);
+      }
+
+      private int memoizedSerializedSize = -1;
+      public int getSerializedSize() {
+        int size = memoizedSerializedSize;
+        if (size != -1) return size;
+
+        size = 0;
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeInt32Size(1, sampleOffset_);
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeInt64Size(2, timeInSamples_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeDoubleSize(3, ppqPosition_);
+        }
+        if (((bitField0_ & 0x00000008) == 0x00000008)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeBytesSize(4, data_);
+        }
+        size += getUnknownFields().getSerializedSize();
+        memoizedSerializedSize = size;
+        return size;
+      }
+
+      private static final long serialVersionUID = 0L;
+      @java.lang.Override
+      protected java.lang.Object writeReplace()
+          throws java.io.ObjectStreamException {
+        return super.writeReplace();
+      }
+
+      public static SignalMessages.MidiEvent.Event parseFrom(
+          com.google.protobuf.ByteString data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.MidiEvent.Event parseFrom(
+          com.google.protobuf.ByteString data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.MidiEvent.Event parseFrom(byte[] data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.MidiEvent.Event parseFrom(
+          byte[] data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.MidiEvent.Event parseFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.MidiEvent.Event parseFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.MidiEvent.Event parseDelimitedFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input);
+      }
+      public static SignalMessages.MidiEvent.Event parseDelimitedFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.MidiEvent.Event parseFrom(
+          com.google.protobuf.CodedInputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.MidiEvent.Event parseFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+
+      public static Builder newBuilder() { return Builder.create(); }
+      public Builder newBuilderForType() { return newBuilder(); }
+      public static Builder newBuilder(SignalMessages.MidiEvent.Event prototype) {
+        return newBuilder().mergeFrom(prototype);
+      }
+      public Builder toBuilder() { return newBuilder(this); }
+
+      @java.lang.Override
+      protected Builder newBuilderForType(
+          com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+        Builder builder = new Builder(parent);
+        return builder;
+      }
+      /**
+       * Protobuf type {@code MidiEvent.Event}
+       */
+      public static final class Builder extends
+          com.google.protobuf.GeneratedMessage.Builder<Builder>
+         implements SignalMessages.MidiEvent.EventOrBuilder {
+        public static final com.google.protobuf.Descriptors.Descriptor
+            getDescriptor() {
+          return SignalMessages.internal_static_MidiEvent_Event_descriptor;
+        }
+
+        protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+            internalGetFieldAccessorTable() {
+          return SignalMessages.internal_static_MidiEvent_Event_fieldAccessorTable
+              .ensureFieldAccessorsInitialized(
+                  SignalMessages.MidiEvent.Event.class, SignalMessages.MidiEvent.Event.Builder.class);
+        }
+
+        // Construct using SignalMessages.MidiEvent.Event.newBuilder()
+        private Builder() {
+          maybeForceBuilderInitialization();
+        }
+
+        private Builder(
+            com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+          super(parent);
+          maybeForceBuilderInitialization();
+        }
+        private void maybeForceBuilderInitialization() {
+          if (com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders) {
+          }
+        }
+        private static Builder create() {
+          return new Builder();
+        }
+
+        public Builder clear() {
+          super.clear();
+          sampleOffset_ = 0;
+          bitField0_ = (bitField0_ & ~0x00000001);
+          timeInSamples_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000002);
+          ppqPosition_ = 0D;
+          bitField0_ = (bitField0_ & ~0x00000004);
+          data_ = com.google.protobuf.ByteString.EMPTY;
+          bitField0_ = (bitField0_ & ~0x00000008);
+          return this;
+        }
+
+        public Builder clone() {
+          return create().mergeFrom(buildPartial());
+        }
+
+        public com.google.protobuf.Descriptors.Descriptor
+            getDescriptorForType() {
+          return SignalMessages.internal_static_MidiEvent_Event_descriptor;
+        }
+
+        public SignalMessages.MidiEvent.Event getDefaultInstanceForType() {
+          return SignalMessages.MidiEvent.Event.getDefaultInstance();
+        }
+
+        public SignalMessages.MidiEvent.Event build() {
+          SignalMessages.MidiEvent.Event result = buildPartial();
+          if (!result.isInitialized()) {
+            throw newUninitializedMessageException(result);
+          }
+          return result;
+        }
+
+        public SignalMessages.MidiEvent.Event buildPartial() {
+          SignalMessages.MidiEvent.Event result = new SignalMessages.MidiEvent.Event(this);
+          int from_bitField0_ = bitField0_;
+          int to_bitField0_ = 0;
+          if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+            to_bitField0_ |= 0x00000001;
+          }
+          result.sampleOffset_ = sampleOffset_;
+          if (((from_bitField0_ & 0x00000002) == 0x00000002)) {
+            to_bitField0_ |= 0x00000002;
+          }
+          result.timeInSamples_ = timeInSamples_;
+          if (((from_bitField0_ & 0x00000004) == 0x00000004)) {
+            to_bitField0_ |= 0x00000004;
+          }
+          result.ppqPosition_ = ppqPosition_;
+          if (((from_bitField0_ & 0x00000008) == 0x00000008)) {
+            to_bitField0_ |= 0x00000008;
+          }
+          result.data_ = data_;
+          result.bitField0_ = to_bitField0_;
+          onBuilt();
+          return result;
+        }
+
+        public Builder mergeFrom(com.google.protobuf.Message other) {
+          if (other instanceof SignalMessages.MidiEvent.Event) {
+            return mergeFrom((SignalMessages.MidiEvent.Event)other);
+          } else {
+            super.mergeFrom(other);
+            return this;
+          }
+        }
+
+        public Builder mergeFrom(SignalMessages.MidiEvent.Event other) {
+          if (other == SignalMessages.MidiEvent.Event.getDefaultInstance()) return this;
+          if (other.hasSampleOffset()) {
+            setSampleOffset(other.getSampleOffset());
+          }
+          if (other.hasTimeInSamples()) {
+            setTimeInSamples(other.getTimeInSamples());
+          }
+          if (other.hasPpqPosition()) {
+            setPpqPosition(other.getPpqPosition());
+          }
+          if (other.hasData()) {
+            setData(other.getData());
+          }
+          this.mergeUnknownFields(other.getUnknownFields());
+          return this;
+        }
+
+        public final boolean isInitialized() {
+          if (!hasSampleOffset()) {
+            
+            return false;
+          }
+          if (!hasTimeInSamples()) {
+            
+            return false;
+          }
+          if (!hasData()) {
+            
+            return false;
+          }
+          return true;
+        }
+
+        public Builder mergeFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws java.io.IOException {
+          SignalMessages.MidiEvent.Event parsedMessage = null;
+          try {
+            parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+          } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+            parsedMessage = (SignalMessages.MidiEvent.Event) e.getUnfinishedMessage();
+            throw e;
+          } finally {
+            if (parsedMessage != null) {
+              mergeFrom(parsedMessage);
+            }
+          }
+          return this;
+        }
+        private int bitField0_;
+
+        // required int32 sampleOffset = 1;
+        private int sampleOffset_ ;
+        /**
+         * <code>required int32 sampleOffset = 1;</code>
+         *
+         * <pre>
+         *Position of the event in its block, in samples
+         * </pre>
+         */
+        public boolean hasSampleOffset() {
+          return ((bitField0_ & 0x00000001) == 0x00000001);
+        }
+        /**
+         * <code>required int32 sampleOffset = 1;</code>
+         *
+         * <pre>
+         *Position of the event in its block, in samples
+         * </pre>
+         */
+        public int getSampleOffset() {
+          return sampleOffset_;
+        }
+        /**
+         * <code>required int32 sampleOffset = 1;</code>
+         *
+         * <pre>
+         *Position of the event in its block, in samples
+         * </pre>
+         */
+        public Builder setSampleOffset(int value) {
+          bitField0_ |= 0x00000001;
+          sampleOffset_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required int32 sampleOffset = 1;</code>
+         *
+         * <pre>
+         *Position of the event in its block, in samples
+         * </pre>
+         */
+        public Builder clearSampleOffset() {
+          bitField0_ = (bitField0_ & ~0x00000001);
+          sampleOffset_ = 0;
+          onChanged();
+          return this;
+        }
+
+        // required int64 timeInSamples = 2;
+        private long timeInSamples_ ;
+        /**
+         * <code>required int64 timeInSamples = 2;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in samples
+         * </pre>
+         */
+        public boolean hasTimeInSamples() {
+          return ((bitField0_ & 0x00000002) == 0x00000002);
+        }
+        /**
+         * <code>required int64 timeInSamples = 2;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in samples
+         * </pre>
+         */
+        public long getTimeInSamples() {
+          return timeInSamples_;
+        }
+        /**
+         * <code>required int64 timeInSamples = 2;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in samples
+         * </pre>
+         */
+        public Builder setTimeInSamples(long value) {
+          bitField0_ |= 0x00000002;
+          timeInSamples_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required int64 timeInSamples = 2;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in samples
+         * </pre>
+         */
+        public Builder clearTimeInSamples() {
+          bitField0_ = (bitField0_ & ~0x00000002);
+          timeInSamples_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional double ppqPosition = 3;
+        private double ppqPosition_ ;
+        /**
+         * <code>optional double ppqPosition = 3;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in pulses-per-quarter-note
+         * </pre>
+         */
+        public boolean hasPpqPosition() {
+          return ((bitField0_ & 0x00000004) == 0x00000004);
+        }
+        /**
+         * <code>optional double ppqPosition = 3;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in pulses-per-quarter-note
+         * </pre>
+         */
+        public double getPpqPosition() {
+          return ppqPosition_;
+        }
+        /**
+         * <code>optional double ppqPosition = 3;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in pulses-per-quarter-note
+         * </pre>
+         */
+        public Builder setPpqPosition(double value) {
+          bitField0_ |= 0x00000004;
+          ppqPosition_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional double ppqPosition = 3;</code>
+         *
+         * <pre>
+         *Host timeline position of the event, in pulses-per-quarter-note
+         * </pre>
+         */
+        public Builder clearPpqPosition() {
+          bitField0_ = (bitField0_ & ~0x00000004);
+          ppqPosition_ = 0D;
+          onChanged();
+          return this;
+        }
+
+        // required bytes data = 4;
+        private com.google.protobuf.ByteString data_ = com.google.protobuf.ByteString.EMPTY;
+        /**
+         * <code>required bytes data = 4;</code>
+         *
+         * <pre>
+         *MIDI message : status byte, then its data bytes
+         * </pre>
+         */
+        public boolean hasData() {
+          return ((bitField0_ & 0x00000008) == 0x00000008);
+        }
+        /**
+         * <code>required bytes data = 4;</code>
+         *
+         * <pre>
+         *MIDI message : status byte, then its data bytes
+         * </pre>
+         */
+        public com.google.protobuf.ByteString getData() {
+          return data_;
+        }
+        /**
+         * <code>required bytes data = 4;</code>
+         *
+         * <pre>
+         *MIDI message : status byte, then its data bytes
+         * </pre>
+         */
+        public Builder setData(com.google.protobuf.ByteString value) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          bitField0_ |= 0x00000008;
+          data_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required bytes data = 4;</code>
+         *
+         * <pre>
+         *MIDI message : status byte, then its data bytes
+         * </pre>
+         */
+        public Builder clearData() {
+          bitField0_ = (bitField0_ & ~0x00000008);
+          data_ = getDefaultInstance().getData();
+          onChanged();
+          return this;
+        }
+
+        // @@protoc_insertion_point(builder_scope:MidiEvent.Event)
+      }
+
+      static {
+        defaultInstance = new Event(true);
+        defaultInstance.initFields();
+      }
+
+      // @@protoc_insertion_point(class_scope:MidiEvent.Event)
+    }
+
+    private int bitField0_;
+    // required int32 signalID = 1 [default = 1];
+    public static final int SIGNALID_FIELD_NUMBER = 1;
+    private int signalID_;
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    public boolean hasSignalID() {
+      return ((bitField0_ & 0x00000001) == 0x00000001);
+    }
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    public int getSignalID() {
+      return signalID_;
+    }
+
+    // required bool isPlaying = 2 [default = false];
+    public static final int ISPLAYING_FIELD_NUMBER = 2;
+    private boolean isPlaying_;
+    /**
+     * <code>required bool isPlaying = 2 [default = false];</code>
+     */
+    public boolean hasIsPlaying() {
+      return ((bitField0_ & 0x00000002) == 0x00000002);
+    }
+    /**
+     * <code>required bool isPlaying = 2 [default = false];</code>
+     */
+    public boolean getIsPlaying() {
+      return isPlaying_;
+    }
+
+    // repeated .MidiEvent.Event events = 3;
+    public static final int EVENTS_FIELD_NUMBER = 3;
+    private java.util.List<SignalMessages.MidiEvent.Event> events_;
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    public java.util.List<SignalMessages.MidiEvent.Event> getEventsList() {
+      return events_;
+    }
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    public java.util.List<? extends SignalMessages.MidiEvent.EventOrBuilder> 
+        getEventsOrBuilderList() {
+      return events_;
+    }
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    public int getEventsCount() {
+      return events_.size();
+    }
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    public SignalMessages.MidiEvent.Event getEvents(int index) {
+      return events_.get(index);
+    }
+    /**
+     * <code>repeated .MidiEvent.Event events = 3;</code>
+     */
+    public SignalMessages.MidiEvent.EventOrBuilder getEventsOrBuilder(
+        int index) {
+      return events_.get(index);
+    }
+
+    private void initFields() {
+      signalID_ = 1;
+      isPlaying_ = false;
+      events_ = java.util.Collections.emptyList();
+    }
+    private byte memoizedIsInitialized = -1;
+    public final boolean isInitialized() {
+      byte isInitialized = memoizedIsInitialized;
+      if (isInitialized != -1) return isInitialized == 1;
+
+      if (!hasSignalID()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      if (!hasIsPlaying()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      for (int i = 0; i < getEventsCount(); i++) {
+        if (!getEvents(i).isInitialized()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+      }
+      memoizedIsInitialized = 1;
+      return true;
+    }
+
+    public void writeTo(com.google.protobuf.CodedOutputStream output)
+                        throws java.io.IOException {
+      getSerializedSize();
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        output.writeInt32(1, signalID_);
+      }
+      if (((bitField0_ & 0x00000002) == 0x00000002)) {
+        output.writeBool(2, isPlaying_);
+      }
+      for (int i = 0; i < events_.size(); i++) {
+        output.writeMessage(3, events_.get(i));
+      }
+      getUnknownFields().writeTo(output);
+    }
+
+    private int memoizedSerializedSize = -1;
+    public int getSerializedSize() {
+      int size = memoizedSerializedSize;
+      if (size != -1) return size;
+
+      size = 0;
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeInt32Size(1, signalID_);
+      }
+      if (((bitField0_ & 0x00000002) == 0x00000002)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBoolSize(2, isPlaying_);
+      }
+      for (int i = 0; i < events_.size(); i++) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(3, events_.get(i));
+      }
+      size += getUnknownFields().getSerializedSize();
+      memoizedSerializedSize = size;
+      return size;
+    }
+
+    private static final long serialVersionUID = 0L;
+    @java.lang.Override
+    protected java.lang.Object writeReplace()
+        throws java.io.ObjectStreamException {
+      return super.writeReplace();
+    }
+
+    public static SignalMessages.MidiEvent parseFrom(
+        com.google.protobuf.ByteString data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static SignalMessages.MidiEvent parseFrom(
+        com.google.protobuf.ByteString data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static SignalMessages.MidiEvent parseFrom(byte[] data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static SignalMessages.MidiEvent parseFrom(
+        byte[] data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static SignalMessages.MidiEvent parseFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static SignalMessages.MidiEvent parseFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+    public static SignalMessages.MidiEvent parseDelimitedFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input);
+    }
+    public static SignalMessages.MidiEvent parseDelimitedFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input, extensionRegistry);
+    }
+    public static SignalMessages.MidiEvent parseFrom(
+        com.google.protobuf.CodedInputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static SignalMessages.MidiEvent parseFrom(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+
+    public static Builder newBuilder() { return Builder.create(); }
+    public Builder newBuilderForType() { return newBuilder(); }
+    public static Builder newBuilder(SignalMessages.MidiEvent prototype) {
+      return newBuilder().mergeFrom(prototype);
+    }
+    public Builder toBuilder() { return newBuilder(this); }
+
+    @java.lang.Override
+    protected Builder newBuilderForType(
+        com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+      Builder builder = new Builder(parent);
+      return builder;
+    }
+    /**
+     * Protobuf type {@code MidiEvent}
+     *
+     * <pre>
+     * MIDI events the host passed to one processBlock call, all sent in one packet (several if they do not fit in
+     * one), right before the features computed on the same block. When the host has no transport, timeInSamples
+     * counts the samples the plugin has processed, and ppqPosition is not set
+     * </pre>
+     */
+    public static final class Builder extends
+        com.google.protobuf.GeneratedMessage.Builder<Builder>
+       implements SignalMessages.MidiEventOrBuilder {
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return SignalMessages.internal_static_MidiEvent_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return SignalMessages.internal_static_MidiEvent_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                SignalMessages.MidiEvent.class, SignalMessages.MidiEvent.Builder.class);
+      }
+
+      // Construct using SignalMessages.MidiEvent.newBuilder()
+      private Builder() {
+        maybeForceBuilderInitialization();
+      }
+
+      private Builder(
+          com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+        super(parent);
+        maybeForceBuilderInitialization();
+      }
+      private void maybeForceBuilderInitialization() {
+        if (com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders) {
+          getEventsFieldBuilder();
+        }
+      }
+      private static Builder create() {
+        return new Builder();
+      }
+
+      public Builder clear() {
+        super.clear();
+        signalID_ = 1;
+        bitField0_ = (bitField0_ & ~0x00000001);
+        isPlaying_ = false;
+        bitField0_ = (bitField0_ & ~0x00000002);
+        if (eventsBuilder_ == null) {
+          events_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000004);
+        } else {
+          eventsBuilder_.clear();
+        }
+        return this;
+      }
+
+      public Builder clone() {
+        return create().mergeFrom(buildPartial());
+      }
+
+      public com.google.protobuf.Descriptors.Descriptor
+          getDescriptorForType() {
+        return SignalMessages.internal_static_MidiEvent_descriptor;
+      }
+
+      public SignalMessages.MidiEvent getDefaultInstanceForType() {
+        return SignalMessages.MidiEvent.getDefaultInstance();
+      }
+
+      public SignalMessages.MidiEvent build() {
+        SignalMessages.MidiEvent result = buildPartial();
+        if (!result.isInitialized()) {
+          throw newUninitializedMessageException(result);
+        }
+        return result;
+      }
+
+      public SignalMessages.MidiEvent buildPartial() {
+        SignalMessages.MidiEvent result = new SignalMessages.MidiEvent(this);
+        int from_bitField0_ = bitField0_;
+        int to_bitField0_ = 0;
+        if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+          to_bitField0_ |= 0x00000001;
+        }
+        result.signalID_ = signalID_;
+        if (((from_bitField0_ & 0x00000002) == 0x00000002)) {
+          to_bitField0_ |= 0x00000002;
+        }
+        result.isPlaying_ = isPlaying_;
+        if (eventsBuilder_ == null) {
+          if (((bitField0_ & 0x00000004) == 0x00000004)) {
+            events_ = java.util.Collections.unmodifiableList(events_);
+            bitField0_ = (bitField0_ & ~0x00000004);
+          }
+          result.events_ = events_;
+        } else {
+          result.events_ = eventsBuilder_.build();
+        }
+        result.bitField0_ = to_bitField0_;
+        onBuilt();
+        return result;
+      }
+
+      public Builder mergeFrom(com.google.protobuf.Message other) {
+        if (other instanceof SignalMessages.MidiEvent) {
+          return mergeFrom((SignalMessages.MidiEvent)other);
+        } else {
+          super.mergeFrom(other);
+          return this;
+        }
+      }
+
+      public Builder mergeFrom(SignalMessages.MidiEvent other) {
+        if (other == SignalMessages.MidiEvent.getDefaultInstance()) return this;
+        if (other.hasSignalID()) {
+          setSignalID(other.getSignalID());
+        }
+        if (other.hasIsPlaying()) {
+          setIsPlaying(other.getIsPlaying());
+        }
+        if (eventsBuilder_ == null) {
+          if (!other.events_.isEmpty()) {
+            if (events_.isEmpty()) {
+              events_ = other.events_;
+              bitField0_ = (bitField0_ & ~0x00000004);
+            } else {
+              ensureEventsIsMutable();
+              events_.addAll(other.events_);
+            }
+            onChanged();
+          }
+        } else {
+          if (!other.events_.isEmpty()) {
+            if (eventsBuilder_.isEmpty()) {
+              eventsBuilder_.dispose();
+              eventsBuilder_ = null;
+              events_ = other.events_;
+              bitField0_ = (bitField0_ & ~0x00000004);
+              eventsBuilder_ = 
+                com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders ?
+                   getEventsFieldBuilder() : null;
+            } else {
+              eventsBuilder_.addAllMessages(other.events_);
+            }
+          }
+        }
+        this.mergeUnknownFields(other.getUnknownFields());
+        return this;
+      }
+
+      public final boolean isInitialized() {
+        if (!hasSignalID()) {
+          
+          return false;
+        }
+        if (!hasIsPlaying()) {
+          
+          return false;
+        }
+        for (int i = 0; i < getEventsCount(); i++) {
+          if (!getEvents(i).isInitialized()) {
+            
+            return false;
+          }
+        }
+        return true;
+      }
+
+      public Builder mergeFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        SignalMessages.MidiEvent parsedMessage = null;
+        try {
+          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          parsedMessage = (SignalMessages.MidiEvent) e.getUnfinishedMessage();
+          throw e;
+        } finally {
+          if (parsedMessage != null) {
+            mergeFrom(parsedMessage);
+          }
+        }
+        return this;
+      }
+      private int bitField0_;
+
+      // required int32 signalID = 1 [default = 1];
+      private int signalID_ = 1;
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public boolean hasSignalID() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public int getSignalID() {
+        return signalID_;
+      }
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public Builder setSignalID(int value) {
+        bitField0_ |= 0x00000001;
+        signalID_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public Builder clearSignalID() {
+        bitField0_ = (bitField0_ & ~0x00000001);
+        signalID_ = 1;
+        onChanged();
+        return this;
+      }
+
+      // required bool isPlaying = 2 [default = false];
+      private boolean isPlaying_ ;
+      /**
+       * <code>required bool isPlaying = 2 [default = false];</code>
+       */
+      public boolean hasIsPlaying() {
+        return ((bitField0_ & 0x00000002) == 0x00000002);
+      }
+      /**
+       * <code>required bool isPlaying = 2 [default = false];</code>
+       */
+      public boolean getIsPlaying() {
+        return isPlaying_;
+      }
+      /**
+       * <code>required bool isPlaying = 2 [default = false];</code>
+       */
+      public Builder setIsPlaying(boolean value) {
+        bitField0_ |= 0x00000002;
+        isPlaying_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>required bool isPlaying = 2 [default = false];</code>
+       */
+      public Builder clearIsPlaying() {
+        bitField0_ = (bitField0_ & ~0x00000002);
+        isPlaying_ = false;
+        onChanged();
+        return this;
+      }
+
+      // repeated .MidiEvent.Event events = 3;
+      private java.util.List<SignalMessages.MidiEvent.Event> events_ =
+        java.util.Collections.emptyList();
+      private void ensureEventsIsMutable() {
+        if (!((bitField0_ & 0x00000004) == 0x00000004)) {
+          events_ = new java.util.ArrayList<SignalMessages.MidiEvent.Event>(events_);
+          bitField0_ |= 0x00000004;
+         }
+      }
+
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.MidiEvent.Event, SignalMessages.MidiEvent.Event.Builder, SignalMessages.MidiEvent.EventOrBuilder> eventsBuilder_;
+
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public java.util.List<SignalMessages.MidiEvent.Event> getEventsList() {
+        if (eventsBuilder_ == null) {
+          return java.util.Collections.unmodifiableList(events_);
+        } else {
+          return eventsBuilder_.getMessageList();
+        }
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public int getEventsCount() {
+        if (eventsBuilder_ == null) {
+          return events_.size();
+        } else {
+          return eventsBuilder_.getCount();
+        }
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public SignalMessages.MidiEvent.Event getEvents(int index) {
+        if (eventsBuilder_ == null) {
+          return events_.get(index);
+        } else {
+          return eventsBuilder_.getMessage(index);
+        }
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder setEvents(
+          int index, SignalMessages.MidiEvent.Event value) {
+        if (eventsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureEventsIsMutable();
+          events_.set(index, value);
+          onChanged();
+        } else {
+          eventsBuilder_.setMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder setEvents(
+          int index, SignalMessages.MidiEvent.Event.Builder builderForValue) {
+        if (eventsBuilder_ == null) {
+          ensureEventsIsMutable();
+          events_.set(index, builderForValue.build());
+          onChanged();
+        } else {
+          eventsBuilder_.setMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder addEvents(SignalMessages.MidiEvent.Event value) {
+        if (eventsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureEventsIsMutable();
+          events_.add(value);
+          onChanged();
+        } else {
+          eventsBuilder_.addMessage(value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder addEvents(
+          int index, SignalMessages.MidiEvent.Event value) {
+        if (eventsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureEventsIsMutable();
+          events_.add(index, value);
+          onChanged();
+        } else {
+          eventsBuilder_.addMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder addEvents(
+          SignalMessages.MidiEvent.Event.Builder builderForValue) {
+        if (eventsBuilder_ == null) {
+          ensureEventsIsMutable();
+          events_.add(builderForValue.build());
+          onChanged();
+        } else {
+          eventsBuilder_.addMessage(builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder addEvents(
+          int index, SignalMessages.MidiEvent.Event.Builder builderForValue) {
+        if (eventsBuilder_ == null) {
+          ensureEventsIsMutable();
+          events_.add(index, builderForValue.build());
+          onChanged();
+        } else {
+          eventsBuilder_.addMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder addAllEvents(
+          java.lang.Iterable<? extends SignalMessages.MidiEvent.Event> values) {
+        if (eventsBuilder_ == null) {
+          ensureEventsIsMutable();
+          super.addAll(values, events_);
+          onChanged();
+        } else {
+          eventsBuilder_.addAllMessages(values);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder clearEvents() {
+        if (eventsBuilder_ == null) {
+          events_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000004);
+          onChanged();
+        } else {
+          eventsBuilder_.clear();
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public Builder removeEvents(int index) {
+        if (eventsBuilder_ == null) {
+          ensureEventsIsMutable();
+          events_.remove(index);
+          onChanged();
+        } else {
+          eventsBuilder_.remove(index);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public SignalMessages.MidiEvent.Event.Builder getEventsBuilder(
+          int index) {
+        return getEventsFieldBuilder().getBuilder(index);
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public SignalMessages.MidiEvent.EventOrBuilder getEventsOrBuilder(
+          int index) {
+        if (eventsBuilder_ == null) {
+          return events_.get(index);  } else {
+          return eventsBuilder_.getMessageOrBuilder(index);
+        }
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public java.util.List<? extends SignalMessages.MidiEvent.EventOrBuilder> 
+           getEventsOrBuilderList() {
+        if (eventsBuilder_ != null) {
+          return eventsBuilder_.getMessageOrBuilderList();
+        } else {
+          return java.util.Collections.unmodifiableList(events_);
+        }
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public SignalMessages.MidiEvent.Event.Builder addEventsBuilder() {
+        return getEventsFieldBuilder().addBuilder(
+            SignalMessages.MidiEvent.Event.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public SignalMessages.MidiEvent.Event.Builder addEventsBuilder(
+          int index) {
+        return getEventsFieldBuilder().addBuilder(
+            index, SignalMessages.MidiEvent.Event.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .MidiEvent.Event events = 3;</code>
+       */
+      public java.util.List<SignalMessages.MidiEvent.Event.Builder> 
+           getEventsBuilderList() {
+        return getEventsFieldBuilder().getBuilderList();
+      }
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.MidiEvent.Event, SignalMessages.MidiEvent.Event.Builder, SignalMessages.MidiEvent.EventOrBuilder> 
+          getEventsFieldBuilder() {
+        if (eventsBuilder_ == null) {
+          eventsBuilder_ = new com.google.protobuf.RepeatedFieldBuilder<
+              SignalMessages.MidiEvent.Event, SignalMessages.MidiEvent.Event.Builder, SignalMessages.MidiEvent.EventOrBuilder>(
+                  events_,
+                  ((bitField0_ & 0x00000004) == 0x00000004),
+                  getParentForChildren(),
+                  isClean());
+          events_ = null;
+        }
+        return eventsBuilder_;
+      }
+
+      // @@protoc_insertion_point(builder_scope:MidiEvent)
+    }
+
+    static {
+      defaultInstance = new MidiEvent(true);
+      defaultInstance.initFields();
+    }
+
+    // @@protoc_insertion_point(class_scope:MidiEvent)
+  }
+
+  public interface StatsOrBuilder
+      extends com.google.protobuf.MessageOrBuilder {
+
+    // required int32 signalID = 1 [default = 1];
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    boolean hasSignalID();
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    int getSignalID();
+
+    // repeated .Stats.StageLatency stages = 2;
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    java.util.List<SignalMessages.Stats.StageLatency> 
+        getStagesList();
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    SignalMessages.Stats.StageLatency getStages(int index);
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    int getStagesCount();
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    java.util.List<? extends SignalMessages.Stats.StageLatencyOrBuilder> 
+        getStagesOrBuilderList();
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    SignalMessages.Stats.StageLatencyOrBuilder getStagesOrBuilder(
+        int index);
+
+    // required float deadlineUtilization = 3;
+    /**
+     * <code>required float deadlineUtilization = 3;</code>
+     *
+     * <pre>
+     *processBlock duration / duration of the block's audio, last block
+     * </pre>
+     */
+    boolean hasDeadlineUtilization();
+    /**
+     * <code>required float deadlineUtilization = 3;</code>
+     *
+     * <pre>
+     *processBlock duration / duration of the block's audio, last block
+     * </pre>
+     */
+    float getDeadlineUtilization();
+
+    // required float maxDeadlineUtilization = 4;
+    /**
+     * <code>required float maxDeadlineUtilization = 4;</code>
+     *
+     * <pre>
+     *Maximum of the interval
+     * </pre>
+     */
+    boolean hasMaxDeadlineUtilization();
+    /**
+     * <code>required float maxDeadlineUtilization = 4;</code>
+     *
+     * <pre>
+     *Maximum of the interval
+     * </pre>
+     */
+    float getMaxDeadlineUtilization();
+
+    // required uint32 xrunRiskCount = 5;
+    /**
+     * <code>required uint32 xrunRiskCount = 5;</code>
+     *
+     * <pre>
+     *Blocks of the interval whose utilization was above 0.5
+     * </pre>
+     */
+    boolean hasXrunRiskCount();
+    /**
+     * <code>required uint32 xrunRiskCount = 5;</code>
+     *
+     * <pre>
+     *Blocks of the interval whose utilization was above 0.5
+     * </pre>
+     */
+    int getXrunRiskCount();
+
+    // required uint32 nbOfBlocks = 6;
+    /**
+     * <code>required uint32 nbOfBlocks = 6;</code>
+     */
+    boolean hasNbOfBlocks();
+    /**
+     * <code>required uint32 nbOfBlocks = 6;</code>
+     */
+    int getNbOfBlocks();
+
+    // repeated .Stats.TransportCounters transports = 7;
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    java.util.List<SignalMessages.Stats.TransportCounters> 
+        getTransportsList();
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    SignalMessages.Stats.TransportCounters getTransports(int index);
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    int getTransportsCount();
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    java.util.List<? extends SignalMessages.Stats.TransportCountersOrBuilder> 
+        getTransportsOrBuilderList();
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    SignalMessages.Stats.TransportCountersOrBuilder getTransportsOrBuilder(
+        int index);
+
+    // repeated .Stats.StreamCounters streams = 8;
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    java.util.List<SignalMessages.Stats.StreamCounters> 
+        getStreamsList();
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    SignalMessages.Stats.StreamCounters getStreams(int index);
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    int getStreamsCount();
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    java.util.List<? extends SignalMessages.Stats.StreamCountersOrBuilder> 
+        getStreamsOrBuilderList();
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    SignalMessages.Stats.StreamCountersOrBuilder getStreamsOrBuilder(
+        int index);
+  }
+  /**
+   * Protobuf type {@code Stats}
+   *
+   * <pre>
+   * Latency of the plugin's stages over the last interval (sent once per second, on its own port)
+   * </pre>
+   */
+  public static final class Stats extends
+      com.google.protobuf.GeneratedMessage
+      implements StatsOrBuilder {
+    // Use Stats.newBuilder() to construct.
+    private Stats(com.google.protobuf.GeneratedMessage.Builder<?> builder) {
+      super(builder);
+      this.unknownFields = builder.getUnknownFields();
+    }
+    private Stats(boolean noInit) { this.unknownFields = com.google.protobuf.UnknownFieldSet.getDefaultInstance(); }
+
+    private static final Stats defaultInstance;
+    public static Stats getDefaultInstance() {
+      return defaultInstance;
+    }
+
+    public Stats getDefaultInstanceForType() {
+      return defaultInstance;
+    }
+
+    private final com.google.protobuf.UnknownFieldSet unknownFields;
+    @java.lang.Override
+    public final com.google.protobuf.UnknownFieldSet
+        getUnknownFields() {
+      return this.unknownFields;
+    }
+    private Stats(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      initFields();
+      int mutable_bitField0_ = 0;
+      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
+          com.google.protobuf.UnknownFieldSet.newBuilder();
+      try {
+        boolean done = false;
+        while (!done) {
+          int tag = input.readTag();
+          switch (tag) {
+            case 0:
+              done = true;
+              break;
+            default: {
+              if (!parseUnknownField(input, unknownFields,
+                                     extensionRegistry, tag)) {
+                done = true;
+              }
+              break;
+            }
+            case 8: {
+              bitField0_ |= 0x00000001;
+              signalID_ = input.readInt32();
+              break;
+            }
+            case 18: {
+              if (!((mutable_bitField0_ & 0x00000002) == 0x00000002)) {
+                stages_ = new java.util.ArrayList<SignalMessages.Stats.StageLatency>();
+                mutable_bitField0_ |= 0x00000002;
+              }
+              stages_.add(input.readMessage(SignalMessages.Stats.StageLatency.PARSER, extensionRegistry));
+              break;
+            }
+            case 29: {
+              bitField0_ |= 0x00000002;
+              deadlineUtilization_ = input.readFloat();
+              break;
+            }
+            case 37: {
+              bitField0_ |= 0x00000004;
+              maxDeadlineUtilization_ = input.readFloat();
+              break;
+            }
+            case 40: {
+              bitField0_ |= 0x00000008;
+              xrunRiskCount_ = input.readUInt32();
+              break;
+            }
+            case 48: {
+              bitField0_ |= 0x00000010;
+              nbOfBlocks_ = input.readUInt32();
+              break;
+            }
+            case 58: {
+              if (!((mutable_bitField0_ & 0x00000040) == 0x00000040)) {
+                transports_ = new java.util.ArrayList<SignalMessages.Stats.TransportCounters>();
+                mutable_bitField0_ |= 0x00000040;
+              }
+              transports_.add(input.readMessage(SignalMessages.Stats.TransportCounters.PARSER, extensionRegistry));
+              break;
+            }
+            case 66: {
+              if (!((mutable_bitField0_ & 0x00000080) == 0x00000080)) {
+                streams_ = new java.util.ArrayList<SignalMessages.Stats.StreamCounters>();
+                mutable_bitField0_ |= 0x00000080;
+              }
+              streams_.add(input.readMessage(SignalMessages.Stats.StreamCounters.PARSER, extensionRegistry));
+              break;
+            }
+          }
+        }
+      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+        throw e.setUnfinishedMessage(this);
+      } catch (java.io.IOException e) {
+        throw new com.google.protobuf.InvalidProtocolBufferException(
+            e.getMessage()).setUnfinishedMessage(this);
+      } finally {
+        if (((mutable_bitField0_ & 0x00000002) == 0x00000002)) {
+          stages_ = java.util.Collections.unmodifiableList(stages_);
+        }
+        if (((mutable_bitField0_ & 0x00000040) == 0x00000040)) {
+          transports_ = java.util.Collections.unmodifiableList(transports_);
+        }
+        if (((mutable_bitField0_ & 0x00000080) == 0x00000080)) {
+          streams_ = java.util.Collections.unmodifiableList(streams_);
+        }
+        this.unknownFields = unknownFields.build();
+        makeExtensionsImmutable();
+      }
+    }
+    public static final com.google.protobuf.Descriptors.Descriptor
+        getDescriptor() {
+      return SignalMessages.internal_static_Stats_descriptor;
+    }
+
+    protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+        internalGetFieldAccessorTable() {
+      return SignalMessages.internal_static_Stats_fieldAccessorTable
+          .ensureFieldAccessorsInitialized(
+              SignalMessages.Stats.class, SignalMessages.Stats.Builder.class);
+    }
+
+    public static com.google.protobuf.Parser<Stats> PARSER =
+        new com.google.protobuf.AbstractParser<Stats>() {
+      public Stats parsePartialFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return new Stats(input, extensionRegistry);
+      }
+    };
+
+    @java.lang.Override
+    public com.google.protobuf.Parser<Stats> getParserForType() {
+      return PARSER;
+    }
+
+    /**
+     * Protobuf enum {@code Stats.Stage}
+     */
+    public enum Stage
+        implements com.google.protobuf.ProtocolMessageEnum {
+      /**
+       * <code>PROCESS_BLOCK = 0;</code>
+       */
+      PROCESS_BLOCK(0, 0),
+      /**
+       * <code>FFT = 1;</code>
+       */
+      FFT(1, 1),
+      /**
+       * <code>SERIALIZATION = 2;</code>
+       */
+      SERIALIZATION(2, 2),
+      /**
+       * <code>SEND = 3;</code>
+       */
+      SEND(3, 3),
+      ;
+
+      /**
+       * <code>PROCESS_BLOCK = 0;</code>
+       */
+      public static final int PROCESS_BLOCK_VALUE = 0;
+      /**
+       * <code>FFT = 1;</code>
+       */
+      public static final int FFT_VALUE = 1;
+      /**
+       * <code>SERIALIZATION = 2;</code>
+       */
+      public static final int SERIALIZATION_VALUE = 2;
+      /**
+       * <code>SEND = 3;</code>
+       */
+      public static final int SEND_VALUE = 3;
+
+
+      public final int getNumber() { return value; }
+
+      public static Stage valueOf(int value) {
+        switch (value) {
+          case 0: return PROCESS_BLOCK;
+          case 1: return FFT;
+          case 2: return SERIALIZATION;
+          case 3: return SEND;
+          default: return null;
+        }
+      }
+
+      public static com.google.protobuf.Internal.EnumLiteMap<Stage>
+          internalGetValueMap() {
+        return internalValueMap;
+      }
+      private static com.google.protobuf.Internal.EnumLiteMap<Stage>
+          internalValueMap =
+            new com.google.protobuf.Internal.EnumLiteMap<Stage>() {
+              public Stage findValueByNumber(int number) {
+                return Stage.valueOf(number);
+              }
+            };
+
+      public final com.google.protobuf.Descriptors.EnumValueDescriptor
+          getValueDescriptor() {
+        return getDescriptor().getValues().get(index);
+      }
+      public final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptorForType() {
+        return getDescriptor();
+      }
+      public static final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptor() {
+        return SignalMessages.Stats.getDescriptor().getEnumTypes().get(0);
+      }
+
+      private static final Stage[] VALUES = values();
+
+      public static Stage valueOf(
+          com.google.protobuf.Descriptors.EnumValueDescriptor desc) {
+        if (desc.getType() != getDescriptor()) {
+          throw new java.lang.IllegalArgumentException(
+            "EnumValueDescriptor is not for this type.");
+        }
+        return VALUES[desc.getIndex()];
+      }
+
+      private final int index;
+      private final int value;
+
+      private Stage(int index, int value) {
+        this.index = index;
+        this.value = value;
+      }
+
+      // @@protoc_insertion_point(enum_scope:Stats.Stage)
+    }
+
+    /**
+     * Protobuf enum {@code Stats.Destination}
+     */
+    public enum Destination
+        implements com.google.protobuf.ProtocolMessageEnum {
+      /**
+       * <code>SIGNAL_LEVEL_PORT = 0;</code>
+       */
+      SIGNAL_LEVEL_PORT(0, 0),
+      /**
+       * <code>SIGNAL_INSTANT_VAL_PORT = 1;</code>
+       */
+      SIGNAL_INSTANT_VAL_PORT(1, 1),
+      /**
+       * <code>IMPULSE_PORT = 2;</code>
+       */
+      IMPULSE_PORT(2, 2),
+      /**
+       * <code>TIME_INFO_PORT = 3;</code>
+       */
+      TIME_INFO_PORT(3, 3),
+      /**
+       * <code>FFT_PORT = 4;</code>
+       */
+      FFT_PORT(4, 4),
+      /**
+       * <code>STATS_PORT = 5;</code>
+       */
+      STATS_PORT(5, 5),
+      /**
+       * <code>OSC_PORT = 6;</code>
+       */
+      OSC_PORT(6, 6),
+      /**
+       * <code>MIDI_EVENT_PORT = 7;</code>
+       */
+      MIDI_EVENT_PORT(7, 7),
+      ;
+
+      /**
+       * <code>SIGNAL_LEVEL_PORT = 0;</code>
+       */
+      public static final int SIGNAL_LEVEL_PORT_VALUE = 0;
+      /**
+       * <code>SIGNAL_INSTANT_VAL_PORT = 1;</code>
+       */
+      public static final int SIGNAL_INSTANT_VAL_PORT_VALUE = 1;
+      /**
+       * <code>IMPULSE_PORT = 2;</code>
+       */
+      public static final int IMPULSE_PORT_VALUE = 2;
+      /**
+       * <code>TIME_INFO_PORT = 3;</code>
+       */
+      public static final int TIME_INFO_PORT_VALUE = 3;
+      /**
+       * <code>FFT_PORT = 4;</code>
+       */
+      public static final int FFT_PORT_VALUE = 4;
+      /**
+       * <code>STATS_PORT = 5;</code>
+       */
+      public static final int STATS_PORT_VALUE = 5;
+      /**
+       * <code>OSC_PORT = 6;</code>
+       */
+      public static final int OSC_PORT_VALUE = 6;
+      /**
+       * <code>MIDI_EVENT_PORT = 7;</code>
+       */
+      public static final int MIDI_EVENT_PORT_VALUE = 7;
+
+
+      public final int getNumber() { return value; }
+
+      public static Destination valueOf(int value) {
+        switch (value) {
+          case 0: return SIGNAL_LEVEL_PORT;
+          case 1: return SIGNAL_INSTANT_VAL_PORT;
+          case 2: return IMPULSE_PORT;
+          case 3: return TIME_INFO_PORT;
+          case 4: return FFT_PORT;
+          case 5: return STATS_PORT;
+          case 6: return OSC_PORT;
+          case 7: return MIDI_EVENT_PORT;
+          default: return null;
+        }
+      }
+
+      public static com.google.protobuf.Internal.EnumLiteMap<Destination>
+          internalGetValueMap() {
+        return internalValueMap;
+      }
+      private static com.google.protobuf.Internal.EnumLiteMap<Destination>
+          internalValueMap =
+            new com.google.protobuf.Internal.EnumLiteMap<Destination>() {
+              public Destination findValueByNumber(int number) {
+                return Destination.valueOf(number);
+              }
+            };
+
+      public final com.google.protobuf.Descriptors.EnumValueDescriptor
+          getValueDescriptor() {
+        return getDescriptor().getValues().get(index);
+      }
+      public final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptorForType() {
+        return getDescriptor();
+      }
+      public static final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptor() {
+        return SignalMessages.Stats.getDescriptor().getEnumTypes().get(1);
+      }
+
+      private static final Destination[] VALUES = values();
+
+      public static Destination valueOf(
+          com.google.protobuf.Descriptors.EnumValueDescriptor desc) {
+        if (desc.getType() != getDescriptor()) {
+          throw new java.lang.IllegalArgumentException(
+            "EnumValueDescriptor is not for this type.");
+        }
+        return VALUES[desc.getIndex()];
+      }
+
+      private final int index;
+      private final int value;
+
+      private Destination(int index, int value) {
+        this.index = index;
+        this.value = value;
+      }
+
+      // @@protoc_insertion_point(enum_scope:Stats.Destination)
+    }
+
+    /**
+     * Protobuf enum {@code Stats.Stream}
+     */
+    public enum Stream
+        implements com.google.protobuf.ProtocolMessageEnum {
+      /**
+       * <code>SIGNAL_LEVEL_STREAM = 0;</code>
+       */
+      SIGNAL_LEVEL_STREAM(0, 0),
+      /**
+       * <code>SIGNAL_INSTANT_VAL_STREAM = 1;</code>
+       */
+      SIGNAL_INSTANT_VAL_STREAM(1, 1),
+      /**
+       * <code>FFT_STREAM = 2;</code>
+       */
+      FFT_STREAM(2, 2),
+      ;
+
+      /**
+       * <code>SIGNAL_LEVEL_STREAM = 0;</code>
+       */
+      public static final int SIGNAL_LEVEL_STREAM_VALUE = 0;
+      /**
+       * <code>SIGNAL_INSTANT_VAL_STREAM = 1;</code>
+       */
+      public static final int SIGNAL_INSTANT_VAL_STREAM_VALUE = 1;
+      /**
+       * <code>FFT_STREAM = 2;</code>
+       */
+      public static final int FFT_STREAM_VALUE = 2;
+
+
+      public final int getNumber() { return value; }
+
+      public static Stream valueOf(int value) {
+        switch (value) {
+          case 0: return SIGNAL_LEVEL_STREAM;
+          case 1: return SIGNAL_INSTANT_VAL_STREAM;
+          case 2: return FFT_STREAM;
+          default: return null;
+        }
+      }
+
+      public static com.google.protobuf.Internal.EnumLiteMap<Stream>
+          internalGetValueMap() {
+        return internalValueMap;
+      }
+      private static com.google.protobuf.Internal.EnumLiteMap<Stream>
+          internalValueMap =
+            new com.google.protobuf.Internal.EnumLiteMap<Stream>() {
+              public Stream findValueByNumber(int number) {
+                return Stream.valueOf(number);
+              }
+            };
+
+      public final com.google.protobuf.Descriptors.EnumValueDescriptor
+          getValueDescriptor() {
+        return getDescriptor().getValues().get(index);
+      }
+      public final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptorForType() {
+        return getDescriptor();
+      }
+      public static final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptor() {
+        return SignalMessages.Stats.getDescriptor().getEnumTypes().get(2);
+      }
+
+      private static final Stream[] VALUES = values();
+
+      public static Stream valueOf(
+          com.google.protobuf.Descriptors.EnumValueDescriptor desc) {
+        if (desc.getType() != getDescriptor()) {
+          throw new java.lang.IllegalArgumentException(
+            "EnumValueDescriptor is not for this type.");
+        }
+        return VALUES[desc.getIndex()];
+      }
+
+      private final int index;
+      private final int value;
+
+      private Stream(int index, int value) {
+        this.index = index;
+        this.value = value;
+      }
+
+      // @@protoc_insertion_point(enum_scope:Stats.Stream)
+    }
+
+    public interface StageLatencyOrBuilder
+        extends com.google.protobuf.MessageOrBuilder {
+
+      // required .Stats.Stage stage = 1;
+      /**
+       * <code>required .Stats.Stage stage = 1;</code>
+       */
+      boolean hasStage();
+      /**
+       * <code>required .Stats.Stage stage = 1;</code>
+       */
+      SignalMessages.Stats.Stage getStage();
+
+      // required uint32 count = 2;
+      /**
+       * <code>required uint32 count = 2;</code>
+       *
+       * <pre>
+       *Number of measures in the interval
+       * </pre>
+       */
+      boolean hasCount();
+      /**
+       * <code>required uint32 count = 2;</code>
+       *
+       * <pre>
+       *Number of measures in the interval
+       * </pre>
+       */
+      int getCount();
+
+      // required float p50 = 3;
+      /**
+       * <code>required float p50 = 3;</code>
+       *
+       * <pre>
+       *Durations in microseconds
+       * </pre>
+       */
+      boolean hasP50();
+      /**
+       * <code>required float p50 = 3;</code>
+       *
+       * <pre>
+       *Durations in microseconds
+       * </pre>
+       */
+      float getP50();
+
+      // required float p99 = 4;
+      /**
+       * <code>required float p99 = 4;</code>
+       */
+      boolean hasP99();
+      /**
+       * <code>required float p99 = 4;</code>
+       */
+      float getP99();
+
+      // required float max = 5;
+      /**
+       * <code>required float max = 5;</code>
+       */
+      boolean hasMax();
+      /**
+       * <code>required float max = 5;</code>
+       */
+      float getMax();
+    }
+    /**
+     * Protobuf type {@code Stats.StageLatency}
+     */
+    public static final class StageLatency extends
+        com.google.protobuf.GeneratedMessage
+        implements StageLatencyOrBuilder {
+      // Use StageLatency.newBuilder() to construct.
+      private StageLatency(com.google.protobuf.GeneratedMessage.Builder<?> builder) {
+        super(builder);
+        this.unknownFields = builder.getUnknownFields();
+      }
+      private StageLatency(boolean noInit) { this.unknownFields = com.google.protobuf.UnknownFieldSet.getDefaultInstance(); }
+
+      private static final StageLatency defaultInstance;
+      public static StageLatency getDefaultInstance() {
+        return defaultInstance;
+      }
+
+      public StageLatency getDefaultInstanceForType() {
+        return defaultInstance;
+      }
+
+      private final com.google.protobuf.UnknownFieldSet unknownFields;
+      @java.lang.Override
+      public final com.google.protobuf.UnknownFieldSet
+          getUnknownFields() {
+        return this.unknownFields;
+      }
+      private StageLatency(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        initFields();
+        int mutable_bitField0_ = 0;
+        com.google.protobuf.UnknownFieldSet.Builder unknownFields =
+            com.google.protobuf.UnknownFieldSet.newBuilder();
+        try {
+          boolean done = false;
+          while (!done) {
+            int tag = input.readTag();
+            switch (tag) {
+              case 0:
+                done = true;
+                break;
+              default: {
+                if (!parseUnknownField(input, unknownFields,
+                                       extensionRegistry, tag)) {
+                  done = true;
+                }
+                break;
+              }
+              case 8: {
+                int rawValue = input.readEnum();
+                SignalMessages.Stats.Stage value = SignalMessages.Stats.Stage.valueOf(rawValue);
+                if (value == null) {
+                  unknownFields.mergeVarintField(1, rawValue);
+                } else {
+                  bitField0_ |= 0x00000001;
+                  stage_ = value;
+                }
+                break;
+              }
+              case 16: {
+                bitField0_ |= 0x00000002;
+                count_ = input.readUInt32();
+                break;
+              }
+              case 29: {
+                bitField0_ |= 0x00000004;
+                p50_ = input.readFloat();
+                break;
+              }
+              case 37: {
+                bitField0_ |= 0x00000008;
+                p99_ = input.readFloat();
+                break;
+              }
+              case 45: {
+                bitField0_ |= 0x00000010;
+                max_ = input.readFloat();
+                break;
+              }
+            }
+          }
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          throw e.setUnfinishedMessage(this);
+        } catch (java.io.IOException e) {
+          throw new com.google.protobuf.InvalidProtocolBufferException(
+              e.getMessage()).setUnfinishedMessage(this);
+        } finally {
+          this.unknownFields = unknownFields.build();
+          makeExtensionsImmutable();
+        }
+      }
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return SignalMessages.internal_static_Stats_StageLatency_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return SignalMessages.internal_static_Stats_StageLatency_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                SignalMessages.Stats.StageLatency.class, SignalMessages.Stats.StageLatency.Builder.class);
+      }
+
+      public static com.google.protobuf.Parser<StageLatency> PARSER =
+          new com.google.protobuf.AbstractParser<StageLatency>() {
+        public StageLatency parsePartialFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws com.google.protobuf.InvalidProtocolBufferException {
+          return new StageLatency(input, extensionRegistry);
+        }
+      };
+
+      @java.lang.Override
+      public com.google.protobuf.Parser<StageLatency> getParserForType() {
+        return PARSER;
+      }
+
+      private int bitField0_;
+      // required .Stats.Stage stage = 1;
+      public static final int STAGE_FIELD_NUMBER = 1;
+      private SignalMessages.Stats.Stage stage_;
+      /**
+       * <code>required .Stats.Stage stage = 1;</code>
+       */
+      public boolean hasStage() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required .Stats.Stage stage = 1;</code>
+       */
+      public SignalMessages.Stats.Stage getStage() {
+        return stage_;
+      }
+
+      // required uint32 count = 2;
+      public static final int COUNT_FIELD_NUMBER = 2;
+      private int count_;
+      /**
+       * <code>required uint32 count = 2;</code>
+       *
+       * <pre>
+       *Number of measures in the interval
+       * </pre>
+       */
+      public boolean hasCount() {
+        return ((bitField0_ & 0x00000002) == 0x00000002);
+      }
+      /**
+       * <code>required uint32 count = 2;</code>
+       *
+       * <pre>
+       *Number of measures in the interval
+       * </pre>
+       */
+      public int getCount() {
+        return count_;
+      }
+
+      // required float p50 = 3;
+      public static final int P50_FIELD_NUMBER = 3;
+      private float p50_;
+      /**
+       * <code>required float p50 = 3;</code>
+       *
+       * <pre>
+       *Durations in microseconds
+       * </pre>
+       */
+      public boolean hasP50() {
+        return ((bitField0_ & 0x00000004) == 0x00000004);
+      }
+      /**
+       * <code>required float p50 = 3;</code>
+       *
+       * <pre>
+       *Durations in microseconds
+       * </pre>
+       */
+      public float getP50() {
+        return p50_;
+      }
+
+      // required float p99 = 4;
+      public static final int P99_FIELD_NUMBER = 4;
+      private float p99_;
+      /**
+       * <code>required float p99 = 4;</code>
+       */
+      public boolean hasP99() {
+        return ((bitField0_ & 0x00000008) == 0x00000008);
+      }
+      /**
+       * <code>required float p99 = 4;</code>
+       */
+      public float getP99() {
+        return p99_;
+      }
+
+      // required float max = 5;
+      public static final int MAX_FIELD_NUMBER = 5;
+      private float max_;
+      /**
+       * <code>required float max = 5;</code>
+       */
+      public boolean hasMax() {
+        return ((bitField0_ & 0x00000010) == 0x00000010);
+      }
+      /**
+       * <code>required float max = 5;</code>
+       */
+      public float getMax() {
+        return max_;
+      }
+
+      private void initFields() {
+        stage_ = SignalMessages.Stats.Stage.PROCESS_BLOCK;
+        count_ = 0;
+        p50_ = 0F;
+        p99_ = 0F;
+        max_ = 0F;
+      }
+      private byte memoizedIsInitialized = -1;
+      public final boolean isInitialized() {
+        byte isInitialized = memoizedIsInitialized;
+        if (isInitialized != -1) return isInitialized == 1;
+
+        if (!hasStage()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasCount()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasP50()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasP99()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasMax()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        memoizedIsInitialized = 1;
+        return true;
+      }
+
+      public void writeTo(com.google.protobuf.CodedOutputStream output)
+                          throws java.io.IOException {
+        getSerializedSize();
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          output.writeEnum(1, stage_.getNumber());
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          output.writeUInt32(2, count_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          output.writeFloat(3, p50_);
+        }
+        if (((bitField0_ & 0x00000008) == 0x00000008)) {
+          output.writeFloat(4, p99_);
+        }
+        if (((bitField0_ & 0x00000010) == 0x00000010)) {
+          output.writeFloat(5, max_);
+        }
+        getUnknownFields().writeTo(output);
+      }
+
+      private int memoizedSerializedSize = -1;
+      public int getSerializedSize() {
+        int size = memoizedSerializedSize;
+        if (size != -1) return size;
+
+        size = 0;
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeEnumSize(1, stage_.getNumber());
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt32Size(2, count_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeFloatSize(3, p50_);
+        }
+        if (((bitField0_ & 0x00000008) == 0x00000008)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeFloatSize(4, p99_);
+        }
+        if (((bitField0_ & 0x00000010) == 0x00000010)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeFloatSize(5, max_);
+        }
+        size += getUnknownFields().getSerializedSize();
+        memoizedSerializedSize = size;
+        return size;
+      }
+
+      private static final long serialVersionUID = 0L;
+      @java.lang.Override
+      protected java.lang.Object writeReplace()
+          throws java.io.ObjectStreamException {
+        return super.writeReplace();
+      }
+
+      public static SignalMessages.Stats.StageLatency parseFrom(
+          com.google.protobuf.ByteString data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.Stats.StageLatency parseFrom(
+          com.google.protobuf.ByteString data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StageLatency parseFrom(byte[] data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.Stats.StageLatency parseFrom(
+          byte[] data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StageLatency parseFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.Stats.StageLatency parseFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StageLatency parseDelimitedFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input);
+      }
+      public static SignalMessages.Stats.StageLatency parseDelimitedFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StageLatency parseFrom(
+          com.google.protobuf.CodedInputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.Stats.StageLatency parseFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+
+      public static Builder newBuilder() { return Builder.create(); }
+      public Builder newBuilderForType() { return newBuilder(); }
+      public static Builder newBuilder(SignalMessages.Stats.StageLatency prototype) {
+        return newBuilder().mergeFrom(prototype);
+      }
+      public Builder toBuilder() { return newBuilder(this); }
+
+      @java.lang.Override
+      protected Builder newBuilderForType(
+          com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+        Builder builder = new Builder(parent);
+        return builder;
+      }
+      /**
+       * Protobuf type {@code Stats.StageLatency}
+       */
+      public static final class Builder extends
+          com.google.protobuf.GeneratedMessage.Builder<Builder>
+         implements SignalMessages.Stats.StageLatencyOrBuilder {
+        public static final com.google.protobuf.Descriptors.Descriptor
+            getDescriptor() {
+          return SignalMessages.internal_static_Stats_StageLatency_descriptor;
+        }
+
+        protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+            internalGetFieldAccessorTable() {
+          return SignalMessages.internal_static_Stats_StageLatency_fieldAccessorTable
+              .ensureFieldAccessorsInitialized(
+                  SignalMessages.Stats.StageLatency.class, SignalMessages.Stats.StageLatency.Builder.class);
+        }
+
+        // Construct using SignalMessages.Stats.StageLatency.newBuilder()
+        private Builder() {
+          maybeForceBuilderInitialization();
+        }
+
+        private Builder(
+            com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+          super(parent);
+          maybeForceBuilderInitialization();
+        }
+        private void maybeForceBuilderInitialization() {
+          if (com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders) {
+          }
+        }
+        private static Builder create() {
+          return new Builder();
+        }
+
+        public Builder clear() {
+          super.clear();
+          stage_ = SignalMessages.Stats.Stage.PROCESS_BLOCK;
+          bitField0_ = (bitField0_ & ~0x00000001);
+          count_ = 0;
+          bitField0_ = (bitField0_ & ~0x00000002);
+          p50_ = 0F;
+          bitField0_ = (bitField0_ & ~0x00000004);
+          p99_ = 0F;
+          bitField0_ = (bitField0_ & ~0x00000008);
+          max_ = 0F;
+          bitField0_ = (bitField0_ & ~0x00000010);
+          return this;
+        }
+
+        public Builder clone() {
+          return create().mergeFrom(buildPartial());
+        }
+
+        public com.google.protobuf.Descriptors.Descriptor
+            getDescriptorForType() {
+          return SignalMessages.internal_static_Stats_StageLatency_descriptor;
+        }
+
+        public SignalMessages.Stats.StageLatency getDefaultInstanceForType() {
+          return SignalMessages.Stats.StageLatency.getDefaultInstance();
+        }
+
+        public SignalMessages.Stats.StageLatency build() {
+          SignalMessages.Stats.StageLatency result = buildPartial();
+          if (!result.isInitialized()) {
+            throw newUninitializedMessageException(result);
+          }
+          return result;
+        }
+
+        public SignalMessages.Stats.StageLatency buildPartial() {
+          SignalMessages.Stats.StageLatency result = new SignalMessages.Stats.StageLatency(this);
+          int from_bitField0_ = bitField0_;
+          int to_bitField0_ = 0;
+          if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+            to_bitField0_ |= 0x00000001;
+          }
+          result.stage_ = stage_;
+          if (((from_bitField0_ & 0x00000002) == 0x00000002)) {
+            to_bitField0_ |= 0x00000002;
+          }
+          result.count_ = count_;
+          if (((from_bitField0_ & 0x00000004) == 0x00000004)) {
+            to_bitField0_ |= 0x00000004;
+          }
+          result.p50_ = p50_;
+          if (((from_bitField0_ & 0x00000008) == 0x00000008)) {
+            to_bitField0_ |= 0x00000008;
+          }
+          result.p99_ = p99_;
+          if (((from_bitField0_ & 0x00000010) == 0x00000010)) {
+            to_bitField0_ |= 0x00000010;
+          }
+          result.max_ = max_;
+          result.bitField0_ = to_bitField0_;
+          onBuilt();
+          return result;
+        }
+
+        public Builder mergeFrom(com.google.protobuf.Message other) {
+          if (other instanceof SignalMessages.Stats.StageLatency) {
+            return mergeFrom((SignalMessages.Stats.StageLatency)other);
+          } else {
+            super.mergeFrom(other);
+            return this;
+          }
+        }
+
+        public Builder mergeFrom(SignalMessages.Stats.StageLatency other) {
+          if (other == SignalMessages.Stats.StageLatency.getDefaultInstance()) return this;
+          if (other.hasStage()) {
+            setStage(other.getStage());
+          }
+          if (other.hasCount()) {
+            setCount(other.getCount());
+          }
+          if (other.hasP50()) {
+            setP50(other.getP50());
+          }
+          if (other.hasP99()) {
+            setP99(other.getP99());
+          }
+          if (other.hasMax()) {
+            setMax(other.getMax());
+          }
+          this.mergeUnknownFields(other.getUnknownFields());
+          return this;
+        }
+
+        public final boolean isInitialized() {
+          if (!hasStage()) {
+            
+            return false;
+          }
+          if (!hasCount()) {
+            
+            return false;
+          }
+          if (!hasP50()) {
+            
+            return false;
+          }
+          if (!hasP99()) {
+            
+            return false;
+          }
+          if (!hasMax()) {
+            
+            return false;
+          }
+          return true;
+        }
+
+        public Builder mergeFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws java.io.IOException {
+          SignalMessages.Stats.StageLatency parsedMessage = null;
+          try {
+            parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+          } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+            parsedMessage = (SignalMessages.Stats.StageLatency) e.getUnfinishedMessage();
+            throw e;
+          } finally {
+            if (parsedMessage != null) {
+              mergeFrom(parsedMessage);
+            }
+          }
+          return this;
+        }
+        private int bitField0_;
+
+        // required .Stats.Stage stage = 1;
+        private SignalMessages.Stats.Stage stage_ = SignalMessages.Stats.Stage.PROCESS_BLOCK;
+        /**
+         * <code>required .Stats.Stage stage = 1;</code>
+         */
+        public boolean hasStage() {
+          return ((bitField0_ & 0x00000001) == 0x00000001);
+        }
+        /**
+         * <code>required .Stats.Stage stage = 1;</code>
+         */
+        public SignalMessages.Stats.Stage getStage() {
+          return stage_;
+        }
+        /**
+         * <code>required .Stats.Stage stage = 1;</code>
+         */
+        public Builder setStage(SignalMessages.Stats.Stage value) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          bitField0_ |= 0x00000001;
+          stage_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required .Stats.Stage stage = 1;</code>
+         */
+        public Builder clearStage() {
+          bitField0_ = (bitField0_ & ~0x00000001);
+          stage_ = SignalMessages.Stats.Stage.PROCESS_BLOCK;
+          onChanged();
+          return this;
+        }
+
+        // required uint32 count = 2;
+        private int count_ ;
+        /**
+         * <code>required uint32 count = 2;</code>
+         *
+         * <pre>
+         *Number of measures in the interval
+         * </pre>
+         */
+        public boolean hasCount() {
+          return ((bitField0_ & 0x00000002) == 0x00000002);
+        }
+        /**
+         * <code>required uint32 count = 2;</code>
+         *
+         * <pre>
+         *Number of measures in the interval
+         * </pre>
+         */
+        public int getCount() {
+          return count_;
+        }
+        /**
+         * <code>required uint32 count = 2;</code>
+         *
+         * <pre>
+         *Number of measures in the interval
+         * </pre>
+         */
+        public Builder setCount(int value) {
+          bitField0_ |= 0x00000002;
+          count_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required uint32 count = 2;</code>
+         *
+         * <pre>
+         *Number of measures in the interval
+         * </pre>
+         */
+        public Builder clearCount() {
+          bitField0_ = (bitField0_ & ~0x00000002);
+          count_ = 0;
+          onChanged();
+          return this;
+        }
+
+        // required float p50 = 3;
+        private float p50_ ;
+        /**
+         * <code>required float p50 = 3;</code>
+         *
+         * <pre>
+         *Durations in microseconds
+         * </pre>
+         */
+        public boolean hasP50() {
+          return ((bitField0_ & 0x00000004) == 0x00000004);
+        }
+        /**
+         * <code>required float p50 = 3;</code>
+         *
+         * <pre>
+         *Durations in microseconds
+         * </pre>
+         */
+        public float getP50() {
+          return p50_;
+        }
+        /**
+         * <code>required float p50 = 3;</code>
+         *
+         * <pre>
+         *Durations in microseconds
+         * </pre>
+         */
+        public Builder setP50(float value) {
+          bitField0_ |= 0x00000004;
+          p50_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required float p50 = 3;</code>
+         *
+         * <pre>
+         *Durations in microseconds
+         * </pre>
+         */
+        public Builder clearP50() {
+          bitField0_ = (bitField0_ & ~0x00000004);
+          p50_ = 0F;
+          onChanged();
+          return this;
+        }
+
+        // required float p99 = 4;
+        private float p99_ ;
+        /**
+         * <code>required float p99 = 4;</code>
+         */
+        public boolean hasP99() {
+          return ((bitField0_ & 0x00000008) == 0x00000008);
+        }
+        /**
+         * <code>required float p99 = 4;</code>
+         */
+        public float getP99() {
+          return p99_;
+        }
+        /**
+         * <code>required float p99 = 4;</code>
+         */
+        public Builder setP99(float value) {
+          bitField0_ |= 0x00000008;
+          p99_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required float p99 = 4;</code>
+         */
+        public Builder clearP99() {
+          bitField0_ = (bitField0_ & ~0x00000008);
+          p99_ = 0F;
+          onChanged();
+          return this;
+        }
+
+        // required float max = 5;
+        private float max_ ;
+        /**
+         * <code>required float max = 5;</code>
+         */
+        public boolean hasMax() {
+          return ((bitField0_ & 0x00000010) == 0x00000010);
+        }
+        /**
+         * <code>required float max = 5;</code>
+         */
+        public float getMax() {
+          return max_;
+        }
+        /**
+         * <code>required float max = 5;</code>
+         */
+        public Builder setMax(float value) {
+          bitField0_ |= 0x00000010;
+          max_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required float max = 5;</code>
+         */
+        public Builder clearMax() {
+          bitField0_ = (bitField0_ & ~0x00000010);
+          max_ = 0F;
+          onChanged();
+          return this;
+        }
+
+        // @@protoc_insertion_point(builder_scope:Stats.StageLatency)
+      }
+
+      static {
+        defaultInstance = new StageLatency(true);
+        defaultInstance.initFields();
+      }
+
+      // @@protoc_insertion_point(class_scope:Stats.StageLatency)
+    }
+
+    public interface TransportCountersOrBuilder
+        extends com.google.protobuf.MessageOrBuilder {
+
+      // required .Stats.Destination destination = 1;
+      /**
+       * <code>required .Stats.Destination destination = 1;</code>
+       */
+      boolean hasDestination();
+      /**
+       * <code>required .Stats.Destination destination = 1;</code>
+       */
+      SignalMessages.Stats.Destination getDestination();
+
+      // required uint64 packets = 2;
+      /**
+       * <code>required uint64 packets = 2;</code>
+       */
+      boolean hasPackets();
+      /**
+       * <code>required uint64 packets = 2;</code>
+       */
+      long getPackets();
+
+      // required uint64 bytes = 3;
+      /**
+       * <code>required uint64 bytes = 3;</code>
+       */
+      boolean hasBytes();
+      /**
+       * <code>required uint64 bytes = 3;</code>
+       */
+      long getBytes();
+
+      // optional uint64 notReadyDrops = 4;
+      /**
+       * <code>optional uint64 notReadyDrops = 4;</code>
+       *
+       * <pre>
+       *Before the sockets were open
+       * </pre>
+       */
+      boolean hasNotReadyDrops();
+      /**
+       * <code>optional uint64 notReadyDrops = 4;</code>
+       *
+       * <pre>
+       *Before the sockets were open
+       * </pre>
+       */
+      long getNotReadyDrops();
+
+      // optional uint64 oversizedDrops = 5;
+      /**
+       * <code>optional uint64 oversizedDrops = 5;</code>
+       *
+       * <pre>
+       *Larger than the plugin's buffer
+       * </pre>
+       */
+      boolean hasOversizedDrops();
+      /**
+       * <code>optional uint64 oversizedDrops = 5;</code>
+       *
+       * <pre>
+       *Larger than the plugin's buffer
+       * </pre>
+       */
+      long getOversizedDrops();
+
+      // optional uint64 partialSends = 6;
+      /**
+       * <code>optional uint64 partialSends = 6;</code>
+       */
+      boolean hasPartialSends();
+      /**
+       * <code>optional uint64 partialSends = 6;</code>
+       */
+      long getPartialSends();
+
+      // optional uint64 wouldBlockErrors = 7;
+      /**
+       * <code>optional uint64 wouldBlockErrors = 7;</code>
+       *
+       * <pre>
+       *EAGAIN, EWOULDBLOCK
+       * </pre>
+       */
+      boolean hasWouldBlockErrors();
+      /**
+       * <code>optional uint64 wouldBlockErrors = 7;</code>
+       *
+       * <pre>
+       *EAGAIN, EWOULDBLOCK
+       * </pre>
+       */
+      long getWouldBlockErrors();
+
+      // optional uint64 noBufferErrors = 8;
+      /**
+       * <code>optional uint64 noBufferErrors = 8;</code>
+       *
+       * <pre>
+       *ENOBUFS
+       * </pre>
+       */
+      boolean hasNoBufferErrors();
+      /**
+       * <code>optional uint64 noBufferErrors = 8;</code>
+       *
+       * <pre>
+       *ENOBUFS
+       * </pre>
+       */
+      long getNoBufferErrors();
+
+      // optional uint64 refusedErrors = 9;
+      /**
+       * <code>optional uint64 refusedErrors = 9;</code>
+       *
+       * <pre>
+       *ECONNREFUSED
+       * </pre>
+       */
+      boolean hasRefusedErrors();
+      /**
+       * <code>optional uint64 refusedErrors = 9;</code>
+       *
+       * <pre>
+       *ECONNREFUSED
+       * </pre>
+       */
+      long getRefusedErrors();
+
+      // optional uint64 unreachableErrors = 10;
+      /**
+       * <code>optional uint64 unreachableErrors = 10;</code>
+       *
+       * <pre>
+       *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+       * </pre>
+       */
+      boolean hasUnreachableErrors();
+      /**
+       * <code>optional uint64 unreachableErrors = 10;</code>
+       *
+       * <pre>
+       *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+       * </pre>
+       */
+      long getUnreachableErrors();
+
+      // optional uint64 messageSizeErrors = 11;
+      /**
+       * <code>optional uint64 messageSizeErrors = 11;</code>
+       *
+       * <pre>
+       *EMSGSIZE
+       * </pre>
+       */
+      boolean hasMessageSizeErrors();
+      /**
+       * <code>optional uint64 messageSizeErrors = 11;</code>
+       *
+       * <pre>
+       *EMSGSIZE
+       * </pre>
+       */
+      long getMessageSizeErrors();
+
+      // optional uint64 otherErrors = 12;
+      /**
+       * <code>optional uint64 otherErrors = 12;</code>
+       */
+      boolean hasOtherErrors();
+      /**
+       * <code>optional uint64 otherErrors = 12;</code>
+       */
+      long getOtherErrors();
+
+      // optional uint32 queueHighWater = 13;
+      /**
+       * <code>optional uint32 queueHighWater = 13;</code>
+       *
+       * <pre>
+       *Largest send queue occupancy of the interval, in bytes
+       * </pre>
+       */
+      boolean hasQueueHighWater();
+      /**
+       * <code>optional uint32 queueHighWater = 13;</code>
+       *
+       * <pre>
+       *Largest send queue occupancy of the interval, in bytes
+       * </pre>
+       */
+      int getQueueHighWater();
+
+      // optional int32 lastErrno = 14;
+      /**
+       * <code>optional int32 lastErrno = 14;</code>
+       */
+      boolean hasLastErrno();
+      /**
+       * <code>optional int32 lastErrno = 14;</code>
+       */
+      int getLastErrno();
+    }
+    /**
+     * Protobuf type {@code Stats.TransportCounters}
+     *
+     * <pre>
+     *Totals since the plugin was loaded
+     * </pre>
+     */
+    public static final class TransportCounters extends
+        com.google.protobuf.GeneratedMessage
+        implements TransportCountersOrBuilder {
+      // Use TransportCounters.newBuilder() to construct.
+      private TransportCounters(com.google.protobuf.GeneratedMessage.Builder<?> builder) {
+        super(builder);
+        this.unknownFields = builder.getUnknownFields();
+      }
+      private TransportCounters(boolean noInit) { this.unknownFields = com.google.protobuf.UnknownFieldSet.getDefaultInstance(); }
+
+      private static final TransportCounters defaultInstance;
+      public static TransportCounters getDefaultInstance() {
+        return defaultInstance;
+      }
+
+      public TransportCounters getDefaultInstanceForType() {
+        return defaultInstance;
+      }
+
+      private final com.google.protobuf.UnknownFieldSet unknownFields;
+      @java.lang.Override
+      public final com.google.protobuf.UnknownFieldSet
+          getUnknownFields() {
+        return this.unknownFields;
+      }
+      private TransportCounters(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        initFields();
+        int mutable_bitField0_ = 0;
+        com.google.protobuf.UnknownFieldSet.Builder unknownFields =
+            com.google.protobuf.UnknownFieldSet.newBuilder();
+        try {
+          boolean done = false;
+          while (!done) {
+            int tag = input.readTag();
+            switch (tag) {
+              case 0:
+                done = true;
+                break;
+              default: {
+                if (!parseUnknownField(input, unknownFields,
+                                       extensionRegistry, tag)) {
+                  done = true;
+                }
+                break;
+              }
+              case 8: {
+                int rawValue = input.readEnum();
+                SignalMessages.Stats.Destination value = SignalMessages.Stats.Destination.valueOf(rawValue);
+                if (value == null) {
+                  unknownFields.mergeVarintField(1, rawValue);
+                } else {
+                  bitField0_ |= 0x00000001;
+                  destination_ = value;
+                }
+                break;
+              }
+              case 16: {
+                bitField0_ |= 0x00000002;
+                packets_ = input.readUInt64();
+                break;
+              }
+              case 24: {
+                bitField0_ |= 0x00000004;
+                bytes_ = input.readUInt64();
+                break;
+              }
+              case 32: {
+                bitField0_ |= 0x00000008;
+                notReadyDrops_ = input.readUInt64();
+                break;
+              }
+              case 40: {
+                bitField0_ |= 0x00000010;
+                oversizedDrops_ = input.readUInt64();
+                break;
+              }
+              case 48: {
+                bitField0_ |= 0x00000020;
+                partialSends_ = input.readUInt64();
+                break;
+              }
+              case 56: {
+                bitField0_ |= 0x00000040;
+                wouldBlockErrors_ = input.readUInt64();
+                break;
+              }
+              case 64: {
+                bitField0_ |= 0x00000080;
+                noBufferErrors_ = input.readUInt64();
+                break;
+              }
+              case 72: {
+                bitField0_ |= 0x00000100;
+                refusedErrors_ = input.readUInt64();
+                break;
+              }
+              case 80: {
+                bitField0_ |= 0x00000200;
+                unreachableErrors_ = input.readUInt64();
+                break;
+              }
+              case 88: {
+                bitField0_ |= 0x00000400;
+                messageSizeErrors_ = input.readUInt64();
+                break;
+              }
+              case 96: {
+                bitField0_ |= 0x00000800;
+                otherErrors_ = input.readUInt64();
+                break;
+              }
+              case 104: {
+                bitField0_ |= 0x00001000;
+                queueHighWater_ = input.readUInt32();
+                break;
+              }
+              case 112: {
+                bitField0_ |= 0x00002000;
+                lastErrno_ = input.readInt32();
+                break;
+              }
+            }
+          }
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          throw e.setUnfinishedMessage(this);
+        } catch (java.io.IOException e) {
+          throw new com.google.protobuf.InvalidProtocolBufferException(
+              e.getMessage()).setUnfinishedMessage(this);
+        } finally {
+          this.unknownFields = unknownFields.build();
+          makeExtensionsImmutable();
+        }
+      }
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return SignalMessages.internal_static_Stats_TransportCounters_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return SignalMessages.internal_static_Stats_TransportCounters_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                SignalMessages.Stats.TransportCounters.class, SignalMessages.Stats.TransportCounters.Builder.class);
+      }
+
+      public static com.google.protobuf.Parser<TransportCounters> PARSER =
+          new com.google.protobuf.AbstractParser<TransportCounters>() {
+        public TransportCounters parsePartialFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws com.google.protobuf.InvalidProtocolBufferException {
+          return new TransportCounters(input, extensionRegistry);
+        }
+      };
+
+      @java.lang.Override
+      public com.google.protobuf.Parser<TransportCounters> getParserForType() {
+        return PARSER;
+      }
+
+      private int bitField0_;
+      // required .Stats.Destination destination = 1;
+      public static final int DESTINATION_FIELD_NUMBER = 1;
+      private SignalMessages.Stats.Destination destination_;
+      /**
+       * <code>required .Stats.Destination destination = 1;</code>
+       */
+      public boolean hasDestination() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required .Stats.Destination destination = 1;</code>
+       */
+      public SignalMessages.Stats.Destination getDestination() {
+        return destination_;
+      }
+
+      // required uint64 packets = 2;
+      public static final int PACKETS_FIELD_NUMBER = 2;
+      private long packets_;
+      /**
+       * <code>required uint64 packets = 2;</code>
+       */
+      public boolean hasPackets() {
+        return ((bitField0_ & 0x00000002) == 0x00000002);
+      }
+      /**
+       * <code>required uint64 packets = 2;</code>
+       */
+      public long getPackets() {
+        return packets_;
+      }
+
+      // required uint64 bytes = 3;
+      public static final int BYTES_FIELD_NUMBER = 3;
+      private long bytes_;
+      /**
+       * <code>required uint64 bytes = 3;</code>
+       */
+      public boolean hasBytes() {
+        return ((bitField0_ & 0x00000004) == 0x00000004);
+      }
+      /**
+       * <code>required uint64 bytes = 3;</code>
+       */
+      public long getBytes() {
+        return bytes_;
+      }
+
+      // optional uint64 notReadyDrops = 4;
+      public static final int NOTREADYDROPS_FIELD_NUMBER = 4;
+      private long notReadyDrops_;
+      /**
+       * <code>optional uint64 notReadyDrops = 4;</code>
+       *
+       * <pre>
+       *Before the sockets were open
+       * </pre>
+       */
+      public boolean hasNotReadyDrops() {
+        return ((bitField0_ & 0x00000008) == 0x00000008);
+      }
+      /**
+       * <code>optional uint64 notReadyDrops = 4;</code>
+       *
+       * <pre>
+       *Before the sockets were open
+       * </pre>
+       */
+      public long getNotReadyDrops() {
+        return notReadyDrops_;
+      }
+
+      // optional uint64 oversizedDrops = 5;
+      public static final int OVERSIZEDDROPS_FIELD_NUMBER = 5;
+      private long oversizedDrops_;
+      /**
+       * <code>optional uint64 oversizedDrops = 5;</code>
+       *
+       * <pre>
+       *Larger than the plugin's buffer
+       * </pre>
+       */
+      public boolean hasOversizedDrops() {
+        return ((bitField0_ & 0x00000010) == 0x00000010);
+      }
+      /**
+       * <code>optional uint64 oversizedDrops = 5;</code>
+       *
+       * <pre>
+       *Larger than the plugin's buffer
+       * </pre>
+       */
+      public long getOversizedDrops() {
+        return oversizedDrops_;
+      }
+
+      // optional uint64 partialSends = 6;
+      public static final int PARTIALSENDS_FIELD_NUMBER = 6;
+      private long partialSends_;
+      /**
+       * <code>optional uint64 partialSends = 6;</code>
+       */
+      public boolean hasPartialSends() {
+        return ((bitField0_ & 0x00000020) == 0x00000020);
+      }
+      /**
+       * <code>optional uint64 partialSends = 6;</code>
+       */
+      public long getPartialSends() {
+        return partialSends_;
+      }
+
+      // optional uint64 wouldBlockErrors = 7;
+      public static final int WOULDBLOCKERRORS_FIELD_NUMBER = 7;
+      private long wouldBlockErrors_;
+      /**
+       * <code>optional uint64 wouldBlockErrors = 7;</code>
+       *
+       * <pre>
+       *EAGAIN, EWOULDBLOCK
+       * </pre>
+       */
+      public boolean hasWouldBlockErrors() {
+        return ((bitField0_ & 0x00000040) == 0x00000040);
+      }
+      /**
+       * <code>optional uint64 wouldBlockErrors = 7;</code>
+       *
+       * <pre>
+       *EAGAIN, EWOULDBLOCK
+       * </pre>
+       */
+      public long getWouldBlockErrors() {
+        return wouldBlockErrors_;
+      }
+
+      // optional uint64 noBufferErrors = 8;
+      public static final int NOBUFFERERRORS_FIELD_NUMBER = 8;
+      private long noBufferErrors_;
+      /**
+       * <code>optional uint64 noBufferErrors = 8;</code>
+       *
+       * <pre>
+       *ENOBUFS
+       * </pre>
+       */
+      public boolean hasNoBufferErrors() {
+        return ((bitField0_ & 0x00000080) == 0x00000080);
+      }
+      /**
+       * <code>optional uint64 noBufferErrors = 8;</code>
+       *
+       * <pre>
+       *ENOBUFS
+       * </pre>
+       */
+      public long getNoBufferErrors() {
+        return noBufferErrors_;
+      }
+
+      // optional uint64 refusedErrors = 9;
+      public static final int REFUSEDERRORS_FIELD_NUMBER = 9;
+      private long refusedErrors_;
+      /**
+       * <code>optional uint64 refusedErrors = 9;</code>
+       *
+       * <pre>
+       *ECONNREFUSED
+       * </pre>
+       */
+      public boolean hasRefusedErrors() {
+        return ((bitField0_ & 0x00000100) == 0x00000100);
+      }
+      /**
+       * <code>optional uint64 refusedErrors = 9;</code>
+       *
+       * <pre>
+       *ECONNREFUSED
+       * </pre>
+       */
+      public long getRefusedErrors() {
+        return refusedErrors_;
+      }
+
+      // optional uint64 unreachableErrors = 10;
+      public static final int UNREACHABLEERRORS_FIELD_NUMBER = 10;
+      private long unreachableErrors_;
+      /**
+       * <code>optional uint64 unreachableErrors = 10;</code>
+       *
+       * <pre>
+       *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+       * </pre>
+       */
+      public boolean hasUnreachableErrors() {
+        return ((bitField0_ & 0x00000200) == 0x00000200);
+      }
+      /**
+       * <code>optional uint64 unreachableErrors = 10;</code>
+       *
+       * <pre>
+       *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+       * </pre>
+       */
+      public long getUnreachableErrors() {
+        return unreachableErrors_;
+      }
+
+      // optional uint64 messageSizeErrors = 11;
+      public static final int MESSAGESIZEERRORS_FIELD_NUMBER = 11;
+      private long messageSizeErrors_;
+      /**
+       * <code>optional uint64 messageSizeErrors = 11;</code>
+       *
+       * <pre>
+       *EMSGSIZE
+       * </pre>
+       */
+      public boolean hasMessageSizeErrors() {
+        return ((bitField0_ & 0x00000400) == 0x00000400);
+      }
+      /**
+       * <code>optional uint64 messageSizeErrors = 11;</code>
+       *
+       * <pre>
+       *EMSGSIZE
+       * </pre>
+       */
+      public long getMessageSizeErrors() {
+        return messageSizeErrors_;
+      }
+
+      // optional uint64 otherErrors = 12;
+      public static final int OTHERERRORS_FIELD_NUMBER = 12;
+      private long otherErrors_;
+      /**
+       * <code>optional uint64 otherErrors = 12;</code>
+       */
+      public boolean hasOtherErrors() {
+        return ((bitField0_ & 0x00000800) == 0x00000800);
+      }
+      /**
+       * <code>optional uint64 otherErrors = 12;</code>
+       */
+      public long getOtherErrors() {
+        return otherErrors_;
+      }
+
+      // optional uint32 queueHighWater = 13;
+      public static final int QUEUEHIGHWATER_FIELD_NUMBER = 13;
+      private int queueHighWater_;
+      /**
+       * <code>optional uint32 queueHighWater = 13;</code>
+       *
+       * <pre>
+       *Largest send queue occupancy of the interval, in bytes
+       * </pre>
+       */
+      public boolean hasQueueHighWater() {
+        return ((bitField0_ & 0x00001000) == 0x00001000);
+      }
+      /**
+       * <code>optional uint32 queueHighWater = 13;</code>
+       *
+       * <pre>
+       *Largest send queue occupancy of the interval, in bytes
+       * </pre>
+       */
+      public int getQueueHighWater() {
+        return queueHighWater_;
+      }
+
+      // optional int32 lastErrno = 14;
+      public static final int LASTERRNO_FIELD_NUMBER = 14;
+      private int lastErrno_;
+      /**
+       * <code>optional int32 lastErrno = 14;</code>
+       */
+      public boolean hasLastErrno() {
+        return ((bitField0_ & 0x00002000) == 0x00002000);
+      }
+      /**
+       * <code>optional int32 lastErrno = 14;</code>
+       */
+      public int getLastErrno() {
+        return lastErrno_;
+      }
+
+      private void initFields() {
+        destination_ = SignalMessages.Stats.Destination.SIGNAL_LEVEL_PORT;
+        packets_ = 0L;
+        bytes_ = 0L;
+        notReadyDrops_ = 0L;
+        oversizedDrops_ = 0L;
+        partialSends_ = 0L;
+        wouldBlockErrors_ = 0L;
+        noBufferErrors_ = 0L;
+        refusedErrors_ = 0L;
+        unreachableErrors_ = 0L;
+        messageSizeErrors_ = 0L;
+        otherErrors_ = 0L;
+        queueHighWater_ = 0;
+        lastErrno_ = 0;
+      }
+      private byte memoizedIsInitialized = -1;
+      public final boolean isInitialized() {
+        byte isInitialized = memoizedIsInitialized;
+        if (isInitialized != -1) return isInitialized == 1;
+
+        if (!hasDestination()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasPackets()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasBytes()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        memoizedIsInitialized = 1;
+        return true;
+      }
+
+      public void writeTo(com.google.protobuf.CodedOutputStream output)
+                          throws java.io.IOException {
+        getSerializedSize();
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          output.writeEnum(1, destination_.getNumber());
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          output.writeUInt64(2, packets_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          output.writeUInt64(3, bytes_);
+        }
+        if (((bitField0_ & 0x00000008) == 0x00000008)) {
+          output.writeUInt64(4, notReadyDrops_);
+        }
+        if (((bitField0_ & 0x00000010) == 0x00000010)) {
+          output.writeUInt64(5, oversizedDrops_);
+        }
+        if (((bitField0_ & 0x00000020) == 0x00000020)) {
+          output.writeUInt64(6, partialSends_);
+        }
+        if (((bitField0_ & 0x00000040) == 0x00000040)) {
+          output.writeUInt64(7, wouldBlockErrors_);
+        }
+        if (((bitField0_ & 0x00000080) == 0x00000080)) {
+          output.writeUInt64(8, noBufferErrors_);
+        }
+        if (((bitField0_ & 0x00000100) == 0x00000100)) {
+          output.writeUInt64(9, refusedErrors_);
+        }
+        if (((bitField0_ & 0x00000200) == 0x00000200)) {
+          output.writeUInt64(10, unreachableErrors_);
+        }
+        if (((bitField0_ & 0x00000400) == 0x00000400)) {
+          output.writeUInt64(11, messageSizeErrors_);
+        }
+        if (((bitField0_ & 0x00000800) == 0x00000800)) {
+          output.writeUInt64(12, otherErrors_);
+        }
+        if (((bitField0_ & 0x00001000) == 0x00001000)) {
+          output.writeUInt32(13, queueHighWater_);
+        }
+        if (((bitField0_ & 0x00002000) == 0x00002000)) {
+          output.writeInt32(14, lastErrno_);
+        }
+        getUnknownFields().writeTo(output);
+      }
+
+      private int memoizedSerializedSize = -1;
+      public int getSerializedSize() {
+        int size = memoizedSerializedSize;
+        if (size != -1) return size;
+
+        size = 0;
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeEnumSize(1, destination_.getNumber());
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(2, packets_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(3, bytes_);
+        }
+        if (((bitField0_ & 0x00000008) == 0x00000008)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(4, notReadyDrops_);
+        }
+        if (((bitField0_ & 0x00000010) == 0x00000010)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(5, oversizedDrops_);
+        }
+        if (((bitField0_ & 0x00000020) == 0x00000020)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(6, partialSends_);
+        }
+        if (((bitField0_ & 0x00000040) == 0x00000040)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(7, wouldBlockErrors_);
+        }
+        if (((bitField0_ & 0x00000080) == 0x00000080)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(8, noBufferErrors_);
+        }
+        if (((bitField0_ & 0x00000100) == 0x00000100)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(9, refusedErrors_);
+        }
+        if (((bitField0_ & 0x00000200) == 0x00000200)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(10, unreachableErrors_);
+        }
+        if (((bitField0_ & 0x00000400) == 0x00000400)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(11, messageSizeErrors_);
+        }
+        if (((bitField0_ & 0x00000800) == 0x00000800)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(12, otherErrors_);
+        }
+        if (((bitField0_ & 0x00001000) == 0x00001000)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt32Size(13, queueHighWater_);
+        }
+        if (((bitField0_ & 0x00002000) == 0x00002000)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeInt32Size(14, lastErrno_);
+        }
+        size += getUnknownFields().getSerializedSize();
+        memoizedSerializedSize = size;
+        return size;
+      }
+
+      private static final long serialVersionUID = 0L;
+      @java.lang.Override
+      protected java.lang.Object writeReplace()
+          throws java.io.ObjectStreamException {
+        return super.writeReplace();
+      }
+
+      public static SignalMessages.Stats.TransportCounters parseFrom(
+          com.google.protobuf.ByteString data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.Stats.TransportCounters parseFrom(
+          com.google.protobuf.ByteString data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.Stats.TransportCounters parseFrom(byte[] data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.Stats.TransportCounters parseFrom(
+          byte[] data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.Stats.TransportCounters parseFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.Stats.TransportCounters parseFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.Stats.TransportCounters parseDelimitedFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input);
+      }
+      public static SignalMessages.Stats.TransportCounters parseDelimitedFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.Stats.TransportCounters parseFrom(
+          com.google.protobuf.CodedInputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.Stats.TransportCounters parseFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+
+      public static Builder newBuilder() { return Builder.create(); }
+      public Builder newBuilderForType() { return newBuilder(); }
+      public static Builder newBuilder(SignalMessages.Stats.TransportCounters prototype) {
+        return newBuilder().mergeFrom(prototype);
+      }
+      public Builder toBuilder() { return newBuilder(this); }
+
+      @java.lang.Override
+      protected Builder newBuilderForType(
+          com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+        Builder builder = new Builder(parent);
+        return builder;
+      }
+      /**
+       * Protobuf type {@code Stats.TransportCounters}
+       *
+       * <pre>
+       *Totals since the plugin was loaded
+       * </pre>
+       */
+      public static final class Builder extends
+          com.google.protobuf.GeneratedMessage.Builder<Builder>
+         implements SignalMessages.Stats.TransportCountersOrBuilder {
+        public static final com.google.protobuf.Descriptors.Descriptor
+            getDescriptor() {
+          return SignalMessages.internal_static_Stats_TransportCounters_descriptor;
+        }
+
+        protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+            internalGetFieldAccessorTable() {
+          return SignalMessages.internal_static_Stats_TransportCounters_fieldAccessorTable
+              .ensureFieldAccessorsInitialized(
+                  SignalMessages.Stats.TransportCounters.class, SignalMessages.Stats.TransportCounters.Builder.class);
+        }
+
+        // Construct using SignalMessages.Stats.TransportCounters.newBuilder()
+        private Builder() {
+          maybeForceBuilderInitialization();
+        }
+
+        private Builder(
+            com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+          super(parent);
+          maybeForceBuilderInitialization();
+        }
+        private void maybeForceBuilderInitialization() {
+          if (com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders) {
+          }
+        }
+        private static Builder create() {
+          return new Builder();
+        }
+
+        public Builder clear() {
+          super.clear();
+          destination_ = SignalMessages.Stats.Destination.SIGNAL_LEVEL_PORT;
+          bitField0_ = (bitField0_ & ~0x00000001);
+          packets_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000002);
+          bytes_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000004);
+          notReadyDrops_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000008);
+          oversizedDrops_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000010);
+          partialSends_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000020);
+          wouldBlockErrors_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000040);
+          noBufferErrors_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000080);
+          refusedErrors_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000100);
+          unreachableErrors_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000200);
+          messageSizeErrors_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000400);
+          otherErrors_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000800);
+          queueHighWater_ = 0;
+          bitField0_ = (bitField0_ & ~0x00001000);
+          lastErrno_ = 0;
+          bitField0_ = (bitField0_ & ~0x00002000);
+          return this;
+        }
+
+        public Builder clone() {
+          return create().mergeFrom(buildPartial());
+        }
+
+        public com.google.protobuf.Descriptors.Descriptor
+            getDescriptorForType() {
+          return SignalMessages.internal_static_Stats_TransportCounters_descriptor;
+        }
+
+        public SignalMessages.Stats.TransportCounters getDefaultInstanceForType() {
+          return SignalMessages.Stats.TransportCounters.getDefaultInstance();
+        }
+
+        public SignalMessages.Stats.TransportCounters build() {
+          SignalMessages.Stats.TransportCounters result = buildPartial();
+          if (!result.isInitialized()) {
+            throw newUninitializedMessageException(result);
+          }
+          return result;
+        }
+
+        public SignalMessages.Stats.TransportCounters buildPartial() {
+          SignalMessages.Stats.TransportCounters result = new SignalMessages.Stats.TransportCounters(this);
+          int from_bitField0_ = bitField0_;
+          int to_bitField0_ = 0;
+          if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+            to_bitField0_ |= 0x00000001;
+          }
+          result.destination_ = destination_;
+          if (((from_bitField0_ & 0x00000002) == 0x00000002)) {
+            to_bitField0_ |= 0x00000002;
+          }
+          result.packets_ = packets_;
+          if (((from_bitField0_ & 0x00000004) == 0x00000004)) {
+            to_bitField0_ |= 0x00000004;
+          }
+          result.bytes_ = bytes_;
+          if (((from_bitField0_ & 0x00000008) == 0x00000008)) {
+            to_bitField0_ |= 0x00000008;
+          }
+          result.notReadyDrops_ = notReadyDrops_;
+          if (((from_bitField0_ & 0x00000010) == 0x00000010)) {
+            to_bitField0_ |= 0x00000010;
+          }
+          result.oversizedDrops_ = oversizedDrops_;
+          if (((from_bitField0_ & 0x00000020) == 0x00000020)) {
+            to_bitField0_ |= 0x00000020;
+          }
+          result.partialSends_ = partialSends_;
+          if (((from_bitField0_ & 0x00000040) == 0x00000040)) {
+            to_bitField0_ |= 0x00000040;
+          }
+          result.wouldBlockErrors_ = wouldBlockErrors_;
+          if (((from_bitField0_ & 0x00000080) == 0x00000080)) {
+            to_bitField0_ |= 0x00000080;
+          }
+          result.noBufferErrors_ = noBufferErrors_;
+          if (((from_bitField0_ & 0x00000100) == 0x00000100)) {
+            to_bitField0_ |= 0x00000100;
+          }
+          result.refusedErrors_ = refusedErrors_;
+          if (((from_bitField0_ & 0x00000200) == 0x00000200)) {
+            to_bitField0_ |= 0x00000200;
+          }
+          result.unreachableErrors_ = unreachableErrors_;
+          if (((from_bitField0_ & 0x00000400) == 0x00000400)) {
+            to_bitField0_ |= 0x00000400;
+          }
+          result.messageSizeErrors_ = messageSizeErrors_;
+          if (((from_bitField0_ & 0x00000800) == 0x00000800)) {
+            to_bitField0_ |= 0x00000800;
+          }
+          result.otherErrors_ = otherErrors_;
+          if (((from_bitField0_ & 0x00001000) == 0x00001000)) {
+            to_bitField0_ |= 0x00001000;
+          }
+          result.queueHighWater_ = queueHighWater_;
+          if (((from_bitField0_ & 0x00002000) == 0x00002000)) {
+            to_bitField0_ |= 0x00002000;
+          }
+          result.lastErrno_ = lastErrno_;
+          result.bitField0_ = to_bitField0_;
+          onBuilt();
+          return result;
+        }
+
+        public Builder mergeFrom(com.google.protobuf.Message other) {
+          if (other instanceof SignalMessages.Stats.TransportCounters) {
+            return mergeFrom((SignalMessages.Stats.TransportCounters)other);
+          } else {
+            super.mergeFrom(other);
+            return this;
+          }
+        }
+
+        public Builder mergeFrom(SignalMessages.Stats.TransportCounters other) {
+          if (other == SignalMessages.Stats.TransportCounters.getDefaultInstance()) return this;
+          if (other.hasDestination()) {
+            setDestination(other.getDestination());
+          }
+          if (other.hasPackets()) {
+            setPackets(other.getPackets());
+          }
+          if (other.hasBytes()) {
+            setBytes(other.getBytes());
+          }
+          if (other.hasNotReadyDrops()) {
+            setNotReadyDrops(other.getNotReadyDrops());
+          }
+          if (other.hasOversizedDrops()) {
+            setOversizedDrops(other.getOversizedDrops());
+          }
+          if (other.hasPartialSends()) {
+            setPartialSends(other.getPartialSends());
+          }
+          if (other.hasWouldBlockErrors()) {
+            setWouldBlockErrors(other.getWouldBlockErrors());
+          }
+          if (other.hasNoBufferErrors()) {
+            setNoBufferErrors(other.getNoBufferErrors());
+          }
+          if (other.hasRefusedErrors()) {
+            setRefusedErrors(other.getRefusedErrors());
+          }
+          if (other.hasUnreachableErrors()) {
+            setUnreachableErrors(other.getUnreachableErrors());
+          }
+          if (other.hasMessageSizeErrors()) {
+            setMessageSizeErrors(other.getMessageSizeErrors());
+          }
+          if (other.hasOtherErrors()) {
+            setOtherErrors(other.getOtherErrors());
+          }
+          if (other.hasQueueHighWater()) {
+            setQueueHighWater(other.getQueueHighWater());
+          }
+          if (other.hasLastErrno()) {
+            setLastErrno(other.getLastErrno());
+          }
+          this.mergeUnknownFields(other.getUnknownFields());
+          return this;
+        }
+
+        public final boolean isInitialized() {
+          if (!hasDestination()) {
+            
+            return false;
+          }
+          if (!hasPackets()) {
+            
+            return false;
+          }
+          if (!hasBytes()) {
+            
+            return false;
+          }
+          return true;
+        }
+
+        public Builder mergeFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws java.io.IOException {
+          SignalMessages.Stats.TransportCounters parsedMessage = null;
+          try {
+            parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+          } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+            parsedMessage = (SignalMessages.Stats.TransportCounters) e.getUnfinishedMessage();
+            throw e;
+          } finally {
+            if (parsedMessage != null) {
+              mergeFrom(parsedMessage);
+            }
+          }
+          return this;
+        }
+        private int bitField0_;
+
+        // required .Stats.Destination destination = 1;
+        private SignalMessages.Stats.Destination destination_ = SignalMessages.Stats.Destination.SIGNAL_LEVEL_PORT;
+        /**
+         * <code>required .Stats.Destination destination = 1;</code>
+         */
+        public boolean hasDestination() {
+          return ((bitField0_ & 0x00000001) == 0x00000001);
+        }
+        /**
+         * <code>required .Stats.Destination destination = 1;</code>
+         */
+        public SignalMessages.Stats.Destination getDestination() {
+          return destination_;
+        }
+        /**
+         * <code>required .Stats.Destination destination = 1;</code>
+         */
+        public Builder setDestination(SignalMessages.Stats.Destination value) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          bitField0_ |= 0x00000001;
+          destination_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required .Stats.Destination destination = 1;</code>
+         */
+        public Builder clearDestination() {
+          bitField0_ = (bitField0_ & ~0x00000001);
+          destination_ = SignalMessages.Stats.Destination.SIGNAL_LEVEL_PORT;
+          onChanged();
+          return this;
+        }
+
+        // required uint64 packets = 2;
+        private long packets_ ;
+        /**
+         * <code>required uint64 packets = 2;</code>
+         */
+        public boolean hasPackets() {
+          return ((bitField0_ & 0x00000002) == 0x00000002);
+        }
+        /**
+         * <code>required uint64 packets = 2;</code>
+         */
+        public long getPackets() {
+          return packets_;
+        }
+        /**
+         * <code>required uint64 packets = 2;</code>
+         */
+        public Builder setPackets(long value) {
+          bitField0_ |= 0x00000002;
+          packets_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required uint64 packets = 2;</code>
+         */
+        public Builder clearPackets() {
+          bitField0_ = (bitField0_ & ~0x00000002);
+          packets_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // required uint64 bytes = 3;
+        private long bytes_ ;
+        /**
+         * <code>required uint64 bytes = 3;</code>
+         */
+        public boolean hasBytes() {
+          return ((bitField0_ & 0x00000004) == 0x00000004);
+        }
+        /**
+         * <code>required uint64 bytes = 3;</code>
+         */
+        public long getBytes() {
+          return bytes_;
+        }
+        /**
+         * <code>required uint64 bytes = 3;</code>
+         */
+        public Builder setBytes(long value) {
+          bitField0_ |= 0x00000004;
+          bytes_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required uint64 bytes = 3;</code>
+         */
+        public Builder clearBytes() {
+          bitField0_ = (bitField0_ & ~0x00000004);
+          bytes_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 notReadyDrops = 4;
+        private long notReadyDrops_ ;
+        /**
+         * <code>optional uint64 notReadyDrops = 4;</code>
+         *
+         * <pre>
+         *Before the sockets were open
+         * </pre>
+         */
+        public boolean hasNotReadyDrops() {
+          return ((bitField0_ & 0x00000008) == 0x00000008);
+        }
+        /**
+         * <code>optional uint64 notReadyDrops = 4;</code>
+         *
+         * <pre>
+         *Before the sockets were open
+         * </pre>
+         */
+        public long getNotReadyDrops() {
+          return notReadyDrops_;
+        }
+        /**
+         * <code>optional uint64 notReadyDrops = 4;</code>
+         *
+         * <pre>
+         *Before the sockets were open
+         * </pre>
+         */
+        public Builder setNotReadyDrops(long value) {
+          bitField0_ |= 0x00000008;
+          notReadyDrops_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 notReadyDrops = 4;</code>
+         *
+         * <pre>
+         *Before the sockets were open
+         * </pre>
+         */
+        public Builder clearNotReadyDrops() {
+          bitField0_ = (bitField0_ & ~0x00000008);
+          notReadyDrops_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 oversizedDrops = 5;
+        private long oversizedDrops_ ;
+        /**
+         * <code>optional uint64 oversizedDrops = 5;</code>
+         *
+         * <pre>
+         *Larger than the plugin's buffer
+         * </pre>
+         */
+        public boolean hasOversizedDrops() {
+          return ((bitField0_ & 0x00000010) == 0x00000010);
+        }
+        /**
+         * <code>optional uint64 oversizedDrops = 5;</code>
+         *
+         * <pre>
+         *Larger than the plugin's buffer
+         * </pre>
+         */
+        public long getOversizedDrops() {
+          return oversizedDrops_;
+        }
+        /**
+         * <code>optional uint64 oversizedDrops = 5;</code>
+         *
+         * <pre>
+         *Larger than the plugin's buffer
+         * </pre>
+         */
+        public Builder setOversizedDrops(long value) {
+          bitField0_ |= 0x00000010;
+          oversizedDrops_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 oversizedDrops = 5;</code>
+         *
+         * <pre>
+         *Larger than the plugin's buffer
+         * </pre>
+         */
+        public Builder clearOversizedDrops() {
+          bitField0_ = (bitField0_ & ~0x00000010);
+          oversizedDrops_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 partialSends = 6;
+        private long partialSends_ ;
+        /**
+         * <code>optional uint64 partialSends = 6;</code>
+         */
+        public boolean hasPartialSends() {
+          return ((bitField0_ & 0x00000020) == 0x00000020);
+        }
+        /**
+         * <code>optional uint64 partialSends = 6;</code>
+         */
+        public long getPartialSends() {
+          return partialSends_;
+        }
+        /**
+         * <code>optional uint64 partialSends = 6;</code>
+         */
+        public Builder setPartialSends(long value) {
+          bitField0_ |= 0x00000020;
+          partialSends_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 partialSends = 6;</code>
+         */
+        public Builder clearPartialSends() {
+          bitField0_ = (bitField0_ & ~0x00000020);
+          partialSends_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 wouldBlockErrors = 7;
+        private long wouldBlockErrors_ ;
+        /**
+         * <code>optional uint64 wouldBlockErrors = 7;</code>
+         *
+         * <pre>
+         *EAGAIN, EWOULDBLOCK
+         * </pre>
+         */
+        public boolean hasWouldBlockErrors() {
+          return ((bitField0_ & 0x00000040) == 0x00000040);
+        }
+        /**
+         * <code>optional uint64 wouldBlockErrors = 7;</code>
+         *
+         * <pre>
+         *EAGAIN, EWOULDBLOCK
+         * </pre>
+         */
+        public long getWouldBlockErrors() {
+          return wouldBlockErrors_;
+        }
+        /**
+         * <code>optional uint64 wouldBlockErrors = 7;</code>
+         *
+         * <pre>
+         *EAGAIN, EWOULDBLOCK
+         * </pre>
+         */
+        public Builder setWouldBlockErrors(long value) {
+          bitField0_ |= 0x00000040;
+          wouldBlockErrors_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 wouldBlockErrors = 7;</code>
+         *
+         * <pre>
+         *EAGAIN, EWOULDBLOCK
+         * </pre>
+         */
+        public Builder clearWouldBlockErrors() {
+          bitField0_ = (bitField0_ & ~0x00000040);
+          wouldBlockErrors_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 noBufferErrors = 8;
+        private long noBufferErrors_ ;
+        /**
+         * <code>optional uint64 noBufferErrors = 8;</code>
+         *
+         * <pre>
+         *ENOBUFS
+         * </pre>
+         */
+        public boolean hasNoBufferErrors() {
+          return ((bitField0_ & 0x00000080) == 0x00000080);
+        }
+        /**
+         * <code>optional uint64 noBufferErrors = 8;</code>
+         *
+         * <pre>
+         *ENOBUFS
+         * </pre>
+         */
+        public long getNoBufferErrors() {
+          return noBufferErrors_;
+        }
+        /**
+         * <code>optional uint64 noBufferErrors = 8;</code>
+         *
+         * <pre>
+         *ENOBUFS
+         * </pre>
+         */
+        public Builder setNoBufferErrors(long value) {
+          bitField0_ |= 0x00000080;
+          noBufferErrors_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 noBufferErrors = 8;</code>
+         *
+         * <pre>
+         *ENOBUFS
+         * </pre>
+         */
+        public Builder clearNoBufferErrors() {
+          bitField0_ = (bitField0_ & ~0x00000080);
+          noBufferErrors_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 refusedErrors = 9;
+        private long refusedErrors_ ;
+        /**
+         * <code>optional uint64 refusedErrors = 9;</code>
+         *
+         * <pre>
+         *ECONNREFUSED
+         * </pre>
+         */
+        public boolean hasRefusedErrors() {
+          return ((bitField0_ & 0x00000100) == 0x00000100);
+        }
+        /**
+         * <code>optional uint64 refusedErrors = 9;</code>
+         *
+         * <pre>
+         *ECONNREFUSED
+         * </pre>
+         */
+        public long getRefusedErrors() {
+          return refusedErrors_;
+        }
+        /**
+         * <code>optional uint64 refusedErrors = 9;</code>
+         *
+         * <pre>
+         *ECONNREFUSED
+         * </pre>
+         */
+        public Builder setRefusedErrors(long value) {
+          bitField0_ |= 0x00000100;
+          refusedErrors_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 refusedErrors = 9;</code>
+         *
+         * <pre>
+         *ECONNREFUSED
+         * </pre>
+         */
+        public Builder clearRefusedErrors() {
+          bitField0_ = (bitField0_ & ~0x00000100);
+          refusedErrors_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 unreachableErrors = 10;
+        private long unreachableErrors_ ;
+        /**
+         * <code>optional uint64 unreachableErrors = 10;</code>
+         *
+         * <pre>
+         *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+         * </pre>
+         */
+        public boolean hasUnreachableErrors() {
+          return ((bitField0_ & 0x00000200) == 0x00000200);
+        }
+        /**
+         * <code>optional uint64 unreachableErrors = 10;</code>
+         *
+         * <pre>
+         *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+         * </pre>
+         */
+        public long getUnreachableErrors() {
+          return unreachableErrors_;
+        }
+        /**
+         * <code>optional uint64 unreachableErrors = 10;</code>
+         *
+         * <pre>
+         *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+         * </pre>
+         */
+        public Builder setUnreachableErrors(long value) {
+          bitField0_ |= 0x00000200;
+          unreachableErrors_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 unreachableErrors = 10;</code>
+         *
+         * <pre>
+         *ENETDOWN, ENETUNREACH, EHOSTDOWN, EHOSTUNREACH
+         * </pre>
+         */
+        public Builder clearUnreachableErrors() {
+          bitField0_ = (bitField0_ & ~0x00000200);
+          unreachableErrors_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 messageSizeErrors = 11;
+        private long messageSizeErrors_ ;
+        /**
+         * <code>optional uint64 messageSizeErrors = 11;</code>
+         *
+         * <pre>
+         *EMSGSIZE
+         * </pre>
+         */
+        public boolean hasMessageSizeErrors() {
+          return ((bitField0_ & 0x00000400) == 0x00000400);
+        }
+        /**
+         * <code>optional uint64 messageSizeErrors = 11;</code>
+         *
+         * <pre>
+         *EMSGSIZE
+         * </pre>
+         */
+        public long getMessageSizeErrors() {
+          return messageSizeErrors_;
+        }
+        /**
+         * <code>optional uint64 messageSizeErrors = 11;</code>
+         *
+         * <pre>
+         *EMSGSIZE
+         * </pre>
+         */
+        public Builder setMessageSizeErrors(long value) {
+          bitField0_ |= 0x00000400;
+          messageSizeErrors_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 messageSizeErrors = 11;</code>
+         *
+         * <pre>
+         *EMSGSIZE
+         * </pre>
+         */
+        public Builder clearMessageSizeErrors() {
+          bitField0_ = (bitField0_ & ~0x00000400);
+          messageSizeErrors_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint64 otherErrors = 12;
+        private long otherErrors_ ;
+        /**
+         * <code>optional uint64 otherErrors = 12;</code>
+         */
+        public boolean hasOtherErrors() {
+          return ((bitField0_ & 0x00000800) == 0x00000800);
+        }
+        /**
+         * <code>optional uint64 otherErrors = 12;</code>
+         */
+        public long getOtherErrors() {
+          return otherErrors_;
+        }
+        /**
+         * <code>optional uint64 otherErrors = 12;</code>
+         */
+        public Builder setOtherErrors(long value) {
+          bitField0_ |= 0x00000800;
+          otherErrors_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint64 otherErrors = 12;</code>
+         */
+        public Builder clearOtherErrors() {
+          bitField0_ = (bitField0_ & ~0x00000800);
+          otherErrors_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // optional uint32 queueHighWater = 13;
+        private int queueHighWater_ ;
+        /**
+         * <code>optional uint32 queueHighWater = 13;</code>
+         *
+         * <pre>
+         *Largest send queue occupancy of the interval, in bytes
+         * </pre>
+         */
+        public boolean hasQueueHighWater() {
+          return ((bitField0_ & 0x00001000) == 0x00001000);
+        }
+        /**
+         * <code>optional uint32 queueHighWater = 13;</code>
+         *
+         * <pre>
+         *Largest send queue occupancy of the interval, in bytes
+         * </pre>
+         */
+        public int getQueueHighWater() {
+          return queueHighWater_;
+        }
+        /**
+         * <code>optional uint32 queueHighWater = 13;</code>
+         *
+         * <pre>
+         *Largest send queue occupancy of the interval, in bytes
+         * </pre>
+         */
+        public Builder setQueueHighWater(int value) {
+          bitField0_ |= 0x00001000;
+          queueHighWater_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional uint32 queueHighWater = 13;</code>
+         *
+         * <pre>
+         *Largest send queue occupancy of the interval, in bytes
+         * </pre>
+         */
+        public Builder clearQueueHighWater() {
+          bitField0_ = (bitField0_ & ~0x00001000);
+          queueHighWater_ = 0;
+          onChanged();
+          return this;
+        }
+
+        // optional int32 lastErrno = 14;
+        private int lastErrno_ ;
+        /**
+         * <code>optional int32 lastErrno = 14;</code>
+         */
+        public boolean hasLastErrno() {
+          return ((bitField0_ & 0x00002000) == 0x00002000);
+        }
+        /**
+         * <code>optional int32 lastErrno = 14;</code>
+         */
+        public int getLastErrno() {
+          return lastErrno_;
+        }
+        /**
+         * <code>optional int32 lastErrno = 14;</code>
+         */
+        public Builder setLastErrno(int value) {
+          bitField0_ |= 0x00002000;
+          lastErrno_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>optional int32 lastErrno = 14;</code>
+         */
+        public Builder clearLastErrno() {
+          bitField0_ = (bitField0_ & ~0x00002000);
+          lastErrno_ = 0;
+          onChanged();
+          return this;
+        }
+
+        // @@protoc_insertion_point(builder_scope:Stats.TransportCounters)
+      }
+
+      static {
+        defaultInstance = new TransportCounters(true);
+        defaultInstance.initFields();
+      }
+
+      // @@protoc_insertion_point(class_scope:Stats.TransportCounters)
+    }
+
+    public interface StreamCountersOrBuilder
+        extends com.google.protobuf.MessageOrBuilder {
+
+      // required .Stats.Stream stream = 1;
+      /**
+       * <code>required .Stats.Stream stream = 1;</code>
+       */
+      boolean hasStream();
+      /**
+       * <code>required .Stats.Stream stream = 1;</code>
+       */
+      SignalMessages.Stats.Stream getStream();
+
+      // required uint64 sent = 2;
+      /**
+       * <code>required uint64 sent = 2;</code>
+       */
+      boolean hasSent();
+      /**
+       * <code>required uint64 sent = 2;</code>
+       */
+      long getSent();
+
+      // required uint64 suppressed = 3;
+      /**
+       * <code>required uint64 suppressed = 3;</code>
+       */
+      boolean hasSuppressed();
+      /**
+       * <code>required uint64 suppressed = 3;</code>
+       */
+      long getSuppressed();
+    }
+    /**
+     * Protobuf type {@code Stats.StreamCounters}
+     *
+     * <pre>
+     *Output policy of a continuous stream, since the plugin was loaded
+     * </pre>
+     */
+    public static final class StreamCounters extends
+        com.google.protobuf.GeneratedMessage
+        implements StreamCountersOrBuilder {
+      // Use StreamCounters.newBuilder() to construct.
+      private StreamCounters(com.google.protobuf.GeneratedMessage.Builder<?> builder) {
+        super(builder);
+        this.unknownFields = builder.getUnknownFields();
+      }
+      private StreamCounters(boolean noInit) { this.unknownFields = com.google.protobuf.UnknownFieldSet.getDefaultInstance(); }
+
+      private static final StreamCounters defaultInstance;
+      public static StreamCounters getDefaultInstance() {
+        return defaultInstance;
+      }
+
+      public StreamCounters getDefaultInstanceForType() {
+        return defaultInstance;
+      }
+
+      private final com.google.protobuf.UnknownFieldSet unknownFields;
+      @java.lang.Override
+      public final com.google.protobuf.UnknownFieldSet
+          getUnknownFields() {
+        return this.unknownFields;
+      }
+      private StreamCounters(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        initFields();
+        int mutable_bitField0_ = 0;
+        com.google.protobuf.UnknownFieldSet.Builder unknownFields =
+            com.google.protobuf.UnknownFieldSet.newBuilder();
+        try {
+          boolean done = false;
+          while (!done) {
+            int tag = input.readTag();
+            switch (tag) {
+              case 0:
+                done = true;
+                break;
+              default: {
+                if (!parseUnknownField(input, unknownFields,
+                                       extensionRegistry, tag)) {
+                  done = true;
+                }
+                break;
+              }
+              case 8: {
+                int rawValue = input.readEnum();
+                SignalMessages.Stats.Stream value = SignalMessages.Stats.Stream.valueOf(rawValue);
+                if (value == null) {
+                  unknownFields.mergeVarintField(1, rawValue);
+                } else {
+                  bitField0_ |= 0x00000001;
+                  stream_ = value;
+                }
+                break;
+              }
+              case 16: {
+                bitField0_ |= 0x00000002;
+                sent_ = input.readUInt64();
+                break;
+              }
+              case 24: {
+                bitField0_ |= 0x00000004;
+                suppressed_ = input.readUInt64();
+                break;
+              }
+            }
+          }
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          throw e.setUnfinishedMessage(this);
+        } catch (java.io.IOException e) {
+          throw new com.google.protobuf.InvalidProtocolBufferException(
+              e.getMessage()).setUnfinishedMessage(this);
+        } finally {
+          this.unknownFields = unknownFields.build();
+          makeExtensionsImmutable();
+        }
+      }
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return SignalMessages.internal_static_Stats_StreamCounters_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return SignalMessages.internal_static_Stats_StreamCounters_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                SignalMessages.Stats.StreamCounters.class, SignalMessages.Stats.StreamCounters.Builder.class);
+      }
+
+      public static com.google.protobuf.Parser<StreamCounters> PARSER =
+          new com.google.protobuf.AbstractParser<StreamCounters>() {
+        public StreamCounters parsePartialFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws com.google.protobuf.InvalidProtocolBufferException {
+          return new StreamCounters(input, extensionRegistry);
+        }
+      };
+
+      @java.lang.Override
+      public com.google.protobuf.Parser<StreamCounters> getParserForType() {
+        return PARSER;
+      }
+
+      private int bitField0_;
+      // required .Stats.Stream stream = 1;
+      public static final int STREAM_FIELD_NUMBER = 1;
+      private SignalMessages.Stats.Stream stream_;
+      /**
+       * <code>required .Stats.Stream stream = 1;</code>
+       */
+      public boolean hasStream() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required .Stats.Stream stream = 1;</code>
+       */
+      public SignalMessages.Stats.Stream getStream() {
+        return stream_;
+      }
+
+      // required uint64 sent = 2;
+      public static final int SENT_FIELD_NUMBER = 2;
+      private long sent_;
+      /**
+       * <code>required uint64 sent = 2;</code>
+       */
+      public boolean hasSent() {
+        return ((bitField0_ & 0x00000002) == 0x00000002);
+      }
+      /**
+       * <code>required uint64 sent = 2;</code>
+       */
+      public long getSent() {
+        return sent_;
+      }
+
+      // required uint64 suppressed = 3;
+      public static final int SUPPRESSED_FIELD_NUMBER = 3;
+      private long suppressed_;
+      /**
+       * <code>required uint64 suppressed = 3;</code>
+       */
+      public boolean hasSuppressed() {
+        return ((bitField0_ & 0x00000004) == 0x00000004);
+      }
+      /**
+       * <code>required uint64 suppressed = 3;</code>
+       */
+      public long getSuppressed() {
+        return suppressed_;
+      }
+
+      private void initFields() {
+        stream_ = SignalMessages.Stats.Stream.SIGNAL_LEVEL_STREAM;
+        sent_ = 0L;
+        suppressed_ = 0L;
+      }
+      private byte memoizedIsInitialized = -1;
+      public final boolean isInitialized() {
+        byte isInitialized = memoizedIsInitialized;
+        if (isInitialized != -1) return isInitialized == 1;
+
+        if (!hasStream()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasSent()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        if (!hasSuppressed()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+        memoizedIsInitialized = 1;
+        return true;
+      }
+
+      public void writeTo(com.google.protobuf.CodedOutputStream output)
+                          throws java.io.IOException {
+        getSerializedSize();
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          output.writeEnum(1, stream_.getNumber());
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          output.writeUInt64(2, sent_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          output.writeUInt64(3, suppressed_);
+        }
+        getUnknownFields().writeTo(output);
+      }
+
+      private int memoizedSerializedSize = -1;
+      public int getSerializedSize() {
+        int size = memoizedSerializedSize;
+        if (size != -1) return size;
+
+        size = 0;
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeEnumSize(1, stream_.getNumber());
+        }
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(2, sent_);
+        }
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          size += com.google.protobuf.CodedOutputStream
+            .computeUInt64Size(3, suppressed_);
+        }
+        size += getUnknownFields().getSerializedSize();
+        memoizedSerializedSize = size;
+        return size;
+      }
+
+      private static final long serialVersionUID = 0L;
+      @java.lang.Override
+      protected java.lang.Object writeReplace()
+          throws java.io.ObjectStreamException {
+        return super.writeReplace();
+      }
+
+      public static SignalMessages.Stats.StreamCounters parseFrom(
+          com.google.protobuf.ByteString data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.Stats.StreamCounters parseFrom(
+          com.google.protobuf.ByteString data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StreamCounters parseFrom(byte[] data)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data);
+      }
+      public static SignalMessages.Stats.StreamCounters parseFrom(
+          byte[] data,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return PARSER.parseFrom(data, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StreamCounters parseFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.Stats.StreamCounters parseFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StreamCounters parseDelimitedFrom(java.io.InputStream input)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input);
+      }
+      public static SignalMessages.Stats.StreamCounters parseDelimitedFrom(
+          java.io.InputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseDelimitedFrom(input, extensionRegistry);
+      }
+      public static SignalMessages.Stats.StreamCounters parseFrom(
+          com.google.protobuf.CodedInputStream input)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input);
+      }
+      public static SignalMessages.Stats.StreamCounters parseFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        return PARSER.parseFrom(input, extensionRegistry);
+      }
+
+      public static Builder newBuilder() { return Builder.create(); }
+      public Builder newBuilderForType() { return newBuilder(); }
+      public static Builder newBuilder(SignalMessages.Stats.StreamCounters prototype) {
+        return newBuilder().mergeFrom(prototype);
+      }
+      public Builder toBuilder() { return newBuilder(this); }
+
+      @java.lang.Override
+      protected Builder newBuilderForType(
+          com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+        Builder builder = new Builder(parent);
+        return builder;
+      }
+      /**
+       * Protobuf type {@code Stats.StreamCounters}
+       *
+       * <pre>
+       *Output policy of a continuous stream, since the plugin was loaded
+       * </pre>
+       */
+      public static final class Builder extends
+          com.google.protobuf.GeneratedMessage.Builder<Builder>
+         implements SignalMessages.Stats.StreamCountersOrBuilder {
+        public static final com.google.protobuf.Descriptors.Descriptor
+            getDescriptor() {
+          return SignalMessages.internal_static_Stats_StreamCounters_descriptor;
+        }
+
+        protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+            internalGetFieldAccessorTable() {
+          return SignalMessages.internal_static_Stats_StreamCounters_fieldAccessorTable
+              .ensureFieldAccessorsInitialized(
+                  SignalMessages.Stats.StreamCounters.class, SignalMessages.Stats.StreamCounters.Builder.class);
+        }
+
+        // Construct using SignalMessages.Stats.StreamCounters.newBuilder()
+        private Builder() {
+          maybeForceBuilderInitialization();
+        }
+
+        private Builder(
+            com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+          super(parent);
+          maybeForceBuilderInitialization();
+        }
+        private void maybeForceBuilderInitialization() {
+          if (com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders) {
+          }
+        }
+        private static Builder create() {
+          return new Builder();
+        }
+
+        public Builder clear() {
+          super.clear();
+          stream_ = SignalMessages.Stats.Stream.SIGNAL_LEVEL_STREAM;
+          bitField0_ = (bitField0_ & ~0x00000001);
+          sent_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000002);
+          suppressed_ = 0L;
+          bitField0_ = (bitField0_ & ~0x00000004);
+          return this;
+        }
+
+        public Builder clone() {
+          return create().mergeFrom(buildPartial());
+        }
+
+        public com.google.protobuf.Descriptors.Descriptor
+            getDescriptorForType() {
+          return SignalMessages.internal_static_Stats_StreamCounters_descriptor;
+        }
+
+        public SignalMessages.Stats.StreamCounters getDefaultInstanceForType() {
+          return SignalMessages.Stats.StreamCounters.getDefaultInstance();
+        }
+
+        public SignalMessages.Stats.StreamCounters build() {
+          SignalMessages.Stats.StreamCounters result = buildPartial();
+          if (!result.isInitialized()) {
+            throw newUninitializedMessageException(result);
+          }
+          return result;
+        }
+
+        public SignalMessages.Stats.StreamCounters buildPartial() {
+          SignalMessages.Stats.StreamCounters result = new SignalMessages.Stats.StreamCounters(this);
+          int from_bitField0_ = bitField0_;
+          int to_bitField0_ = 0;
+          if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+            to_bitField0_ |= 0x00000001;
+          }
+          result.stream_ = stream_;
+          if (((from_bitField0_ & 0x00000002) == 0x00000002)) {
+            to_bitField0_ |= 0x00000002;
+          }
+          result.sent_ = sent_;
+          if (((from_bitField0_ & 0x00000004) == 0x00000004)) {
+            to_bitField0_ |= 0x00000004;
+          }
+          result.suppressed_ = suppressed_;
+          result.bitField0_ = to_bitField0_;
+          onBuilt();
+          return result;
+        }
+
+        public Builder mergeFrom(com.google.protobuf.Message other) {
+          if (other instanceof SignalMessages.Stats.StreamCounters) {
+            return mergeFrom((SignalMessages.Stats.StreamCounters)other);
+          } else {
+            super.mergeFrom(other);
+            return this;
+          }
+        }
+
+        public Builder mergeFrom(SignalMessages.Stats.StreamCounters other) {
+          if (other == SignalMessages.Stats.StreamCounters.getDefaultInstance()) return this;
+          if (other.hasStream()) {
+            setStream(other.getStream());
+          }
+          if (other.hasSent()) {
+            setSent(other.getSent());
+          }
+          if (other.hasSuppressed()) {
+            setSuppressed(other.getSuppressed());
+          }
+          this.mergeUnknownFields(other.getUnknownFields());
+          return this;
+        }
+
+        public final boolean isInitialized() {
+          if (!hasStream()) {
+            
+            return false;
+          }
+          if (!hasSent()) {
+            
+            return false;
+          }
+          if (!hasSuppressed()) {
+            
+            return false;
+          }
+          return true;
+        }
+
+        public Builder mergeFrom(
+            com.google.protobuf.CodedInputStream input,
+            com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+            throws java.io.IOException {
+          SignalMessages.Stats.StreamCounters parsedMessage = null;
+          try {
+            parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+          } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+            parsedMessage = (SignalMessages.Stats.StreamCounters) e.getUnfinishedMessage();
+            throw e;
+          } finally {
+            if (parsedMessage != null) {
+              mergeFrom(parsedMessage);
+            }
+          }
+          return this;
+        }
+        private int bitField0_;
+
+        // required .Stats.Stream stream = 1;
+        private SignalMessages.Stats.Stream stream_ = SignalMessages.Stats.Stream.SIGNAL_LEVEL_STREAM;
+        /**
+         * <code>required .Stats.Stream stream = 1;</code>
+         */
+        public boolean hasStream() {
+          return ((bitField0_ & 0x00000001) == 0x00000001);
+        }
+        /**
+         * <code>required .Stats.Stream stream = 1;</code>
+         */
+        public SignalMessages.Stats.Stream getStream() {
+          return stream_;
+        }
+        /**
+         * <code>required .Stats.Stream stream = 1;</code>
+         */
+        public Builder setStream(SignalMessages.Stats.Stream value) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          bitField0_ |= 0x00000001;
+          stream_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required .Stats.Stream stream = 1;</code>
+         */
+        public Builder clearStream() {
+          bitField0_ = (bitField0_ & ~0x00000001);
+          stream_ = SignalMessages.Stats.Stream.SIGNAL_LEVEL_STREAM;
+          onChanged();
+          return this;
+        }
+
+        // required uint64 sent = 2;
+        private long sent_ ;
+        /**
+         * <code>required uint64 sent = 2;</code>
+         */
+        public boolean hasSent() {
+          return ((bitField0_ & 0x00000002) == 0x00000002);
+        }
+        /**
+         * <code>required uint64 sent = 2;</code>
+         */
+        public long getSent() {
+          return sent_;
+        }
+        /**
+         * <code>required uint64 sent = 2;</code>
+         */
+        public Builder setSent(long value) {
+          bitField0_ |= 0x00000002;
+          sent_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required uint64 sent = 2;</code>
+         */
+        public Builder clearSent() {
+          bitField0_ = (bitField0_ & ~0x00000002);
+          sent_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // required uint64 suppressed = 3;
+        private long suppressed_ ;
+        /**
+         * <code>required uint64 suppressed = 3;</code>
+         */
+        public boolean hasSuppressed() {
+          return ((bitField0_ & 0x00000004) == 0x00000004);
+        }
+        /**
+         * <code>required uint64 suppressed = 3;</code>
+         */
+        public long getSuppressed() {
+          return suppressed_;
+        }
+        /**
+         * <code>required uint64 suppressed = 3;</code>
+         */
+        public Builder setSuppressed(long value) {
+          bitField0_ |= 0x00000004;
+          suppressed_ = value;
+          onChanged();
+          return this;
+        }
+        /**
+         * <code>required uint64 suppressed = 3;</code>
+         */
+        public Builder clearSuppressed() {
+          bitField0_ = (bitField0_ & ~0x00000004);
+          suppressed_ = 0L;
+          onChanged();
+          return this;
+        }
+
+        // @@protoc_insertion_point(builder_scope:Stats.StreamCounters)
+      }
+
+      static {
+        defaultInstance = new StreamCounters(true);
+        defaultInstance.initFields();
+      }
+
+      // @@protoc_insertion_point(class_scope:Stats.StreamCounters)
+    }
+
+    private int bitField0_;
+    // required int32 signalID = 1 [default = 1];
+    public static final int SIGNALID_FIELD_NUMBER = 1;
+    private int signalID_;
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    public boolean hasSignalID() {
+      return ((bitField0_ & 0x00000001) == 0x00000001);
+    }
+    /**
+     * <code>required int32 signalID = 1 [default = 1];</code>
+     */
+    public int getSignalID() {
+      return signalID_;
+    }
+
+    // repeated .Stats.StageLatency stages = 2;
+    public static final int STAGES_FIELD_NUMBER = 2;
+    private java.util.List<SignalMessages.Stats.StageLatency> stages_;
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    public java.util.List<SignalMessages.Stats.StageLatency> getStagesList() {
+      return stages_;
+    }
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    public java.util.List<? extends SignalMessages.Stats.StageLatencyOrBuilder> 
+        getStagesOrBuilderList() {
+      return stages_;
+    }
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    public int getStagesCount() {
+      return stages_.size();
+    }
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    public SignalMessages.Stats.StageLatency getStages(int index) {
+      return stages_.get(index);
+    }
+    /**
+     * <code>repeated .Stats.StageLatency stages = 2;</code>
+     */
+    public SignalMessages.Stats.StageLatencyOrBuilder getStagesOrBuilder(
+        int index) {
+      return stages_.get(index);
+    }
+
+    // required float deadlineUtilization = 3;
+    public static final int DEADLINEUTILIZATION_FIELD_NUMBER = 3;
+    private float deadlineUtilization_;
+    /**
+     * <code>required float deadlineUtilization = 3;</code>
+     *
+     * <pre>
+     *processBlock duration / duration of the block's audio, last block
+     * </pre>
+     */
+    public boolean hasDeadlineUtilization() {
+      return ((bitField0_ & 0x00000002) == 0x00000002);
+    }
+    /**
+     * <code>required float deadlineUtilization = 3;</code>
+     *
+     * <pre>
+     *processBlock duration / duration of the block's audio, last block
+     * </pre>
+     */
+    public float getDeadlineUtilization() {
+      return deadlineUtilization_;
+    }
+
+    // required float maxDeadlineUtilization = 4;
+    public static final int MAXDEADLINEUTILIZATION_FIELD_NUMBER = 4;
+    private float maxDeadlineUtilization_;
+    /**
+     * <code>required float maxDeadlineUtilization = 4;</code>
+     *
+     * <pre>
+     *Maximum of the interval
+     * </pre>
+     */
+    public boolean hasMaxDeadlineUtilization() {
+      return ((bitField0_ & 0x00000004) == 0x00000004);
+    }
+    /**
+     * <code>required float maxDeadlineUtilization = 4;</code>
+     *
+     * <pre>
+     *Maximum of the interval
+     * </pre>
+     */
+    public float getMaxDeadlineUtilization() {
+      return maxDeadlineUtilization_;
+    }
+
+    // required uint32 xrunRiskCount = 5;
+    public static final int XRUNRISKCOUNT_FIELD_NUMBER = 5;
+    private int xrunRiskCount_;
+    /**
+     * <code>required uint32 xrunRiskCount = 5;</code>
+     *
+     * <pre>
+     *Blocks of the interval whose utilization was above 0.5
+     * </pre>
+     */
+    public boolean hasXrunRiskCount() {
+      return ((bitField0_ & 0x00000008) == 0x00000008);
+    }
+    /**
+     * <code>required uint32 xrunRiskCount = 5;</code>
+     *
+     * <pre>
+     *Blocks of the interval whose utilization was above 0.5
+     * </pre>
+     */
+    public int getXrunRiskCount() {
+      return xrunRiskCount_;
+    }
+
+    // required uint32 nbOfBlocks = 6;
+    public static final int NBOFBLOCKS_FIELD_NUMBER = 6;
+    private int nbOfBlocks_;
+    /**
+     * <code>required uint32 nbOfBlocks = 6;</code>
+     */
+    public boolean hasNbOfBlocks() {
+      return ((bitField0_ & 0x00000010) == 0x00000010);
+    }
+    /**
+     * <code>required uint32 nbOfBlocks = 6;</code>
+     */
+    public int getNbOfBlocks() {
+      return nbOfBlocks_;
+    }
+
+    // repeated .Stats.TransportCounters transports = 7;
+    public static final int TRANSPORTS_FIELD_NUMBER = 7;
+    private java.util.List<SignalMessages.Stats.TransportCounters> transports_;
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    public java.util.List<SignalMessages.Stats.TransportCounters> getTransportsList() {
+      return transports_;
+    }
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    public java.util.List<? extends SignalMessages.Stats.TransportCountersOrBuilder> 
+        getTransportsOrBuilderList() {
+      return transports_;
+    }
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    public int getTransportsCount() {
+      return transports_.size();
+    }
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    public SignalMessages.Stats.TransportCounters getTransports(int index) {
+      return transports_.get(index);
+    }
+    /**
+     * <code>repeated .Stats.TransportCounters transports = 7;</code>
+     */
+    public SignalMessages.Stats.TransportCountersOrBuilder getTransportsOrBuilder(
+        int index) {
+      return transports_.get(index);
+    }
+
+    // repeated .Stats.StreamCounters streams = 8;
+    public static final int STREAMS_FIELD_NUMBER = 8;
+    private java.util.List<SignalMessages.Stats.StreamCounters> streams_;
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    public java.util.List<SignalMessages.Stats.StreamCounters> getStreamsList() {
+      return streams_;
+    }
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    public java.util.List<? extends SignalMessages.Stats.StreamCountersOrBuilder> 
+        getStreamsOrBuilderList() {
+      return streams_;
+    }
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    public int getStreamsCount() {
+      return streams_.size();
+    }
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    public SignalMessages.Stats.StreamCounters getStreams(int index) {
+      return streams_.get(index);
+    }
+    /**
+     * <code>repeated .Stats.StreamCounters streams = 8;</code>
+     */
+    public SignalMessages.Stats.StreamCountersOrBuilder getStreamsOrBuilder(
+        int index) {
+      return streams_.get(index);
+    }
+
+    private void initFields() {
+      signalID_ = 1;
+      stages_ = java.util.Collections.emptyList();
+      deadlineUtilization_ = 0F;
+      maxDeadlineUtilization_ = 0F;
+      xrunRiskCount_ = 0;
+      nbOfBlocks_ = 0;
+      transports_ = java.util.Collections.emptyList();
+      streams_ = java.util.Collections.emptyList();
+    }
+    private byte memoizedIsInitialized = -1;
+    public final boolean isInitialized() {
+      byte isInitialized = memoizedIsInitialized;
+      if (isInitialized != -1) return isInitialized == 1;
+
+      if (!hasSignalID()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      if (!hasDeadlineUtilization()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      if (!hasMaxDeadlineUtilization()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      if (!hasXrunRiskCount()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      if (!hasNbOfBlocks()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      for (int i = 0; i < getStagesCount(); i++) {
+        if (!getStages(i).isInitialized()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+      }
+      for (int i = 0; i < getTransportsCount(); i++) {
+        if (!getTransports(i).isInitialized()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+      }
+      for (int i = 0; i < getStreamsCount(); i++) {
+        if (!getStreams(i).isInitialized()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+      }
+      memoizedIsInitialized = 1;
+      return true;
+    }
+
+    public void writeTo(com.google.protobuf.CodedOutputStream output)
+                        throws java.io.IOException {
+      getSerializedSize();
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        output.writeInt32(1, signalID_);
+      }
+      for (int i = 0; i < stages_.size(); i++) {
+        output.writeMessage(2, stages_.get(i));
+      }
+      if (((bitField0_ & 0x00000002) == 0x00000002)) {
+        output.writeFloat(3, deadlineUtilization_);
+      }
+      if (((bitField0_ & 0x00000004) == 0x00000004)) {
+        output.writeFloat(4, maxDeadlineUtilization_);
+      }
+      if (((bitField0_ & 0x00000008) == 0x00000008)) {
+        output.writeUInt32(5, xrunRiskCount_);
+      }
+      if (((bitField0_ & 0x00000010) == 0x00000010)) {
+        output.writeUInt32(6, nbOfBlocks_);
+      }
+      for (int i = 0; i < transports_.size(); i++) {
+        output.writeMessage(7, transports_.get(i));
+      }
+      for (int i = 0; i < streams_.size(); i++) {
+        output.writeMessage(8, streams_.get(i));
+      }
+      getUnknownFields().writeTo(output);
+    }
+
+    private int memoizedSerializedSize = -1;
+    public int getSerializedSize() {
+      int size = memoizedSerializedSize;
+      if (size != -1) return size;
+
+      size = 0;
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeInt32Size(1, signalID_);
+      }
+      for (int i = 0; i < stages_.size(); i++) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(2, stages_.get(i));
+      }
+      if (((bitField0_ & 0x00000002) == 0x00000002)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeFloatSize(3, deadlineUtilization_);
+      }
+      if (((bitField0_ & 0x00000004) == 0x00000004)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeFloatSize(4, maxDeadlineUtilization_);
+      }
+      if (((bitField0_ & 0x00000008) == 0x00000008)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeUInt32Size(5, xrunRiskCount_);
+      }
+      if (((bitField0_ & 0x00000010) == 0x00000010)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeUInt32Size(6, nbOfBlocks_);
+      }
+      for (int i = 0; i < transports_.size(); i++) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(7, transports_.get(i));
+      }
+      for (int i = 0; i < streams_.size(); i++) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(8, streams_.get(i));
+      }
+      size += getUnknownFields().getSerializedSize();
+      memoizedSerializedSize = size;
+      return size;
+    }
+
+    private static final long serialVersionUID = 0L;
+    @java.lang.Override
+    protected java.lang.Object writeReplace()
+        throws java.io.ObjectStreamException {
+      return super.writeReplace();
+    }
+
+    public static SignalMessages.Stats parseFrom(
+        com.google.protobuf.ByteString data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static SignalMessages.Stats parseFrom(
+        com.google.protobuf.ByteString data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static SignalMessages.Stats parseFrom(byte[] data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static SignalMessages.Stats parseFrom(
+        byte[] data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static SignalMessages.Stats parseFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static SignalMessages.Stats parseFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+    public static SignalMessages.Stats parseDelimitedFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input);
+    }
+    public static SignalMessages.Stats parseDelimitedFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input, extensionRegistry);
+    }
+    public static SignalMessages.Stats parseFrom(
+        com.google.protobuf.CodedInputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static SignalMessages.Stats parseFrom(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+
+    public static Builder newBuilder() { return Builder.create(); }
+    public Builder newBuilderForType() { return newBuilder(); }
+    public static Builder newBuilder(SignalMessages.Stats prototype) {
+      return newBuilder().mergeFrom(prototype);
+    }
+    public Builder toBuilder() { return newBuilder(this); }
+
+    @java.lang.Override
+    protected Builder newBuilderForType(
+        com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+      Builder builder = new Builder(parent);
+      return builder;
+    }
+    /**
+     * Protobuf type {@code Stats}
+     *
+     * <pre>
+     * Latency of the plugin's stages over the last interval (sent once per second, on its own port)
+     * </pre>
+     */
+    public static final class Builder extends
+        com.google.protobuf.GeneratedMessage.Builder<Builder>
+       implements SignalMessages.StatsOrBuilder {
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return SignalMessages.internal_static_Stats_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessage.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return SignalMessages.internal_static_Stats_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                SignalMessages.Stats.class, SignalMessages.Stats.Builder.class);
+      }
+
+      // Construct using SignalMessages.Stats.newBuilder()
+      private Builder() {
+        maybeForceBuilderInitialization();
+      }
+
+      private Builder(
+          com.google.protobuf.GeneratedMessage.BuilderParent parent) {
+        super(parent);
+        maybeForceBuilderInitialization();
+      }
+      private void maybeForceBuilderInitialization() {
+        if (com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders) {
+          getStagesFieldBuilder();
+          getTransportsFieldBuilder();
+          getStreamsFieldBuilder();
+        }
+      }
+      private static Builder create() {
+        return new Builder();
+      }
+
+      public Builder clear() {
+        super.clear();
+        signalID_ = 1;
+        bitField0_ = (bitField0_ & ~0x00000001);
+        if (stagesBuilder_ == null) {
+          stages_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000002);
+        } else {
+          stagesBuilder_.clear();
+        }
+        deadlineUtilization_ = 0F;
+        bitField0_ = (bitField0_ & ~0x00000004);
+        maxDeadlineUtilization_ = 0F;
+        bitField0_ = (bitField0_ & ~0x00000008);
+        xrunRiskCount_ = 0;
+        bitField0_ = (bitField0_ & ~0x00000010);
+        nbOfBlocks_ = 0;
+        bitField0_ = (bitField0_ & ~0x00000020);
+        if (transportsBuilder_ == null) {
+          transports_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000040);
+        } else {
+          transportsBuilder_.clear();
+        }
+        if (streamsBuilder_ == null) {
+          streams_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000080);
+        } else {
+          streamsBuilder_.clear();
+        }
+        return this;
+      }
+
+      public Builder clone() {
+        return create().mergeFrom(buildPartial());
+      }
+
+      public com.google.protobuf.Descriptors.Descriptor
+          getDescriptorForType() {
+        return SignalMessages.internal_static_Stats_descriptor;
+      }
+
+      public SignalMessages.Stats getDefaultInstanceForType() {
+        return SignalMessages.Stats.getDefaultInstance();
+      }
+
+      public SignalMessages.Stats build() {
+        SignalMessages.Stats result = buildPartial();
+        if (!result.isInitialized()) {
+          throw newUninitializedMessageException(result);
+        }
+        return result;
+      }
+
+      public SignalMessages.Stats buildPartial() {
+        SignalMessages.Stats result = new SignalMessages.Stats(this);
+        int from_bitField0_ = bitField0_;
+        int to_bitField0_ = 0;
+        if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+          to_bitField0_ |= 0x00000001;
+        }
+        result.signalID_ = signalID_;
+        if (stagesBuilder_ == null) {
+          if (((bitField0_ & 0x00000002) == 0x00000002)) {
+            stages_ = java.util.Collections.unmodifiableList(stages_);
+            bitField0_ = (bitField0_ & ~0x00000002);
+          }
+          result.stages_ = stages_;
+        } else {
+          result.stages_ = stagesBuilder_.build();
+        }
+        if (((from_bitField0_ & 0x00000004) == 0x00000004)) {
+          to_bitField0_ |= 0x00000002;
+        }
+        result.deadlineUtilization_ = deadlineUtilization_;
+        if (((from_bitField0_ & 0x00000008) == 0x00000008)) {
+          to_bitField0_ |= 0x00000004;
+        }
+        result.maxDeadlineUtilization_ = maxDeadlineUtilization_;
+        if (((from_bitField0_ & 0x00000010) == 0x00000010)) {
+          to_bitField0_ |= 0x00000008;
+        }
+        result.xrunRiskCount_ = xrunRiskCount_;
+        if (((from_bitField0_ & 0x00000020) == 0x00000020)) {
+          to_bitField0_ |= 0x00000010;
+        }
+        result.nbOfBlocks_ = nbOfBlocks_;
+        if (transportsBuilder_ == null) {
+          if (((bitField0_ & 0x00000040) == 0x00000040)) {
+            transports_ = java.util.Collections.unmodifiableList(transports_);
+            bitField0_ = (bitField0_ & ~0x00000040);
+          }
+          result.transports_ = transports_;
+        } else {
+          result.transports_ = transportsBuilder_.build();
+        }
+        if (streamsBuilder_ == null) {
+          if (((bitField0_ & 0x00000080) == 0x00000080)) {
+            streams_ = java.util.Collections.unmodifiableList(streams_);
+            bitField0_ = (bitField0_ & ~0x00000080);
+          }
+          result.streams_ = streams_;
+        } else {
+          result.streams_ = streamsBuilder_.build();
+        }
+        result.bitField0_ = to_bitField0_;
+        onBuilt();
+        return result;
+      }
+
+      public Builder mergeFrom(com.google.protobuf.Message other) {
+        if (other instanceof SignalMessages.Stats) {
+          return mergeFrom((SignalMessages.Stats)other);
+        } else {
+          super.mergeFrom(other);
+          return this;
+        }
+      }
+
+      public Builder mergeFrom(SignalMessages.Stats other) {
+        if (other == SignalMessages.Stats.getDefaultInstance()) return this;
+        if (other.hasSignalID()) {
+          setSignalID(other.getSignalID());
+        }
+        if (stagesBuilder_ == null) {
+          if (!other.stages_.isEmpty()) {
+            if (stages_.isEmpty()) {
+              stages_ = other.stages_;
+              bitField0_ = (bitField0_ & ~0x00000002);
+            } else {
+              ensureStagesIsMutable();
+              stages_.addAll(other.stages_);
+            }
+            onChanged();
+          }
+        } else {
+          if (!other.stages_.isEmpty()) {
+            if (stagesBuilder_.isEmpty()) {
+              stagesBuilder_.dispose();
+              stagesBuilder_ = null;
+              stages_ = other.stages_;
+              bitField0_ = (bitField0_ & ~0x00000002);
+              stagesBuilder_ = 
+                com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders ?
+                   getStagesFieldBuilder() : null;
+            } else {
+              stagesBuilder_.addAllMessages(other.stages_);
+            }
+          }
+        }
+        if (other.hasDeadlineUtilization()) {
+          setDeadlineUtilization(other.getDeadlineUtilization());
+        }
+        if (other.hasMaxDeadlineUtilization()) {
+          setMaxDeadlineUtilization(other.getMaxDeadlineUtilization());
+        }
+        if (other.hasXrunRiskCount()) {
+          setXrunRiskCount(other.getXrunRiskCount());
+        }
+        if (other.hasNbOfBlocks()) {
+          setNbOfBlocks(other.getNbOfBlocks());
+        }
+        if (transportsBuilder_ == null) {
+          if (!other.transports_.isEmpty()) {
+            if (transports_.isEmpty()) {
+              transports_ = other.transports_;
+              bitField0_ = (bitField0_ & ~0x00000040);
+            } else {
+              ensureTransportsIsMutable();
+              transports_.addAll(other.transports_);
+            }
+            onChanged();
+          }
+        } else {
+          if (!other.transports_.isEmpty()) {
+            if (transportsBuilder_.isEmpty()) {
+              transportsBuilder_.dispose();
+              transportsBuilder_ = null;
+              transports_ = other.transports_;
+              bitField0_ = (bitField0_ & ~0x00000040);
+              transportsBuilder_ = 
+                com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders ?
+                   getTransportsFieldBuilder() : null;
+            } else {
+              transportsBuilder_.addAllMessages(other.transports_);
+            }
+          }
+        }
+        if (streamsBuilder_ == null) {
+          if (!other.streams_.isEmpty()) {
+            if (streams_.isEmpty()) {
+              streams_ = other.streams_;
+              bitField0_ = (bitField0_ & ~0x00000080);
+            } else {
+              ensureStreamsIsMutable();
+              streams_.addAll(other.streams_);
+            }
+            onChanged();
+          }
+        } else {
+          if (!other.streams_.isEmpty()) {
+            if (streamsBuilder_.isEmpty()) {
+              streamsBuilder_.dispose();
+              streamsBuilder_ = null;
+              streams_ = other.streams_;
+              bitField0_ = (bitField0_ & ~0x00000080);
+              streamsBuilder_ = 
+                com.google.protobuf.GeneratedMessage.alwaysUseFieldBuilders ?
+                   getStreamsFieldBuilder() : null;
+            } else {
+              streamsBuilder_.addAllMessages(other.streams_);
+            }
+          }
+        }
+        this.mergeUnknownFields(other.getUnknownFields());
+        return this;
+      }
+
+      public final boolean isInitialized() {
+        if (!hasSignalID()) {
+          
+          return false;
+        }
+        if (!hasDeadlineUtilization()) {
+          
+          return false;
+        }
+        if (!hasMaxDeadlineUtilization()) {
+          
+          return false;
+        }
+        if (!hasXrunRiskCount()) {
+          
+          return false;
+        }
+        if (!hasNbOfBlocks()) {
+          
+          return false;
+        }
+        for (int i = 0; i < getStagesCount(); i++) {
+          if (!getStages(i).isInitialized()) {
+            
+            return false;
+          }
+        }
+        for (int i = 0; i < getTransportsCount(); i++) {
+          if (!getTransports(i).isInitialized()) {
+            
+            return false;
+          }
+        }
+        for (int i = 0; i < getStreamsCount(); i++) {
+          if (!getStreams(i).isInitialized()) {
+            
+            return false;
+          }
+        }
+        return true;
+      }
+
+      public Builder mergeFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        SignalMessages.Stats parsedMessage = null;
+        try {
+          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          parsedMessage = (SignalMessages.Stats) e.getUnfinishedMessage();
+          throw e;
+        } finally {
+          if (parsedMessage != null) {
+            mergeFrom(parsedMessage);
+          }
+        }
+        return this;
+      }
+      private int bitField0_;
+
+      // required int32 signalID = 1 [default = 1];
+      private int signalID_ = 1;
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public boolean hasSignalID() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public int getSignalID() {
+        return signalID_;
+      }
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public Builder setSignalID(int value) {
+        bitField0_ |= 0x00000001;
+        signalID_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>required int32 signalID = 1 [default = 1];</code>
+       */
+      public Builder clearSignalID() {
+        bitField0_ = (bitField0_ & ~0x00000001);
+        signalID_ = 1;
+        onChanged();
+        return this;
+      }
+
+      // repeated .Stats.StageLatency stages = 2;
+      private java.util.List<SignalMessages.Stats.StageLatency> stages_ =
+        java.util.Collections.emptyList();
+      private void ensureStagesIsMutable() {
+        if (!((bitField0_ & 0x00000002) == 0x00000002)) {
+          stages_ = new java.util.ArrayList<SignalMessages.Stats.StageLatency>(stages_);
+          bitField0_ |= 0x00000002;
+         }
+      }
+
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.Stats.StageLatency, SignalMessages.Stats.StageLatency.Builder, SignalMessages.Stats.StageLatencyOrBuilder> stagesBuilder_;
+
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public java.util.List<SignalMessages.Stats.StageLatency> getStagesList() {
+        if (stagesBuilder_ == null) {
+          return java.util.Collections.unmodifiableList(stages_);
+        } else {
+          return stagesBuilder_.getMessageList();
+        }
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public int getStagesCount() {
+        if (stagesBuilder_ == null) {
+          return stages_.size();
+        } else {
+          return stagesBuilder_.getCount();
+        }
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public SignalMessages.Stats.StageLatency getStages(int index) {
+        if (stagesBuilder_ == null) {
+          return stages_.get(index);
+        } else {
+          return stagesBuilder_.getMessage(index);
+        }
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder setStages(
+          int index, SignalMessages.Stats.StageLatency value) {
+        if (stagesBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureStagesIsMutable();
+          stages_.set(index, value);
+          onChanged();
+        } else {
+          stagesBuilder_.setMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder setStages(
+          int index, SignalMessages.Stats.StageLatency.Builder builderForValue) {
+        if (stagesBuilder_ == null) {
+          ensureStagesIsMutable();
+          stages_.set(index, builderForValue.build());
+          onChanged();
+        } else {
+          stagesBuilder_.setMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder addStages(SignalMessages.Stats.StageLatency value) {
+        if (stagesBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureStagesIsMutable();
+          stages_.add(value);
+          onChanged();
+        } else {
+          stagesBuilder_.addMessage(value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder addStages(
+          int index, SignalMessages.Stats.StageLatency value) {
+        if (stagesBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureStagesIsMutable();
+          stages_.add(index, value);
+          onChanged();
+        } else {
+          stagesBuilder_.addMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder addStages(
+          SignalMessages.Stats.StageLatency.Builder builderForValue) {
+        if (stagesBuilder_ == null) {
+          ensureStagesIsMutable();
+          stages_.add(builderForValue.build());
+          onChanged();
+        } else {
+          stagesBuilder_.addMessage(builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder addStages(
+          int index, SignalMessages.Stats.StageLatency.Builder builderForValue) {
+        if (stagesBuilder_ == null) {
+          ensureStagesIsMutable();
+          stages_.add(index, builderForValue.build());
+          onChanged();
+        } else {
+          stagesBuilder_.addMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder addAllStages(
+          java.lang.Iterable<? extends SignalMessages.Stats.StageLatency> values) {
+        if (stagesBuilder_ == null) {
+          ensureStagesIsMutable();
+          super.addAll(values, stages_);
+          onChanged();
+        } else {
+          stagesBuilder_.addAllMessages(values);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder clearStages() {
+        if (stagesBuilder_ == null) {
+          stages_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000002);
+          onChanged();
+        } else {
+          stagesBuilder_.clear();
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public Builder removeStages(int index) {
+        if (stagesBuilder_ == null) {
+          ensureStagesIsMutable();
+          stages_.remove(index);
+          onChanged();
+        } else {
+          stagesBuilder_.remove(index);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public SignalMessages.Stats.StageLatency.Builder getStagesBuilder(
+          int index) {
+        return getStagesFieldBuilder().getBuilder(index);
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public SignalMessages.Stats.StageLatencyOrBuilder getStagesOrBuilder(
+          int index) {
+        if (stagesBuilder_ == null) {
+          return stages_.get(index);  } else {
+          return stagesBuilder_.getMessageOrBuilder(index);
+        }
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public java.util.List<? extends SignalMessages.Stats.StageLatencyOrBuilder> 
+           getStagesOrBuilderList() {
+        if (stagesBuilder_ != null) {
+          return stagesBuilder_.getMessageOrBuilderList();
+        } else {
+          return java.util.Collections.unmodifiableList(stages_);
+        }
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public SignalMessages.Stats.StageLatency.Builder addStagesBuilder() {
+        return getStagesFieldBuilder().addBuilder(
+            SignalMessages.Stats.StageLatency.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public SignalMessages.Stats.StageLatency.Builder addStagesBuilder(
+          int index) {
+        return getStagesFieldBuilder().addBuilder(
+            index, SignalMessages.Stats.StageLatency.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .Stats.StageLatency stages = 2;</code>
+       */
+      public java.util.List<SignalMessages.Stats.StageLatency.Builder> 
+           getStagesBuilderList() {
+        return getStagesFieldBuilder().getBuilderList();
+      }
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.Stats.StageLatency, SignalMessages.Stats.StageLatency.Builder, SignalMessages.Stats.StageLatencyOrBuilder> 
+          getStagesFieldBuilder() {
+        if (stagesBuilder_ == null) {
+          stagesBuilder_ = new com.google.protobuf.RepeatedFieldBuilder<
+              SignalMessages.Stats.StageLatency, SignalMessages.Stats.StageLatency.Builder, SignalMessages.Stats.StageLatencyOrBuilder>(
+                  stages_,
+                  ((bitField0_ & 0x00000002) == 0x00000002),
+                  getParentForChildren(),
+                  isClean());
+          stages_ = null;
+        }
+        return stagesBuilder_;
+      }
+
+      // required float deadlineUtilization = 3;
+      private float deadlineUtilization_ ;
+      /**
+       * <code>required float deadlineUtilization = 3;</code>
+       *
+       * <pre>
+       *processBlock duration / duration of the block's audio, last block
+       * </pre>
+       */
+      public boolean hasDeadlineUtilization() {
+        return ((bitField0_ & 0x00000004) == 0x00000004);
+      }
+      /**
+       * <code>required float deadlineUtilization = 3;</code>
+       *
+       * <pre>
+       *processBlock duration / duration of the block's audio, last block
+       * </pre>
+       */
+      public float getDeadlineUtilization() {
+        return deadlineUtilization_;
+      }
+      /**
+       * <code>required float deadlineUtilization = 3;</code>
+       *
+       * <pre>
+       *processBlock duration / duration of the block's audio, last block
+       * </pre>
+       */
+      public Builder setDeadlineUtilization(float value) {
+        bitField0_ |= 0x00000004;
+        deadlineUtilization_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>required float deadlineUtilization = 3;</code>
+       *
+       * <pre>
+       *processBlock duration / duration of the block's audio, last block
+       * </pre>
+       */
+      public Builder clearDeadlineUtilization() {
+        bitField0_ = (bitField0_ & ~0x00000004);
+        deadlineUtilization_ = 0F;
+        onChanged();
+        return this;
+      }
+
+      // required float maxDeadlineUtilization = 4;
+      private float maxDeadlineUtilization_ ;
+      /**
+       * <code>required float maxDeadlineUtilization = 4;</code>
+       *
+       * <pre>
+       *Maximum of the interval
+       * </pre>
+       */
+      public boolean hasMaxDeadlineUtilization() {
+        return ((bitField0_ & 0x00000008) == 0x00000008);
+      }
+      /**
+       * <code>required float maxDeadlineUtilization = 4;</code>
+       *
+       * <pre>
+       *Maximum of the interval
+       * </pre>
+       */
+      public float getMaxDeadlineUtilization() {
+        return maxDeadlineUtilization_;
+      }
+      /**
+       * <code>required float maxDeadlineUtilization = 4;</code>
+       *
+       * <pre>
+       *Maximum of the interval
+       * </pre>
+       */
+      public Builder setMaxDeadlineUtilization(float value) {
+        bitField0_ |= 0x00000008;
+        maxDeadlineUtilization_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>required float maxDeadlineUtilization = 4;</code>
+       *
+       * <pre>
+       *Maximum of the interval
+       * </pre>
+       */
+      public Builder clearMaxDeadlineUtilization() {
+        bitField0_ = (bitField0_ & ~0x00000008);
+        maxDeadlineUtilization_ = 0F;
+        onChanged();
+        return this;
+      }
+
+      // required uint32 xrunRiskCount = 5;
+      private int xrunRiskCount_ ;
+      /**
+       * <code>required uint32 xrunRiskCount = 5;</code>
+       *
+       * <pre>
+       *Blocks of the interval whose utilization was above 0.5
+       * </pre>
+       */
+      public boolean hasXrunRiskCount() {
+        return ((bitField0_ & 0x00000010) == 0x00000010);
+      }
+      /**
+       * <code>required uint32 xrunRiskCount = 5;</code>
+       *
+       * <pre>
+       *Blocks of the interval whose utilization was above 0.5
+       * </pre>
+       */
+      public int getXrunRiskCount() {
+        return xrunRiskCount_;
+      }
+      /**
+       * <code>required uint32 xrunRiskCount = 5;</code>
+       *
+       * <pre>
+       *Blocks of the interval whose utilization was above 0.5
+       * </pre>
+       */
+      public Builder setXrunRiskCount(int value) {
+        bitField0_ |= 0x00000010;
+        xrunRiskCount_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>required uint32 xrunRiskCount = 5;</code>
+       *
+       * <pre>
+       *Blocks of the interval whose utilization was above 0.5
+       * </pre>
+       */
+      public Builder clearXrunRiskCount() {
+        bitField0_ = (bitField0_ & ~0x00000010);
+        xrunRiskCount_ = 0;
+        onChanged();
+        return this;
+      }
+
+      // required uint32 nbOfBlocks = 6;
+      private int nbOfBlocks_ ;
+      /**
+       * <code>required uint32 nbOfBlocks = 6;</code>
+       */
+      public boolean hasNbOfBlocks() {
+        return ((bitField0_ & 0x00000020) == 0x00000020);
+      }
+      /**
+       * <code>required uint32 nbOfBlocks = 6;</code>
+       */
+      public int getNbOfBlocks() {
+        return nbOfBlocks_;
+      }
+      /**
+       * <code>required uint32 nbOfBlocks = 6;</code>
+       */
+      public Builder setNbOfBlocks(int value) {
+        bitField0_ |= 0x00000020;
+        nbOfBlocks_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>required uint32 nbOfBlocks = 6;</code>
+       */
+      public Builder clearNbOfBlocks() {
+        bitField0_ = (bitField0_ & ~0x00000020);
+        nbOfBlocks_ = 0;
+        onChanged();
+        return this;
+      }
+
+      // repeated .Stats.TransportCounters transports = 7;
+      private java.util.List<SignalMessages.Stats.TransportCounters> transports_ =
+        java.util.Collections.emptyList();
+      private void ensureTransportsIsMutable() {
+        if (!((bitField0_ & 0x00000040) == 0x00000040)) {
+          transports_ = new java.util.ArrayList<SignalMessages.Stats.TransportCounters>(transports_);
+          bitField0_ |= 0x00000040;
+         }
+      }
+
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.Stats.TransportCounters, SignalMessages.Stats.TransportCounters.Builder, SignalMessages.Stats.TransportCountersOrBuilder> transportsBuilder_;
+
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public java.util.List<SignalMessages.Stats.TransportCounters> getTransportsList() {
+        if (transportsBuilder_ == null) {
+          return java.util.Collections.unmodifiableList(transports_);
+        } else {
+          return transportsBuilder_.getMessageList();
+        }
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public int getTransportsCount() {
+        if (transportsBuilder_ == null) {
+          return transports_.size();
+        } else {
+          return transportsBuilder_.getCount();
+        }
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public SignalMessages.Stats.TransportCounters getTransports(int index) {
+        if (transportsBuilder_ == null) {
+          return transports_.get(index);
+        } else {
+          return transportsBuilder_.getMessage(index);
+        }
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder setTransports(
+          int index, SignalMessages.Stats.TransportCounters value) {
+        if (transportsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureTransportsIsMutable();
+          transports_.set(index, value);
+          onChanged();
+        } else {
+          transportsBuilder_.setMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder setTransports(
+          int index, SignalMessages.Stats.TransportCounters.Builder builderForValue) {
+        if (transportsBuilder_ == null) {
+          ensureTransportsIsMutable();
+          transports_.set(index, builderForValue.build());
+          onChanged();
+        } else {
+          transportsBuilder_.setMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder addTransports(SignalMessages.Stats.TransportCounters value) {
+        if (transportsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureTransportsIsMutable();
+          transports_.add(value);
+          onChanged();
+        } else {
+          transportsBuilder_.addMessage(value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder addTransports(
+          int index, SignalMessages.Stats.TransportCounters value) {
+        if (transportsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureTransportsIsMutable();
+          transports_.add(index, value);
+          onChanged();
+        } else {
+          transportsBuilder_.addMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder addTransports(
+          SignalMessages.Stats.TransportCounters.Builder builderForValue) {
+        if (transportsBuilder_ == null) {
+          ensureTransportsIsMutable();
+          transports_.add(builderForValue.build());
+          onChanged();
+        } else {
+          transportsBuilder_.addMessage(builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder addTransports(
+          int index, SignalMessages.Stats.TransportCounters.Builder builderForValue) {
+        if (transportsBuilder_ == null) {
+          ensureTransportsIsMutable();
+          transports_.add(index, builderForValue.build());
+          onChanged();
+        } else {
+          transportsBuilder_.addMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder addAllTransports(
+          java.lang.Iterable<? extends SignalMessages.Stats.TransportCounters> values) {
+        if (transportsBuilder_ == null) {
+          ensureTransportsIsMutable();
+          super.addAll(values, transports_);
+          onChanged();
+        } else {
+          transportsBuilder_.addAllMessages(values);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder clearTransports() {
+        if (transportsBuilder_ == null) {
+          transports_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000040);
+          onChanged();
+        } else {
+          transportsBuilder_.clear();
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public Builder removeTransports(int index) {
+        if (transportsBuilder_ == null) {
+          ensureTransportsIsMutable();
+          transports_.remove(index);
+          onChanged();
+        } else {
+          transportsBuilder_.remove(index);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public SignalMessages.Stats.TransportCounters.Builder getTransportsBuilder(
+          int index) {
+        return getTransportsFieldBuilder().getBuilder(index);
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public SignalMessages.Stats.TransportCountersOrBuilder getTransportsOrBuilder(
+          int index) {
+        if (transportsBuilder_ == null) {
+          return transports_.get(index);  } else {
+          return transportsBuilder_.getMessageOrBuilder(index);
+        }
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public java.util.List<? extends SignalMessages.Stats.TransportCountersOrBuilder> 
+           getTransportsOrBuilderList() {
+        if (transportsBuilder_ != null) {
+          return transportsBuilder_.getMessageOrBuilderList();
+        } else {
+          return java.util.Collections.unmodifiableList(transports_);
+        }
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public SignalMessages.Stats.TransportCounters.Builder addTransportsBuilder() {
+        return getTransportsFieldBuilder().addBuilder(
+            SignalMessages.Stats.TransportCounters.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public SignalMessages.Stats.TransportCounters.Builder addTransportsBuilder(
+          int index) {
+        return getTransportsFieldBuilder().addBuilder(
+            index, SignalMessages.Stats.TransportCounters.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .Stats.TransportCounters transports = 7;</code>
+       */
+      public java.util.List<SignalMessages.Stats.TransportCounters.Builder> 
+           getTransportsBuilderList() {
+        return getTransportsFieldBuilder().getBuilderList();
+      }
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.Stats.TransportCounters, SignalMessages.Stats.TransportCounters.Builder, SignalMessages.Stats.TransportCountersOrBuilder> 
+          getTransportsFieldBuilder() {
+        if (transportsBuilder_ == null) {
+          transportsBuilder_ = new com.google.protobuf.RepeatedFieldBuilder<
+              SignalMessages.Stats.TransportCounters, SignalMessages.Stats.TransportCounters.Builder, SignalMessages.Stats.TransportCountersOrBuilder>(
+                  transports_,
+                  ((bitField0_ & 0x00000040) == 0x00000040),
+                  getParentForChildren(),
+                  isClean());
+          transports_ = null;
+        }
+        return transportsBuilder_;
+      }
+
+      // repeated .Stats.StreamCounters streams = 8;
+      private java.util.List<SignalMessages.Stats.StreamCounters> streams_ =
+        java.util.Collections.emptyList();
+      private void ensureStreamsIsMutable() {
+        if (!((bitField0_ & 0x00000080) == 0x00000080)) {
+          streams_ = new java.util.ArrayList<SignalMessages.Stats.StreamCounters>(streams_);
+          bitField0_ |= 0x00000080;
+         }
+      }
+
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.Stats.StreamCounters, SignalMessages.Stats.StreamCounters.Builder, SignalMessages.Stats.StreamCountersOrBuilder> streamsBuilder_;
+
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public java.util.List<SignalMessages.Stats.StreamCounters> getStreamsList() {
+        if (streamsBuilder_ == null) {
+          return java.util.Collections.unmodifiableList(streams_);
+        } else {
+          return streamsBuilder_.getMessageList();
+        }
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public int getStreamsCount() {
+        if (streamsBuilder_ == null) {
+          return streams_.size();
+        } else {
+          return streamsBuilder_.getCount();
+        }
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public SignalMessages.Stats.StreamCounters getStreams(int index) {
+        if (streamsBuilder_ == null) {
+          return streams_.get(index);
+        } else {
+          return streamsBuilder_.getMessage(index);
+        }
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder setStreams(
+          int index, SignalMessages.Stats.StreamCounters value) {
+        if (streamsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureStreamsIsMutable();
+          streams_.set(index, value);
+          onChanged();
+        } else {
+          streamsBuilder_.setMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder setStreams(
+          int index, SignalMessages.Stats.StreamCounters.Builder builderForValue) {
+        if (streamsBuilder_ == null) {
+          ensureStreamsIsMutable();
+          streams_.set(index, builderForValue.build());
+          onChanged();
+        } else {
+          streamsBuilder_.setMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder addStreams(SignalMessages.Stats.StreamCounters value) {
+        if (streamsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureStreamsIsMutable();
+          streams_.add(value);
+          onChanged();
+        } else {
+          streamsBuilder_.addMessage(value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder addStreams(
+          int index, SignalMessages.Stats.StreamCounters value) {
+        if (streamsBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ensureStreamsIsMutable();
+          streams_.add(index, value);
+          onChanged();
+        } else {
+          streamsBuilder_.addMessage(index, value);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder addStreams(
+          SignalMessages.Stats.StreamCounters.Builder builderForValue) {
+        if (streamsBuilder_ == null) {
+          ensureStreamsIsMutable();
+          streams_.add(builderForValue.build());
+          onChanged();
+        } else {
+          streamsBuilder_.addMessage(builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder addStreams(
+          int index, SignalMessages.Stats.StreamCounters.Builder builderForValue) {
+        if (streamsBuilder_ == null) {
+          ensureStreamsIsMutable();
+          streams_.add(index, builderForValue.build());
+          onChanged();
+        } else {
+          streamsBuilder_.addMessage(index, builderForValue.build());
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder addAllStreams(
+          java.lang.Iterable<? extends SignalMessages.Stats.StreamCounters> values) {
+        if (streamsBuilder_ == null) {
+          ensureStreamsIsMutable();
+          super.addAll(values, streams_);
+          onChanged();
+        } else {
+          streamsBuilder_.addAllMessages(values);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder clearStreams() {
+        if (streamsBuilder_ == null) {
+          streams_ = java.util.Collections.emptyList();
+          bitField0_ = (bitField0_ & ~0x00000080);
+          onChanged();
+        } else {
+          streamsBuilder_.clear();
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public Builder removeStreams(int index) {
+        if (streamsBuilder_ == null) {
+          ensureStreamsIsMutable();
+          streams_.remove(index);
+          onChanged();
+        } else {
+          streamsBuilder_.remove(index);
+        }
+        return this;
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public SignalMessages.Stats.StreamCounters.Builder getStreamsBuilder(
+          int index) {
+        return getStreamsFieldBuilder().getBuilder(index);
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public SignalMessages.Stats.StreamCountersOrBuilder getStreamsOrBuilder(
+          int index) {
+        if (streamsBuilder_ == null) {
+          return streams_.get(index);  } else {
+          return streamsBuilder_.getMessageOrBuilder(index);
+        }
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public java.util.List<? extends SignalMessages.Stats.StreamCountersOrBuilder> 
+           getStreamsOrBuilderList() {
+        if (streamsBuilder_ != null) {
+          return streamsBuilder_.getMessageOrBuilderList();
+        } else {
+          return java.util.Collections.unmodifiableList(streams_);
+        }
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public SignalMessages.Stats.StreamCounters.Builder addStreamsBuilder() {
+        return getStreamsFieldBuilder().addBuilder(
+            SignalMessages.Stats.StreamCounters.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public SignalMessages.Stats.StreamCounters.Builder addStreamsBuilder(
+          int index) {
+        return getStreamsFieldBuilder().addBuilder(
+            index, SignalMessages.Stats.StreamCounters.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .Stats.StreamCounters streams = 8;</code>
+       */
+      public java.util.List<SignalMessages.Stats.StreamCounters.Builder> 
+           getStreamsBuilderList() {
+        return getStreamsFieldBuilder().getBuilderList();
+      }
+      private com.google.protobuf.RepeatedFieldBuilder<
+          SignalMessages.Stats.StreamCounters, SignalMessages.Stats.StreamCounters.Builder, SignalMessages.Stats.StreamCountersOrBuilder> 
+          getStreamsFieldBuilder() {
+        if (streamsBuilder_ == null) {
+          streamsBuilder_ = new com.google.protobuf.RepeatedFieldBuilder<
+              SignalMessages.Stats.StreamCounters, SignalMessages.Stats.StreamCounters.Builder, SignalMessages.Stats.StreamCountersOrBuilder>(
+                  streams_,
+                  ((bitField0_ & 0x00000080) == 0x00000080),
+                  getParentForChildren(),
+                  isClean());
+          streams_ = null;
+        }
+        return streamsBuilder_;
+      }
+
+      // @@protoc_insertion_point(builder_scope:Stats)
+    }
+
+    static {
+      defaultInstance = new Stats(true);
+      defaultInstance.initFields();
+    }
+
+    // @@protoc_insertion_point(class_scope:Stats)
+  }
+
   private static com.google.protobuf.Descriptors.Descriptor
     internal_static_SignalLevel_descriptor;
   private static
@@ -4694,6 +11858,36 @@ public final class SignalMessages {
   private static
     com.google.protobuf.GeneratedMessage.FieldAccessorTable
       internal_static_TimeInfo_fieldAccessorTable;
+  private static com.google.protobuf.Descriptors.Descriptor
+    internal_static_MidiEvent_descriptor;
+  private static
+    com.google.protobuf.GeneratedMessage.FieldAccessorTable
+      internal_static_MidiEvent_fieldAccessorTable;
+  private static com.google.protobuf.Descriptors.Descriptor
+    internal_static_MidiEvent_Event_descriptor;
+  private static
+    com.google.protobuf.GeneratedMessage.FieldAccessorTable
+      internal_static_MidiEvent_Event_fieldAccessorTable;
+  private static com.google.protobuf.Descriptors.Descriptor
+    internal_static_Stats_descriptor;
+  private static
+    com.google.protobuf.GeneratedMessage.FieldAccessorTable
+      internal_static_Stats_fieldAccessorTable;
+  private static com.google.protobuf.Descriptors.Descriptor
+    internal_static_Stats_StageLatency_descriptor;
+  private static
+    com.google.protobuf.GeneratedMessage.FieldAccessorTable
+      internal_static_Stats_StageLatency_fieldAccessorTable;
+  private static com.google.protobuf.Descriptors.Descriptor
+    internal_static_Stats_TransportCounters_descriptor;
+  private static
+    com.google.protobuf.GeneratedMessage.FieldAccessorTable
+      internal_static_Stats_TransportCounters_fieldAccessorTable;
+  private static com.google.protobuf.Descriptors.Descriptor
+    internal_static_Stats_StreamCounters_descriptor;
+  private static
+    com.google.protobuf.GeneratedMessage.FieldAccessorTable
+      internal_static_Stats_StreamCounters_fieldAccessorTable;
 
   public static com.google.protobuf.Descriptors.FileDescriptor
       getDescriptor() {
@@ -4717,7 +11911,40 @@ public final class SignalMessages {
       "\002\022\r\n\005band9\030\013 \001(\002\022\016\n\006band10\030\014 \001(\002\022\016\n\006band" +
       "11\030\r \001(\002\022\016\n\006band12\030\016 \001(\002\"K\n\010TimeInfo\022\030\n\t" +
       "isPlaying\030\001 \002(\010:\005false\022\020\n\005tempo\030\002 \002(\002:\0010" +
-      "\022\023\n\010position\030\003 \002(\002:\0010B\020B\016SignalMessages"
+      "\022\023\n\010position\030\003 \002(\002:\0010\"\265\001\n\tMidiEvent\022\023\n\010s" +
+      "ignalID\030\001 \002(\005:\0011\022\030\n\tisPlaying\030\002 \002(\010:\005fal" +
+      "se\022 \n\006events\030\003 \003(\0132\020.MidiEvent.Event\032W\n\005" +
+      "Event\022\024\n\014sampleOffset\030\001 \002(\005\022\025\n\rtimeInSam" +
+      "ples\030\002 \002(\003\022\023\n\013ppqPosition\030\003 \001(\001\022\014\n\004data\030" +
+      "\004 \002(\014\"\327\010\n\005Stats\022\023\n\010signalID\030\001 \002(\005:\0011\022#\n\006",
+      "stages\030\002 \003(\0132\023.Stats.StageLatency\022\033\n\023dea" +
+      "dlineUtilization\030\003 \002(\002\022\036\n\026maxDeadlineUti" +
+      "lization\030\004 \002(\002\022\025\n\rxrunRiskCount\030\005 \002(\r\022\022\n" +
+      "\nnbOfBlocks\030\006 \002(\r\022,\n\ntransports\030\007 \003(\0132\030." +
+      "Stats.TransportCounters\022&\n\007streams\030\010 \003(\013" +
+      "2\025.Stats.StreamCounters\032a\n\014StageLatency\022" +
+      "\033\n\005stage\030\001 \002(\0162\014.Stats.Stage\022\r\n\005count\030\002 " +
+      "\002(\r\022\013\n\003p50\030\003 \002(\002\022\013\n\003p99\030\004 \002(\002\022\013\n\003max\030\005 \002" +
+      "(\002\032\340\002\n\021TransportCounters\022\'\n\013destination\030" +
+      "\001 \002(\0162\022.Stats.Destination\022\017\n\007packets\030\002 \002",
+      "(\004\022\r\n\005bytes\030\003 \002(\004\022\025\n\rnotReadyDrops\030\004 \001(\004" +
+      "\022\026\n\016oversizedDrops\030\005 \001(\004\022\024\n\014partialSends" +
+      "\030\006 \001(\004\022\030\n\020wouldBlockErrors\030\007 \001(\004\022\026\n\016noBu" +
+      "fferErrors\030\010 \001(\004\022\025\n\rrefusedErrors\030\t \001(\004\022" +
+      "\031\n\021unreachableErrors\030\n \001(\004\022\031\n\021messageSiz" +
+      "eErrors\030\013 \001(\004\022\023\n\013otherErrors\030\014 \001(\004\022\026\n\016qu" +
+      "eueHighWater\030\r \001(\r\022\021\n\tlastErrno\030\016 \001(\005\032Q\n" +
+      "\016StreamCounters\022\035\n\006stream\030\001 \002(\0162\r.Stats." +
+      "Stream\022\014\n\004sent\030\002 \002(\004\022\022\n\nsuppressed\030\003 \002(\004" +
+      "\"@\n\005Stage\022\021\n\rPROCESS_BLOCK\020\000\022\007\n\003FFT\020\001\022\021\n",
+      "\rSERIALIZATION\020\002\022\010\n\004SEND\020\003\"\250\001\n\013Destinati" +
+      "on\022\025\n\021SIGNAL_LEVEL_PORT\020\000\022\033\n\027SIGNAL_INST" +
+      "ANT_VAL_PORT\020\001\022\020\n\014IMPULSE_PORT\020\002\022\022\n\016TIME" +
+      "_INFO_PORT\020\003\022\014\n\010FFT_PORT\020\004\022\016\n\nSTATS_PORT" +
+      "\020\005\022\014\n\010OSC_PORT\020\006\022\023\n\017MIDI_EVENT_PORT\020\007\"P\n" +
+      "\006Stream\022\027\n\023SIGNAL_LEVEL_STREAM\020\000\022\035\n\031SIGN" +
+      "AL_INSTANT_VAL_STREAM\020\001\022\016\n\nFFT_STREAM\020\002B" +
+      "\020B\016SignalMessages"
     };
     com.google.protobuf.Descriptors.FileDescriptor.InternalDescriptorAssigner assigner =
       new com.google.protobuf.Descriptors.FileDescriptor.InternalDescriptorAssigner() {
@@ -4760,6 +11987,42 @@ public final class SignalMessages {
             com.google.protobuf.GeneratedMessage.FieldAccessorTable(
               internal_static_TimeInfo_descriptor,
               new java.lang.String[] { "IsPlaying", "Tempo", "Position", });
+          internal_static_MidiEvent_descriptor =
+            getDescriptor().getMessageTypes().get(6);
+          internal_static_MidiEvent_fieldAccessorTable = new
+            com.google.protobuf.GeneratedMessage.FieldAccessorTable(
+              internal_static_MidiEvent_descriptor,
+              new java.lang.String[] { "SignalID", "IsPlaying", "Events", });
+          internal_static_MidiEvent_Event_descriptor =
+            internal_static_MidiEvent_descriptor.getNestedTypes().get(0);
+          internal_static_MidiEvent_Event_fieldAccessorTable = new
+            com.google.protobuf.GeneratedMessage.FieldAccessorTable(
+              internal_static_MidiEvent_Event_descriptor,
+              new java.lang.String[] { "SampleOffset", "TimeInSamples", "PpqPosition", "Data", });
+          internal_static_Stats_descriptor =
+            getDescriptor().getMessageTypes().get(7);
+          internal_static_Stats_fieldAccessorTable = new
+            com.google.protobuf.GeneratedMessage.FieldAccessorTable(
+              internal_static_Stats_descriptor,
+              new java.lang.String[] { "SignalID", "Stages", "DeadlineUtilization", "MaxDeadlineUtilization", "XrunRiskCount", "NbOfBlocks", "Transports", "Streams", });
+          internal_static_Stats_StageLatency_descriptor =
+            internal_static_Stats_descriptor.getNestedTypes().get(0);
+          internal_static_Stats_StageLatency_fieldAccessorTable = new
+            com.google.protobuf.GeneratedMessage.FieldAccessorTable(
+              internal_static_Stats_StageLatency_descriptor,
+              new java.lang.String[] { "Stage", "Count", "P50", "P99", "Max", });
+          internal_static_Stats_TransportCounters_descriptor =
+            internal_static_Stats_descriptor.getNestedTypes().get(1);
+          internal_static_Stats_TransportCounters_fieldAccessorTable = new
+            com.google.protobuf.GeneratedMessage.FieldAccessorTable(
+              internal_static_Stats_TransportCounters_descriptor,
+              new java.lang.String[] { "Destination", "Packets", "Bytes", "NotReadyDrops", "OversizedDrops", "PartialSends", "WouldBlockErrors", "NoBufferErrors", "RefusedErrors", "UnreachableErrors", "MessageSizeErrors", "OtherErrors", "QueueHighWater", "LastErrno", });
+          internal_static_Stats_StreamCounters_descriptor =
+            internal_static_Stats_descriptor.getNestedTypes().get(2);
+          internal_static_Stats_StreamCounters_fieldAccessorTable = new
+            com.google.protobuf.GeneratedMessage.FieldAccessorTable(
+              internal_static_Stats_StreamCounters_descriptor,
+              new java.lang.String[] { "Stream", "Sent", "Suppressed", });
           return null;
         }
       };
@@ -36,6 +36,27 @@ const ::google_public::protobuf::internal::GeneratedMessageReflection*
 const ::google_public::protobuf::Descriptor* TimeInfo_descriptor_ = NULL;
 const ::google_public::protobuf::internal::GeneratedMessageReflection*
   TimeInfo_reflection_ = NULL;
+const ::google_public::protobuf::Descriptor* MidiEvent_descriptor_ = NULL;
+const ::google_public::protobuf::internal::GeneratedMessageReflection*
+  MidiEvent_reflection_ = NULL;
+const ::google_public::protobuf::Descriptor* MidiEvent_Event_descriptor_ = NULL;
+const ::google_public::protobuf::internal::GeneratedMessageReflection*
+  MidiEvent_Event_reflection_ = NULL;
+const ::google_public::protobuf::Descriptor* Stats_descriptor_ = NULL;
+const ::google_public::protobuf::internal::GeneratedMessageReflection*
+  Stats_reflection_ = NULL;
+const ::google_public::protobuf::Descriptor* Stats_StageLatency_descriptor_ = NULL;
+const ::google_public::protobuf::internal::GeneratedMessageReflection*
+  Stats_StageLatency_reflection_ = NULL;
+const ::google_public::protobuf::Descriptor* Stats_TransportCounters_descriptor_ = NULL;
+const ::google_public::protobuf::internal::GeneratedMessageReflection*
+  Stats_TransportCounters_reflection_ = NULL;
+const ::google_public::protobuf::Descriptor* Stats_StreamCounters_descriptor_ = NULL;
+const ::google_public::protobuf::internal::GeneratedMessageReflection*
+  Stats_StreamCounters_reflection_ = NULL;
+const ::google_public::protobuf::EnumDescriptor* Stats_Stage_descriptor_ = NULL;
+const ::google_public::protobuf::EnumDescriptor* Stats_Destination_descriptor_ = NULL;
+const ::google_public::protobuf::EnumDescriptor* Stats_Stream_descriptor_ = NULL;
 
 }  // namespace
 
@@ -155,6 +176,130 @@ void protobuf_AssignDesc_SignalMessages_2eproto() {
       ::google_public::protobuf::DescriptorPool::generated_pool(),
       ::google_public::protobuf::MessageFactory::generated_factory(),
       sizeof(TimeInfo));
+  MidiEvent_descriptor_ = file->message_type(6);
+  static const int MidiEvent_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent, signalid_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent, isplaying_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent, events_),
+  };
+  MidiEvent_reflection_ =
+    new ::google_public::protobuf::internal::GeneratedMessageReflection(
+      MidiEvent_descriptor_,
+      MidiEvent::default_instance_,
+      MidiEvent_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent, _unknown_fields_),
+      -1,
+      ::google_public::protobuf::DescriptorPool::generated_pool(),
+      ::google_public::protobuf::MessageFactory::generated_factory(),
+      sizeof(MidiEvent));
+  MidiEvent_Event_descriptor_ = MidiEvent_descriptor_->nested_type(0);
+  static const int MidiEvent_Event_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent_Event, sampleoffset_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent_Event, timeinsamples_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent_Event, ppqposition_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent_Event, data_),
+  };
+  MidiEvent_Event_reflection_ =
+    new ::google_public::protobuf::internal::GeneratedMessageReflection(
+      MidiEvent_Event_descriptor_,
+      MidiEvent_Event::default_instance_,
+      MidiEvent_Event_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent_Event, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MidiEvent_Event, _unknown_fields_),
+      -1,
+      ::google_public::protobuf::DescriptorPool::generated_pool(),
+      ::google_public::protobuf::MessageFactory::generated_factory(),
+      sizeof(MidiEvent_Event));
+  Stats_descriptor_ = file->message_type(7);
+  static const int Stats_offsets_[8] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, signalid_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, stages_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, deadlineutilization_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, maxdeadlineutilization_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, xrunriskcount_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, nbofblocks_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, transports_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, streams_),
+  };
+  Stats_reflection_ =
+    new ::google_public::protobuf::internal::GeneratedMessageReflection(
+      Stats_descriptor_,
+      Stats::default_instance_,
+      Stats_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats, _unknown_fields_),
+      -1,
+      ::google_public::protobuf::DescriptorPool::generated_pool(),
+      ::google_public::protobuf::MessageFactory::generated_factory(),
+      sizeof(Stats));
+  Stats_StageLatency_descriptor_ = Stats_descriptor_->nested_type(0);
+  static const int Stats_StageLatency_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StageLatency, stage_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StageLatency, count_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StageLatency, p50_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StageLatency, p99_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StageLatency, max_),
+  };
+  Stats_StageLatency_reflection_ =
+    new ::google_public::protobuf::internal::GeneratedMessageReflection(
+      Stats_StageLatency_descriptor_,
+      Stats_StageLatency::default_instance_,
+      Stats_StageLatency_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StageLatency, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StageLatency, _unknown_fields_),
+      -1,
+      ::google_public::protobuf::DescriptorPool::generated_pool(),
+      ::google_public::protobuf::MessageFactory::generated_factory(),
+      sizeof(Stats_StageLatency));
+  Stats_TransportCounters_descriptor_ = Stats_descriptor_->nested_type(1);
+  static const int Stats_TransportCounters_offsets_[14] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, destination_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, packets_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, bytes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, notreadydrops_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, oversizeddrops_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, partialsends_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, wouldblockerrors_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, nobuffererrors_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, refusederrors_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, unreachableerrors_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, messagesizeerrors_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, othererrors_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, queuehighwater_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, lasterrno_),
+  };
+  Stats_TransportCounters_reflection_ =
+    new ::google_public::protobuf::internal::GeneratedMessageReflection(
+      Stats_TransportCounters_descriptor_,
+      Stats_TransportCounters::default_instance_,
+      Stats_TransportCounters_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_TransportCounters, _unknown_fields_),
+      -1,
+      ::google_public::protobuf::DescriptorPool::generated_pool(),
+      ::google_public::protobuf::MessageFactory::generated_factory(),
+      sizeof(Stats_TransportCounters));
+  Stats_StreamCounters_descriptor_ = Stats_descriptor_->nested_type(2);
+  static const int Stats_StreamCounters_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StreamCounters, stream_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StreamCounters, sent_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StreamCounters, suppressed_),
+  };
+  Stats_StreamCounters_reflection_ =
+    new ::google_public::protobuf::internal::GeneratedMessageReflection(
+      Stats_StreamCounters_descriptor_,
+      Stats_StreamCounters::default_instance_,
+      Stats_StreamCounters_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StreamCounters, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stats_StreamCounters, _unknown_fields_),
+      -1,
+      ::google_public::protobuf::DescriptorPool::generated_pool(),
+      ::google_public::protobuf::MessageFactory::generated_factory(),
+      sizeof(Stats_StreamCounters));
+  Stats_Stage_descriptor_ = Stats_descriptor_->enum_type(0);
+  Stats_Destination_descriptor_ = Stats_descriptor_->enum_type(1);
+  Stats_Stream_descriptor_ = Stats_descriptor_->enum_type(2);
 }
 
 namespace {
@@ -179,6 +324,18 @@ void protobuf_RegisterTypes(const ::std::string&) {
     LogFFT_descriptor_, &LogFFT::default_instance());
   ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     TimeInfo_descriptor_, &TimeInfo::default_instance());
+  ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    MidiEvent_descriptor_, &MidiEvent::default_instance());
+  ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    MidiEvent_Event_descriptor_, &MidiEvent_Event::default_instance());
+  ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Stats_descriptor_, &Stats::default_instance());
+  ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Stats_StageLatency_descriptor_, &Stats_StageLatency::default_instance());
+  ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Stats_TransportCounters_descriptor_, &Stats_TransportCounters::default_instance());
+  ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Stats_StreamCounters_descriptor_, &Stats_StreamCounters::default_instance());
 }
 
 }  // namespace
@@ -196,6 +353,18 @@ void protobuf_ShutdownFile_SignalMessages_2eproto() {
   delete LogFFT_reflection_;
   delete TimeInfo::default_instance_;
   delete TimeInfo_reflection_;
+  delete MidiEvent::default_instance_;
+  delete MidiEvent_reflection_;
+  delete MidiEvent_Event::default_instance_;
+  delete MidiEvent_Event_reflection_;
+  delete Stats::default_instance_;
+  delete Stats_reflection_;
+  delete Stats_StageLatency::default_instance_;
+  delete Stats_StageLatency_reflection_;
+  delete Stats_TransportCounters::default_instance_;
+  delete Stats_TransportCounters_reflection_;
+  delete Stats_StreamCounters::default_instance_;
+  delete Stats_StreamCounters_reflection_;
 }
 
 void protobuf_AddDesc_SignalMessages_2eproto() {
@@ -219,7 +388,40 @@ void protobuf_AddDesc_SignalMessages_2eproto() {
     "\002\022\r\n\005band9\030\013 \001(\002\022\016\n\006band10\030\014 \001(\002\022\016\n\006band"
     "11\030\r \001(\002\022\016\n\006band12\030\016 \001(\002\"K\n\010TimeInfo\022\030\n\t"
     "isPlaying\030\001 \002(\010:\005false\022\020\n\005tempo\030\002 \002(\002:\0010"
-    "\022\023\n\010position\030\003 \002(\002:\0010B\020B\016SignalMessages", 599);
+    "\022\023\n\010position\030\003 \002(\002:\0010\"\265\001\n\tMidiEvent\022\023\n\010s"
+    "ignalID\030\001 \002(\005:\0011\022\030\n\tisPlaying\030\002 \002(\010:\005fal"
+    "se\022 \n\006events\030\003 \003(\0132\020.MidiEvent.Event\032W\n\005"
+    "Event\022\024\n\014sampleOffset\030\001 \002(\005\022\025\n\rtimeInSam"
+    "ples\030\002 \002(\003\022\023\n\013ppqPosition\030\003 \001(\001\022\014\n\004data\030"
+    "\004 \002(\014\"\327\010\n\005Stats\022\023\n\010signalID\030\001 \002(\005:\0011\022#\n\006"
+    "stages\030\002 \003(\0132\023.Stats.StageLatency\022\033\n\023dea"
+    "dlineUtilization\030\003 \002(\002\022\036\n\026maxDeadlineUti"
+    "lization\030\004 \002(\002\022\025\n\rxrunRiskCount\030\005 \002(\r\022\022\n"
+    "\nnbOfBlocks\030\006 \002(\r\022,\n\ntransports\030\007 \003(\0132\030."
+    "Stats.TransportCounters\022&\n\007streams\030\010 \003(\013"
+    "2\025.Stats.StreamCounters\032a\n\014StageLatency\022"
+    "\033\n\005stage\030\001 \002(\0162\014.Stats.Stage\022\r\n\005count\030\002 "
+    "\002(\r\022\013\n\003p50\030\003 \002(\002\022\013\n\003p99\030\004 \002(\002\022\013\n\003max\030\005 \002"
+    "(\002\032\340\002\n\021TransportCounters\022\'\n\013destination\030"
+    "\001 \002(\0162\022.Stats.Destination\022\017\n\007packets\030\002 \002"
+    "(\004\022\r\n\005bytes\030\003 \002(\004\022\025\n\rnotReadyDrops\030\004 \001(\004"
+    "\022\026\n\016oversizedDrops\030\005 \001(\004\022\024\n\014partialSends"
+    "\030\006 \001(\004\022\030\n\020wouldBlockErrors\030\007 \001(\004\022\026\n\016noBu"
+    "fferErrors\030\010 \001(\004\022\025\n\rrefusedErrors\030\t \001(\004\022"
+    "\031\n\021unreachableErrors\030\n \001(\004\022\031\n\021messageSiz"
+    "eErrors\030\013 \001(\004\022\023\n\013otherErrors\030\014 \001(\004\022\026\n\016qu"
+    "eueHighWater\030\r \001(\r\022\021\n\tlastErrno\030\016 \001(\005\032Q\n"
+    "\016StreamCounters\022\035\n\006stream\030\001 \002(\0162\r.Stats."
+    "Stream\022\014\n\004sent\030\002 \002(\004\022\022\n\nsuppressed\030\003 \002(\004"
+    "\"@\n\005Stage\022\021\n\rPROCESS_BLOCK\020\000\022\007\n\003FFT\020\001\022\021\n"
+    "\rSERIALIZATION\020\002\022\010\n\004SEND\020\003\"\250\001\n\013Destinati"
+    "on\022\025\n\021SIGNAL_LEVEL_PORT\020\000\022\033\n\027SIGNAL_INST"
+    "ANT_VAL_PORT\020\001\022\020\n\014IMPULSE_PORT\020\002\022\022\n\016TIME"
+    "_INFO_PORT\020\003\022\014\n\010FFT_PORT\020\004\022\016\n\nSTATS_PORT"
+    "\020\005\022\014\n\010OSC_PORT\020\006\022\023\n\017MIDI_EVENT_PORT\020\007\"P\n"
+    "\006Stream\022\027\n\023SIGNAL_LEVEL_STREAM\020\000\022\035\n\031SIGN"
+    "AL_INSTANT_VAL_STREAM\020\001\022\016\n\nFFT_STREAM\020\002B"
+    "\020B\016SignalMessages", 1897);
   ::google_public::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "SignalMessages.proto", &protobuf_RegisterTypes);
   SignalLevel::default_instance_ = new SignalLevel();
@@ -228,12 +430,24 @@ void protobuf_AddDesc_SignalMessages_2eproto() {
   LinearFFT::default_instance_ = new LinearFFT();
   LogFFT::default_instance_ = new LogFFT();
   TimeInfo::default_instance_ = new TimeInfo();
+  MidiEvent::default_instance_ = new MidiEvent();
+  MidiEvent_Event::default_instance_ = new MidiEvent_Event();
+  Stats::default_instance_ = new Stats();
+  Stats_StageLatency::default_instance_ = new Stats_StageLatency();
+  Stats_TransportCounters::default_instance_ = new Stats_TransportCounters();
+  Stats_StreamCounters::default_instance_ = new Stats_StreamCounters();
   SignalLevel::default_instance_->InitAsDefaultInstance();
   SignalInstantVal::default_instance_->InitAsDefaultInstance();
   Impulse::default_instance_->InitAsDefaultInstance();
   LinearFFT::default_instance_->InitAsDefaultInstance();
   LogFFT::default_instance_->InitAsDefaultInstance();
   TimeInfo::default_instance_->InitAsDefaultInstance();
+  MidiEvent::default_instance_->InitAsDefaultInstance();
+  MidiEvent_Event::default_instance_->InitAsDefaultInstance();
+  Stats::default_instance_->InitAsDefaultInstance();
+  Stats_StageLatency::default_instance_->InitAsDefaultInstance();
+  Stats_TransportCounters::default_instance_->InitAsDefaultInstance();
+  Stats_StreamCounters::default_instance_->InitAsDefaultInstance();
   ::google_public::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_SignalMessages_2eproto);
 }
 
@@ -2248,6 +2462,2610 @@ void TimeInfo::Swap(TimeInfo* other) {
 }
 
 
+// ===================================================================
+
+#ifndef _MSC_VER
+const int MidiEvent_Event::kSampleOffsetFieldNumber;
+const int MidiEvent_Event::kTimeInSamplesFieldNumber;
+const int MidiEvent_Event::kPpqPositionFieldNumber;
+const int MidiEvent_Event::kDataFieldNumber;
+#endif  // !_MSC_VER
+
+MidiEvent_Event::MidiEvent_Event()
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+}
+
+void MidiEvent_Event::InitAsDefaultInstance() {
+}
+
+MidiEvent_Event::MidiEvent_Event(const MidiEvent_Event& from)
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void MidiEvent_Event::SharedCtor() {
+  _cached_size_ = 0;
+  sampleoffset_ = 0;
+  timeinsamples_ = GOOGLE_LONGLONG(0);
+  ppqposition_ = 0;
+  data_ = const_cast< ::std::string*>(&::google_public::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+MidiEvent_Event::~MidiEvent_Event() {
+  SharedDtor();
+}
+
+void MidiEvent_Event::SharedDtor() {
+  if (data_ != &::google_public::protobuf::internal::kEmptyString) {
+    delete data_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void MidiEvent_Event::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google_public::protobuf::Descriptor* MidiEvent_Event::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return MidiEvent_Event_descriptor_;
+}
+
+const MidiEvent_Event& MidiEvent_Event::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalMessages_2eproto();
+  return *default_instance_;
+}
+
+MidiEvent_Event* MidiEvent_Event::default_instance_ = NULL;
+
+MidiEvent_Event* MidiEvent_Event::New() const {
+  return new MidiEvent_Event;
+}
+
+void MidiEvent_Event::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    sampleoffset_ = 0;
+    timeinsamples_ = GOOGLE_LONGLONG(0);
+    ppqposition_ = 0;
+    if (has_data()) {
+      if (data_ != &::google_public::protobuf::internal::kEmptyString) {
+        data_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool MidiEvent_Event::MergePartialFromCodedStream(
+    ::google_public::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google_public::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google_public::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int32 sampleOffset = 1;
+      case 1: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::int32, ::google_public::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &sampleoffset_)));
+          set_has_sampleoffset();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_timeInSamples;
+        break;
+      }
+
+      // required int64 timeInSamples = 2;
+      case 2: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_timeInSamples:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::int64, ::google_public::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &timeinsamples_)));
+          set_has_timeinsamples();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(25)) goto parse_ppqPosition;
+        break;
+      }
+
+      // optional double ppqPosition = 3;
+      case 3: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_FIXED64) {
+         parse_ppqPosition:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google_public::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &ppqposition_)));
+          set_has_ppqposition();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_data;
+        break;
+      }
+
+      // required bytes data = 4;
+      case 4: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_data:
+          DO_(::google_public::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_data()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google_public::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void MidiEvent_Event::SerializeWithCachedSizes(
+    ::google_public::protobuf::io::CodedOutputStream* output) const {
+  // required int32 sampleOffset = 1;
+  if (has_sampleoffset()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteInt32(1, this->sampleoffset(), output);
+  }
+
+  // required int64 timeInSamples = 2;
+  if (has_timeinsamples()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteInt64(2, this->timeinsamples(), output);
+  }
+
+  // optional double ppqPosition = 3;
+  if (has_ppqposition()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteDouble(3, this->ppqposition(), output);
+  }
+
+  // required bytes data = 4;
+  if (has_data()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteBytes(
+      4, this->data(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google_public::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google_public::protobuf::uint8* MidiEvent_Event::SerializeWithCachedSizesToArray(
+    ::google_public::protobuf::uint8* target) const {
+  // required int32 sampleOffset = 1;
+  if (has_sampleoffset()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->sampleoffset(), target);
+  }
+
+  // required int64 timeInSamples = 2;
+  if (has_timeinsamples()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->timeinsamples(), target);
+  }
+
+  // optional double ppqPosition = 3;
+  if (has_ppqposition()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->ppqposition(), target);
+  }
+
+  // required bytes data = 4;
+  if (has_data()) {
+    target =
+      ::google_public::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        4, this->data(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google_public::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int MidiEvent_Event::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int32 sampleOffset = 1;
+    if (has_sampleoffset()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::Int32Size(
+          this->sampleoffset());
+    }
+
+    // required int64 timeInSamples = 2;
+    if (has_timeinsamples()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::Int64Size(
+          this->timeinsamples());
+    }
+
+    // optional double ppqPosition = 3;
+    if (has_ppqposition()) {
+      total_size += 1 + 8;
+    }
+
+    // required bytes data = 4;
+    if (has_data()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::BytesSize(this->data());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void MidiEvent_Event::MergeFrom(const ::google_public::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const MidiEvent_Event* source =
+    ::google_public::protobuf::internal::dynamic_cast_if_available<const MidiEvent_Event*>(
+      &from);
+  if (source == NULL) {
+    ::google_public::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void MidiEvent_Event::MergeFrom(const MidiEvent_Event& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_sampleoffset()) {
+      set_sampleoffset(from.sampleoffset());
+    }
+    if (from.has_timeinsamples()) {
+      set_timeinsamples(from.timeinsamples());
+    }
+    if (from.has_ppqposition()) {
+      set_ppqposition(from.ppqposition());
+    }
+    if (from.has_data()) {
+      set_data(from.data());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void MidiEvent_Event::CopyFrom(const ::google_public::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MidiEvent_Event::CopyFrom(const MidiEvent_Event& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MidiEvent_Event::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000b) != 0x0000000b) return false;
+
+  return true;
+}
+
+void MidiEvent_Event::Swap(MidiEvent_Event* other) {
+  if (other != this) {
+    std::swap(sampleoffset_, other->sampleoffset_);
+    std::swap(timeinsamples_, other->timeinsamples_);
+    std::swap(ppqposition_, other->ppqposition_);
+    std::swap(data_, other->data_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google_public::protobuf::Metadata MidiEvent_Event::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google_public::protobuf::Metadata metadata;
+  metadata.descriptor = MidiEvent_Event_descriptor_;
+  metadata.reflection = MidiEvent_Event_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int MidiEvent::kSignalIDFieldNumber;
+const int MidiEvent::kIsPlayingFieldNumber;
+const int MidiEvent::kEventsFieldNumber;
+#endif  // !_MSC_VER
+
+MidiEvent::MidiEvent()
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+}
+
+void MidiEvent::InitAsDefaultInstance() {
+}
+
+MidiEvent::MidiEvent(const MidiEvent& from)
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void MidiEvent::SharedCtor() {
+  _cached_size_ = 0;
+  signalid_ = 1;
+  isplaying_ = false;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+MidiEvent::~MidiEvent() {
+  SharedDtor();
+}
+
+void MidiEvent::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void MidiEvent::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google_public::protobuf::Descriptor* MidiEvent::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return MidiEvent_descriptor_;
+}
+
+const MidiEvent& MidiEvent::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalMessages_2eproto();
+  return *default_instance_;
+}
+
+MidiEvent* MidiEvent::default_instance_ = NULL;
+
+MidiEvent* MidiEvent::New() const {
+  return new MidiEvent;
+}
+
+void MidiEvent::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    signalid_ = 1;
+    isplaying_ = false;
+  }
+  events_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool MidiEvent::MergePartialFromCodedStream(
+    ::google_public::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google_public::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google_public::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int32 signalID = 1 [default = 1];
+      case 1: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::int32, ::google_public::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &signalid_)));
+          set_has_signalid();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_isPlaying;
+        break;
+      }
+
+      // required bool isPlaying = 2 [default = false];
+      case 2: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_isPlaying:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google_public::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &isplaying_)));
+          set_has_isplaying();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_events;
+        break;
+      }
+
+      // repeated .MidiEvent.Event events = 3;
+      case 3: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_events:
+          DO_(::google_public::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_events()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_events;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google_public::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void MidiEvent::SerializeWithCachedSizes(
+    ::google_public::protobuf::io::CodedOutputStream* output) const {
+  // required int32 signalID = 1 [default = 1];
+  if (has_signalid()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteInt32(1, this->signalid(), output);
+  }
+
+  // required bool isPlaying = 2 [default = false];
+  if (has_isplaying()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteBool(2, this->isplaying(), output);
+  }
+
+  // repeated .MidiEvent.Event events = 3;
+  for (int i = 0; i < this->events_size(); i++) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->events(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google_public::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google_public::protobuf::uint8* MidiEvent::SerializeWithCachedSizesToArray(
+    ::google_public::protobuf::uint8* target) const {
+  // required int32 signalID = 1 [default = 1];
+  if (has_signalid()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->signalid(), target);
+  }
+
+  // required bool isPlaying = 2 [default = false];
+  if (has_isplaying()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->isplaying(), target);
+  }
+
+  // repeated .MidiEvent.Event events = 3;
+  for (int i = 0; i < this->events_size(); i++) {
+    target = ::google_public::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->events(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google_public::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int MidiEvent::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int32 signalID = 1 [default = 1];
+    if (has_signalid()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::Int32Size(
+          this->signalid());
+    }
+
+    // required bool isPlaying = 2 [default = false];
+    if (has_isplaying()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  // repeated .MidiEvent.Event events = 3;
+  total_size += 1 * this->events_size();
+  for (int i = 0; i < this->events_size(); i++) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->events(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void MidiEvent::MergeFrom(const ::google_public::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const MidiEvent* source =
+    ::google_public::protobuf::internal::dynamic_cast_if_available<const MidiEvent*>(
+      &from);
+  if (source == NULL) {
+    ::google_public::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void MidiEvent::MergeFrom(const MidiEvent& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  events_.MergeFrom(from.events_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_signalid()) {
+      set_signalid(from.signalid());
+    }
+    if (from.has_isplaying()) {
+      set_isplaying(from.isplaying());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void MidiEvent::CopyFrom(const ::google_public::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MidiEvent::CopyFrom(const MidiEvent& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MidiEvent::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  for (int i = 0; i < events_size(); i++) {
+    if (!this->events(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void MidiEvent::Swap(MidiEvent* other) {
+  if (other != this) {
+    std::swap(signalid_, other->signalid_);
+    std::swap(isplaying_, other->isplaying_);
+    events_.Swap(&other->events_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google_public::protobuf::Metadata MidiEvent::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google_public::protobuf::Metadata metadata;
+  metadata.descriptor = MidiEvent_descriptor_;
+  metadata.reflection = MidiEvent_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+const ::google_public::protobuf::EnumDescriptor* Stats_Stage_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Stats_Stage_descriptor_;
+}
+bool Stats_Stage_IsValid(int value) {
+  switch(value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#ifndef _MSC_VER
+const Stats_Stage Stats::PROCESS_BLOCK;
+const Stats_Stage Stats::FFT;
+const Stats_Stage Stats::SERIALIZATION;
+const Stats_Stage Stats::SEND;
+const Stats_Stage Stats::Stage_MIN;
+const Stats_Stage Stats::Stage_MAX;
+const int Stats::Stage_ARRAYSIZE;
+#endif  // _MSC_VER
+const ::google_public::protobuf::EnumDescriptor* Stats_Destination_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Stats_Destination_descriptor_;
+}
+bool Stats_Destination_IsValid(int value) {
+  switch(value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#ifndef _MSC_VER
+const Stats_Destination Stats::SIGNAL_LEVEL_PORT;
+const Stats_Destination Stats::SIGNAL_INSTANT_VAL_PORT;
+const Stats_Destination Stats::IMPULSE_PORT;
+const Stats_Destination Stats::TIME_INFO_PORT;
+const Stats_Destination Stats::FFT_PORT;
+const Stats_Destination Stats::STATS_PORT;
+const Stats_Destination Stats::OSC_PORT;
+const Stats_Destination Stats::MIDI_EVENT_PORT;
+const Stats_Destination Stats::Destination_MIN;
+const Stats_Destination Stats::Destination_MAX;
+const int Stats::Destination_ARRAYSIZE;
+#endif  // _MSC_VER
+const ::google_public::protobuf::EnumDescriptor* Stats_Stream_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Stats_Stream_descriptor_;
+}
+bool Stats_Stream_IsValid(int value) {
+  switch(value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#ifndef _MSC_VER
+const Stats_Stream Stats::SIGNAL_LEVEL_STREAM;
+const Stats_Stream Stats::SIGNAL_INSTANT_VAL_STREAM;
+const Stats_Stream Stats::FFT_STREAM;
+const Stats_Stream Stats::Stream_MIN;
+const Stats_Stream Stats::Stream_MAX;
+const int Stats::Stream_ARRAYSIZE;
+#endif  // _MSC_VER
+#ifndef _MSC_VER
+const int Stats_StageLatency::kStageFieldNumber;
+const int Stats_StageLatency::kCountFieldNumber;
+const int Stats_StageLatency::kP50FieldNumber;
+const int Stats_StageLatency::kP99FieldNumber;
+const int Stats_StageLatency::kMaxFieldNumber;
+#endif  // !_MSC_VER
+
+Stats_StageLatency::Stats_StageLatency()
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+}
+
+void Stats_StageLatency::InitAsDefaultInstance() {
+}
+
+Stats_StageLatency::Stats_StageLatency(const Stats_StageLatency& from)
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void Stats_StageLatency::SharedCtor() {
+  _cached_size_ = 0;
+  stage_ = 0;
+  count_ = 0u;
+  p50_ = 0;
+  p99_ = 0;
+  max_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Stats_StageLatency::~Stats_StageLatency() {
+  SharedDtor();
+}
+
+void Stats_StageLatency::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Stats_StageLatency::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google_public::protobuf::Descriptor* Stats_StageLatency::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Stats_StageLatency_descriptor_;
+}
+
+const Stats_StageLatency& Stats_StageLatency::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalMessages_2eproto();
+  return *default_instance_;
+}
+
+Stats_StageLatency* Stats_StageLatency::default_instance_ = NULL;
+
+Stats_StageLatency* Stats_StageLatency::New() const {
+  return new Stats_StageLatency;
+}
+
+void Stats_StageLatency::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    stage_ = 0;
+    count_ = 0u;
+    p50_ = 0;
+    p99_ = 0;
+    max_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Stats_StageLatency::MergePartialFromCodedStream(
+    ::google_public::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google_public::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google_public::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required .Stats.Stage stage = 1;
+      case 1: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          int value;
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google_public::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::Stats_Stage_IsValid(value)) {
+            set_stage(static_cast< ::Stats_Stage >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(1, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_count;
+        break;
+      }
+
+      // required uint32 count = 2;
+      case 2: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_count:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint32, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &count_)));
+          set_has_count();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(29)) goto parse_p50;
+        break;
+      }
+
+      // required float p50 = 3;
+      case 3: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
+         parse_p50:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google_public::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &p50_)));
+          set_has_p50();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(37)) goto parse_p99;
+        break;
+      }
+
+      // required float p99 = 4;
+      case 4: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
+         parse_p99:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google_public::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &p99_)));
+          set_has_p99();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(45)) goto parse_max;
+        break;
+      }
+
+      // required float max = 5;
+      case 5: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
+         parse_max:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google_public::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &max_)));
+          set_has_max();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google_public::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void Stats_StageLatency::SerializeWithCachedSizes(
+    ::google_public::protobuf::io::CodedOutputStream* output) const {
+  // required .Stats.Stage stage = 1;
+  if (has_stage()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->stage(), output);
+  }
+
+  // required uint32 count = 2;
+  if (has_count()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt32(2, this->count(), output);
+  }
+
+  // required float p50 = 3;
+  if (has_p50()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteFloat(3, this->p50(), output);
+  }
+
+  // required float p99 = 4;
+  if (has_p99()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteFloat(4, this->p99(), output);
+  }
+
+  // required float max = 5;
+  if (has_max()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteFloat(5, this->max(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google_public::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google_public::protobuf::uint8* Stats_StageLatency::SerializeWithCachedSizesToArray(
+    ::google_public::protobuf::uint8* target) const {
+  // required .Stats.Stage stage = 1;
+  if (has_stage()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->stage(), target);
+  }
+
+  // required uint32 count = 2;
+  if (has_count()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->count(), target);
+  }
+
+  // required float p50 = 3;
+  if (has_p50()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->p50(), target);
+  }
+
+  // required float p99 = 4;
+  if (has_p99()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->p99(), target);
+  }
+
+  // required float max = 5;
+  if (has_max()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->max(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google_public::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int Stats_StageLatency::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .Stats.Stage stage = 1;
+    if (has_stage()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::EnumSize(this->stage());
+    }
+
+    // required uint32 count = 2;
+    if (has_count()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt32Size(
+          this->count());
+    }
+
+    // required float p50 = 3;
+    if (has_p50()) {
+      total_size += 1 + 4;
+    }
+
+    // required float p99 = 4;
+    if (has_p99()) {
+      total_size += 1 + 4;
+    }
+
+    // required float max = 5;
+    if (has_max()) {
+      total_size += 1 + 4;
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Stats_StageLatency::MergeFrom(const ::google_public::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Stats_StageLatency* source =
+    ::google_public::protobuf::internal::dynamic_cast_if_available<const Stats_StageLatency*>(
+      &from);
+  if (source == NULL) {
+    ::google_public::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Stats_StageLatency::MergeFrom(const Stats_StageLatency& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_stage()) {
+      set_stage(from.stage());
+    }
+    if (from.has_count()) {
+      set_count(from.count());
+    }
+    if (from.has_p50()) {
+      set_p50(from.p50());
+    }
+    if (from.has_p99()) {
+      set_p99(from.p99());
+    }
+    if (from.has_max()) {
+      set_max(from.max());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Stats_StageLatency::CopyFrom(const ::google_public::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Stats_StageLatency::CopyFrom(const Stats_StageLatency& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stats_StageLatency::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000001f) != 0x0000001f) return false;
+
+  return true;
+}
+
+void Stats_StageLatency::Swap(Stats_StageLatency* other) {
+  if (other != this) {
+    std::swap(stage_, other->stage_);
+    std::swap(count_, other->count_);
+    std::swap(p50_, other->p50_);
+    std::swap(p99_, other->p99_);
+    std::swap(max_, other->max_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google_public::protobuf::Metadata Stats_StageLatency::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google_public::protobuf::Metadata metadata;
+  metadata.descriptor = Stats_StageLatency_descriptor_;
+  metadata.reflection = Stats_StageLatency_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int Stats_TransportCounters::kDestinationFieldNumber;
+const int Stats_TransportCounters::kPacketsFieldNumber;
+const int Stats_TransportCounters::kBytesFieldNumber;
+const int Stats_TransportCounters::kNotReadyDropsFieldNumber;
+const int Stats_TransportCounters::kOversizedDropsFieldNumber;
+const int Stats_TransportCounters::kPartialSendsFieldNumber;
+const int Stats_TransportCounters::kWouldBlockErrorsFieldNumber;
+const int Stats_TransportCounters::kNoBufferErrorsFieldNumber;
+const int Stats_TransportCounters::kRefusedErrorsFieldNumber;
+const int Stats_TransportCounters::kUnreachableErrorsFieldNumber;
+const int Stats_TransportCounters::kMessageSizeErrorsFieldNumber;
+const int Stats_TransportCounters::kOtherErrorsFieldNumber;
+const int Stats_TransportCounters::kQueueHighWaterFieldNumber;
+const int Stats_TransportCounters::kLastErrnoFieldNumber;
+#endif  // !_MSC_VER
+
+Stats_TransportCounters::Stats_TransportCounters()
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+}
+
+void Stats_TransportCounters::InitAsDefaultInstance() {
+}
+
+Stats_TransportCounters::Stats_TransportCounters(const Stats_TransportCounters& from)
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void Stats_TransportCounters::SharedCtor() {
+  _cached_size_ = 0;
+  destination_ = 0;
+  packets_ = GOOGLE_ULONGLONG(0);
+  bytes_ = GOOGLE_ULONGLONG(0);
+  notreadydrops_ = GOOGLE_ULONGLONG(0);
+  oversizeddrops_ = GOOGLE_ULONGLONG(0);
+  partialsends_ = GOOGLE_ULONGLONG(0);
+  wouldblockerrors_ = GOOGLE_ULONGLONG(0);
+  nobuffererrors_ = GOOGLE_ULONGLONG(0);
+  refusederrors_ = GOOGLE_ULONGLONG(0);
+  unreachableerrors_ = GOOGLE_ULONGLONG(0);
+  messagesizeerrors_ = GOOGLE_ULONGLONG(0);
+  othererrors_ = GOOGLE_ULONGLONG(0);
+  queuehighwater_ = 0u;
+  lasterrno_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Stats_TransportCounters::~Stats_TransportCounters() {
+  SharedDtor();
+}
+
+void Stats_TransportCounters::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Stats_TransportCounters::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google_public::protobuf::Descriptor* Stats_TransportCounters::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Stats_TransportCounters_descriptor_;
+}
+
+const Stats_TransportCounters& Stats_TransportCounters::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalMessages_2eproto();
+  return *default_instance_;
+}
+
+Stats_TransportCounters* Stats_TransportCounters::default_instance_ = NULL;
+
+Stats_TransportCounters* Stats_TransportCounters::New() const {
+  return new Stats_TransportCounters;
+}
+
+void Stats_TransportCounters::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    destination_ = 0;
+    packets_ = GOOGLE_ULONGLONG(0);
+    bytes_ = GOOGLE_ULONGLONG(0);
+    notreadydrops_ = GOOGLE_ULONGLONG(0);
+    oversizeddrops_ = GOOGLE_ULONGLONG(0);
+    partialsends_ = GOOGLE_ULONGLONG(0);
+    wouldblockerrors_ = GOOGLE_ULONGLONG(0);
+    nobuffererrors_ = GOOGLE_ULONGLONG(0);
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    refusederrors_ = GOOGLE_ULONGLONG(0);
+    unreachableerrors_ = GOOGLE_ULONGLONG(0);
+    messagesizeerrors_ = GOOGLE_ULONGLONG(0);
+    othererrors_ = GOOGLE_ULONGLONG(0);
+    queuehighwater_ = 0u;
+    lasterrno_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Stats_TransportCounters::MergePartialFromCodedStream(
+    ::google_public::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google_public::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google_public::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required .Stats.Destination destination = 1;
+      case 1: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          int value;
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google_public::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::Stats_Destination_IsValid(value)) {
+            set_destination(static_cast< ::Stats_Destination >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(1, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_packets;
+        break;
+      }
+
+      // required uint64 packets = 2;
+      case 2: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_packets:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &packets_)));
+          set_has_packets();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_bytes;
+        break;
+      }
+
+      // required uint64 bytes = 3;
+      case 3: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_bytes:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &bytes_)));
+          set_has_bytes();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_notReadyDrops;
+        break;
+      }
+
+      // optional uint64 notReadyDrops = 4;
+      case 4: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_notReadyDrops:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &notreadydrops_)));
+          set_has_notreadydrops();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_oversizedDrops;
+        break;
+      }
+
+      // optional uint64 oversizedDrops = 5;
+      case 5: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_oversizedDrops:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &oversizeddrops_)));
+          set_has_oversizeddrops();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(48)) goto parse_partialSends;
+        break;
+      }
+
+      // optional uint64 partialSends = 6;
+      case 6: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_partialSends:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &partialsends_)));
+          set_has_partialsends();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(56)) goto parse_wouldBlockErrors;
+        break;
+      }
+
+      // optional uint64 wouldBlockErrors = 7;
+      case 7: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_wouldBlockErrors:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &wouldblockerrors_)));
+          set_has_wouldblockerrors();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(64)) goto parse_noBufferErrors;
+        break;
+      }
+
+      // optional uint64 noBufferErrors = 8;
+      case 8: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_noBufferErrors:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &nobuffererrors_)));
+          set_has_nobuffererrors();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(72)) goto parse_refusedErrors;
+        break;
+      }
+
+      // optional uint64 refusedErrors = 9;
+      case 9: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_refusedErrors:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &refusederrors_)));
+          set_has_refusederrors();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(80)) goto parse_unreachableErrors;
+        break;
+      }
+
+      // optional uint64 unreachableErrors = 10;
+      case 10: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_unreachableErrors:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &unreachableerrors_)));
+          set_has_unreachableerrors();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(88)) goto parse_messageSizeErrors;
+        break;
+      }
+
+      // optional uint64 messageSizeErrors = 11;
+      case 11: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_messageSizeErrors:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &messagesizeerrors_)));
+          set_has_messagesizeerrors();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(96)) goto parse_otherErrors;
+        break;
+      }
+
+      // optional uint64 otherErrors = 12;
+      case 12: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_otherErrors:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &othererrors_)));
+          set_has_othererrors();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(104)) goto parse_queueHighWater;
+        break;
+      }
+
+      // optional uint32 queueHighWater = 13;
+      case 13: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_queueHighWater:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint32, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &queuehighwater_)));
+          set_has_queuehighwater();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(112)) goto parse_lastErrno;
+        break;
+      }
+
+      // optional int32 lastErrno = 14;
+      case 14: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_lastErrno:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::int32, ::google_public::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &lasterrno_)));
+          set_has_lasterrno();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google_public::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void Stats_TransportCounters::SerializeWithCachedSizes(
+    ::google_public::protobuf::io::CodedOutputStream* output) const {
+  // required .Stats.Destination destination = 1;
+  if (has_destination()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->destination(), output);
+  }
+
+  // required uint64 packets = 2;
+  if (has_packets()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(2, this->packets(), output);
+  }
+
+  // required uint64 bytes = 3;
+  if (has_bytes()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(3, this->bytes(), output);
+  }
+
+  // optional uint64 notReadyDrops = 4;
+  if (has_notreadydrops()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(4, this->notreadydrops(), output);
+  }
+
+  // optional uint64 oversizedDrops = 5;
+  if (has_oversizeddrops()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(5, this->oversizeddrops(), output);
+  }
+
+  // optional uint64 partialSends = 6;
+  if (has_partialsends()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(6, this->partialsends(), output);
+  }
+
+  // optional uint64 wouldBlockErrors = 7;
+  if (has_wouldblockerrors()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(7, this->wouldblockerrors(), output);
+  }
+
+  // optional uint64 noBufferErrors = 8;
+  if (has_nobuffererrors()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(8, this->nobuffererrors(), output);
+  }
+
+  // optional uint64 refusedErrors = 9;
+  if (has_refusederrors()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(9, this->refusederrors(), output);
+  }
+
+  // optional uint64 unreachableErrors = 10;
+  if (has_unreachableerrors()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(10, this->unreachableerrors(), output);
+  }
+
+  // optional uint64 messageSizeErrors = 11;
+  if (has_messagesizeerrors()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(11, this->messagesizeerrors(), output);
+  }
+
+  // optional uint64 otherErrors = 12;
+  if (has_othererrors()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(12, this->othererrors(), output);
+  }
+
+  // optional uint32 queueHighWater = 13;
+  if (has_queuehighwater()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt32(13, this->queuehighwater(), output);
+  }
+
+  // optional int32 lastErrno = 14;
+  if (has_lasterrno()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteInt32(14, this->lasterrno(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google_public::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google_public::protobuf::uint8* Stats_TransportCounters::SerializeWithCachedSizesToArray(
+    ::google_public::protobuf::uint8* target) const {
+  // required .Stats.Destination destination = 1;
+  if (has_destination()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->destination(), target);
+  }
+
+  // required uint64 packets = 2;
+  if (has_packets()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->packets(), target);
+  }
+
+  // required uint64 bytes = 3;
+  if (has_bytes()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->bytes(), target);
+  }
+
+  // optional uint64 notReadyDrops = 4;
+  if (has_notreadydrops()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->notreadydrops(), target);
+  }
+
+  // optional uint64 oversizedDrops = 5;
+  if (has_oversizeddrops()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->oversizeddrops(), target);
+  }
+
+  // optional uint64 partialSends = 6;
+  if (has_partialsends()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->partialsends(), target);
+  }
+
+  // optional uint64 wouldBlockErrors = 7;
+  if (has_wouldblockerrors()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->wouldblockerrors(), target);
+  }
+
+  // optional uint64 noBufferErrors = 8;
+  if (has_nobuffererrors()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->nobuffererrors(), target);
+  }
+
+  // optional uint64 refusedErrors = 9;
+  if (has_refusederrors()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->refusederrors(), target);
+  }
+
+  // optional uint64 unreachableErrors = 10;
+  if (has_unreachableerrors()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(10, this->unreachableerrors(), target);
+  }
+
+  // optional uint64 messageSizeErrors = 11;
+  if (has_messagesizeerrors()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(11, this->messagesizeerrors(), target);
+  }
+
+  // optional uint64 otherErrors = 12;
+  if (has_othererrors()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(12, this->othererrors(), target);
+  }
+
+  // optional uint32 queueHighWater = 13;
+  if (has_queuehighwater()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt32ToArray(13, this->queuehighwater(), target);
+  }
+
+  // optional int32 lastErrno = 14;
+  if (has_lasterrno()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteInt32ToArray(14, this->lasterrno(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google_public::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int Stats_TransportCounters::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .Stats.Destination destination = 1;
+    if (has_destination()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::EnumSize(this->destination());
+    }
+
+    // required uint64 packets = 2;
+    if (has_packets()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->packets());
+    }
+
+    // required uint64 bytes = 3;
+    if (has_bytes()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->bytes());
+    }
+
+    // optional uint64 notReadyDrops = 4;
+    if (has_notreadydrops()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->notreadydrops());
+    }
+
+    // optional uint64 oversizedDrops = 5;
+    if (has_oversizeddrops()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->oversizeddrops());
+    }
+
+    // optional uint64 partialSends = 6;
+    if (has_partialsends()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->partialsends());
+    }
+
+    // optional uint64 wouldBlockErrors = 7;
+    if (has_wouldblockerrors()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->wouldblockerrors());
+    }
+
+    // optional uint64 noBufferErrors = 8;
+    if (has_nobuffererrors()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->nobuffererrors());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional uint64 refusedErrors = 9;
+    if (has_refusederrors()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->refusederrors());
+    }
+
+    // optional uint64 unreachableErrors = 10;
+    if (has_unreachableerrors()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->unreachableerrors());
+    }
+
+    // optional uint64 messageSizeErrors = 11;
+    if (has_messagesizeerrors()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->messagesizeerrors());
+    }
+
+    // optional uint64 otherErrors = 12;
+    if (has_othererrors()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->othererrors());
+    }
+
+    // optional uint32 queueHighWater = 13;
+    if (has_queuehighwater()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt32Size(
+          this->queuehighwater());
+    }
+
+    // optional int32 lastErrno = 14;
+    if (has_lasterrno()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::Int32Size(
+          this->lasterrno());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Stats_TransportCounters::MergeFrom(const ::google_public::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Stats_TransportCounters* source =
+    ::google_public::protobuf::internal::dynamic_cast_if_available<const Stats_TransportCounters*>(
+      &from);
+  if (source == NULL) {
+    ::google_public::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Stats_TransportCounters::MergeFrom(const Stats_TransportCounters& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_destination()) {
+      set_destination(from.destination());
+    }
+    if (from.has_packets()) {
+      set_packets(from.packets());
+    }
+    if (from.has_bytes()) {
+      set_bytes(from.bytes());
+    }
+    if (from.has_notreadydrops()) {
+      set_notreadydrops(from.notreadydrops());
+    }
+    if (from.has_oversizeddrops()) {
+      set_oversizeddrops(from.oversizeddrops());
+    }
+    if (from.has_partialsends()) {
+      set_partialsends(from.partialsends());
+    }
+    if (from.has_wouldblockerrors()) {
+      set_wouldblockerrors(from.wouldblockerrors());
+    }
+    if (from.has_nobuffererrors()) {
+      set_nobuffererrors(from.nobuffererrors());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_refusederrors()) {
+      set_refusederrors(from.refusederrors());
+    }
+    if (from.has_unreachableerrors()) {
+      set_unreachableerrors(from.unreachableerrors());
+    }
+    if (from.has_messagesizeerrors()) {
+      set_messagesizeerrors(from.messagesizeerrors());
+    }
+    if (from.has_othererrors()) {
+      set_othererrors(from.othererrors());
+    }
+    if (from.has_queuehighwater()) {
+      set_queuehighwater(from.queuehighwater());
+    }
+    if (from.has_lasterrno()) {
+      set_lasterrno(from.lasterrno());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Stats_TransportCounters::CopyFrom(const ::google_public::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Stats_TransportCounters::CopyFrom(const Stats_TransportCounters& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stats_TransportCounters::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+
+  return true;
+}
+
+void Stats_TransportCounters::Swap(Stats_TransportCounters* other) {
+  if (other != this) {
+    std::swap(destination_, other->destination_);
+    std::swap(packets_, other->packets_);
+    std::swap(bytes_, other->bytes_);
+    std::swap(notreadydrops_, other->notreadydrops_);
+    std::swap(oversizeddrops_, other->oversizeddrops_);
+    std::swap(partialsends_, other->partialsends_);
+    std::swap(wouldblockerrors_, other->wouldblockerrors_);
+    std::swap(nobuffererrors_, other->nobuffererrors_);
+    std::swap(refusederrors_, other->refusederrors_);
+    std::swap(unreachableerrors_, other->unreachableerrors_);
+    std::swap(messagesizeerrors_, other->messagesizeerrors_);
+    std::swap(othererrors_, other->othererrors_);
+    std::swap(queuehighwater_, other->queuehighwater_);
+    std::swap(lasterrno_, other->lasterrno_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google_public::protobuf::Metadata Stats_TransportCounters::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google_public::protobuf::Metadata metadata;
+  metadata.descriptor = Stats_TransportCounters_descriptor_;
+  metadata.reflection = Stats_TransportCounters_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int Stats_StreamCounters::kStreamFieldNumber;
+const int Stats_StreamCounters::kSentFieldNumber;
+const int Stats_StreamCounters::kSuppressedFieldNumber;
+#endif  // !_MSC_VER
+
+Stats_StreamCounters::Stats_StreamCounters()
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+}
+
+void Stats_StreamCounters::InitAsDefaultInstance() {
+}
+
+Stats_StreamCounters::Stats_StreamCounters(const Stats_StreamCounters& from)
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void Stats_StreamCounters::SharedCtor() {
+  _cached_size_ = 0;
+  stream_ = 0;
+  sent_ = GOOGLE_ULONGLONG(0);
+  suppressed_ = GOOGLE_ULONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Stats_StreamCounters::~Stats_StreamCounters() {
+  SharedDtor();
+}
+
+void Stats_StreamCounters::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Stats_StreamCounters::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google_public::protobuf::Descriptor* Stats_StreamCounters::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Stats_StreamCounters_descriptor_;
+}
+
+const Stats_StreamCounters& Stats_StreamCounters::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalMessages_2eproto();
+  return *default_instance_;
+}
+
+Stats_StreamCounters* Stats_StreamCounters::default_instance_ = NULL;
+
+Stats_StreamCounters* Stats_StreamCounters::New() const {
+  return new Stats_StreamCounters;
+}
+
+void Stats_StreamCounters::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    stream_ = 0;
+    sent_ = GOOGLE_ULONGLONG(0);
+    suppressed_ = GOOGLE_ULONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Stats_StreamCounters::MergePartialFromCodedStream(
+    ::google_public::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google_public::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google_public::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required .Stats.Stream stream = 1;
+      case 1: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          int value;
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google_public::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::Stats_Stream_IsValid(value)) {
+            set_stream(static_cast< ::Stats_Stream >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(1, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_sent;
+        break;
+      }
+
+      // required uint64 sent = 2;
+      case 2: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_sent:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &sent_)));
+          set_has_sent();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_suppressed;
+        break;
+      }
+
+      // required uint64 suppressed = 3;
+      case 3: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_suppressed:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint64, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &suppressed_)));
+          set_has_suppressed();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google_public::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void Stats_StreamCounters::SerializeWithCachedSizes(
+    ::google_public::protobuf::io::CodedOutputStream* output) const {
+  // required .Stats.Stream stream = 1;
+  if (has_stream()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->stream(), output);
+  }
+
+  // required uint64 sent = 2;
+  if (has_sent()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(2, this->sent(), output);
+  }
+
+  // required uint64 suppressed = 3;
+  if (has_suppressed()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt64(3, this->suppressed(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google_public::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google_public::protobuf::uint8* Stats_StreamCounters::SerializeWithCachedSizesToArray(
+    ::google_public::protobuf::uint8* target) const {
+  // required .Stats.Stream stream = 1;
+  if (has_stream()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->stream(), target);
+  }
+
+  // required uint64 sent = 2;
+  if (has_sent()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->sent(), target);
+  }
+
+  // required uint64 suppressed = 3;
+  if (has_suppressed()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->suppressed(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google_public::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int Stats_StreamCounters::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .Stats.Stream stream = 1;
+    if (has_stream()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::EnumSize(this->stream());
+    }
+
+    // required uint64 sent = 2;
+    if (has_sent()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->sent());
+    }
+
+    // required uint64 suppressed = 3;
+    if (has_suppressed()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt64Size(
+          this->suppressed());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Stats_StreamCounters::MergeFrom(const ::google_public::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Stats_StreamCounters* source =
+    ::google_public::protobuf::internal::dynamic_cast_if_available<const Stats_StreamCounters*>(
+      &from);
+  if (source == NULL) {
+    ::google_public::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Stats_StreamCounters::MergeFrom(const Stats_StreamCounters& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_stream()) {
+      set_stream(from.stream());
+    }
+    if (from.has_sent()) {
+      set_sent(from.sent());
+    }
+    if (from.has_suppressed()) {
+      set_suppressed(from.suppressed());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Stats_StreamCounters::CopyFrom(const ::google_public::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Stats_StreamCounters::CopyFrom(const Stats_StreamCounters& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stats_StreamCounters::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+
+  return true;
+}
+
+void Stats_StreamCounters::Swap(Stats_StreamCounters* other) {
+  if (other != this) {
+    std::swap(stream_, other->stream_);
+    std::swap(sent_, other->sent_);
+    std::swap(suppressed_, other->suppressed_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google_public::protobuf::Metadata Stats_StreamCounters::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google_public::protobuf::Metadata metadata;
+  metadata.descriptor = Stats_StreamCounters_descriptor_;
+  metadata.reflection = Stats_StreamCounters_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int Stats::kSignalIDFieldNumber;
+const int Stats::kStagesFieldNumber;
+const int Stats::kDeadlineUtilizationFieldNumber;
+const int Stats::kMaxDeadlineUtilizationFieldNumber;
+const int Stats::kXrunRiskCountFieldNumber;
+const int Stats::kNbOfBlocksFieldNumber;
+const int Stats::kTransportsFieldNumber;
+const int Stats::kStreamsFieldNumber;
+#endif  // !_MSC_VER
+
+Stats::Stats()
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+}
+
+void Stats::InitAsDefaultInstance() {
+}
+
+Stats::Stats(const Stats& from)
+  : ::google_public::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void Stats::SharedCtor() {
+  _cached_size_ = 0;
+  signalid_ = 1;
+  deadlineutilization_ = 0;
+  maxdeadlineutilization_ = 0;
+  xrunriskcount_ = 0u;
+  nbofblocks_ = 0u;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Stats::~Stats() {
+  SharedDtor();
+}
+
+void Stats::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Stats::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google_public::protobuf::Descriptor* Stats::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Stats_descriptor_;
+}
+
+const Stats& Stats::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalMessages_2eproto();
+  return *default_instance_;
+}
+
+Stats* Stats::default_instance_ = NULL;
+
+Stats* Stats::New() const {
+  return new Stats;
+}
+
+void Stats::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    signalid_ = 1;
+    deadlineutilization_ = 0;
+    maxdeadlineutilization_ = 0;
+    xrunriskcount_ = 0u;
+    nbofblocks_ = 0u;
+  }
+  stages_.Clear();
+  transports_.Clear();
+  streams_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Stats::MergePartialFromCodedStream(
+    ::google_public::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google_public::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google_public::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int32 signalID = 1 [default = 1];
+      case 1: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::int32, ::google_public::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &signalid_)));
+          set_has_signalid();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_stages;
+        break;
+      }
+
+      // repeated .Stats.StageLatency stages = 2;
+      case 2: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_stages:
+          DO_(::google_public::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_stages()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_stages;
+        if (input->ExpectTag(29)) goto parse_deadlineUtilization;
+        break;
+      }
+
+      // required float deadlineUtilization = 3;
+      case 3: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
+         parse_deadlineUtilization:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google_public::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &deadlineutilization_)));
+          set_has_deadlineutilization();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(37)) goto parse_maxDeadlineUtilization;
+        break;
+      }
+
+      // required float maxDeadlineUtilization = 4;
+      case 4: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
+         parse_maxDeadlineUtilization:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google_public::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &maxdeadlineutilization_)));
+          set_has_maxdeadlineutilization();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_xrunRiskCount;
+        break;
+      }
+
+      // required uint32 xrunRiskCount = 5;
+      case 5: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_xrunRiskCount:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint32, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &xrunriskcount_)));
+          set_has_xrunriskcount();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(48)) goto parse_nbOfBlocks;
+        break;
+      }
+
+      // required uint32 nbOfBlocks = 6;
+      case 6: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_nbOfBlocks:
+          DO_((::google_public::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google_public::protobuf::uint32, ::google_public::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &nbofblocks_)));
+          set_has_nbofblocks();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(58)) goto parse_transports;
+        break;
+      }
+
+      // repeated .Stats.TransportCounters transports = 7;
+      case 7: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_transports:
+          DO_(::google_public::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_transports()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(58)) goto parse_transports;
+        if (input->ExpectTag(66)) goto parse_streams;
+        break;
+      }
+
+      // repeated .Stats.StreamCounters streams = 8;
+      case 8: {
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_streams:
+          DO_(::google_public::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_streams()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(66)) goto parse_streams;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google_public::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google_public::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google_public::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void Stats::SerializeWithCachedSizes(
+    ::google_public::protobuf::io::CodedOutputStream* output) const {
+  // required int32 signalID = 1 [default = 1];
+  if (has_signalid()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteInt32(1, this->signalid(), output);
+  }
+
+  // repeated .Stats.StageLatency stages = 2;
+  for (int i = 0; i < this->stages_size(); i++) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->stages(i), output);
+  }
+
+  // required float deadlineUtilization = 3;
+  if (has_deadlineutilization()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteFloat(3, this->deadlineutilization(), output);
+  }
+
+  // required float maxDeadlineUtilization = 4;
+  if (has_maxdeadlineutilization()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteFloat(4, this->maxdeadlineutilization(), output);
+  }
+
+  // required uint32 xrunRiskCount = 5;
+  if (has_xrunriskcount()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt32(5, this->xrunriskcount(), output);
+  }
+
+  // required uint32 nbOfBlocks = 6;
+  if (has_nbofblocks()) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteUInt32(6, this->nbofblocks(), output);
+  }
+
+  // repeated .Stats.TransportCounters transports = 7;
+  for (int i = 0; i < this->transports_size(); i++) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->transports(i), output);
+  }
+
+  // repeated .Stats.StreamCounters streams = 8;
+  for (int i = 0; i < this->streams_size(); i++) {
+    ::google_public::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, this->streams(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google_public::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google_public::protobuf::uint8* Stats::SerializeWithCachedSizesToArray(
+    ::google_public::protobuf::uint8* target) const {
+  // required int32 signalID = 1 [default = 1];
+  if (has_signalid()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->signalid(), target);
+  }
+
+  // repeated .Stats.StageLatency stages = 2;
+  for (int i = 0; i < this->stages_size(); i++) {
+    target = ::google_public::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->stages(i), target);
+  }
+
+  // required float deadlineUtilization = 3;
+  if (has_deadlineutilization()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->deadlineutilization(), target);
+  }
+
+  // required float maxDeadlineUtilization = 4;
+  if (has_maxdeadlineutilization()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->maxdeadlineutilization(), target);
+  }
+
+  // required uint32 xrunRiskCount = 5;
+  if (has_xrunriskcount()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->xrunriskcount(), target);
+  }
+
+  // required uint32 nbOfBlocks = 6;
+  if (has_nbofblocks()) {
+    target = ::google_public::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->nbofblocks(), target);
+  }
+
+  // repeated .Stats.TransportCounters transports = 7;
+  for (int i = 0; i < this->transports_size(); i++) {
+    target = ::google_public::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->transports(i), target);
+  }
+
+  // repeated .Stats.StreamCounters streams = 8;
+  for (int i = 0; i < this->streams_size(); i++) {
+    target = ::google_public::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        8, this->streams(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google_public::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int Stats::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int32 signalID = 1 [default = 1];
+    if (has_signalid()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::Int32Size(
+          this->signalid());
+    }
+
+    // required float deadlineUtilization = 3;
+    if (has_deadlineutilization()) {
+      total_size += 1 + 4;
+    }
+
+    // required float maxDeadlineUtilization = 4;
+    if (has_maxdeadlineutilization()) {
+      total_size += 1 + 4;
+    }
+
+    // required uint32 xrunRiskCount = 5;
+    if (has_xrunriskcount()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt32Size(
+          this->xrunriskcount());
+    }
+
+    // required uint32 nbOfBlocks = 6;
+    if (has_nbofblocks()) {
+      total_size += 1 +
+        ::google_public::protobuf::internal::WireFormatLite::UInt32Size(
+          this->nbofblocks());
+    }
+
+  }
+  // repeated .Stats.StageLatency stages = 2;
+  total_size += 1 * this->stages_size();
+  for (int i = 0; i < this->stages_size(); i++) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->stages(i));
+  }
+
+  // repeated .Stats.TransportCounters transports = 7;
+  total_size += 1 * this->transports_size();
+  for (int i = 0; i < this->transports_size(); i++) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->transports(i));
+  }
+
+  // repeated .Stats.StreamCounters streams = 8;
+  total_size += 1 * this->streams_size();
+  for (int i = 0; i < this->streams_size(); i++) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->streams(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google_public::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Stats::MergeFrom(const ::google_public::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Stats* source =
+    ::google_public::protobuf::internal::dynamic_cast_if_available<const Stats*>(
+      &from);
+  if (source == NULL) {
+    ::google_public::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Stats::MergeFrom(const Stats& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  stages_.MergeFrom(from.stages_);
+  transports_.MergeFrom(from.transports_);
+  streams_.MergeFrom(from.streams_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_signalid()) {
+      set_signalid(from.signalid());
+    }
+    if (from.has_deadlineutilization()) {
+      set_deadlineutilization(from.deadlineutilization());
+    }
+    if (from.has_maxdeadlineutilization()) {
+      set_maxdeadlineutilization(from.maxdeadlineutilization());
+    }
+    if (from.has_xrunriskcount()) {
+      set_xrunriskcount(from.xrunriskcount());
+    }
+    if (from.has_nbofblocks()) {
+      set_nbofblocks(from.nbofblocks());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Stats::CopyFrom(const ::google_public::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Stats::CopyFrom(const Stats& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stats::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000003d) != 0x0000003d) return false;
+
+  for (int i = 0; i < stages_size(); i++) {
+    if (!this->stages(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < transports_size(); i++) {
+    if (!this->transports(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < streams_size(); i++) {
+    if (!this->streams(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Stats::Swap(Stats* other) {
+  if (other != this) {
+    std::swap(signalid_, other->signalid_);
+    stages_.Swap(&other->stages_);
+    std::swap(deadlineutilization_, other->deadlineutilization_);
+    std::swap(maxdeadlineutilization_, other->maxdeadlineutilization_);
+    std::swap(xrunriskcount_, other->xrunriskcount_);
+    std::swap(nbofblocks_, other->nbofblocks_);
+    transports_.Swap(&other->transports_);
+    streams_.Swap(&other->streams_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google_public::protobuf::Metadata Stats::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google_public::protobuf::Metadata metadata;
+  metadata.descriptor = Stats_descriptor_;
+  metadata.reflection = Stats_reflection_;
+  return metadata;
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 
 // @@protoc_insertion_point(global_scope)
@@ -23,6 +23,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 
@@ -37,7 +38,79 @@ class Impulse;
 class LinearFFT;
 class LogFFT;
 class TimeInfo;
+class MidiEvent;
+class MidiEvent_Event;
+class Stats;
+class Stats_StageLatency;
+class Stats_TransportCounters;
+class Stats_StreamCounters;
+
+enum Stats_Stage {
+  Stats_Stage_PROCESS_BLOCK = 0,
+  Stats_Stage_FFT = 1,
+  Stats_Stage_SERIALIZATION = 2,
+  Stats_Stage_SEND = 3
+};
+bool Stats_Stage_IsValid(int value);
+const Stats_Stage Stats_Stage_Stage_MIN = Stats_Stage_PROCESS_BLOCK;
+const Stats_Stage Stats_Stage_Stage_MAX = Stats_Stage_SEND;
+const int Stats_Stage_Stage_ARRAYSIZE = Stats_Stage_Stage_MAX + 1;
+
+const ::google_public::protobuf::EnumDescriptor* Stats_Stage_descriptor();
+inline const ::std::string& Stats_Stage_Name(Stats_Stage value) {
+  return ::google_public::protobuf::internal::NameOfEnum(
+    Stats_Stage_descriptor(), value);
+}
+inline bool Stats_Stage_Parse(
+    const ::std::string& name, Stats_Stage* value) {
+  return ::google_public::protobuf::internal::ParseNamedEnum<Stats_Stage>(
+    Stats_Stage_descriptor(), name, value);
+}
+enum Stats_Destination {
+  Stats_Destination_SIGNAL_LEVEL_PORT = 0,
+  Stats_Destination_SIGNAL_INSTANT_VAL_PORT = 1,
+  Stats_Destination_IMPULSE_PORT = 2,
+  Stats_Destination_TIME_INFO_PORT = 3,
+  Stats_Destination_FFT_PORT = 4,
+  Stats_Destination_STATS_PORT = 5,
+  Stats_Destination_OSC_PORT = 6,
+  Stats_Destination_MIDI_EVENT_PORT = 7
+};
+bool Stats_Destination_IsValid(int value);
+const Stats_Destination Stats_Destination_Destination_MIN = Stats_Destination_SIGNAL_LEVEL_PORT;
+const Stats_Destination Stats_Destination_Destination_MAX = Stats_Destination_MIDI_EVENT_PORT;
+const int Stats_Destination_Destination_ARRAYSIZE = Stats_Destination_Destination_MAX + 1;
+
+const ::google_public::protobuf::EnumDescriptor* Stats_Destination_descriptor();
+inline const ::std::string& Stats_Destination_Name(Stats_Destination value) {
+  return ::google_public::protobuf::internal::NameOfEnum(
+    Stats_Destination_descriptor(), value);
+}
+inline bool Stats_Destination_Parse(
+    const ::std::string& name, Stats_Destination* value) {
+  return ::google_public::protobuf::internal::ParseNamedEnum<Stats_Destination>(
+    Stats_Destination_descriptor(), name, value);
+}
+enum Stats_Stream {
+  Stats_Stream_SIGNAL_LEVEL_STREAM = 0,
+  Stats_Stream_SIGNAL_INSTANT_VAL_STREAM = 1,
+  Stats_Stream_FFT_STREAM = 2
+};
+bool Stats_Stream_IsValid(int value);
+const Stats_Stream Stats_Stream_Stream_MIN = Stats_Stream_SIGNAL_LEVEL_STREAM;
+const Stats_Stream Stats_Stream_Stream_MAX = Stats_Stream_FFT_STREAM;
+const int Stats_Stream_Stream_ARRAYSIZE = Stats_Stream_Stream_MAX + 1;
 
+const ::google_public::protobuf::EnumDescriptor* Stats_Stream_descriptor();
+inline const ::std::string& Stats_Stream_Name(Stats_Stream value) {
+  return ::google_public::protobuf::internal::NameOfEnum(
+    Stats_Stream_descriptor(), value);
+}
+inline bool Stats_Stream_Parse(
+    const ::std::string& name, Stats_Stream* value) {
+  return ::google_public::protobuf::internal::ParseNamedEnum<Stats_Stream>(
+    Stats_Stream_descriptor(), name, value);
+}
 // ===================================================================
 
 class SignalLevel : public ::google_public::protobuf::Message {
@@ -724,584 +797,2391 @@ class TimeInfo : public ::google_public::protobuf::Message {
   void InitAsDefaultInstance();
   static TimeInfo* default_instance_;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class MidiEvent_Event : public ::google_public::protobuf::Message {
+ public:
+  MidiEvent_Event();
+  virtual ~MidiEvent_Event();
 
-// ===================================================================
+  MidiEvent_Event(const MidiEvent_Event& from);
 
-// SignalLevel
+  inline MidiEvent_Event& operator=(const MidiEvent_Event& from) {
+    CopyFrom(from);
+    return *this;
+  }
 
-// required int32 signalID = 1 [default = 1];
-inline bool SignalLevel::has_signalid() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SignalLevel::set_has_signalid() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SignalLevel::clear_has_signalid() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SignalLevel::clear_signalid() {
-  signalid_ = 1;
-  clear_has_signalid();
-}
-inline ::google_public::protobuf::int32 SignalLevel::signalid() const {
-  return signalid_;
-}
-inline void SignalLevel::set_signalid(::google_public::protobuf::int32 value) {
-  set_has_signalid();
-  signalid_ = value;
-}
+  inline const ::google_public::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
 
-// required float signalLevel = 2 [default = 0];
-inline bool SignalLevel::has_signallevel() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SignalLevel::set_has_signallevel() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SignalLevel::clear_has_signallevel() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void SignalLevel::clear_signallevel() {
-  signallevel_ = 0;
-  clear_has_signallevel();
-}
-inline float SignalLevel::signallevel() const {
-  return signallevel_;
-}
-inline void SignalLevel::set_signallevel(float value) {
-  set_has_signallevel();
-  signallevel_ = value;
-}
+  inline ::google_public::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
 
-// -------------------------------------------------------------------
+  static const ::google_public::protobuf::Descriptor* descriptor();
+  static const MidiEvent_Event& default_instance();
 
-// SignalInstantVal
+  void Swap(MidiEvent_Event* other);
 
-// required int32 signalID = 1 [default = 1];
-inline bool SignalInstantVal::has_signalid() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SignalInstantVal::set_has_signalid() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SignalInstantVal::clear_has_signalid() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SignalInstantVal::clear_signalid() {
-  signalid_ = 1;
-  clear_has_signalid();
-}
-inline ::google_public::protobuf::int32 SignalInstantVal::signalid() const {
-  return signalid_;
-}
-inline void SignalInstantVal::set_signalid(::google_public::protobuf::int32 value) {
-  set_has_signalid();
-  signalid_ = value;
-}
+  // implements Message ----------------------------------------------
 
-// required float signalInstantVal = 2 [default = 0];
-inline bool SignalInstantVal::has_signalinstantval() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SignalInstantVal::set_has_signalinstantval() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SignalInstantVal::clear_has_signalinstantval() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void SignalInstantVal::clear_signalinstantval() {
-  signalinstantval_ = 0;
-  clear_has_signalinstantval();
-}
-inline float SignalInstantVal::signalinstantval() const {
-  return signalinstantval_;
-}
-inline void SignalInstantVal::set_signalinstantval(float value) {
-  set_has_signalinstantval();
-  signalinstantval_ = value;
-}
+  MidiEvent_Event* New() const;
+  void CopyFrom(const ::google_public::protobuf::Message& from);
+  void MergeFrom(const ::google_public::protobuf::Message& from);
+  void CopyFrom(const MidiEvent_Event& from);
+  void MergeFrom(const MidiEvent_Event& from);
+  void Clear();
+  bool IsInitialized() const;
 
-// -------------------------------------------------------------------
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google_public::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google_public::protobuf::io::CodedOutputStream* output) const;
+  ::google_public::protobuf::uint8* SerializeWithCachedSizesToArray(::google_public::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
 
-// Impulse
+  ::google_public::protobuf::Metadata GetMetadata() const;
 
-// required int32 signalID = 1 [default = 1];
-inline bool Impulse::has_signalid() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Impulse::set_has_signalid() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Impulse::clear_has_signalid() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void Impulse::clear_signalid() {
-  signalid_ = 1;
-  clear_has_signalid();
-}
-inline ::google_public::protobuf::int32 Impulse::signalid() const {
-  return signalid_;
-}
-inline void Impulse::set_signalid(::google_public::protobuf::int32 value) {
-  set_has_signalid();
-  signalid_ = value;
-}
+  // nested types ----------------------------------------------------
 
-// -------------------------------------------------------------------
+  // accessors -------------------------------------------------------
 
-// LinearFFT
+  // required int32 sampleOffset = 1;
+  inline bool has_sampleoffset() const;
+  inline void clear_sampleoffset();
+  static const int kSampleOffsetFieldNumber = 1;
+  inline ::google_public::protobuf::int32 sampleoffset() const;
+  inline void set_sampleoffset(::google_public::protobuf::int32 value);
+
+  // required int64 timeInSamples = 2;
+  inline bool has_timeinsamples() const;
+  inline void clear_timeinsamples();
+  static const int kTimeInSamplesFieldNumber = 2;
+  inline ::google_public::protobuf::int64 timeinsamples() const;
+  inline void set_timeinsamples(::google_public::protobuf::int64 value);
+
+  // optional double ppqPosition = 3;
+  inline bool has_ppqposition() const;
+  inline void clear_ppqposition();
+  static const int kPpqPositionFieldNumber = 3;
+  inline double ppqposition() const;
+  inline void set_ppqposition(double value);
+
+  // required bytes data = 4;
+  inline bool has_data() const;
+  inline void clear_data();
+  static const int kDataFieldNumber = 4;
+  inline const ::std::string& data() const;
+  inline void set_data(const ::std::string& value);
+  inline void set_data(const char* value);
+  inline void set_data(const void* value, size_t size);
+  inline ::std::string* mutable_data();
+  inline ::std::string* release_data();
+  inline void set_allocated_data(::std::string* data);
+
+  // @@protoc_insertion_point(class_scope:MidiEvent.Event)
+ private:
+  inline void set_has_sampleoffset();
+  inline void clear_has_sampleoffset();
+  inline void set_has_timeinsamples();
+  inline void clear_has_timeinsamples();
+  inline void set_has_ppqposition();
+  inline void clear_has_ppqposition();
+  inline void set_has_data();
+  inline void clear_has_data();
 
-// required int32 signalID = 1 [default = 1];
-inline bool LinearFFT::has_signalid() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LinearFFT::set_has_signalid() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LinearFFT::clear_has_signalid() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void LinearFFT::clear_signalid() {
-  signalid_ = 1;
-  clear_has_signalid();
-}
-inline ::google_public::protobuf::int32 LinearFFT::signalid() const {
-  return signalid_;
-}
-inline void LinearFFT::set_signalid(::google_public::protobuf::int32 value) {
-  set_has_signalid();
-  signalid_ = value;
-}
+  ::google_public::protobuf::UnknownFieldSet _unknown_fields_;
 
-// required float fundamentalFreq = 2 [default = 0];
-inline bool LinearFFT::has_fundamentalfreq() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void LinearFFT::set_has_fundamentalfreq() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void LinearFFT::clear_has_fundamentalfreq() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void LinearFFT::clear_fundamentalfreq() {
-  fundamentalfreq_ = 0;
-  clear_has_fundamentalfreq();
-}
-inline float LinearFFT::fundamentalfreq() const {
-  return fundamentalfreq_;
-}
-inline void LinearFFT::set_fundamentalfreq(float value) {
-  set_has_fundamentalfreq();
-  fundamentalfreq_ = value;
-}
+  ::google_public::protobuf::int64 timeinsamples_;
+  double ppqposition_;
+  ::std::string* data_;
+  ::google_public::protobuf::int32 sampleoffset_;
 
-// repeated float data = 3 [packed = true];
-inline int LinearFFT::data_size() const {
-  return data_.size();
-}
-inline void LinearFFT::clear_data() {
-  data_.Clear();
-}
-inline float LinearFFT::data(int index) const {
-  return data_.Get(index);
-}
-inline void LinearFFT::set_data(int index, float value) {
-  data_.Set(index, value);
-}
-inline void LinearFFT::add_data(float value) {
-  data_.Add(value);
-}
-inline const ::google_public::protobuf::RepeatedField< float >&
-LinearFFT::data() const {
-  return data_;
-}
-inline ::google_public::protobuf::RepeatedField< float >*
-LinearFFT::mutable_data() {
-  return &data_;
-}
+  mutable int _cached_size_;
+  ::google_public::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalMessages_2eproto();
+  friend void protobuf_AssignDesc_SignalMessages_2eproto();
+  friend void protobuf_ShutdownFile_SignalMessages_2eproto();
 
+  void InitAsDefaultInstance();
+  static MidiEvent_Event* default_instance_;
+};
 // -------------------------------------------------------------------
 
-// LogFFT
+class MidiEvent : public ::google_public::protobuf::Message {
+ public:
+  MidiEvent();
+  virtual ~MidiEvent();
 
-// optional int32 signalID = 1 [default = 1];
-inline bool LogFFT::has_signalid() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LogFFT::set_has_signalid() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LogFFT::clear_has_signalid() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void LogFFT::clear_signalid() {
-  signalid_ = 1;
-  clear_has_signalid();
-}
-inline ::google_public::protobuf::int32 LogFFT::signalid() const {
-  return signalid_;
-}
-inline void LogFFT::set_signalid(::google_public::protobuf::int32 value) {
-  set_has_signalid();
-  signalid_ = value;
-}
+  MidiEvent(const MidiEvent& from);
 
-// optional float fundamentalFreq = 2;
-inline bool LogFFT::has_fundamentalfreq() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void LogFFT::set_has_fundamentalfreq() {
-  _has_bits_[0] |= 0x00000002u;
+  inline MidiEvent& operator=(const MidiEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google_public::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google_public::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google_public::protobuf::Descriptor* descriptor();
+  static const MidiEvent& default_instance();
+
+  void Swap(MidiEvent* other);
+
+  // implements Message ----------------------------------------------
+
+  MidiEvent* New() const;
+  void CopyFrom(const ::google_public::protobuf::Message& from);
+  void MergeFrom(const ::google_public::protobuf::Message& from);
+  void CopyFrom(const MidiEvent& from);
+  void MergeFrom(const MidiEvent& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google_public::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google_public::protobuf::io::CodedOutputStream* output) const;
+  ::google_public::protobuf::uint8* SerializeWithCachedSizesToArray(::google_public::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google_public::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef MidiEvent_Event Event;
+
+  // accessors -------------------------------------------------------
+
+  // required int32 signalID = 1 [default = 1];
+  inline bool has_signalid() const;
+  inline void clear_signalid();
+  static const int kSignalIDFieldNumber = 1;
+  inline ::google_public::protobuf::int32 signalid() const;
+  inline void set_signalid(::google_public::protobuf::int32 value);
+
+  // required bool isPlaying = 2 [default = false];
+  inline bool has_isplaying() const;
+  inline void clear_isplaying();
+  static const int kIsPlayingFieldNumber = 2;
+  inline bool isplaying() const;
+  inline void set_isplaying(bool value);
+
+  // repeated .MidiEvent.Event events = 3;
+  inline int events_size() const;
+  inline void clear_events();
+  static const int kEventsFieldNumber = 3;
+  inline const ::MidiEvent_Event& events(int index) const;
+  inline ::MidiEvent_Event* mutable_events(int index);
+  inline ::MidiEvent_Event* add_events();
+  inline const ::google_public::protobuf::RepeatedPtrField< ::MidiEvent_Event >&
+      events() const;
+  inline ::google_public::protobuf::RepeatedPtrField< ::MidiEvent_Event >*
+      mutable_events();
+
+  // @@protoc_insertion_point(class_scope:MidiEvent)
+ private:
+  inline void set_has_signalid();
+  inline void clear_has_signalid();
+  inline void set_has_isplaying();
+  inline void clear_has_isplaying();
+
+  ::google_public::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google_public::protobuf::int32 signalid_;
+  bool isplaying_;
+  ::google_public::protobuf::RepeatedPtrField< ::MidiEvent_Event > events_;
+
+  mutable int _cached_size_;
+  ::google_public::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalMessages_2eproto();
+  friend void protobuf_AssignDesc_SignalMessages_2eproto();
+  friend void protobuf_ShutdownFile_SignalMessages_2eproto();
+
+  void InitAsDefaultInstance();
+  static MidiEvent* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Stats_StageLatency : public ::google_public::protobuf::Message {
+ public:
+  Stats_StageLatency();
+  virtual ~Stats_StageLatency();
+
+  Stats_StageLatency(const Stats_StageLatency& from);
+
+  inline Stats_StageLatency& operator=(const Stats_StageLatency& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google_public::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google_public::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google_public::protobuf::Descriptor* descriptor();
+  static const Stats_StageLatency& default_instance();
+
+  void Swap(Stats_StageLatency* other);
+
+  // implements Message ----------------------------------------------
+
+  Stats_StageLatency* New() const;
+  void CopyFrom(const ::google_public::protobuf::Message& from);
+  void MergeFrom(const ::google_public::protobuf::Message& from);
+  void CopyFrom(const Stats_StageLatency& from);
+  void MergeFrom(const Stats_StageLatency& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google_public::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google_public::protobuf::io::CodedOutputStream* output) const;
+  ::google_public::protobuf::uint8* SerializeWithCachedSizesToArray(::google_public::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google_public::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required .Stats.Stage stage = 1;
+  inline bool has_stage() const;
+  inline void clear_stage();
+  static const int kStageFieldNumber = 1;
+  inline ::Stats_Stage stage() const;
+  inline void set_stage(::Stats_Stage value);
+
+  // required uint32 count = 2;
+  inline bool has_count() const;
+  inline void clear_count();
+  static const int kCountFieldNumber = 2;
+  inline ::google_public::protobuf::uint32 count() const;
+  inline void set_count(::google_public::protobuf::uint32 value);
+
+  // required float p50 = 3;
+  inline bool has_p50() const;
+  inline void clear_p50();
+  static const int kP50FieldNumber = 3;
+  inline float p50() const;
+  inline void set_p50(float value);
+
+  // required float p99 = 4;
+  inline bool has_p99() const;
+  inline void clear_p99();
+  static const int kP99FieldNumber = 4;
+  inline float p99() const;
+  inline void set_p99(float value);
+
+  // required float max = 5;
+  inline bool has_max() const;
+  inline void clear_max();
+  static const int kMaxFieldNumber = 5;
+  inline float max() const;
+  inline void set_max(float value);
+
+  // @@protoc_insertion_point(class_scope:Stats.StageLatency)
+ private:
+  inline void set_has_stage();
+  inline void clear_has_stage();
+  inline void set_has_count();
+  inline void clear_has_count();
+  inline void set_has_p50();
+  inline void clear_has_p50();
+  inline void set_has_p99();
+  inline void clear_has_p99();
+  inline void set_has_max();
+  inline void clear_has_max();
+
+  ::google_public::protobuf::UnknownFieldSet _unknown_fields_;
+
+  int stage_;
+  ::google_public::protobuf::uint32 count_;
+  float p50_;
+  float p99_;
+  float max_;
+
+  mutable int _cached_size_;
+  ::google_public::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalMessages_2eproto();
+  friend void protobuf_AssignDesc_SignalMessages_2eproto();
+  friend void protobuf_ShutdownFile_SignalMessages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Stats_StageLatency* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Stats_TransportCounters : public ::google_public::protobuf::Message {
+ public:
+  Stats_TransportCounters();
+  virtual ~Stats_TransportCounters();
+
+  Stats_TransportCounters(const Stats_TransportCounters& from);
+
+  inline Stats_TransportCounters& operator=(const Stats_TransportCounters& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google_public::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google_public::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google_public::protobuf::Descriptor* descriptor();
+  static const Stats_TransportCounters& default_instance();
+
+  void Swap(Stats_TransportCounters* other);
+
+  // implements Message ----------------------------------------------
+
+  Stats_TransportCounters* New() const;
+  void CopyFrom(const ::google_public::protobuf::Message& from);
+  void MergeFrom(const ::google_public::protobuf::Message& from);
+  void CopyFrom(const Stats_TransportCounters& from);
+  void MergeFrom(const Stats_TransportCounters& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google_public::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google_public::protobuf::io::CodedOutputStream* output) const;
+  ::google_public::protobuf::uint8* SerializeWithCachedSizesToArray(::google_public::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google_public::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required .Stats.Destination destination = 1;
+  inline bool has_destination() const;
+  inline void clear_destination();
+  static const int kDestinationFieldNumber = 1;
+  inline ::Stats_Destination destination() const;
+  inline void set_destination(::Stats_Destination value);
+
+  // required uint64 packets = 2;
+  inline bool has_packets() const;
+  inline void clear_packets();
+  static const int kPacketsFieldNumber = 2;
+  inline ::google_public::protobuf::uint64 packets() const;
+  inline void set_packets(::google_public::protobuf::uint64 value);
+
+  // required uint64 bytes = 3;
+  inline bool has_bytes() const;
+  inline void clear_bytes();
+  static const int kBytesFieldNumber = 3;
+  inline ::google_public::protobuf::uint64 bytes() const;
+  inline void set_bytes(::google_public::protobuf::uint64 value);
+
+  // optional uint64 notReadyDrops = 4;
+  inline bool has_notreadydrops() const;
+  inline void clear_notreadydrops();
+  static const int kNotReadyDropsFieldNumber = 4;
+  inline ::google_public::protobuf::uint64 notreadydrops() const;
+  inline void set_notreadydrops(::google_public::protobuf::uint64 value);
+
+  // optional uint64 oversizedDrops = 5;
+  inline bool has_oversizeddrops() const;
+  inline void clear_oversizeddrops();
+  static const int kOversizedDropsFieldNumber = 5;
+  inline ::google_public::protobuf::uint64 oversizeddrops() const;
+  inline void set_oversizeddrops(::google_public::protobuf::uint64 value);
+
+  // optional uint64 partialSends = 6;
+  inline bool has_partialsends() const;
+  inline void clear_partialsends();
+  static const int kPartialSendsFieldNumber = 6;
+  inline ::google_public::protobuf::uint64 partialsends() const;
+  inline void set_partialsends(::google_public::protobuf::uint64 value);
+
+  // optional uint64 wouldBlockErrors = 7;
+  inline bool has_wouldblockerrors() const;
+  inline void clear_wouldblockerrors();
+  static const int kWouldBlockErrorsFieldNumber = 7;
+  inline ::google_public::protobuf::uint64 wouldblockerrors() const;
+  inline void set_wouldblockerrors(::google_public::protobuf::uint64 value);
+
+  // optional uint64 noBufferErrors = 8;
+  inline bool has_nobuffererrors() const;
+  inline void clear_nobuffererrors();
+  static const int kNoBufferErrorsFieldNumber = 8;
+  inline ::google_public::protobuf::uint64 nobuffererrors() const;
+  inline void set_nobuffererrors(::google_public::protobuf::uint64 value);
+
+  // optional uint64 refusedErrors = 9;
+  inline bool has_refusederrors() const;
+  inline void clear_refusederrors();
+  static const int kRefusedErrorsFieldNumber = 9;
+  inline ::google_public::protobuf::uint64 refusederrors() const;
+  inline void set_refusederrors(::google_public::protobuf::uint64 value);
+
+  // optional uint64 unreachableErrors = 10;
+  inline bool has_unreachableerrors() const;
+  inline void clear_unreachableerrors();
+  static const int kUnreachableErrorsFieldNumber = 10;
+  inline ::google_public::protobuf::uint64 unreachableerrors() const;
+  inline void set_unreachableerrors(::google_public::protobuf::uint64 value);
+
+  // optional uint64 messageSizeErrors = 11;
+  inline bool has_messagesizeerrors() const;
+  inline void clear_messagesizeerrors();
+  static const int kMessageSizeErrorsFieldNumber = 11;
+  inline ::google_public::protobuf::uint64 messagesizeerrors() const;
+  inline void set_messagesizeerrors(::google_public::protobuf::uint64 value);
+
+  // optional uint64 otherErrors = 12;
+  inline bool has_othererrors() const;
+  inline void clear_othererrors();
+  static const int kOtherErrorsFieldNumber = 12;
+  inline ::google_public::protobuf::uint64 othererrors() const;
+  inline void set_othererrors(::google_public::protobuf::uint64 value);
+
+  // optional uint32 queueHighWater = 13;
+  inline bool has_queuehighwater() const;
+  inline void clear_queuehighwater();
+  static const int kQueueHighWaterFieldNumber = 13;
+  inline ::google_public::protobuf::uint32 queuehighwater() const;
+  inline void set_queuehighwater(::google_public::protobuf::uint32 value);
+
+  // optional int32 lastErrno = 14;
+  inline bool has_lasterrno() const;
+  inline void clear_lasterrno();
+  static const int kLastErrnoFieldNumber = 14;
+  inline ::google_public::protobuf::int32 lasterrno() const;
+  inline void set_lasterrno(::google_public::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:Stats.TransportCounters)
+ private:
+  inline void set_has_destination();
+  inline void clear_has_destination();
+  inline void set_has_packets();
+  inline void clear_has_packets();
+  inline void set_has_bytes();
+  inline void clear_has_bytes();
+  inline void set_has_notreadydrops();
+  inline void clear_has_notreadydrops();
+  inline void set_has_oversizeddrops();
+  inline void clear_has_oversizeddrops();
+  inline void set_has_partialsends();
+  inline void clear_has_partialsends();
+  inline void set_has_wouldblockerrors();
+  inline void clear_has_wouldblockerrors();
+  inline void set_has_nobuffererrors();
+  inline void clear_has_nobuffererrors();
+  inline void set_has_refusederrors();
+  inline void clear_has_refusederrors();
+  inline void set_has_unreachableerrors();
+  inline void clear_has_unreachableerrors();
+  inline void set_has_messagesizeerrors();
+  inline void clear_has_messagesizeerrors();
+  inline void set_has_othererrors();
+  inline void clear_has_othererrors();
+  inline void set_has_queuehighwater();
+  inline void clear_has_queuehighwater();
+  inline void set_has_lasterrno();
+  inline void clear_has_lasterrno();
+
+  ::google_public::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google_public::protobuf::uint64 packets_;
+  ::google_public::protobuf::uint64 bytes_;
+  ::google_public::protobuf::uint64 notreadydrops_;
+  ::google_public::protobuf::uint64 oversizeddrops_;
+  ::google_public::protobuf::uint64 partialsends_;
+  ::google_public::protobuf::uint64 wouldblockerrors_;
+  int destination_;
+  ::google_public::protobuf::uint32 queuehighwater_;
+  ::google_public::protobuf::uint64 nobuffererrors_;
+  ::google_public::protobuf::uint64 refusederrors_;
+  ::google_public::protobuf::uint64 unreachableerrors_;
+  ::google_public::protobuf::uint64 messagesizeerrors_;
+  ::google_public::protobuf::uint64 othererrors_;
+  ::google_public::protobuf::int32 lasterrno_;
+
+  mutable int _cached_size_;
+  ::google_public::protobuf::uint32 _has_bits_[(14 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalMessages_2eproto();
+  friend void protobuf_AssignDesc_SignalMessages_2eproto();
+  friend void protobuf_ShutdownFile_SignalMessages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Stats_TransportCounters* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Stats_StreamCounters : public ::google_public::protobuf::Message {
+ public:
+  Stats_StreamCounters();
+  virtual ~Stats_StreamCounters();
+
+  Stats_StreamCounters(const Stats_StreamCounters& from);
+
+  inline Stats_StreamCounters& operator=(const Stats_StreamCounters& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google_public::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google_public::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google_public::protobuf::Descriptor* descriptor();
+  static const Stats_StreamCounters& default_instance();
+
+  void Swap(Stats_StreamCounters* other);
+
+  // implements Message ----------------------------------------------
+
+  Stats_StreamCounters* New() const;
+  void CopyFrom(const ::google_public::protobuf::Message& from);
+  void MergeFrom(const ::google_public::protobuf::Message& from);
+  void CopyFrom(const Stats_StreamCounters& from);
+  void MergeFrom(const Stats_StreamCounters& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google_public::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google_public::protobuf::io::CodedOutputStream* output) const;
+  ::google_public::protobuf::uint8* SerializeWithCachedSizesToArray(::google_public::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google_public::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required .Stats.Stream stream = 1;
+  inline bool has_stream() const;
+  inline void clear_stream();
+  static const int kStreamFieldNumber = 1;
+  inline ::Stats_Stream stream() const;
+  inline void set_stream(::Stats_Stream value);
+
+  // required uint64 sent = 2;
+  inline bool has_sent() const;
+  inline void clear_sent();
+  static const int kSentFieldNumber = 2;
+  inline ::google_public::protobuf::uint64 sent() const;
+  inline void set_sent(::google_public::protobuf::uint64 value);
+
+  // required uint64 suppressed = 3;
+  inline bool has_suppressed() const;
+  inline void clear_suppressed();
+  static const int kSuppressedFieldNumber = 3;
+  inline ::google_public::protobuf::uint64 suppressed() const;
+  inline void set_suppressed(::google_public::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:Stats.StreamCounters)
+ private:
+  inline void set_has_stream();
+  inline void clear_has_stream();
+  inline void set_has_sent();
+  inline void clear_has_sent();
+  inline void set_has_suppressed();
+  inline void clear_has_suppressed();
+
+  ::google_public::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google_public::protobuf::uint64 sent_;
+  ::google_public::protobuf::uint64 suppressed_;
+  int stream_;
+
+  mutable int _cached_size_;
+  ::google_public::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalMessages_2eproto();
+  friend void protobuf_AssignDesc_SignalMessages_2eproto();
+  friend void protobuf_ShutdownFile_SignalMessages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Stats_StreamCounters* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Stats : public ::google_public::protobuf::Message {
+ public:
+  Stats();
+  virtual ~Stats();
+
+  Stats(const Stats& from);
+
+  inline Stats& operator=(const Stats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google_public::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google_public::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google_public::protobuf::Descriptor* descriptor();
+  static const Stats& default_instance();
+
+  void Swap(Stats* other);
+
+  // implements Message ----------------------------------------------
+
+  Stats* New() const;
+  void CopyFrom(const ::google_public::protobuf::Message& from);
+  void MergeFrom(const ::google_public::protobuf::Message& from);
+  void CopyFrom(const Stats& from);
+  void MergeFrom(const Stats& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google_public::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google_public::protobuf::io::CodedOutputStream* output) const;
+  ::google_public::protobuf::uint8* SerializeWithCachedSizesToArray(::google_public::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google_public::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef Stats_StageLatency StageLatency;
+  typedef Stats_TransportCounters TransportCounters;
+  typedef Stats_StreamCounters StreamCounters;
+
+  typedef Stats_Stage Stage;
+  static const Stage PROCESS_BLOCK = Stats_Stage_PROCESS_BLOCK;
+  static const Stage FFT = Stats_Stage_FFT;
+  static const Stage SERIALIZATION = Stats_Stage_SERIALIZATION;
+  static const Stage SEND = Stats_Stage_SEND;
+  static inline bool Stage_IsValid(int value) {
+    return Stats_Stage_IsValid(value);
+  }
+  static const Stage Stage_MIN =
+    Stats_Stage_Stage_MIN;
+  static const Stage Stage_MAX =
+    Stats_Stage_Stage_MAX;
+  static const int Stage_ARRAYSIZE =
+    Stats_Stage_Stage_ARRAYSIZE;
+  static inline const ::google_public::protobuf::EnumDescriptor*
+  Stage_descriptor() {
+    return Stats_Stage_descriptor();
+  }
+  static inline const ::std::string& Stage_Name(Stage value) {
+    return Stats_Stage_Name(value);
+  }
+  static inline bool Stage_Parse(const ::std::string& name,
+      Stage* value) {
+    return Stats_Stage_Parse(name, value);
+  }
+
+  typedef Stats_Destination Destination;
+  static const Destination SIGNAL_LEVEL_PORT = Stats_Destination_SIGNAL_LEVEL_PORT;
+  static const Destination SIGNAL_INSTANT_VAL_PORT = Stats_Destination_SIGNAL_INSTANT_VAL_PORT;
+  static const Destination IMPULSE_PORT = Stats_Destination_IMPULSE_PORT;
+  static const Destination TIME_INFO_PORT = Stats_Destination_TIME_INFO_PORT;
+  static const Destination FFT_PORT = Stats_Destination_FFT_PORT;
+  static const Destination STATS_PORT = Stats_Destination_STATS_PORT;
+  static const Destination OSC_PORT = Stats_Destination_OSC_PORT;
+  static const Destination MIDI_EVENT_PORT = Stats_Destination_MIDI_EVENT_PORT;
+  static inline bool Destination_IsValid(int value) {
+    return Stats_Destination_IsValid(value);
+  }
+  static const Destination Destination_MIN =
+    Stats_Destination_Destination_MIN;
+  static const Destination Destination_MAX =
+    Stats_Destination_Destination_MAX;
+  static const int Destination_ARRAYSIZE =
+    Stats_Destination_Destination_ARRAYSIZE;
+  static inline const ::google_public::protobuf::EnumDescriptor*
+  Destination_descriptor() {
+    return Stats_Destination_descriptor();
+  }
+  static inline const ::std::string& Destination_Name(Destination value) {
+    return Stats_Destination_Name(value);
+  }
+  static inline bool Destination_Parse(const ::std::string& name,
+      Destination* value) {
+    return Stats_Destination_Parse(name, value);
+  }
+
+  typedef Stats_Stream Stream;
+  static const Stream SIGNAL_LEVEL_STREAM = Stats_Stream_SIGNAL_LEVEL_STREAM;
+  static const Stream SIGNAL_INSTANT_VAL_STREAM = Stats_Stream_SIGNAL_INSTANT_VAL_STREAM;
+  static const Stream FFT_STREAM = Stats_Stream_FFT_STREAM;
+  static inline bool Stream_IsValid(int value) {
+    return Stats_Stream_IsValid(value);
+  }
+  static const Stream Stream_MIN =
+    Stats_Stream_Stream_MIN;
+  static const Stream Stream_MAX =
+    Stats_Stream_Stream_MAX;
+  static const int Stream_ARRAYSIZE =
+    Stats_Stream_Stream_ARRAYSIZE;
+  static inline const ::google_public::protobuf::EnumDescriptor*
+  Stream_descriptor() {
+    return Stats_Stream_descriptor();
+  }
+  static inline const ::std::string& Stream_Name(Stream value) {
+    return Stats_Stream_Name(value);
+  }
+  static inline bool Stream_Parse(const ::std::string& name,
+      Stream* value) {
+    return Stats_Stream_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // required int32 signalID = 1 [default = 1];
+  inline bool has_signalid() const;
+  inline void clear_signalid();
+  static const int kSignalIDFieldNumber = 1;
+  inline ::google_public::protobuf::int32 signalid() const;
+  inline void set_signalid(::google_public::protobuf::int32 value);
+
+  // repeated .Stats.StageLatency stages = 2;
+  inline int stages_size() const;
+  inline void clear_stages();
+  static const int kStagesFieldNumber = 2;
+  inline const ::Stats_StageLatency& stages(int index) const;
+  inline ::Stats_StageLatency* mutable_stages(int index);
+  inline ::Stats_StageLatency* add_stages();
+  inline const ::google_public::protobuf::RepeatedPtrField< ::Stats_StageLatency >&
+      stages() const;
+  inline ::google_public::protobuf::RepeatedPtrField< ::Stats_StageLatency >*
+      mutable_stages();
+
+  // required float deadlineUtilization = 3;
+  inline bool has_deadlineutilization() const;
+  inline void clear_deadlineutilization();
+  static const int kDeadlineUtilizationFieldNumber = 3;
+  inline float deadlineutilization() const;
+  inline void set_deadlineutilization(float value);
+
+  // required float maxDeadlineUtilization = 4;
+  inline bool has_maxdeadlineutilization() const;
+  inline void clear_maxdeadlineutilization();
+  static const int kMaxDeadlineUtilizationFieldNumber = 4;
+  inline float maxdeadlineutilization() const;
+  inline void set_maxdeadlineutilization(float value);
+
+  // required uint32 xrunRiskCount = 5;
+  inline bool has_xrunriskcount() const;
+  inline void clear_xrunriskcount();
+  static const int kXrunRiskCountFieldNumber = 5;
+  inline ::google_public::protobuf::uint32 xrunriskcount() const;
+  inline void set_xrunriskcount(::google_public::protobuf::uint32 value);
+
+  // required uint32 nbOfBlocks = 6;
+  inline bool has_nbofblocks() const;
+  inline void clear_nbofblocks();
+  static const int kNbOfBlocksFieldNumber = 6;
+  inline ::google_public::protobuf::uint32 nbofblocks() const;
+  inline void set_nbofblocks(::google_public::protobuf::uint32 value);
+
+  // repeated .Stats.TransportCounters transports = 7;
+  inline int transports_size() const;
+  inline void clear_transports();
+  static const int kTransportsFieldNumber = 7;
+  inline const ::Stats_TransportCounters& transports(int index) const;
+  inline ::Stats_TransportCounters* mutable_transports(int index);
+  inline ::Stats_TransportCounters* add_transports();
+  inline const ::google_public::protobuf::RepeatedPtrField< ::Stats_TransportCounters >&
+      transports() const;
+  inline ::google_public::protobuf::RepeatedPtrField< ::Stats_TransportCounters >*
+      mutable_transports();
+
+  // repeated .Stats.StreamCounters streams = 8;
+  inline int streams_size() const;
+  inline void clear_streams();
+  static const int kStreamsFieldNumber = 8;
+  inline const ::Stats_StreamCounters& streams(int index) const;
+  inline ::Stats_StreamCounters* mutable_streams(int index);
+  inline ::Stats_StreamCounters* add_streams();
+  inline const ::google_public::protobuf::RepeatedPtrField< ::Stats_StreamCounters >&
+      streams() const;
+  inline ::google_public::protobuf::RepeatedPtrField< ::Stats_StreamCounters >*
+      mutable_streams();
+
+  // @@protoc_insertion_point(class_scope:Stats)
+ private:
+  inline void set_has_signalid();
+  inline void clear_has_signalid();
+  inline void set_has_deadlineutilization();
+  inline void clear_has_deadlineutilization();
+  inline void set_has_maxdeadlineutilization();
+  inline void clear_has_maxdeadlineutilization();
+  inline void set_has_xrunriskcount();
+  inline void clear_has_xrunriskcount();
+  inline void set_has_nbofblocks();
+  inline void clear_has_nbofblocks();
+
+  ::google_public::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google_public::protobuf::RepeatedPtrField< ::Stats_StageLatency > stages_;
+  ::google_public::protobuf::int32 signalid_;
+  float deadlineutilization_;
+  float maxdeadlineutilization_;
+  ::google_public::protobuf::uint32 xrunriskcount_;
+  ::google_public::protobuf::RepeatedPtrField< ::Stats_TransportCounters > transports_;
+  ::google_public::protobuf::RepeatedPtrField< ::Stats_StreamCounters > streams_;
+  ::google_public::protobuf::uint32 nbofblocks_;
+
+  mutable int _cached_size_;
+  ::google_public::protobuf::uint32 _has_bits_[(8 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalMessages_2eproto();
+  friend void protobuf_AssignDesc_SignalMessages_2eproto();
+  friend void protobuf_ShutdownFile_SignalMessages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Stats* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// SignalLevel
+
+// required int32 signalID = 1 [default = 1];
+inline bool SignalLevel::has_signalid() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void SignalLevel::set_has_signalid() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void SignalLevel::clear_has_signalid() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void SignalLevel::clear_signalid() {
+  signalid_ = 1;
+  clear_has_signalid();
+}
+inline ::google_public::protobuf::int32 SignalLevel::signalid() const {
+  return signalid_;
+}
+inline void SignalLevel::set_signalid(::google_public::protobuf::int32 value) {
+  set_has_signalid();
+  signalid_ = value;
+}
+
+// required float signalLevel = 2 [default = 0];
+inline bool SignalLevel::has_signallevel() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void SignalLevel::set_has_signallevel() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void SignalLevel::clear_has_signallevel() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void SignalLevel::clear_signallevel() {
+  signallevel_ = 0;
+  clear_has_signallevel();
+}
+inline float SignalLevel::signallevel() const {
+  return signallevel_;
+}
+inline void SignalLevel::set_signallevel(float value) {
+  set_has_signallevel();
+  signallevel_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// SignalInstantVal
+
+// required int32 signalID = 1 [default = 1];
+inline bool SignalInstantVal::has_signalid() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void SignalInstantVal::set_has_signalid() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void SignalInstantVal::clear_has_signalid() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void SignalInstantVal::clear_signalid() {
+  signalid_ = 1;
+  clear_has_signalid();
+}
+inline ::google_public::protobuf::int32 SignalInstantVal::signalid() const {
+  return signalid_;
+}
+inline void SignalInstantVal::set_signalid(::google_public::protobuf::int32 value) {
+  set_has_signalid();
+  signalid_ = value;
+}
+
+// required float signalInstantVal = 2 [default = 0];
+inline bool SignalInstantVal::has_signalinstantval() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void SignalInstantVal::set_has_signalinstantval() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void SignalInstantVal::clear_has_signalinstantval() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void SignalInstantVal::clear_signalinstantval() {
+  signalinstantval_ = 0;
+  clear_has_signalinstantval();
+}
+inline float SignalInstantVal::signalinstantval() const {
+  return signalinstantval_;
+}
+inline void SignalInstantVal::set_signalinstantval(float value) {
+  set_has_signalinstantval();
+  signalinstantval_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// Impulse
+
+// required int32 signalID = 1 [default = 1];
+inline bool Impulse::has_signalid() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Impulse::set_has_signalid() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Impulse::clear_has_signalid() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Impulse::clear_signalid() {
+  signalid_ = 1;
+  clear_has_signalid();
+}
+inline ::google_public::protobuf::int32 Impulse::signalid() const {
+  return signalid_;
+}
+inline void Impulse::set_signalid(::google_public::protobuf::int32 value) {
+  set_has_signalid();
+  signalid_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// LinearFFT
+
+// required int32 signalID = 1 [default = 1];
+inline bool LinearFFT::has_signalid() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void LinearFFT::set_has_signalid() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void LinearFFT::clear_has_signalid() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void LinearFFT::clear_signalid() {
+  signalid_ = 1;
+  clear_has_signalid();
+}
+inline ::google_public::protobuf::int32 LinearFFT::signalid() const {
+  return signalid_;
+}
+inline void LinearFFT::set_signalid(::google_public::protobuf::int32 value) {
+  set_has_signalid();
+  signalid_ = value;
+}
+
+// required float fundamentalFreq = 2 [default = 0];
+inline bool LinearFFT::has_fundamentalfreq() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void LinearFFT::set_has_fundamentalfreq() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void LinearFFT::clear_has_fundamentalfreq() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void LinearFFT::clear_fundamentalfreq() {
+  fundamentalfreq_ = 0;
+  clear_has_fundamentalfreq();
+}
+inline float LinearFFT::fundamentalfreq() const {
+  return fundamentalfreq_;
+}
+inline void LinearFFT::set_fundamentalfreq(float value) {
+  set_has_fundamentalfreq();
+  fundamentalfreq_ = value;
+}
+
+// repeated float data = 3 [packed = true];
+inline int LinearFFT::data_size() const {
+  return data_.size();
+}
+inline void LinearFFT::clear_data() {
+  data_.Clear();
+}
+inline float LinearFFT::data(int index) const {
+  return data_.Get(index);
+}
+inline void LinearFFT::set_data(int index, float value) {
+  data_.Set(index, value);
+}
+inline void LinearFFT::add_data(float value) {
+  data_.Add(value);
+}
+inline const ::google_public::protobuf::RepeatedField< float >&
+LinearFFT::data() const {
+  return data_;
+}
+inline ::google_public::protobuf::RepeatedField< float >*
+LinearFFT::mutable_data() {
+  return &data_;
+}
+
+// -------------------------------------------------------------------
+
+// LogFFT
+
+// optional int32 signalID = 1 [default = 1];
+inline bool LogFFT::has_signalid() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void LogFFT::set_has_signalid() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void LogFFT::clear_has_signalid() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void LogFFT::clear_signalid() {
+  signalid_ = 1;
+  clear_has_signalid();
+}
+inline ::google_public::protobuf::int32 LogFFT::signalid() const {
+  return signalid_;
+}
+inline void LogFFT::set_signalid(::google_public::protobuf::int32 value) {
+  set_has_signalid();
+  signalid_ = value;
+}
+
+// optional float fundamentalFreq = 2;
+inline bool LogFFT::has_fundamentalfreq() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void LogFFT::set_has_fundamentalfreq() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void LogFFT::clear_has_fundamentalfreq() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void LogFFT::clear_fundamentalfreq() {
+  fundamentalfreq_ = 0;
+  clear_has_fundamentalfreq();
+}
+inline float LogFFT::fundamentalfreq() const {
+  return fundamentalfreq_;
+}
+inline void LogFFT::set_fundamentalfreq(float value) {
+  set_has_fundamentalfreq();
+  fundamentalfreq_ = value;
+}
+
+// optional float band1 = 3;
+inline bool LogFFT::has_band1() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void LogFFT::set_has_band1() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void LogFFT::clear_has_band1() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void LogFFT::clear_band1() {
+  band1_ = 0;
+  clear_has_band1();
+}
+inline float LogFFT::band1() const {
+  return band1_;
+}
+inline void LogFFT::set_band1(float value) {
+  set_has_band1();
+  band1_ = value;
+}
+
+// optional float band2 = 4;
+inline bool LogFFT::has_band2() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void LogFFT::set_has_band2() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void LogFFT::clear_has_band2() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void LogFFT::clear_band2() {
+  band2_ = 0;
+  clear_has_band2();
+}
+inline float LogFFT::band2() const {
+  return band2_;
+}
+inline void LogFFT::set_band2(float value) {
+  set_has_band2();
+  band2_ = value;
+}
+
+// optional float band3 = 5;
+inline bool LogFFT::has_band3() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void LogFFT::set_has_band3() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void LogFFT::clear_has_band3() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void LogFFT::clear_band3() {
+  band3_ = 0;
+  clear_has_band3();
+}
+inline float LogFFT::band3() const {
+  return band3_;
+}
+inline void LogFFT::set_band3(float value) {
+  set_has_band3();
+  band3_ = value;
+}
+
+// optional float band4 = 6;
+inline bool LogFFT::has_band4() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void LogFFT::set_has_band4() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void LogFFT::clear_has_band4() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void LogFFT::clear_band4() {
+  band4_ = 0;
+  clear_has_band4();
+}
+inline float LogFFT::band4() const {
+  return band4_;
+}
+inline void LogFFT::set_band4(float value) {
+  set_has_band4();
+  band4_ = value;
+}
+
+// optional float band5 = 7;
+inline bool LogFFT::has_band5() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void LogFFT::set_has_band5() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void LogFFT::clear_has_band5() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void LogFFT::clear_band5() {
+  band5_ = 0;
+  clear_has_band5();
+}
+inline float LogFFT::band5() const {
+  return band5_;
+}
+inline void LogFFT::set_band5(float value) {
+  set_has_band5();
+  band5_ = value;
+}
+
+// optional float band6 = 8;
+inline bool LogFFT::has_band6() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void LogFFT::set_has_band6() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void LogFFT::clear_has_band6() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void LogFFT::clear_band6() {
+  band6_ = 0;
+  clear_has_band6();
+}
+inline float LogFFT::band6() const {
+  return band6_;
+}
+inline void LogFFT::set_band6(float value) {
+  set_has_band6();
+  band6_ = value;
+}
+
+// optional float band7 = 9;
+inline bool LogFFT::has_band7() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void LogFFT::set_has_band7() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void LogFFT::clear_has_band7() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void LogFFT::clear_band7() {
+  band7_ = 0;
+  clear_has_band7();
+}
+inline float LogFFT::band7() const {
+  return band7_;
+}
+inline void LogFFT::set_band7(float value) {
+  set_has_band7();
+  band7_ = value;
+}
+
+// optional float band8 = 10;
+inline bool LogFFT::has_band8() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void LogFFT::set_has_band8() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void LogFFT::clear_has_band8() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void LogFFT::clear_band8() {
+  band8_ = 0;
+  clear_has_band8();
+}
+inline float LogFFT::band8() const {
+  return band8_;
+}
+inline void LogFFT::set_band8(float value) {
+  set_has_band8();
+  band8_ = value;
+}
+
+// optional float band9 = 11;
+inline bool LogFFT::has_band9() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void LogFFT::set_has_band9() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void LogFFT::clear_has_band9() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void LogFFT::clear_band9() {
+  band9_ = 0;
+  clear_has_band9();
+}
+inline float LogFFT::band9() const {
+  return band9_;
+}
+inline void LogFFT::set_band9(float value) {
+  set_has_band9();
+  band9_ = value;
+}
+
+// optional float band10 = 12;
+inline bool LogFFT::has_band10() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void LogFFT::set_has_band10() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void LogFFT::clear_has_band10() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void LogFFT::clear_band10() {
+  band10_ = 0;
+  clear_has_band10();
+}
+inline float LogFFT::band10() const {
+  return band10_;
+}
+inline void LogFFT::set_band10(float value) {
+  set_has_band10();
+  band10_ = value;
+}
+
+// optional float band11 = 13;
+inline bool LogFFT::has_band11() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void LogFFT::set_has_band11() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void LogFFT::clear_has_band11() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void LogFFT::clear_band11() {
+  band11_ = 0;
+  clear_has_band11();
+}
+inline float LogFFT::band11() const {
+  return band11_;
+}
+inline void LogFFT::set_band11(float value) {
+  set_has_band11();
+  band11_ = value;
+}
+
+// optional float band12 = 14;
+inline bool LogFFT::has_band12() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void LogFFT::set_has_band12() {
+  _has_bits_[0] |= 0x00002000u;
+}
+inline void LogFFT::clear_has_band12() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline void LogFFT::clear_band12() {
+  band12_ = 0;
+  clear_has_band12();
+}
+inline float LogFFT::band12() const {
+  return band12_;
+}
+inline void LogFFT::set_band12(float value) {
+  set_has_band12();
+  band12_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TimeInfo
+
+// required bool isPlaying = 1 [default = false];
+inline bool TimeInfo::has_isplaying() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void LogFFT::clear_has_fundamentalfreq() {
+inline void TimeInfo::set_has_isplaying() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TimeInfo::clear_has_isplaying() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TimeInfo::clear_isplaying() {
+  isplaying_ = false;
+  clear_has_isplaying();
+}
+inline bool TimeInfo::isplaying() const {
+  return isplaying_;
+}
+inline void TimeInfo::set_isplaying(bool value) {
+  set_has_isplaying();
+  isplaying_ = value;
+}
+
+// required float tempo = 2 [default = 0];
+inline bool TimeInfo::has_tempo() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TimeInfo::set_has_tempo() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TimeInfo::clear_has_tempo() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void LogFFT::clear_fundamentalfreq() {
-  fundamentalfreq_ = 0;
-  clear_has_fundamentalfreq();
+inline void TimeInfo::clear_tempo() {
+  tempo_ = 0;
+  clear_has_tempo();
 }
-inline float LogFFT::fundamentalfreq() const {
-  return fundamentalfreq_;
+inline float TimeInfo::tempo() const {
+  return tempo_;
 }
-inline void LogFFT::set_fundamentalfreq(float value) {
-  set_has_fundamentalfreq();
-  fundamentalfreq_ = value;
+inline void TimeInfo::set_tempo(float value) {
+  set_has_tempo();
+  tempo_ = value;
 }
 
-// optional float band1 = 3;
-inline bool LogFFT::has_band1() const {
+// required float position = 3 [default = 0];
+inline bool TimeInfo::has_position() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void LogFFT::set_has_band1() {
+inline void TimeInfo::set_has_position() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void LogFFT::clear_has_band1() {
+inline void TimeInfo::clear_has_position() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void LogFFT::clear_band1() {
-  band1_ = 0;
-  clear_has_band1();
+inline void TimeInfo::clear_position() {
+  position_ = 0;
+  clear_has_position();
 }
-inline float LogFFT::band1() const {
-  return band1_;
+inline float TimeInfo::position() const {
+  return position_;
 }
-inline void LogFFT::set_band1(float value) {
-  set_has_band1();
-  band1_ = value;
+inline void TimeInfo::set_position(float value) {
+  set_has_position();
+  position_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// MidiEvent_Event
+
+// required int32 sampleOffset = 1;
+inline bool MidiEvent_Event::has_sampleoffset() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void MidiEvent_Event::set_has_sampleoffset() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void MidiEvent_Event::clear_has_sampleoffset() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void MidiEvent_Event::clear_sampleoffset() {
+  sampleoffset_ = 0;
+  clear_has_sampleoffset();
+}
+inline ::google_public::protobuf::int32 MidiEvent_Event::sampleoffset() const {
+  return sampleoffset_;
+}
+inline void MidiEvent_Event::set_sampleoffset(::google_public::protobuf::int32 value) {
+  set_has_sampleoffset();
+  sampleoffset_ = value;
+}
+
+// required int64 timeInSamples = 2;
+inline bool MidiEvent_Event::has_timeinsamples() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void MidiEvent_Event::set_has_timeinsamples() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void MidiEvent_Event::clear_has_timeinsamples() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void MidiEvent_Event::clear_timeinsamples() {
+  timeinsamples_ = GOOGLE_LONGLONG(0);
+  clear_has_timeinsamples();
+}
+inline ::google_public::protobuf::int64 MidiEvent_Event::timeinsamples() const {
+  return timeinsamples_;
+}
+inline void MidiEvent_Event::set_timeinsamples(::google_public::protobuf::int64 value) {
+  set_has_timeinsamples();
+  timeinsamples_ = value;
+}
+
+// optional double ppqPosition = 3;
+inline bool MidiEvent_Event::has_ppqposition() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MidiEvent_Event::set_has_ppqposition() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MidiEvent_Event::clear_has_ppqposition() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MidiEvent_Event::clear_ppqposition() {
+  ppqposition_ = 0;
+  clear_has_ppqposition();
+}
+inline double MidiEvent_Event::ppqposition() const {
+  return ppqposition_;
+}
+inline void MidiEvent_Event::set_ppqposition(double value) {
+  set_has_ppqposition();
+  ppqposition_ = value;
+}
+
+// required bytes data = 4;
+inline bool MidiEvent_Event::has_data() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void MidiEvent_Event::set_has_data() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void MidiEvent_Event::clear_has_data() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void MidiEvent_Event::clear_data() {
+  if (data_ != &::google_public::protobuf::internal::kEmptyString) {
+    data_->clear();
+  }
+  clear_has_data();
+}
+inline const ::std::string& MidiEvent_Event::data() const {
+  return *data_;
+}
+inline void MidiEvent_Event::set_data(const ::std::string& value) {
+  set_has_data();
+  if (data_ == &::google_public::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+}
+inline void MidiEvent_Event::set_data(const char* value) {
+  set_has_data();
+  if (data_ == &::google_public::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+}
+inline void MidiEvent_Event::set_data(const void* value, size_t size) {
+  set_has_data();
+  if (data_ == &::google_public::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  data_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* MidiEvent_Event::mutable_data() {
+  set_has_data();
+  if (data_ == &::google_public::protobuf::internal::kEmptyString) {
+    data_ = new ::std::string;
+  }
+  return data_;
+}
+inline ::std::string* MidiEvent_Event::release_data() {
+  clear_has_data();
+  if (data_ == &::google_public::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = data_;
+    data_ = const_cast< ::std::string*>(&::google_public::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void MidiEvent_Event::set_allocated_data(::std::string* data) {
+  if (data_ != &::google_public::protobuf::internal::kEmptyString) {
+    delete data_;
+  }
+  if (data) {
+    set_has_data();
+    data_ = data;
+  } else {
+    clear_has_data();
+    data_ = const_cast< ::std::string*>(&::google_public::protobuf::internal::kEmptyString);
+  }
+}
+
+// -------------------------------------------------------------------
+
+// MidiEvent
+
+// required int32 signalID = 1 [default = 1];
+inline bool MidiEvent::has_signalid() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void MidiEvent::set_has_signalid() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void MidiEvent::clear_has_signalid() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void MidiEvent::clear_signalid() {
+  signalid_ = 1;
+  clear_has_signalid();
+}
+inline ::google_public::protobuf::int32 MidiEvent::signalid() const {
+  return signalid_;
+}
+inline void MidiEvent::set_signalid(::google_public::protobuf::int32 value) {
+  set_has_signalid();
+  signalid_ = value;
+}
+
+// required bool isPlaying = 2 [default = false];
+inline bool MidiEvent::has_isplaying() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void MidiEvent::set_has_isplaying() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void MidiEvent::clear_has_isplaying() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void MidiEvent::clear_isplaying() {
+  isplaying_ = false;
+  clear_has_isplaying();
+}
+inline bool MidiEvent::isplaying() const {
+  return isplaying_;
+}
+inline void MidiEvent::set_isplaying(bool value) {
+  set_has_isplaying();
+  isplaying_ = value;
+}
+
+// repeated .MidiEvent.Event events = 3;
+inline int MidiEvent::events_size() const {
+  return events_.size();
+}
+inline void MidiEvent::clear_events() {
+  events_.Clear();
+}
+inline const ::MidiEvent_Event& MidiEvent::events(int index) const {
+  return events_.Get(index);
+}
+inline ::MidiEvent_Event* MidiEvent::mutable_events(int index) {
+  return events_.Mutable(index);
+}
+inline ::MidiEvent_Event* MidiEvent::add_events() {
+  return events_.Add();
+}
+inline const ::google_public::protobuf::RepeatedPtrField< ::MidiEvent_Event >&
+MidiEvent::events() const {
+  return events_;
+}
+inline ::google_public::protobuf::RepeatedPtrField< ::MidiEvent_Event >*
+MidiEvent::mutable_events() {
+  return &events_;
+}
+
+// -------------------------------------------------------------------
+
+// Stats_StageLatency
+
+// required .Stats.Stage stage = 1;
+inline bool Stats_StageLatency::has_stage() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Stats_StageLatency::set_has_stage() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Stats_StageLatency::clear_has_stage() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Stats_StageLatency::clear_stage() {
+  stage_ = 0;
+  clear_has_stage();
+}
+inline ::Stats_Stage Stats_StageLatency::stage() const {
+  return static_cast< ::Stats_Stage >(stage_);
+}
+inline void Stats_StageLatency::set_stage(::Stats_Stage value) {
+  assert(::Stats_Stage_IsValid(value));
+  set_has_stage();
+  stage_ = value;
+}
+
+// required uint32 count = 2;
+inline bool Stats_StageLatency::has_count() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Stats_StageLatency::set_has_count() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Stats_StageLatency::clear_has_count() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Stats_StageLatency::clear_count() {
+  count_ = 0u;
+  clear_has_count();
+}
+inline ::google_public::protobuf::uint32 Stats_StageLatency::count() const {
+  return count_;
+}
+inline void Stats_StageLatency::set_count(::google_public::protobuf::uint32 value) {
+  set_has_count();
+  count_ = value;
+}
+
+// required float p50 = 3;
+inline bool Stats_StageLatency::has_p50() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Stats_StageLatency::set_has_p50() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Stats_StageLatency::clear_has_p50() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Stats_StageLatency::clear_p50() {
+  p50_ = 0;
+  clear_has_p50();
+}
+inline float Stats_StageLatency::p50() const {
+  return p50_;
+}
+inline void Stats_StageLatency::set_p50(float value) {
+  set_has_p50();
+  p50_ = value;
+}
+
+// required float p99 = 4;
+inline bool Stats_StageLatency::has_p99() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Stats_StageLatency::set_has_p99() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void Stats_StageLatency::clear_has_p99() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void Stats_StageLatency::clear_p99() {
+  p99_ = 0;
+  clear_has_p99();
+}
+inline float Stats_StageLatency::p99() const {
+  return p99_;
+}
+inline void Stats_StageLatency::set_p99(float value) {
+  set_has_p99();
+  p99_ = value;
+}
+
+// required float max = 5;
+inline bool Stats_StageLatency::has_max() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void Stats_StageLatency::set_has_max() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void Stats_StageLatency::clear_has_max() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void Stats_StageLatency::clear_max() {
+  max_ = 0;
+  clear_has_max();
+}
+inline float Stats_StageLatency::max() const {
+  return max_;
+}
+inline void Stats_StageLatency::set_max(float value) {
+  set_has_max();
+  max_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// Stats_TransportCounters
+
+// required .Stats.Destination destination = 1;
+inline bool Stats_TransportCounters::has_destination() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Stats_TransportCounters::set_has_destination() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Stats_TransportCounters::clear_has_destination() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Stats_TransportCounters::clear_destination() {
+  destination_ = 0;
+  clear_has_destination();
+}
+inline ::Stats_Destination Stats_TransportCounters::destination() const {
+  return static_cast< ::Stats_Destination >(destination_);
+}
+inline void Stats_TransportCounters::set_destination(::Stats_Destination value) {
+  assert(::Stats_Destination_IsValid(value));
+  set_has_destination();
+  destination_ = value;
+}
+
+// required uint64 packets = 2;
+inline bool Stats_TransportCounters::has_packets() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Stats_TransportCounters::set_has_packets() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Stats_TransportCounters::clear_has_packets() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Stats_TransportCounters::clear_packets() {
+  packets_ = GOOGLE_ULONGLONG(0);
+  clear_has_packets();
+}
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::packets() const {
+  return packets_;
+}
+inline void Stats_TransportCounters::set_packets(::google_public::protobuf::uint64 value) {
+  set_has_packets();
+  packets_ = value;
+}
+
+// required uint64 bytes = 3;
+inline bool Stats_TransportCounters::has_bytes() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Stats_TransportCounters::set_has_bytes() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Stats_TransportCounters::clear_has_bytes() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Stats_TransportCounters::clear_bytes() {
+  bytes_ = GOOGLE_ULONGLONG(0);
+  clear_has_bytes();
+}
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::bytes() const {
+  return bytes_;
+}
+inline void Stats_TransportCounters::set_bytes(::google_public::protobuf::uint64 value) {
+  set_has_bytes();
+  bytes_ = value;
 }
 
-// optional float band2 = 4;
-inline bool LogFFT::has_band2() const {
+// optional uint64 notReadyDrops = 4;
+inline bool Stats_TransportCounters::has_notreadydrops() const {
   return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void LogFFT::set_has_band2() {
+inline void Stats_TransportCounters::set_has_notreadydrops() {
   _has_bits_[0] |= 0x00000008u;
 }
-inline void LogFFT::clear_has_band2() {
+inline void Stats_TransportCounters::clear_has_notreadydrops() {
   _has_bits_[0] &= ~0x00000008u;
 }
-inline void LogFFT::clear_band2() {
-  band2_ = 0;
-  clear_has_band2();
+inline void Stats_TransportCounters::clear_notreadydrops() {
+  notreadydrops_ = GOOGLE_ULONGLONG(0);
+  clear_has_notreadydrops();
 }
-inline float LogFFT::band2() const {
-  return band2_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::notreadydrops() const {
+  return notreadydrops_;
 }
-inline void LogFFT::set_band2(float value) {
-  set_has_band2();
-  band2_ = value;
+inline void Stats_TransportCounters::set_notreadydrops(::google_public::protobuf::uint64 value) {
+  set_has_notreadydrops();
+  notreadydrops_ = value;
 }
 
-// optional float band3 = 5;
-inline bool LogFFT::has_band3() const {
+// optional uint64 oversizedDrops = 5;
+inline bool Stats_TransportCounters::has_oversizeddrops() const {
   return (_has_bits_[0] & 0x00000010u) != 0;
 }
-inline void LogFFT::set_has_band3() {
+inline void Stats_TransportCounters::set_has_oversizeddrops() {
   _has_bits_[0] |= 0x00000010u;
 }
-inline void LogFFT::clear_has_band3() {
+inline void Stats_TransportCounters::clear_has_oversizeddrops() {
   _has_bits_[0] &= ~0x00000010u;
 }
-inline void LogFFT::clear_band3() {
-  band3_ = 0;
-  clear_has_band3();
+inline void Stats_TransportCounters::clear_oversizeddrops() {
+  oversizeddrops_ = GOOGLE_ULONGLONG(0);
+  clear_has_oversizeddrops();
 }
-inline float LogFFT::band3() const {
-  return band3_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::oversizeddrops() const {
+  return oversizeddrops_;
 }
-inline void LogFFT::set_band3(float value) {
-  set_has_band3();
-  band3_ = value;
+inline void Stats_TransportCounters::set_oversizeddrops(::google_public::protobuf::uint64 value) {
+  set_has_oversizeddrops();
+  oversizeddrops_ = value;
 }
 
-// optional float band4 = 6;
-inline bool LogFFT::has_band4() const {
+// optional uint64 partialSends = 6;
+inline bool Stats_TransportCounters::has_partialsends() const {
   return (_has_bits_[0] & 0x00000020u) != 0;
 }
-inline void LogFFT::set_has_band4() {
+inline void Stats_TransportCounters::set_has_partialsends() {
   _has_bits_[0] |= 0x00000020u;
 }
-inline void LogFFT::clear_has_band4() {
+inline void Stats_TransportCounters::clear_has_partialsends() {
   _has_bits_[0] &= ~0x00000020u;
 }
-inline void LogFFT::clear_band4() {
-  band4_ = 0;
-  clear_has_band4();
+inline void Stats_TransportCounters::clear_partialsends() {
+  partialsends_ = GOOGLE_ULONGLONG(0);
+  clear_has_partialsends();
 }
-inline float LogFFT::band4() const {
-  return band4_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::partialsends() const {
+  return partialsends_;
 }
-inline void LogFFT::set_band4(float value) {
-  set_has_band4();
-  band4_ = value;
+inline void Stats_TransportCounters::set_partialsends(::google_public::protobuf::uint64 value) {
+  set_has_partialsends();
+  partialsends_ = value;
 }
 
-// optional float band5 = 7;
-inline bool LogFFT::has_band5() const {
+// optional uint64 wouldBlockErrors = 7;
+inline bool Stats_TransportCounters::has_wouldblockerrors() const {
   return (_has_bits_[0] & 0x00000040u) != 0;
 }
-inline void LogFFT::set_has_band5() {
+inline void Stats_TransportCounters::set_has_wouldblockerrors() {
   _has_bits_[0] |= 0x00000040u;
 }
-inline void LogFFT::clear_has_band5() {
+inline void Stats_TransportCounters::clear_has_wouldblockerrors() {
   _has_bits_[0] &= ~0x00000040u;
 }
-inline void LogFFT::clear_band5() {
-  band5_ = 0;
-  clear_has_band5();
+inline void Stats_TransportCounters::clear_wouldblockerrors() {
+  wouldblockerrors_ = GOOGLE_ULONGLONG(0);
+  clear_has_wouldblockerrors();
 }
-inline float LogFFT::band5() const {
-  return band5_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::wouldblockerrors() const {
+  return wouldblockerrors_;
 }
-inline void LogFFT::set_band5(float value) {
-  set_has_band5();
-  band5_ = value;
+inline void Stats_TransportCounters::set_wouldblockerrors(::google_public::protobuf::uint64 value) {
+  set_has_wouldblockerrors();
+  wouldblockerrors_ = value;
 }
 
-// optional float band6 = 8;
-inline bool LogFFT::has_band6() const {
+// optional uint64 noBufferErrors = 8;
+inline bool Stats_TransportCounters::has_nobuffererrors() const {
   return (_has_bits_[0] & 0x00000080u) != 0;
 }
-inline void LogFFT::set_has_band6() {
+inline void Stats_TransportCounters::set_has_nobuffererrors() {
   _has_bits_[0] |= 0x00000080u;
 }
-inline void LogFFT::clear_has_band6() {
+inline void Stats_TransportCounters::clear_has_nobuffererrors() {
   _has_bits_[0] &= ~0x00000080u;
 }
-inline void LogFFT::clear_band6() {
-  band6_ = 0;
-  clear_has_band6();
+inline void Stats_TransportCounters::clear_nobuffererrors() {
+  nobuffererrors_ = GOOGLE_ULONGLONG(0);
+  clear_has_nobuffererrors();
 }
-inline float LogFFT::band6() const {
-  return band6_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::nobuffererrors() const {
+  return nobuffererrors_;
 }
-inline void LogFFT::set_band6(float value) {
-  set_has_band6();
-  band6_ = value;
+inline void Stats_TransportCounters::set_nobuffererrors(::google_public::protobuf::uint64 value) {
+  set_has_nobuffererrors();
+  nobuffererrors_ = value;
 }
 
-// optional float band7 = 9;
-inline bool LogFFT::has_band7() const {
+// optional uint64 refusedErrors = 9;
+inline bool Stats_TransportCounters::has_refusederrors() const {
   return (_has_bits_[0] & 0x00000100u) != 0;
 }
-inline void LogFFT::set_has_band7() {
+inline void Stats_TransportCounters::set_has_refusederrors() {
   _has_bits_[0] |= 0x00000100u;
 }
-inline void LogFFT::clear_has_band7() {
+inline void Stats_TransportCounters::clear_has_refusederrors() {
   _has_bits_[0] &= ~0x00000100u;
 }
-inline void LogFFT::clear_band7() {
-  band7_ = 0;
-  clear_has_band7();
+inline void Stats_TransportCounters::clear_refusederrors() {
+  refusederrors_ = GOOGLE_ULONGLONG(0);
+  clear_has_refusederrors();
 }
-inline float LogFFT::band7() const {
-  return band7_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::refusederrors() const {
+  return refusederrors_;
 }
-inline void LogFFT::set_band7(float value) {
-  set_has_band7();
-  band7_ = value;
+inline void Stats_TransportCounters::set_refusederrors(::google_public::protobuf::uint64 value) {
+  set_has_refusederrors();
+  refusederrors_ = value;
 }
 
-// optional float band8 = 10;
-inline bool LogFFT::has_band8() const {
+// optional uint64 unreachableErrors = 10;
+inline bool Stats_TransportCounters::has_unreachableerrors() const {
   return (_has_bits_[0] & 0x00000200u) != 0;
 }
-inline void LogFFT::set_has_band8() {
+inline void Stats_TransportCounters::set_has_unreachableerrors() {
   _has_bits_[0] |= 0x00000200u;
 }
-inline void LogFFT::clear_has_band8() {
+inline void Stats_TransportCounters::clear_has_unreachableerrors() {
   _has_bits_[0] &= ~0x00000200u;
 }
-inline void LogFFT::clear_band8() {
-  band8_ = 0;
-  clear_has_band8();
+inline void Stats_TransportCounters::clear_unreachableerrors() {
+  unreachableerrors_ = GOOGLE_ULONGLONG(0);
+  clear_has_unreachableerrors();
 }
-inline float LogFFT::band8() const {
-  return band8_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::unreachableerrors() const {
+  return unreachableerrors_;
 }
-inline void LogFFT::set_band8(float value) {
-  set_has_band8();
-  band8_ = value;
+inline void Stats_TransportCounters::set_unreachableerrors(::google_public::protobuf::uint64 value) {
+  set_has_unreachableerrors();
+  unreachableerrors_ = value;
 }
 
-// optional float band9 = 11;
-inline bool LogFFT::has_band9() const {
+// optional uint64 messageSizeErrors = 11;
+inline bool Stats_TransportCounters::has_messagesizeerrors() const {
   return (_has_bits_[0] & 0x00000400u) != 0;
 }
-inline void LogFFT::set_has_band9() {
+inline void Stats_TransportCounters::set_has_messagesizeerrors() {
   _has_bits_[0] |= 0x00000400u;
 }
-inline void LogFFT::clear_has_band9() {
+inline void Stats_TransportCounters::clear_has_messagesizeerrors() {
   _has_bits_[0] &= ~0x00000400u;
 }
-inline void LogFFT::clear_band9() {
-  band9_ = 0;
-  clear_has_band9();
+inline void Stats_TransportCounters::clear_messagesizeerrors() {
+  messagesizeerrors_ = GOOGLE_ULONGLONG(0);
+  clear_has_messagesizeerrors();
 }
-inline float LogFFT::band9() const {
-  return band9_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::messagesizeerrors() const {
+  return messagesizeerrors_;
 }
-inline void LogFFT::set_band9(float value) {
-  set_has_band9();
-  band9_ = value;
+inline void Stats_TransportCounters::set_messagesizeerrors(::google_public::protobuf::uint64 value) {
+  set_has_messagesizeerrors();
+  messagesizeerrors_ = value;
 }
 
-// optional float band10 = 12;
-inline bool LogFFT::has_band10() const {
+// optional uint64 otherErrors = 12;
+inline bool Stats_TransportCounters::has_othererrors() const {
   return (_has_bits_[0] & 0x00000800u) != 0;
 }
-inline void LogFFT::set_has_band10() {
+inline void Stats_TransportCounters::set_has_othererrors() {
   _has_bits_[0] |= 0x00000800u;
 }
-inline void LogFFT::clear_has_band10() {
+inline void Stats_TransportCounters::clear_has_othererrors() {
   _has_bits_[0] &= ~0x00000800u;
 }
-inline void LogFFT::clear_band10() {
-  band10_ = 0;
-  clear_has_band10();
+inline void Stats_TransportCounters::clear_othererrors() {
+  othererrors_ = GOOGLE_ULONGLONG(0);
+  clear_has_othererrors();
 }
-inline float LogFFT::band10() const {
-  return band10_;
+inline ::google_public::protobuf::uint64 Stats_TransportCounters::othererrors() const {
+  return othererrors_;
 }
-inline void LogFFT::set_band10(float value) {
-  set_has_band10();
-  band10_ = value;
+inline void Stats_TransportCounters::set_othererrors(::google_public::protobuf::uint64 value) {
+  set_has_othererrors();
+  othererrors_ = value;
 }
 
-// optional float band11 = 13;
-inline bool LogFFT::has_band11() const {
+// optional uint32 queueHighWater = 13;
+inline bool Stats_TransportCounters::has_queuehighwater() const {
   return (_has_bits_[0] & 0x00001000u) != 0;
 }
-inline void LogFFT::set_has_band11() {
+inline void Stats_TransportCounters::set_has_queuehighwater() {
   _has_bits_[0] |= 0x00001000u;
 }
-inline void LogFFT::clear_has_band11() {
+inline void Stats_TransportCounters::clear_has_queuehighwater() {
   _has_bits_[0] &= ~0x00001000u;
 }
-inline void LogFFT::clear_band11() {
-  band11_ = 0;
-  clear_has_band11();
+inline void Stats_TransportCounters::clear_queuehighwater() {
+  queuehighwater_ = 0u;
+  clear_has_queuehighwater();
 }
-inline float LogFFT::band11() const {
-  return band11_;
+inline ::google_public::protobuf::uint32 Stats_TransportCounters::queuehighwater() const {
+  return queuehighwater_;
 }
-inline void LogFFT::set_band11(float value) {
-  set_has_band11();
-  band11_ = value;
+inline void Stats_TransportCounters::set_queuehighwater(::google_public::protobuf::uint32 value) {
+  set_has_queuehighwater();
+  queuehighwater_ = value;
 }
 
-// optional float band12 = 14;
-inline bool LogFFT::has_band12() const {
+// optional int32 lastErrno = 14;
+inline bool Stats_TransportCounters::has_lasterrno() const {
   return (_has_bits_[0] & 0x00002000u) != 0;
 }
-inline void LogFFT::set_has_band12() {
+inline void Stats_TransportCounters::set_has_lasterrno() {
   _has_bits_[0] |= 0x00002000u;
 }
-inline void LogFFT::clear_has_band12() {
+inline void Stats_TransportCounters::clear_has_lasterrno() {
   _has_bits_[0] &= ~0x00002000u;
 }
-inline void LogFFT::clear_band12() {
-  band12_ = 0;
-  clear_has_band12();
+inline void Stats_TransportCounters::clear_lasterrno() {
+  lasterrno_ = 0;
+  clear_has_lasterrno();
 }
-inline float LogFFT::band12() const {
-  return band12_;
+inline ::google_public::protobuf::int32 Stats_TransportCounters::lasterrno() const {
+  return lasterrno_;
 }
-inline void LogFFT::set_band12(float value) {
-  set_has_band12();
-  band12_ = value;
+inline void Stats_TransportCounters::set_lasterrno(::google_public::protobuf::int32 value) {
+  set_has_lasterrno();
+  lasterrno_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// TimeInfo
+// Stats_StreamCounters
 
-// required bool isPlaying = 1 [default = false];
-inline bool TimeInfo::has_isplaying() const {
+// required .Stats.Stream stream = 1;
+inline bool Stats_StreamCounters::has_stream() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void TimeInfo::set_has_isplaying() {
+inline void Stats_StreamCounters::set_has_stream() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void TimeInfo::clear_has_isplaying() {
+inline void Stats_StreamCounters::clear_has_stream() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void TimeInfo::clear_isplaying() {
-  isplaying_ = false;
-  clear_has_isplaying();
+inline void Stats_StreamCounters::clear_stream() {
+  stream_ = 0;
+  clear_has_stream();
 }
-inline bool TimeInfo::isplaying() const {
-  return isplaying_;
+inline ::Stats_Stream Stats_StreamCounters::stream() const {
+  return static_cast< ::Stats_Stream >(stream_);
 }
-inline void TimeInfo::set_isplaying(bool value) {
-  set_has_isplaying();
-  isplaying_ = value;
+inline void Stats_StreamCounters::set_stream(::Stats_Stream value) {
+  assert(::Stats_Stream_IsValid(value));
+  set_has_stream();
+  stream_ = value;
 }
 
-// required float tempo = 2 [default = 0];
-inline bool TimeInfo::has_tempo() const {
+// required uint64 sent = 2;
+inline bool Stats_StreamCounters::has_sent() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void TimeInfo::set_has_tempo() {
+inline void Stats_StreamCounters::set_has_sent() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void TimeInfo::clear_has_tempo() {
+inline void Stats_StreamCounters::clear_has_sent() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void TimeInfo::clear_tempo() {
-  tempo_ = 0;
-  clear_has_tempo();
+inline void Stats_StreamCounters::clear_sent() {
+  sent_ = GOOGLE_ULONGLONG(0);
+  clear_has_sent();
 }
-inline float TimeInfo::tempo() const {
-  return tempo_;
+inline ::google_public::protobuf::uint64 Stats_StreamCounters::sent() const {
+  return sent_;
 }
-inline void TimeInfo::set_tempo(float value) {
-  set_has_tempo();
-  tempo_ = value;
+inline void Stats_StreamCounters::set_sent(::google_public::protobuf::uint64 value) {
+  set_has_sent();
+  sent_ = value;
 }
 
-// required float position = 3 [default = 0];
-inline bool TimeInfo::has_position() const {
+// required uint64 suppressed = 3;
+inline bool Stats_StreamCounters::has_suppressed() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void TimeInfo::set_has_position() {
+inline void Stats_StreamCounters::set_has_suppressed() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void TimeInfo::clear_has_position() {
+inline void Stats_StreamCounters::clear_has_suppressed() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void TimeInfo::clear_position() {
-  position_ = 0;
-  clear_has_position();
+inline void Stats_StreamCounters::clear_suppressed() {
+  suppressed_ = GOOGLE_ULONGLONG(0);
+  clear_has_suppressed();
 }
-inline float TimeInfo::position() const {
-  return position_;
+inline ::google_public::protobuf::uint64 Stats_StreamCounters::suppressed() const {
+  return suppressed_;
 }
-inline void TimeInfo::set_position(float value) {
-  set_has_position();
-  position_ = value;
+inline void Stats_StreamCounters::set_suppressed(::google_public::protobuf::uint64 value) {
+  set_has_suppressed();
+  suppressed_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// Stats
+
+// required int32 signalID = 1 [default = 1];
+inline bool Stats::has_signalid() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Stats::set_has_signalid() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Stats::clear_has_signalid() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Stats::clear_signalid() {
+  signalid_ = 1;
+  clear_has_signalid();
+}
+inline ::google_public::protobuf::int32 Stats::signalid() const {
+  return signalid_;
+}
+inline void Stats::set_signalid(::google_public::protobuf::int32 value) {
+  set_has_signalid();
+  signalid_ = value;
+}
+
+// repeated .Stats.StageLatency stages = 2;
+inline int Stats::stages_size() const {
+  return stages_.size();
+}
+inline void Stats::clear_stages() {
+  stages_.Clear();
+}
+inline const ::Stats_StageLatency& Stats::stages(int index) const {
+  return stages_.Get(index);
+}
+inline ::Stats_StageLatency* Stats::mutable_stages(int index) {
+  return stages_.Mutable(index);
+}
+inline ::Stats_StageLatency* Stats::add_stages() {
+  return stages_.Add();
+}
+inline const ::google_public::protobuf::RepeatedPtrField< ::Stats_StageLatency >&
+Stats::stages() const {
+  return stages_;
+}
+inline ::google_public::protobuf::RepeatedPtrField< ::Stats_StageLatency >*
+Stats::mutable_stages() {
+  return &stages_;
+}
+
+// required float deadlineUtilization = 3;
+inline bool Stats::has_deadlineutilization() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Stats::set_has_deadlineutilization() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Stats::clear_has_deadlineutilization() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Stats::clear_deadlineutilization() {
+  deadlineutilization_ = 0;
+  clear_has_deadlineutilization();
+}
+inline float Stats::deadlineutilization() const {
+  return deadlineutilization_;
+}
+inline void Stats::set_deadlineutilization(float value) {
+  set_has_deadlineutilization();
+  deadlineutilization_ = value;
+}
+
+// required float maxDeadlineUtilization = 4;
+inline bool Stats::has_maxdeadlineutilization() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Stats::set_has_maxdeadlineutilization() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void Stats::clear_has_maxdeadlineutilization() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void Stats::clear_maxdeadlineutilization() {
+  maxdeadlineutilization_ = 0;
+  clear_has_maxdeadlineutilization();
+}
+inline float Stats::maxdeadlineutilization() const {
+  return maxdeadlineutilization_;
+}
+inline void Stats::set_maxdeadlineutilization(float value) {
+  set_has_maxdeadlineutilization();
+  maxdeadlineutilization_ = value;
+}
+
+// required uint32 xrunRiskCount = 5;
+inline bool Stats::has_xrunriskcount() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void Stats::set_has_xrunriskcount() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void Stats::clear_has_xrunriskcount() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void Stats::clear_xrunriskcount() {
+  xrunriskcount_ = 0u;
+  clear_has_xrunriskcount();
+}
+inline ::google_public::protobuf::uint32 Stats::xrunriskcount() const {
+  return xrunriskcount_;
+}
+inline void Stats::set_xrunriskcount(::google_public::protobuf::uint32 value) {
+  set_has_xrunriskcount();
+  xrunriskcount_ = value;
+}
+
+// required uint32 nbOfBlocks = 6;
+inline bool Stats::has_nbofblocks() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void Stats::set_has_nbofblocks() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void Stats::clear_has_nbofblocks() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void Stats::clear_nbofblocks() {
+  nbofblocks_ = 0u;
+  clear_has_nbofblocks();
+}
+inline ::google_public::protobuf::uint32 Stats::nbofblocks() const {
+  return nbofblocks_;
+}
+inline void Stats::set_nbofblocks(::google_public::protobuf::uint32 value) {
+  set_has_nbofblocks();
+  nbofblocks_ = value;
+}
+
+// repeated .Stats.TransportCounters transports = 7;
+inline int Stats::transports_size() const {
+  return transports_.size();
+}
+inline void Stats::clear_transports() {
+  transports_.Clear();
+}
+inline const ::Stats_TransportCounters& Stats::transports(int index) const {
+  return transports_.Get(index);
+}
+inline ::Stats_TransportCounters* Stats::mutable_transports(int index) {
+  return transports_.Mutable(index);
+}
+inline ::Stats_TransportCounters* Stats::add_transports() {
+  return transports_.Add();
+}
+inline const ::google_public::protobuf::RepeatedPtrField< ::Stats_TransportCounters >&
+Stats::transports() const {
+  return transports_;
+}
+inline ::google_public::protobuf::RepeatedPtrField< ::Stats_TransportCounters >*
+Stats::mutable_transports() {
+  return &transports_;
+}
+
+// repeated .Stats.StreamCounters streams = 8;
+inline int Stats::streams_size() const {
+  return streams_.size();
+}
+inline void Stats::clear_streams() {
+  streams_.Clear();
+}
+inline const ::Stats_StreamCounters& Stats::streams(int index) const {
+  return streams_.Get(index);
+}
+inline ::Stats_StreamCounters* Stats::mutable_streams(int index) {
+  return streams_.Mutable(index);
+}
+inline ::Stats_StreamCounters* Stats::add_streams() {
+  return streams_.Add();
+}
+inline const ::google_public::protobuf::RepeatedPtrField< ::Stats_StreamCounters >&
+Stats::streams() const {
+  return streams_;
+}
+inline ::google_public::protobuf::RepeatedPtrField< ::Stats_StreamCounters >*
+Stats::mutable_streams() {
+  return &streams_;
 }
 
 
@@ -1311,6 +3191,18 @@ inline void TimeInfo::set_position(float value) {
 namespace google_public {
 namespace protobuf {
 
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Stats_Stage>() {
+  return ::Stats_Stage_descriptor();
+}
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Stats_Destination>() {
+  return ::Stats_Destination_descriptor();
+}
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Stats_Stream>() {
+  return ::Stats_Stream_descriptor();
+}
 
 }  // namespace google
 }  // namespace protobuf
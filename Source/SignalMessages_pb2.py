@@ -13,10 +13,109 @@ from google.protobuf import descriptor_pb2
 DESCRIPTOR = _descriptor.FileDescriptor(
   name='SignalMessages.proto',
   package='',
-  serialized_pb='\n\x14SignalMessages.proto\":\n\x0bSignalLevel\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12\x16\n\x0bsignalLevel\x18\x02 \x02(\x02:\x01\x30\"D\n\x10SignalInstantVal\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12\x1b\n\x10signalInstantVal\x18\x02 \x02(\x02:\x01\x30\"\x1e\n\x07Impulse\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\"N\n\tLinearFFT\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12\x1a\n\x0f\x66undamentalFreq\x18\x02 \x02(\x02:\x01\x30\x12\x10\n\x04\x64\x61ta\x18\x03 \x03(\x02\x42\x02\x10\x01\"\xed\x01\n\x06LogFFT\x12\x13\n\x08signalID\x18\x01 \x01(\x05:\x01\x31\x12\x17\n\x0f\x66undamentalFreq\x18\x02 \x01(\x02\x12\r\n\x05\x62\x61nd1\x18\x03 \x01(\x02\x12\r\n\x05\x62\x61nd2\x18\x04 \x01(\x02\x12\r\n\x05\x62\x61nd3\x18\x05 \x01(\x02\x12\r\n\x05\x62\x61nd4\x18\x06 \x01(\x02\x12\r\n\x05\x62\x61nd5\x18\x07 \x01(\x02\x12\r\n\x05\x62\x61nd6\x18\x08 \x01(\x02\x12\r\n\x05\x62\x61nd7\x18\t \x01(\x02\x12\r\n\x05\x62\x61nd8\x18\n \x01(\x02\x12\r\n\x05\x62\x61nd9\x18\x0b \x01(\x02\x12\x0e\n\x06\x62\x61nd10\x18\x0c \x01(\x02\x12\x0e\n\x06\x62\x61nd11\x18\r \x01(\x02\x12\x0e\n\x06\x62\x61nd12\x18\x0e \x01(\x02\"K\n\x08TimeInfo\x12\x18\n\tisPlaying\x18\x01 \x02(\x08:\x05\x66\x61lse\x12\x10\n\x05tempo\x18\x02 \x02(\x02:\x01\x30\x12\x13\n\x08position\x18\x03 \x02(\x02:\x01\x30\x42\x10\x42\x0eSignalMessages')
+  serialized_pb='\n\x14SignalMessages.proto\":\n\x0bSignalLevel\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12\x16\n\x0bsignalLevel\x18\x02 \x02(\x02:\x01\x30\"D\n\x10SignalInstantVal\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12\x1b\n\x10signalInstantVal\x18\x02 \x02(\x02:\x01\x30\"\x1e\n\x07Impulse\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\"N\n\tLinearFFT\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12\x1a\n\x0f\x66undamentalFreq\x18\x02 \x02(\x02:\x01\x30\x12\x10\n\x04\x64\x61ta\x18\x03 \x03(\x02\x42\x02\x10\x01\"\xed\x01\n\x06LogFFT\x12\x13\n\x08signalID\x18\x01 \x01(\x05:\x01\x31\x12\x17\n\x0f\x66undamentalFreq\x18\x02 \x01(\x02\x12\r\n\x05\x62\x61nd1\x18\x03 \x01(\x02\x12\r\n\x05\x62\x61nd2\x18\x04 \x01(\x02\x12\r\n\x05\x62\x61nd3\x18\x05 \x01(\x02\x12\r\n\x05\x62\x61nd4\x18\x06 \x01(\x02\x12\r\n\x05\x62\x61nd5\x18\x07 \x01(\x02\x12\r\n\x05\x62\x61nd6\x18\x08 \x01(\x02\x12\r\n\x05\x62\x61nd7\x18\t \x01(\x02\x12\r\n\x05\x62\x61nd8\x18\n \x01(\x02\x12\r\n\x05\x62\x61nd9\x18\x0b \x01(\x02\x12\x0e\n\x06\x62\x61nd10\x18\x0c \x01(\x02\x12\x0e\n\x06\x62\x61nd11\x18\r \x01(\x02\x12\x0e\n\x06\x62\x61nd12\x18\x0e \x01(\x02\"K\n\x08TimeInfo\x12\x18\n\tisPlaying\x18\x01 \x02(\x08:\x05\x66\x61lse\x12\x10\n\x05tempo\x18\x02 \x02(\x02:\x01\x30\x12\x13\n\x08position\x18\x03 \x02(\x02:\x01\x30\"\xb5\x01\n\tMidiEvent\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12\x18\n\tisPlaying\x18\x02 \x02(\x08:\x05\x66\x61lse\x12 \n\x06\x65vents\x18\x03 \x03(\x0b\x32\x10.MidiEvent.Event\x1aW\n\x05\x45vent\x12\x14\n\x0csampleOffset\x18\x01 \x02(\x05\x12\x15\n\rtimeInSamples\x18\x02 \x02(\x03\x12\x13\n\x0bppqPosition\x18\x03 \x01(\x01\x12\x0c\n\x04\x64\x61ta\x18\x04 \x02(\x0c\"\xd7\x08\n\x05Stats\x12\x13\n\x08signalID\x18\x01 \x02(\x05:\x01\x31\x12#\n\x06stages\x18\x02 \x03(\x0b\x32\x13.Stats.StageLatency\x12\x1b\n\x13\x64\x65\x61\x64lineUtilization\x18\x03 \x02(\x02\x12\x1e\n\x16maxDeadlineUtilization\x18\x04 \x02(\x02\x12\x15\n\rxrunRiskCount\x18\x05 \x02(\r\x12\x12\n\nnbOfBlocks\x18\x06 \x02(\r\x12,\n\ntransports\x18\x07 \x03(\x0b\x32\x18.Stats.TransportCounters\x12&\n\x07streams\x18\x08 \x03(\x0b\x32\x15.Stats.StreamCounters\x1a\x61\n\x0cStageLatency\x12\x1b\n\x05stage\x18\x01 \x02(\x0e\x32\x0c.Stats.Stage\x12\r\n\x05\x63ount\x18\x02 \x02(\r\x12\x0b\n\x03p50\x18\x03 \x02(\x02\x12\x0b\n\x03p99\x18\x04 \x02(\x02\x12\x0b\n\x03max\x18\x05 \x02(\x02\x1a\xe0\x02\n\x11TransportCounters\x12\'\n\x0b\x64\x65stination\x18\x01 \x02(\x0e\x32\x12.Stats.Destination\x12\x0f\n\x07packets\x18\x02 \x02(\x04\x12\r\n\x05\x62ytes\x18\x03 \x02(\x04\x12\x15\n\rnotReadyDrops\x18\x04 \x01(\x04\x12\x16\n\x0eoversizedDrops\x18\x05 \x01(\x04\x12\x14\n\x0cpartialSends\x18\x06 \x01(\x04\x12\x18\n\x10wouldBlockErrors\x18\x07 \x01(\x04\x12\x16\n\x0enoBufferErrors\x18\x08 \x01(\x04\x12\x15\n\rrefusedErrors\x18\t \x01(\x04\x12\x19\n\x11unreachableErrors\x18\n \x01(\x04\x12\x19\n\x11messageSizeErrors\x18\x0b \x01(\x04\x12\x13\n\x0botherErrors\x18\x0c \x01(\x04\x12\x16\n\x0equeueHighWater\x18\r \x01(\r\x12\x11\n\tlastErrno\x18\x0e \x01(\x05\x1aQ\n\x0eStreamCounters\x12\x1d\n\x06stream\x18\x01 \x02(\x0e\x32\r.Stats.Stream\x12\x0c\n\x04sent\x18\x02 \x02(\x04\x12\x12\n\nsuppressed\x18\x03 \x02(\x04\"@\n\x05Stage\x12\x11\n\rPROCESS_BLOCK\x10\x00\x12\x07\n\x03\x46\x46T\x10\x01\x12\x11\n\rSERIALIZATION\x10\x02\x12\x08\n\x04SEND\x10\x03\"\xa8\x01\n\x0b\x44\x65stination\x12\x15\n\x11SIGNAL_LEVEL_PORT\x10\x00\x12\x1b\n\x17SIGNAL_INSTANT_VAL_PORT\x10\x01\x12\x10\n\x0cIMPULSE_PORT\x10\x02\x12\x12\n\x0eTIME_INFO_PORT\x10\x03\x12\x0c\n\x08\x46\x46T_PORT\x10\x04\x12\x0e\n\nSTATS_PORT\x10\x05\x12\x0c\n\x08OSC_PORT\x10\x06\x12\x13\n\x0fMIDI_EVENT_PORT\x10\x07\"P\n\x06Stream\x12\x17\n\x13SIGNAL_LEVEL_STREAM\x10\x00\x12\x1d\n\x19SIGNAL_INSTANT_VAL_STREAM\x10\x01\x12\x0e\n\nFFT_STREAM\x10\x02\x42\x10\x42\x0eSignalMessages')
 
 
 
+_STATS_STAGE = _descriptor.EnumDescriptor(
+  name='Stage',
+  full_name='Stats.Stage',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='PROCESS_BLOCK', index=0, number=0,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='FFT', index=1, number=1,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='SERIALIZATION', index=2, number=2,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='SEND', index=3, number=3,
+      options=None,
+      type=None),
+  ],
+  containing_type=None,
+  options=None,
+  serialized_start=1562,
+  serialized_end=1626,
+)
+
+_STATS_DESTINATION = _descriptor.EnumDescriptor(
+  name='Destination',
+  full_name='Stats.Destination',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='SIGNAL_LEVEL_PORT', index=0, number=0,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='SIGNAL_INSTANT_VAL_PORT', index=1, number=1,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='IMPULSE_PORT', index=2, number=2,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='TIME_INFO_PORT', index=3, number=3,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='FFT_PORT', index=4, number=4,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='STATS_PORT', index=5, number=5,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='OSC_PORT', index=6, number=6,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='MIDI_EVENT_PORT', index=7, number=7,
+      options=None,
+      type=None),
+  ],
+  containing_type=None,
+  options=None,
+  serialized_start=1629,
+  serialized_end=1797,
+)
+
+_STATS_STREAM = _descriptor.EnumDescriptor(
+  name='Stream',
+  full_name='Stats.Stream',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='SIGNAL_LEVEL_STREAM', index=0, number=0,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='SIGNAL_INSTANT_VAL_STREAM', index=1, number=1,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='FFT_STREAM', index=2, number=2,
+      options=None,
+      type=None),
+  ],
+  containing_type=None,
+  options=None,
+  serialized_start=1799,
+  serialized_end=1879,
+)
+
 
 _SIGNALLEVEL = _descriptor.Descriptor(
   name='SignalLevel',
@@ -318,12 +417,412 @@ _TIMEINFO = _descriptor.Descriptor(
   serialized_end=581,
 )
 
+
+_MIDIEVENT_EVENT = _descriptor.Descriptor(
+  name='Event',
+  full_name='MidiEvent.Event',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='sampleOffset', full_name='MidiEvent.Event.sampleOffset', index=0,
+      number=1, type=5, cpp_type=1, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='timeInSamples', full_name='MidiEvent.Event.timeInSamples', index=1,
+      number=2, type=3, cpp_type=2, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='ppqPosition', full_name='MidiEvent.Event.ppqPosition', index=2,
+      number=3, type=1, cpp_type=5, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='data', full_name='MidiEvent.Event.data', index=3,
+      number=4, type=12, cpp_type=9, label=2,
+      has_default_value=False, default_value="",
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  serialized_start=678,
+  serialized_end=765,
+)
+
+_MIDIEVENT = _descriptor.Descriptor(
+  name='MidiEvent',
+  full_name='MidiEvent',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='signalID', full_name='MidiEvent.signalID', index=0,
+      number=1, type=5, cpp_type=1, label=2,
+      has_default_value=True, default_value=1,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='isPlaying', full_name='MidiEvent.isPlaying', index=1,
+      number=2, type=8, cpp_type=7, label=2,
+      has_default_value=True, default_value=False,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='events', full_name='MidiEvent.events', index=2,
+      number=3, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[_MIDIEVENT_EVENT, ],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  serialized_start=584,
+  serialized_end=765,
+)
+
+
+_STATS_STAGELATENCY = _descriptor.Descriptor(
+  name='StageLatency',
+  full_name='Stats.StageLatency',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='stage', full_name='Stats.StageLatency.stage', index=0,
+      number=1, type=14, cpp_type=8, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='count', full_name='Stats.StageLatency.count', index=1,
+      number=2, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='p50', full_name='Stats.StageLatency.p50', index=2,
+      number=3, type=2, cpp_type=6, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='p99', full_name='Stats.StageLatency.p99', index=3,
+      number=4, type=2, cpp_type=6, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='max', full_name='Stats.StageLatency.max', index=4,
+      number=5, type=2, cpp_type=6, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  serialized_start=1025,
+  serialized_end=1122,
+)
+
+_STATS_TRANSPORTCOUNTERS = _descriptor.Descriptor(
+  name='TransportCounters',
+  full_name='Stats.TransportCounters',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='destination', full_name='Stats.TransportCounters.destination', index=0,
+      number=1, type=14, cpp_type=8, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='packets', full_name='Stats.TransportCounters.packets', index=1,
+      number=2, type=4, cpp_type=4, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='bytes', full_name='Stats.TransportCounters.bytes', index=2,
+      number=3, type=4, cpp_type=4, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='notReadyDrops', full_name='Stats.TransportCounters.notReadyDrops', index=3,
+      number=4, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='oversizedDrops', full_name='Stats.TransportCounters.oversizedDrops', index=4,
+      number=5, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='partialSends', full_name='Stats.TransportCounters.partialSends', index=5,
+      number=6, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='wouldBlockErrors', full_name='Stats.TransportCounters.wouldBlockErrors', index=6,
+      number=7, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='noBufferErrors', full_name='Stats.TransportCounters.noBufferErrors', index=7,
+      number=8, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='refusedErrors', full_name='Stats.TransportCounters.refusedErrors', index=8,
+      number=9, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='unreachableErrors', full_name='Stats.TransportCounters.unreachableErrors', index=9,
+      number=10, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='messageSizeErrors', full_name='Stats.TransportCounters.messageSizeErrors', index=10,
+      number=11, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='otherErrors', full_name='Stats.TransportCounters.otherErrors', index=11,
+      number=12, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='queueHighWater', full_name='Stats.TransportCounters.queueHighWater', index=12,
+      number=13, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='lastErrno', full_name='Stats.TransportCounters.lastErrno', index=13,
+      number=14, type=5, cpp_type=1, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  serialized_start=1125,
+  serialized_end=1477,
+)
+
+_STATS_STREAMCOUNTERS = _descriptor.Descriptor(
+  name='StreamCounters',
+  full_name='Stats.StreamCounters',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='stream', full_name='Stats.StreamCounters.stream', index=0,
+      number=1, type=14, cpp_type=8, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='sent', full_name='Stats.StreamCounters.sent', index=1,
+      number=2, type=4, cpp_type=4, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='suppressed', full_name='Stats.StreamCounters.suppressed', index=2,
+      number=3, type=4, cpp_type=4, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  serialized_start=1479,
+  serialized_end=1560,
+)
+
+_STATS = _descriptor.Descriptor(
+  name='Stats',
+  full_name='Stats',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='signalID', full_name='Stats.signalID', index=0,
+      number=1, type=5, cpp_type=1, label=2,
+      has_default_value=True, default_value=1,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='stages', full_name='Stats.stages', index=1,
+      number=2, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='deadlineUtilization', full_name='Stats.deadlineUtilization', index=2,
+      number=3, type=2, cpp_type=6, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='maxDeadlineUtilization', full_name='Stats.maxDeadlineUtilization', index=3,
+      number=4, type=2, cpp_type=6, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='xrunRiskCount', full_name='Stats.xrunRiskCount', index=4,
+      number=5, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='nbOfBlocks', full_name='Stats.nbOfBlocks', index=5,
+      number=6, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='transports', full_name='Stats.transports', index=6,
+      number=7, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='streams', full_name='Stats.streams', index=7,
+      number=8, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[_STATS_STAGELATENCY, _STATS_TRANSPORTCOUNTERS, _STATS_STREAMCOUNTERS, ],
+  enum_types=[
+    _STATS_STAGE,
+    _STATS_DESTINATION,
+    _STATS_STREAM,
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  serialized_start=768,
+  serialized_end=1879,
+)
+
+_MIDIEVENT_EVENT.containing_type = _MIDIEVENT;
+_MIDIEVENT.fields_by_name['events'].message_type = _MIDIEVENT_EVENT
+_STATS_STAGELATENCY.fields_by_name['stage'].enum_type = _STATS_STAGE
+_STATS_STAGELATENCY.containing_type = _STATS;
+_STATS_TRANSPORTCOUNTERS.fields_by_name['destination'].enum_type = _STATS_DESTINATION
+_STATS_TRANSPORTCOUNTERS.containing_type = _STATS;
+_STATS_STREAMCOUNTERS.fields_by_name['stream'].enum_type = _STATS_STREAM
+_STATS_STREAMCOUNTERS.containing_type = _STATS;
+_STATS.fields_by_name['stages'].message_type = _STATS_STAGELATENCY
+_STATS.fields_by_name['transports'].message_type = _STATS_TRANSPORTCOUNTERS
+_STATS.fields_by_name['streams'].message_type = _STATS_STREAMCOUNTERS
+_STATS_STAGE.containing_type = _STATS;
+_STATS_DESTINATION.containing_type = _STATS;
+_STATS_STREAM.containing_type = _STATS;
 DESCRIPTOR.message_types_by_name['SignalLevel'] = _SIGNALLEVEL
 DESCRIPTOR.message_types_by_name['SignalInstantVal'] = _SIGNALINSTANTVAL
 DESCRIPTOR.message_types_by_name['Impulse'] = _IMPULSE
 DESCRIPTOR.message_types_by_name['LinearFFT'] = _LINEARFFT
 DESCRIPTOR.message_types_by_name['LogFFT'] = _LOGFFT
 DESCRIPTOR.message_types_by_name['TimeInfo'] = _TIMEINFO
+DESCRIPTOR.message_types_by_name['MidiEvent'] = _MIDIEVENT
+DESCRIPTOR.message_types_by_name['Stats'] = _STATS
 
 class SignalLevel(_message.Message):
   __metaclass__ = _reflection.GeneratedProtocolMessageType
@@ -361,6 +860,42 @@ class TimeInfo(_message.Message):
 
   # @@protoc_insertion_point(class_scope:TimeInfo)
 
+class MidiEvent(_message.Message):
+  __metaclass__ = _reflection.GeneratedProtocolMessageType
+
+  class Event(_message.Message):
+    __metaclass__ = _reflection.GeneratedProtocolMessageType
+    DESCRIPTOR = _MIDIEVENT_EVENT
+
+    # @@protoc_insertion_point(class_scope:MidiEvent.Event)
+  DESCRIPTOR = _MIDIEVENT
+
+  # @@protoc_insertion_point(class_scope:MidiEvent)
+
+class Stats(_message.Message):
+  __metaclass__ = _reflection.GeneratedProtocolMessageType
+
+  class StageLatency(_message.Message):
+    __metaclass__ = _reflection.GeneratedProtocolMessageType
+    DESCRIPTOR = _STATS_STAGELATENCY
+
+    # @@protoc_insertion_point(class_scope:Stats.StageLatency)
+
+  class TransportCounters(_message.Message):
+    __metaclass__ = _reflection.GeneratedProtocolMessageType
+    DESCRIPTOR = _STATS_TRANSPORTCOUNTERS
+
+    # @@protoc_insertion_point(class_scope:Stats.TransportCounters)
+
+  class StreamCounters(_message.Message):
+    __metaclass__ = _reflection.GeneratedProtocolMessageType
+    DESCRIPTOR = _STATS_STREAMCOUNTERS
+
+    # @@protoc_insertion_point(class_scope:Stats.StreamCounters)
+  DESCRIPTOR = _STATS
+
+  # @@protoc_insertion_point(class_scope:Stats)
+
 
 DESCRIPTOR.has_options = True
 DESCRIPTOR._options = _descriptor._ParseOptions(descriptor_pb2.FileOptions(), 'B\016SignalMessages')
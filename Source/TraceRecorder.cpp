@@ -0,0 +1,208 @@
+/*
+ ==============================================================================
+
+    TraceRecorder.cpp
+    PlayMe - SignalProcessor
+    Per-thread trace rings and their Chrome trace_event export
+
+ ==============================================================================
+ */
+
+#include "TraceRecorder.h"
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <pthread.h>
+#include <unistd.h>
+#include <vector>
+
+//==============================================================================
+namespace
+{
+    /*  Single writer ring, read like a SeqLock : the writer announces the slot it overwrites (started),
+        writes it, then publishes it (written). A reader copies the published events, then throws away
+        the ones the writer started overwriting meanwhile
+    */
+    struct TraceRing
+    {
+        std::atomic<bool> owned;
+        std::atomic<uint64_t> started;
+        std::atomic<uint64_t> written;
+        TraceRecorder::Event* events = nullptr;
+
+        // Of the current owner, set when the ring is claimed
+        std::atomic<uint32_t> threadID;
+        char threadName[32];
+    };
+
+    TraceRing rings[TraceRecorder::maxNbOfThreads];
+    std::atomic<uint32_t> nbOfClaims (0);
+    std::mutex enableLock;
+
+    // The ring of the calling thread, released when the thread exits
+    struct ThreadRing
+    {
+        TraceRing* ring = nullptr;
+        uint32_t threadID = 0;
+        bool claimFailed = false;
+
+        ~ThreadRing()
+        {
+            if (ring != nullptr)
+                ring->owned.store (false, std::memory_order_release);
+        }
+    };
+
+    thread_local ThreadRing threadRing;
+
+    bool claimRing (ThreadRing& thread)
+    {
+        for (int i = 0; i < TraceRecorder::maxNbOfThreads; ++i)
+        {
+            TraceRing& ring = rings[i];
+            bool expected = false;
+
+            if (ring.owned.compare_exchange_strong (expected, true, std::memory_order_acquire))
+            {
+                thread.ring = &ring;
+                thread.threadID = nbOfClaims.fetch_add (1, std::memory_order_relaxed) + 1;
+
+                if (pthread_getname_np (pthread_self(), ring.threadName, sizeof (ring.threadName)) != 0
+                     || ring.threadName[0] == 0)
+                    std::snprintf (ring.threadName, sizeof (ring.threadName), "Thread %u", thread.threadID);
+
+                ring.threadID.store (thread.threadID, std::memory_order_release);
+                return true;
+            }
+        }
+
+        // Checking the rings again at every event would cost more than the event itself
+        thread.claimFailed = true;
+        return false;
+    }
+
+    void writeEscaped (std::ostream& output, const char* text)
+    {
+        for (; *text != 0; ++text)
+        {
+            if (*text == '"' || *text == '\\')
+                output << '\\';
+
+            if ((unsigned char) *text >= 0x20)
+                output << *text;
+        }
+    }
+}
+
+std::atomic<bool> TraceRecorder::enabled (false);
+
+//==============================================================================
+void TraceRecorder::enable()
+{
+    std::lock_guard<std::mutex> lock (enableLock);
+
+    if (isEnabled())
+        return;
+
+    for (int i = 0; i < maxNbOfThreads; ++i)
+    {
+        rings[i].owned.store (false, std::memory_order_relaxed);
+        rings[i].started.store (0, std::memory_order_relaxed);
+        rings[i].written.store (0, std::memory_order_relaxed);
+        rings[i].threadID.store (0, std::memory_order_relaxed);
+        rings[i].events = new Event[ringSize];
+    }
+
+    enabled.store (true, std::memory_order_release);
+}
+
+void TraceRecorder::record (const char* name, const char* argName, int32_t argValue, uint64_t start, uint64_t end)
+{
+    ThreadRing& thread = threadRing;
+
+    if (thread.ring == nullptr && (thread.claimFailed || ! claimRing (thread)))
+        return;
+
+    TraceRing& ring = *thread.ring;
+    const uint64_t index = ring.written.load (std::memory_order_relaxed);
+
+    ring.started.store (index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+
+    Event& event = ring.events[index & (ringSize - 1)];
+    event.name      = name;
+    event.argName   = argName;
+    event.start     = start;
+    event.duration  = (uint32_t) std::min<uint64_t> (end - start, 0xffffffff);
+    event.argValue  = argValue;
+    event.threadID  = thread.threadID;
+
+    ring.written.store (index + 1, std::memory_order_release);
+}
+
+//==============================================================================
+int TraceRecorder::writeChromeTrace (std::ostream& output, double seconds)
+{
+    std::vector<Event> events;
+    const uint64_t now = getMonotonicNanoseconds();
+    const uint64_t from = now - std::min<uint64_t> (now, (uint64_t) (seconds * 1.0e9));
+    const int processID = (int) getpid();
+
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+
+    if (isEnabled())
+    {
+        for (int i = 0; i < maxNbOfThreads; ++i)
+        {
+            TraceRing& ring = rings[i];
+            const uint64_t written = ring.written.load (std::memory_order_acquire);
+            const uint64_t oldest = written - std::min<uint64_t> (written, ringSize);
+            const size_t copyStart = events.size();
+
+            for (uint64_t index = oldest; index < written; ++index)
+                events.push_back (ring.events[index & (ringSize - 1)]);
+
+            std::atomic_thread_fence (std::memory_order_acquire);
+            const uint64_t started = ring.started.load (std::memory_order_relaxed);
+
+            // The events the writer overwrote during the copy
+            const uint64_t firstValid = started - std::min<uint64_t> (started, ringSize);
+            if (firstValid > oldest)
+                events.erase (events.begin() + (std::ptrdiff_t) copyStart,
+                              events.begin() + (std::ptrdiff_t) (copyStart + std::min (firstValid - oldest, written - oldest)));
+
+            // Names of the threads (the current owner of the ring)
+            if (const uint32_t threadID = ring.threadID.load (std::memory_order_acquire))
+            {
+                output << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processID
+                       << ",\"tid\":" << threadID << ",\"args\":{\"name\":\"";
+                writeEscaped (output, ring.threadName);
+                output << "\"}}";
+                first = false;
+            }
+        }
+    }
+
+    events.erase (std::remove_if (events.begin(), events.end(), [from] (const Event& e) { return e.start < from; }),
+                  events.end());
+    std::sort (events.begin(), events.end(), [] (const Event& a, const Event& b) { return a.start < b.start; });
+
+    // Complete events, in microseconds
+    char line[256];
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const Event& event = events[i];
+        std::snprintf (line, sizeof (line), "\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                       processID, event.threadID, event.start / 1000.0, event.duration / 1000.0);
+
+        output << (first ? "" : ",") << "\n{\"name\":\"" << event.name << "\"," << line;
+        if (event.argName != nullptr)
+            output << ",\"args\":{\"" << event.argName << "\":" << event.argValue << "}";
+        output << "}";
+        first = false;
+    }
+
+    output << "\n]}\n";
+    return (int) events.size();
+}
@@ -0,0 +1,103 @@
+/*
+ ==============================================================================
+
+    TraceRecorder.h
+    PlayMe - SignalProcessor
+    Trace points of the audio thread (processBlock, FFT, sends) : every
+    thread writes fixed-size events into its own lock-free ring, and the last
+    seconds can be written as a Chrome trace (chrome://tracing, Perfetto)
+
+ ==============================================================================
+ */
+
+#ifndef TRACERECORDER_H_INCLUDED
+#define TRACERECORDER_H_INCLUDED
+
+#include "PerformanceStats.h"               // getMonotonicNanoseconds
+#include <atomic>
+#include <ostream>
+#include <stdint.h>
+
+// Define SIGNALPROCESSOR_TRACING to 0 to compile the trace points out
+#if ! defined (SIGNALPROCESSOR_TRACING)
+ #define SIGNALPROCESSOR_TRACING 1
+#endif
+
+//==============================================================================
+/**
+    The rings are allocated by enable(), on the message thread. A thread
+    claims a ring with its first event and releases it when it exits : no
+    allocation and no lock on the audio thread. A ring keeps the last
+    ringSize events of its thread, about 10 seconds at 64 samples per block.
+    The rings are never freed : a trace point may run at any time
+ */
+class TraceRecorder
+{
+public:
+    static const int ringSize       = 1 << 15;
+    static const int maxNbOfThreads = 8;    // Events of the threads beyond are dropped
+
+    // The name and argName must be string literals : only their address is stored
+    struct Event
+    {
+        const char* name;
+        const char* argName;                // nullptr if the event has no argument
+        uint64_t start;                     // getMonotonicNanoseconds()
+        uint32_t duration;                  // Nanoseconds
+        int32_t argValue;
+        uint32_t threadID;
+        uint32_t padding;
+    };
+
+    // Allocate the rings. Only the first call does something
+    static void enable();
+    static bool isEnabled()                         { return enabled.load (std::memory_order_acquire); }
+
+    // Called by the traced threads
+    static void record (const char* name, const char* argName, int32_t argValue, uint64_t start, uint64_t end);
+
+    // Write the events of the last seconds as Chrome trace_event JSON. Any thread but a traced one
+    // (the message thread) : the events are copied while the other threads keep writing.
+    // Returns the number of events written
+    static int writeChromeTrace (std::ostream& output, double seconds);
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+//==============================================================================
+// Records the duration of its scope
+class TraceScope
+{
+public:
+    TraceScope (const char* n, const char* an = nullptr, int32_t av = 0)
+        : name (n), argName (an), argValue (av),
+          start (TraceRecorder::isEnabled() ? getMonotonicNanoseconds() : 0) {}
+
+    ~TraceScope()
+    {
+        if (start != 0)
+            TraceRecorder::record (name, argName, argValue, start, getMonotonicNanoseconds());
+    }
+
+private:
+    const char* const name;
+    const char* const argName;
+    const int32_t argValue;
+    const uint64_t start;
+
+    TraceScope (const TraceScope&) = delete;
+    TraceScope& operator= (const TraceScope&) = delete;
+};
+
+#define SIGNALPROCESSOR_TRACE_JOIN2(a, b)   a##b
+#define SIGNALPROCESSOR_TRACE_JOIN(a, b)    SIGNALPROCESSOR_TRACE_JOIN2 (a, b)
+
+// SIGNALPROCESSOR_TRACE_SCOPE ("name") or SIGNALPROCESSOR_TRACE_SCOPE ("name", "argName", argValue)
+#if SIGNALPROCESSOR_TRACING
+ #define SIGNALPROCESSOR_TRACE_SCOPE(...)   TraceScope SIGNALPROCESSOR_TRACE_JOIN (traceScope, __LINE__) (__VA_ARGS__)
+#else
+ #define SIGNALPROCESSOR_TRACE_SCOPE(...)
+#endif
+
+#endif  // TRACERECORDER_H_INCLUDED
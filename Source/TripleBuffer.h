@@ -0,0 +1,75 @@
+/*
+ ==============================================================================
+
+    TripleBuffer.h
+    PlayMe - SignalProcessor
+    Lock-free hand-off of the latest value from one writer thread to one
+    reader thread : the writer never waits and the reader always gets the
+    most recent complete value, whatever their rates
+
+ ==============================================================================
+ */
+
+#ifndef TRIPLEBUFFER_H_INCLUDED
+#define TRIPLEBUFFER_H_INCLUDED
+
+#include <atomic>
+
+//==============================================================================
+/**
+    Three buffers : the writer's, the reader's, and the last published one.
+    publish() swaps the writer's buffer with the published one, read() swaps
+    the published one with the reader's if it is newer. The buffers are
+    allocated with the object : the writer's side can run on the audio thread.
+    After publish(), the writer's buffer holds an older value, which must be
+    entirely rewritten.
+    This class does not depend on JUCE
+ */
+template <typename Type>
+class TripleBuffer
+{
+public:
+    TripleBuffer()
+        : published (1),
+          writeIndex (0),
+          readIndex (2)
+    {
+    }
+
+    //==============================================================================
+    // Writer thread
+    Type& getWriteBuffer()                  { return buffers[writeIndex]; }
+
+    void publish()
+    {
+        writeIndex = published.exchange (writeIndex | newDataFlag, std::memory_order_acq_rel) & indexMask;
+    }
+
+    //==============================================================================
+    // Reader thread. Returns true if a newer value was published since the previous call : getReadBuffer()
+    // then returns it. The buffer returned by getReadBuffer() is not modified until the next read()
+    bool read()
+    {
+        if ((published.load (std::memory_order_relaxed) & newDataFlag) == 0)
+            return false;
+
+        readIndex = published.exchange (readIndex, std::memory_order_acq_rel) & indexMask;
+        return true;
+    }
+
+    const Type& getReadBuffer() const       { return buffers[readIndex]; }
+
+private:
+    static const int indexMask      = 3;
+    static const int newDataFlag    = 4;
+
+    Type buffers[3];
+    std::atomic<int> published;             // Index of the published buffer, and newDataFlag
+    int writeIndex;                         // Only used by the writer
+    int readIndex;                          // Only used by the reader
+
+    TripleBuffer (const TripleBuffer&) = delete;
+    TripleBuffer& operator= (const TripleBuffer&) = delete;
+};
+
+#endif  // TRIPLEBUFFER_H_INCLUDED
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
+#include <poll.h>
 
 /* only available on linux >= 2.6.27 */
 #ifndef SOCK_CLOEXEC
@@ -183,6 +184,7 @@
     udp_server::udp_server(const std::string& addr, int port)
     : f_port(port)
     , f_addr(addr)
+    , f_timestamps(false)
     {
         char decimal_port[16];
         snprintf(decimal_port, sizeof(decimal_port), "%d", f_port);
@@ -303,16 +305,16 @@
      */
     int udp_server::timed_recv(char *msg, size_t max_size, int max_wait_ms)
     {
-        fd_set s;
-        FD_ZERO(&s);
-        FD_SET(f_socket, &s);
-        struct timeval timeout;
-        timeout.tv_sec = max_wait_ms / 1000;
-        timeout.tv_usec = (max_wait_ms % 1000) * 1000;
-        int retval = select(f_socket + 1, &s, &s, &s, &timeout);
+        // Only wait for the socket to be readable: a UDP socket is always
+        // writable, so also waiting on it for writing would return at once
+        struct pollfd p;
+        p.fd = f_socket;
+        p.events = POLLIN;
+        p.revents = 0;
+        int retval = poll(&p, 1, max_wait_ms);
         if(retval == -1)
         {
-            // select() set errno accordingly
+            // poll() set errno accordingly
             return -1;
         }
         if(retval > 0)
@@ -326,3 +328,210 @@
         return -1;
     }
     
+    /** \brief Receive several datagrams at once.
+     *
+     * This function waits until at least one datagram is available (or
+     * until max_wait_ms elapsed) and then reads as many pending datagrams
+     * as possible, up to \p count, without blocking again. On Linux all
+     * the datagrams are read with a single recvmmsg() system call, which
+     * lets a receiver process thousands of packets per wake up.
+     *
+     * Each datagram is written in the matching caller provided buffer, and
+     * its size is saved in \p sizes. If the buffer is too small the datagram
+     * is truncated, as with recv().
+     *
+     * If \p timestamps is not NULL and set_timestamps(true) was called, the
+     * kernel arrival time of each datagram is saved in \p timestamps
+     * (CLOCK_REALTIME). Datagrams without a timestamp get a zero timespec.
+     *
+     * \param[in] buffers  The buffers where the datagrams are saved.
+     * \param[out] sizes  The number of bytes saved in each buffer.
+     * \param[out] timestamps  The arrival time of each datagram, or NULL.
+     * \param[in] count  The number of buffers.
+     * \param[in] max_wait_ms  The maximum number of milliseconds to wait for the first datagram, -1 to wait forever.
+     *
+     * \return The number of datagrams received, or -1 if an error occurs or
+     * the function timed out (errno is then set to EAGAIN).
+     */
+    int udp_server::recv_batch(struct iovec *buffers, size_t *sizes, struct timespec *timestamps, int count, int max_wait_ms)
+    {
+        if(count <= 0)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        
+        if(max_wait_ms >= 0)
+        {
+            struct pollfd p;
+            p.fd = f_socket;
+            p.events = POLLIN;
+            p.revents = 0;
+            int retval = poll(&p, 1, max_wait_ms);
+            if(retval == -1)
+            {
+                return -1;
+            }
+            if(retval == 0)
+            {
+                errno = EAGAIN;
+                return -1;
+            }
+        }
+        
+        // Only allocate when the batch grows, the usual case reuses the same headers
+        const size_t control_size = CMSG_SPACE(sizeof(struct timespec));
+        if(f_batch_headers.size() < (size_t) count)
+        {
+            f_batch_headers.resize(count);
+            f_batch_control.resize(count * control_size);
+        }
+        
+        const bool want_timestamps = f_timestamps && timestamps != NULL;
+        
+#ifdef __linux__
+        for(int i(0); i < count; ++i)
+        {
+            struct msghdr& h(f_batch_headers[i].msg_hdr);
+            memset(&h, 0, sizeof(h));
+            h.msg_iov = &buffers[i];
+            h.msg_iovlen = 1;
+            if(want_timestamps)
+            {
+                h.msg_control = &f_batch_control[i * control_size];
+                h.msg_controllen = control_size;
+            }
+            f_batch_headers[i].msg_len = 0;
+        }
+        
+        // Block until the first datagram unless poll() already saw one, then take everything pending
+        int received = recvmmsg(f_socket, &f_batch_headers[0], count, max_wait_ms >= 0 ? MSG_DONTWAIT : MSG_WAITFORONE, NULL);
+        if(received <= 0)
+        {
+            return -1;
+        }
+        
+        for(int i(0); i < received; ++i)
+        {
+            sizes[i] = f_batch_headers[i].msg_len;
+        }
+#else
+        // No recvmmsg() : one recvmsg() per datagram, only the first one may block
+        int received(0);
+        for(; received < count; ++received)
+        {
+            struct msghdr& h(f_batch_headers[received]);
+            memset(&h, 0, sizeof(h));
+            h.msg_iov = &buffers[received];
+            h.msg_iovlen = 1;
+            if(want_timestamps)
+            {
+                h.msg_control = &f_batch_control[received * control_size];
+                h.msg_controllen = control_size;
+            }
+            ssize_t r(recvmsg(f_socket, &h, (received > 0 || max_wait_ms >= 0) ? MSG_DONTWAIT : 0));
+            if(r < 0)
+            {
+                break;
+            }
+            sizes[received] = r;
+        }
+        if(received == 0)
+        {
+            return -1;
+        }
+#endif
+        
+        if(timestamps != NULL)
+        {
+            for(int i(0); i < received; ++i)
+            {
+                timestamps[i].tv_sec = 0;
+                timestamps[i].tv_nsec = 0;
+                if(!want_timestamps)
+                {
+                    continue;
+                }
+#ifdef __linux__
+                struct msghdr *h(&f_batch_headers[i].msg_hdr);
+#else
+                struct msghdr *h(&f_batch_headers[i]);
+#endif
+                for(struct cmsghdr *c(CMSG_FIRSTHDR(h)); c != NULL; c = CMSG_NXTHDR(h, c))
+                {
+#ifdef SO_TIMESTAMPNS
+                    if(c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_TIMESTAMPNS)
+                    {
+                        memcpy(&timestamps[i], CMSG_DATA(c), sizeof(struct timespec));
+                    }
+#else
+                    if(c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_TIMESTAMP)
+                    {
+                        struct timeval tv;
+                        memcpy(&tv, CMSG_DATA(c), sizeof(tv));
+                        timestamps[i].tv_sec = tv.tv_sec;
+                        timestamps[i].tv_nsec = tv.tv_usec * 1000;
+                    }
+#endif
+                }
+            }
+        }
+        
+        return received;
+    }
+    
+    /** \brief Ask the kernel to timestamp the incoming datagrams.
+     *
+     * Once enabled, recv_batch() returns the time at which each datagram
+     * reached the network stack, which is much closer to the real arrival
+     * time than a clock read after the receiving thread woke up. Linux
+     * provides nanosecond timestamps (SO_TIMESTAMPNS), other systems
+     * microsecond ones (SO_TIMESTAMP).
+     *
+     * \param[in] enable  Whether the datagrams should be timestamped.
+     *
+     * \return 0 on success, -1 if an error occurs (errno is set accordingly.)
+     */
+    int udp_server::set_timestamps(bool enable)
+    {
+        int on(enable ? 1 : 0);
+#ifdef SO_TIMESTAMPNS
+        int r(setsockopt(f_socket, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)));
+#else
+        int r(setsockopt(f_socket, SOL_SOCKET, SO_TIMESTAMP, &on, sizeof(on)));
+#endif
+        if(r == 0)
+        {
+            f_timestamps = enable;
+        }
+        return r;
+    }
+    
+    /** \brief Let the kernel busy poll the device when the socket is empty.
+     *
+     * With busy polling, a blocking receive spins on the network device
+     * queue for up to \p busy_poll_us microseconds instead of sleeping
+     * until the next interrupt. This trades CPU time for lower and steadier
+     * latency, and is only useful for latency sensitive receivers. Pass 0 to
+     * disable it again.
+     *
+     * \note
+     * Only available on Linux (SO_BUSY_POLL); values above the
+     * net.core.busy_read limit may require CAP_NET_ADMIN.
+     *
+     * \param[in] busy_poll_us  The busy poll duration, in microseconds.
+     *
+     * \return 0 on success, -1 if an error occurs or the option is not
+     * supported (errno is set accordingly.)
+     */
+    int udp_server::set_busy_poll(int busy_poll_us)
+    {
+#ifdef SO_BUSY_POLL
+        return setsockopt(f_socket, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us, sizeof(busy_poll_us));
+#else
+        (void) busy_poll_us;
+        errno = ENOPROTOOPT;
+        return -1;
+#endif
+    }
+    
@@ -11,9 +11,12 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netdb.h>
+#include <time.h>
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include <unistd.h>
 
     
@@ -56,12 +59,25 @@ public:
     
     int                 recv(char *msg, size_t max_size);
     int                 timed_recv(char *msg, size_t max_size, int max_wait_ms);
+    int                 recv_batch(struct iovec *buffers, size_t *sizes, struct timespec *timestamps, int count, int max_wait_ms = -1);
+    
+    int                 set_timestamps(bool enable);
+    int                 set_busy_poll(int busy_poll_us);
     
 private:
     int                 f_socket;
     int                 f_port;
     std::string         f_addr;
     struct addrinfo *   f_addrinfo;
+    bool                f_timestamps;
+    
+    // recv_batch() headers and control buffers, grown to the largest batch requested
+#ifdef __linux__
+    std::vector<struct mmsghdr> f_batch_headers;
+#else
+    std::vector<struct msghdr>  f_batch_headers;
+#endif
+    std::vector<char>   f_batch_control;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,281 @@
+/*
+ ==============================================================================
+
+    CaptureDaemon.cpp
+    PlayMe - SignalProcessor tools
+    Headless build of the plugin : the SignalProcessor processor analyses an
+    audio input (ALSA or JACK on Linux) directly, without a DAW nor a window,
+    and sends its messages as the plugin does. It is the Standalone wrapper
+    of juce_audio_plugin_client (AudioDeviceManager + AudioProcessorPlayer)
+    without its window, configured by a file instead of the device selector.
+
+    Without a DAW, there is no plugin chain and no host buffering between the
+    input and the analysis : the latency is the device buffer size
+
+ ==============================================================================
+ */
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <syslog.h>
+#include <unistd.h>
+
+//==============================================================================
+/*  Configuration file :
+
+    <SIGNALPROCESSORDAEMON destination="127.0.0.1" tempo="120" analysisWorkers="0">
+      <DEVICESETUP deviceType="ALSA" audioInputDeviceName="hw:1,0" audioOutputDeviceName=""
+                   audioDeviceRate="48000" audioDeviceBufferSize="64" audioDeviceInChans="11"/>
+      <MYPLUGINSETTINGS sendFFT="1" sendOSC="0" channel="1"/>
+    </SIGNALPROCESSORDAEMON>
+
+    DEVICESETUP is read by AudioDeviceManager (the attributes it saves, see --list for the devices).
+    MYPLUGINSETTINGS is the plugin's state, as saved by its host : the missing attributes keep their
+    default value. destination is the address the messages are sent to, tempo the one of the time info.
+    analysisWorkers is the number of threads computing the FFTs of the groups of channels with the audio
+    thread (see SignalProcessorAudioProcessor::setAnalysisWorkers) : 0 by default
+*/
+
+static bool runningAsDaemon = false;
+
+static void log (const String& message)
+{
+    if (runningAsDaemon)
+        syslog (LOG_INFO, "%s", message.toRawUTF8());
+    else
+        std::fprintf (stderr, "%s\n", message.toRawUTF8());
+}
+
+//==============================================================================
+// There is no host : the position is the number of samples analysed since the device started
+class DevicePlayHead  : public AudioPlayHead
+{
+public:
+    DevicePlayHead (double t)  : tempo (t), samplesPlayed (0), sampleRate (44100) {}
+
+    void deviceStarted (double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        samplesPlayed.store (0);
+    }
+
+    void blockPlayed (int nbOfSamples)
+    {
+        samplesPlayed.fetch_add (nbOfSamples, std::memory_order_relaxed);
+    }
+
+    bool getCurrentPosition (CurrentPositionInfo& result) override
+    {
+        const int64 position = samplesPlayed.load (std::memory_order_relaxed);
+
+        result.resetToDefault();
+        result.bpm = tempo;
+        result.timeInSamples = position;
+        result.timeInSeconds = position / sampleRate;
+        result.ppqPosition = result.timeInSeconds * tempo / 60.0;
+        result.isPlaying = true;
+        return true;
+    }
+
+private:
+    const double tempo;
+    std::atomic<int64> samplesPlayed;
+    double sampleRate;
+};
+
+//==============================================================================
+// The AudioProcessorPlayer, followed by the play head
+class CaptureCallback  : public AudioIODeviceCallback
+{
+public:
+    CaptureCallback (AudioProcessorPlayer& p, DevicePlayHead& h)  : player (p), playHead (h) {}
+
+    void audioDeviceIOCallback (const float** inputChannelData, int numInputChannels,
+                                float** outputChannelData, int numOutputChannels, int numSamples) override
+    {
+        player.audioDeviceIOCallback (inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples);
+        playHead.blockPlayed (numSamples);
+    }
+
+    void audioDeviceAboutToStart (AudioIODevice* device) override
+    {
+        playHead.deviceStarted (device->getCurrentSampleRate());
+        player.audioDeviceAboutToStart (device);
+
+        log ("Capturing " + device->getName() + " (" + device->getTypeName() + ") : "
+             + String (device->getActiveInputChannels().countNumberOfSetBits()) + " input channels, "
+             + String (device->getCurrentSampleRate()) + " Hz, "
+             + String (device->getCurrentBufferSizeSamples()) + " samples per block, "
+             + String (device->getInputLatencyInSamples()) + " samples of input latency");
+    }
+
+    void audioDeviceStopped() override
+    {
+        player.audioDeviceStopped();
+        log ("Device stopped");
+    }
+
+    void audioDeviceError (const String& errorMessage) override
+    {
+        log ("Device error : " + errorMessage);
+    }
+
+private:
+    AudioProcessorPlayer& player;
+    DevicePlayHead& playHead;
+};
+
+//==============================================================================
+// SIGTERM and SIGINT only set a flag : the message thread stops the device and quits
+static std::atomic<bool> stopRequested (false);
+
+static void requestStop (int)
+{
+    stopRequested.store (true);
+}
+
+class StopChecker  : public Timer
+{
+public:
+    void timerCallback() override
+    {
+        if (stopRequested.load())
+            MessageManager::getInstance()->stopDispatchLoop();
+    }
+};
+
+//==============================================================================
+static void listDevices()
+{
+    AudioDeviceManager deviceManager;
+    const OwnedArray<AudioIODeviceType>& types = deviceManager.getAvailableDeviceTypes();
+
+    for (int i = 0; i < types.size(); ++i)
+    {
+        types[i]->scanForDevices();
+        const StringArray names (types[i]->getDeviceNames (true));
+
+        std::printf ("deviceType=\"%s\"\n", types[i]->getTypeName().toRawUTF8());
+        for (int n = 0; n < names.size(); ++n)
+            std::printf ("    audioInputDeviceName=\"%s\"\n", names[n].toRawUTF8());
+    }
+}
+
+static int run (const XmlElement& config)
+{
+    const XmlElement* deviceSetup = config.getChildByName ("DEVICESETUP");
+    if (deviceSetup == nullptr)
+    {
+        log ("The configuration has no DEVICESETUP element");
+        return 1;
+    }
+
+    SignalProcessorAudioProcessor* signalProcessor = new SignalProcessorAudioProcessor (config.getStringAttribute ("destination", "127.0.0.1"));
+    ScopedPointer<AudioProcessor> processor (signalProcessor);
+
+    // Before the player prepares the processor
+    const int nbOfAnalysisWorkers = jlimit (0, (int) AnalysisTaskPool::maxNbOfWorkers, config.getIntAttribute ("analysisWorkers", 0));
+    if (nbOfAnalysisWorkers > 0)
+    {
+        signalProcessor->setAnalysisWorkers (nbOfAnalysisWorkers);
+        log ("Analysis on the audio thread and " + String (nbOfAnalysisWorkers) + " workers");
+    }
+
+    // The plugin's state, as a host would restore it
+    if (const XmlElement* settings = config.getChildByName ("MYPLUGINSETTINGS"))
+    {
+        MemoryBlock state;
+        AudioProcessor::copyXmlToBinary (*settings, state);
+        processor->setStateInformation (state.getData(), (int) state.getSize());
+    }
+
+    DevicePlayHead playHead (config.getDoubleAttribute ("tempo", 120));
+    processor->setPlayHead (&playHead);
+
+    AudioProcessorPlayer player;
+    player.setProcessor (processor);
+    CaptureCallback callback (player, playHead);
+
+    // No fallback to the default device : a render node must capture the configured input or fail
+    AudioDeviceManager deviceManager;
+    const String error (deviceManager.initialise (256, 0, deviceSetup, false));
+    if (error.isNotEmpty() || deviceManager.getCurrentAudioDevice() == nullptr)
+    {
+        log ("Cannot open the audio device : " + (error.isNotEmpty() ? error : String ("no device")));
+        return 1;
+    }
+
+    deviceManager.addAudioCallback (&callback);
+
+    std::signal (SIGTERM, requestStop);
+    std::signal (SIGINT, requestStop);
+    StopChecker stopChecker;
+    stopChecker.startTimer (100);
+
+    // The processor's AsyncUpdater needs the message loop
+    MessageManager::getInstance()->runDispatchLoop();
+
+    stopChecker.stopTimer();
+    deviceManager.removeAudioCallback (&callback);
+    deviceManager.closeAudioDevice();
+    player.setProcessor (nullptr);
+    log ("Stopped");
+    return 0;
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    bool detach = false, list = false;
+    const char* configPath = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const String arg (argv[i]);
+
+        if      (arg == "--daemon")         detach = true;
+        else if (arg == "--list")           list = true;
+        else if (configPath == nullptr)     configPath = argv[i];
+    }
+
+    if (configPath == nullptr && ! list)
+    {
+        std::fprintf (stderr, "usage: %s [--daemon] <configuration file>\n       %s --list\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    // Before JUCE starts any thread : only the calling thread survives the fork. The working directory
+    // is kept, for the relative configuration path
+    if (detach)
+    {
+        if (daemon (1, 0) != 0)
+        {
+            std::perror ("daemon");
+            return 1;
+        }
+
+        openlog ("SignalProcessorDaemon", LOG_PID, LOG_DAEMON);
+        runningAsDaemon = true;
+    }
+
+    ScopedJuceInitialiser_GUI juce;
+
+    if (list)
+    {
+        listDevices();
+        return 0;
+    }
+
+    ScopedPointer<XmlElement> config (XmlDocument::parse (File::getCurrentWorkingDirectory().getChildFile (String (configPath))));
+    if (config == nullptr || ! config->hasTagName ("SIGNALPROCESSORDAEMON"))
+    {
+        log (String (configPath) + " : not a SIGNALPROCESSORDAEMON configuration file");
+        return 1;
+    }
+
+    return run (*config);
+}
@@ -0,0 +1,404 @@
+/*
+ ==============================================================================
+
+    FeatureCache.cpp
+    PlayMe - SignalProcessor tools
+    Persistent, memory-mapped cache of analysed tracks
+
+ ==============================================================================
+ */
+
+#include "FeatureCache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FeatureCache
+{
+    static const char magic[8] = { 'S', 'P', 'F', 'C', 'A', 'C', 'H', '1' };
+
+    static uint64_t aligned (uint64_t size)     { return (size + columnAlignment - 1) & ~(uint64_t) (columnAlignment - 1); }
+
+    //==============================================================================
+    std::string Key::toHex() const
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::string hex;
+        for (size_t i = 0; i < sizeof (bytes); ++i)
+        {
+            hex += digits[bytes[i] >> 4];
+            hex += digits[bytes[i] & 0xf];
+        }
+
+        return hex;
+    }
+
+    bool Key::operator== (const Key& other) const
+    {
+        return std::memcmp (bytes, other.bytes, sizeof (bytes)) == 0;
+    }
+
+    //==============================================================================
+    static const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static const uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+
+    static uint64_t rotateLeft (uint64_t value, int bits)      { return (value << bits) | (value >> (64 - bits)); }
+
+    static uint64_t avalanche (uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        hash *= prime3;
+        return hash ^ (hash >> 32);
+    }
+
+    KeyHasher::KeyHasher()
+    {
+        for (int i = 0; i < 4; ++i)
+            lanes[i] = prime1 * (uint64_t) (i + 1) + prime2;
+    }
+
+    void KeyHasher::processStripe (const uint8_t* stripe)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            uint64_t input;
+            std::memcpy (&input, stripe + i * 8, 8);
+            lanes[i] = rotateLeft (lanes[i] + input * prime2, 31) * prime1;
+        }
+    }
+
+    void KeyHasher::update (const void* data, size_t size)
+    {
+        const uint8_t* bytes = (const uint8_t*) data;
+        totalSize += size;
+
+        if (nbOfPendingBytes > 0)
+        {
+            const size_t nbOfCopied = std::min (size, sizeof (pending) - nbOfPendingBytes);
+            std::memcpy (pending + nbOfPendingBytes, bytes, nbOfCopied);
+            nbOfPendingBytes += nbOfCopied;
+            bytes += nbOfCopied;
+            size -= nbOfCopied;
+
+            if (nbOfPendingBytes < sizeof (pending))
+                return;
+
+            processStripe (pending);
+            nbOfPendingBytes = 0;
+        }
+
+        for (; size >= sizeof (pending); bytes += sizeof (pending), size -= sizeof (pending))
+            processStripe (bytes);
+
+        std::memcpy (pending, bytes, size);
+        nbOfPendingBytes = size;
+    }
+
+    Key KeyHasher::getKey() const
+    {
+        // The last stripe is padded with zeros : the total size tells it apart from real zeros
+        KeyHasher last (*this);
+        if (last.nbOfPendingBytes > 0)
+        {
+            std::memset (last.pending + last.nbOfPendingBytes, 0, sizeof (pending) - last.nbOfPendingBytes);
+            last.processStripe (last.pending);
+        }
+
+        // Every part of the key depends on all the lanes
+        Key key;
+        for (int i = 0; i < 4; ++i)
+        {
+            const uint64_t hash = avalanche (last.lanes[i] + rotateLeft (last.lanes[(i + 1) & 3], 23)
+                                             + totalSize * prime4 + (uint64_t) i * prime3);
+            std::memcpy (key.bytes + i * 8, &hash, 8);
+        }
+
+        return key;
+    }
+
+    //==============================================================================
+    uint64_t TrackView::find (int64_t time) const
+    {
+        return (uint64_t) (std::lower_bound (times, times + nbOfRows, time) - times);
+    }
+
+    //==============================================================================
+    void Tracks::add (Feature feature, int64_t time, const float* values, int nbOfValues)
+    {
+        Track& track = tracks[feature];
+        if (track.nbOfColumns < 0)
+            track.nbOfColumns = nbOfValues;
+
+        // Every row of a track has the same number of columns : the others are cut or padded with zeros
+        track.times.push_back (time);
+        const int nbOfCopied = std::min (nbOfValues, track.nbOfColumns);
+        track.values.insert (track.values.end(), values, values + nbOfCopied);
+        track.values.insert (track.values.end(), (size_t) (track.nbOfColumns - nbOfCopied), 0.0f);
+    }
+
+    void Tracks::append (const Tracks& other)
+    {
+        for (int f = 0; f < nbOfFeatures; ++f)
+        {
+            const Track& source = other.tracks[f];
+            if (source.times.empty())
+                continue;
+
+            TrackView view = other.getTrack ((Feature) f);
+            for (uint64_t row = 0; row < view.nbOfRows; ++row)
+                add ((Feature) f, view.times[row], &source.values[row * source.nbOfColumns], source.nbOfColumns);
+        }
+    }
+
+    void Tracks::sort()
+    {
+        for (int f = 0; f < nbOfFeatures; ++f)
+        {
+            Track& track = tracks[f];
+            if (std::is_sorted (track.times.begin(), track.times.end()))
+                continue;
+
+            std::vector<size_t> order (track.times.size());
+            for (size_t i = 0; i < order.size(); ++i)
+                order[i] = i;
+
+            std::stable_sort (order.begin(), order.end(),
+                              [&track] (size_t a, size_t b) { return track.times[a] < track.times[b]; });
+
+            Track sorted;
+            sorted.nbOfColumns = track.nbOfColumns;
+            sorted.times.reserve (track.times.size());
+            sorted.values.reserve (track.values.size());
+
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                sorted.times.push_back (track.times[order[i]]);
+                sorted.values.insert (sorted.values.end(), track.values.begin() + order[i] * track.nbOfColumns,
+                                      track.values.begin() + (order[i] + 1) * track.nbOfColumns);
+            }
+
+            std::swap (track, sorted);
+        }
+    }
+
+    TrackView Tracks::getTrack (Feature feature) const
+    {
+        const Track& track = tracks[feature];
+
+        TrackView view;
+        view.times = track.times.data();
+        view.nbOfRows = track.times.size();
+        view.nbOfColumns = std::max (track.nbOfColumns, 0);
+        view.values = track.values.data();
+        view.rowStride = (uint64_t) view.nbOfColumns;
+        view.columnStride = 1;
+        return view;
+    }
+
+    uint64_t Tracks::getNbOfRows() const
+    {
+        uint64_t nbOfRows = 0;
+        for (int f = 0; f < nbOfFeatures; ++f)
+            nbOfRows += tracks[f].times.size();
+
+        return nbOfRows;
+    }
+
+    //==============================================================================
+    std::string getPath (const std::string& directory, const Key& key)
+    {
+        return directory + "/" + key.toHex() + ".spfc";
+    }
+
+    bool write (const std::string& path, const Key& key, double sampleRate, uint64_t nbOfSamples, const Tracks& tracks)
+    {
+        // Layout : every array starts on a columnAlignment boundary
+        TrackHeader trackHeaders[nbOfFeatures];
+        uint64_t size = aligned (sizeof (Header) + sizeof (trackHeaders));
+
+        for (int f = 0; f < nbOfFeatures; ++f)
+        {
+            const TrackView track = tracks.getTrack ((Feature) f);
+            TrackHeader& header = trackHeaders[f];
+            std::memset (&header, 0, sizeof (header));
+
+            header.nbOfRows = track.nbOfRows;
+            header.nbOfColumns = (uint32_t) track.nbOfColumns;
+            header.timesOffset = size;
+            size += aligned (track.nbOfRows * sizeof (int64_t));
+            header.columnsOffset = size;
+            header.columnStride = aligned (track.nbOfRows * sizeof (float)) / sizeof (float);
+            size += header.columnStride * sizeof (float) * track.nbOfColumns;
+        }
+
+        char pid[32];
+        std::snprintf (pid, sizeof (pid), ".%d.tmp", (int) getpid());
+        const std::string temporaryPath = path + pid;
+
+        const int file = ::open (temporaryPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (file < 0)
+            return false;
+
+        void* mapping = MAP_FAILED;
+        if (ftruncate (file, (off_t) size) == 0)
+            mapping = mmap (nullptr, (size_t) size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close (file);
+            unlink (temporaryPath.c_str());
+            errno = error;
+            return false;
+        }
+
+        // The file is created with zeros : only the header and the values are written
+        char* const data = (char*) mapping;
+        Header* header = (Header*) data;
+        std::memcpy (header->magic, magic, sizeof (magic));
+        std::memcpy (header->key, key.bytes, sizeof (key.bytes));
+        header->sampleRate = sampleRate;
+        header->nbOfSamples = nbOfSamples;
+        header->fileSize = size;
+        std::memcpy (data + sizeof (Header), trackHeaders, sizeof (trackHeaders));
+
+        for (int f = 0; f < nbOfFeatures; ++f)
+        {
+            const TrackView track = tracks.getTrack ((Feature) f);
+            const TrackHeader& trackHeader = trackHeaders[f];
+
+            if (track.nbOfRows > 0)
+                std::memcpy (data + trackHeader.timesOffset, track.times, track.nbOfRows * sizeof (int64_t));
+
+            float* const columns = (float*) (data + trackHeader.columnsOffset);
+            for (int column = 0; column < track.nbOfColumns; ++column)
+            {
+                float* const destination = columns + column * trackHeader.columnStride;
+                for (uint64_t row = 0; row < track.nbOfRows; ++row)
+                    destination[row] = track.get (row, column);
+            }
+        }
+
+        const bool synced = msync (mapping, (size_t) size, MS_SYNC) == 0;
+        munmap (mapping, (size_t) size);
+
+        if (! synced || ::close (file) != 0 || rename (temporaryPath.c_str(), path.c_str()) != 0)
+        {
+            const int error = errno;
+            unlink (temporaryPath.c_str());
+            errno = error;
+            return false;
+        }
+
+        return true;
+    }
+
+    //==============================================================================
+    Reader::Reader() {}
+
+    Reader::~Reader()
+    {
+        close();
+    }
+
+    bool Reader::open (const std::string& path, const Key& key)
+    {
+        close();
+
+        file = ::open (path.c_str(), O_RDONLY);
+        if (file < 0)
+            return false;
+
+        struct stat status;
+        if (fstat (file, &status) != 0 || (size_t) status.st_size < sizeof (Header) + nbOfFeatures * sizeof (TrackHeader))
+        {
+            close();
+            return false;
+        }
+
+        void* newMapping = mmap (nullptr, (size_t) status.st_size, PROT_READ, MAP_SHARED, file, 0);
+        if (newMapping == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+
+        mapping = (const char*) newMapping;
+        mappingSize = (size_t) status.st_size;
+
+        const Header* header = (const Header*) mapping;
+        bool valid = std::memcmp (header->magic, magic, sizeof (magic)) == 0
+                  && std::memcmp (header->key, key.bytes, sizeof (key.bytes)) == 0
+                  && header->fileSize == mappingSize;
+
+        const TrackHeader* tracks = (const TrackHeader*) (mapping + sizeof (Header));
+        for (int f = 0; f < nbOfFeatures && valid; ++f)
+        {
+            const TrackHeader& track = tracks[f];
+            valid = track.timesOffset % columnAlignment == 0 && track.columnsOffset % columnAlignment == 0
+                 && track.columnStride >= track.nbOfRows
+                 && track.timesOffset + track.nbOfRows * sizeof (int64_t) <= mappingSize
+                 && track.columnsOffset + track.columnStride * sizeof (float) * track.nbOfColumns <= mappingSize;
+        }
+
+        if (! valid)
+        {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void Reader::close()
+    {
+        if (mapping != nullptr)
+        {
+            munmap ((void*) mapping, mappingSize);
+            mapping = nullptr;
+            mappingSize = 0;
+        }
+
+        if (file >= 0)
+        {
+            ::close (file);
+            file = -1;
+        }
+    }
+
+    TrackView Reader::getTrack (Feature feature) const
+    {
+        TrackView view;
+        if (mapping == nullptr)
+            return view;
+
+        const TrackHeader& track = ((const TrackHeader*) (mapping + sizeof (Header)))[feature];
+        view.times = (const int64_t*) (mapping + track.timesOffset);
+        view.nbOfRows = track.nbOfRows;
+        view.nbOfColumns = (int) track.nbOfColumns;
+        view.values = (const float*) (mapping + track.columnsOffset);
+        view.rowStride = 1;
+        view.columnStride = track.columnStride;
+        return view;
+    }
+
+    double Reader::getSampleRate() const
+    {
+        return mapping != nullptr ? ((const Header*) mapping)->sampleRate : 0;
+    }
+
+    uint64_t Reader::getNbOfSamples() const
+    {
+        return mapping != nullptr ? ((const Header*) mapping)->nbOfSamples : 0;
+    }
+}
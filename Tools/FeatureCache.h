@@ -0,0 +1,166 @@
+/*
+ ==============================================================================
+
+    FeatureCache.h
+    PlayMe - SignalProcessor tools
+    Persistent cache of analysed tracks. Every entry is one file, named after
+    its key : a hash of the audio content and of the analysis settings, so a
+    track is only analysed again when the audio or the settings change.
+    The features are stored by columns, memory-mapped when read : the
+    values are used in place, without any parsing or copy
+
+ ==============================================================================
+ */
+
+#ifndef FEATURECACHE_H_INCLUDED
+#define FEATURECACHE_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace FeatureCache
+{
+    enum Feature
+    {
+        signalLevel = 0,                // 1 column : the level
+        signalInstantVal,               // 1 column : the value
+        impulse,                        // No column, only the times
+        logFFT,                         // 1 + 12 columns : the fundamental frequency, then the bands
+        linearFFT,                      // 1 + N columns : the fundamental frequency, then the bins
+        nbOfFeatures
+    };
+
+    // File layout : a Header, nbOfFeatures TrackHeaders, then the columns. For every track, the times
+    // (int64, samples from the start of the audio) and every float column are contiguous arrays of
+    // nbOfRows values, starting on a columnAlignment boundary
+    struct Header
+    {
+        char magic[8];                  // "SPFCACH1"
+        uint8_t key[32];
+        double sampleRate;
+        uint64_t nbOfSamples;           // Length of the analysed audio
+        uint64_t fileSize;              // Complete file : a truncated entry is ignored
+        uint64_t reserved[3];
+    };
+
+    struct TrackHeader
+    {
+        uint64_t nbOfRows;
+        uint32_t nbOfColumns;
+        uint32_t reserved;
+        uint64_t timesOffset;           // From the start of the file
+        uint64_t columnsOffset;         // First column. Column c is at columnsOffset + c * columnStride floats
+        uint64_t columnStride;
+    };
+
+    static const size_t columnAlignment = 64;
+
+    struct Key
+    {
+        uint8_t bytes[32];
+
+        std::string toHex() const;
+        bool operator== (const Key& other) const;
+    };
+
+    //==============================================================================
+    // Builds the keys : a 256 bits non-cryptographic hash (4 lanes of 64 bits, as xxHash64 without the
+    // final merge), several GB/s, so that hashing a file costs much less than analysing it
+    class KeyHasher
+    {
+    public:
+        KeyHasher();
+
+        void update (const void* data, size_t size);
+        Key getKey() const;
+
+    private:
+        void processStripe (const uint8_t* stripe);
+
+        uint64_t lanes[4];
+        uint8_t pending[32];            // Incomplete stripe
+        size_t nbOfPendingBytes = 0;
+        uint64_t totalSize = 0;
+    };
+
+    //==============================================================================
+    // A read-only view of one track, in memory (Tracks) or mapped (Reader)
+    struct TrackView
+    {
+        const int64_t* times = nullptr;
+        uint64_t nbOfRows = 0;
+        int nbOfColumns = 0;
+        const float* values = nullptr;
+        uint64_t rowStride = 0;         // In floats
+        uint64_t columnStride = 0;
+
+        float get (uint64_t row, int column) const      { return values[row * rowStride + column * columnStride]; }
+
+        // First row at or after time, nbOfRows if there is none
+        uint64_t find (int64_t time) const;
+    };
+
+    //==============================================================================
+    // Features of one track as they are computed. Rows are appended in any order, sort() orders them by time
+    class Tracks
+    {
+    public:
+        void add (Feature feature, int64_t time, const float* values, int nbOfValues);
+
+        // Append all the rows of other, after the existing ones
+        void append (const Tracks& other);
+
+        // Stable : the rows with the same time keep their order
+        void sort();
+
+        TrackView getTrack (Feature feature) const;
+        uint64_t getNbOfRows() const;
+
+    private:
+        struct Track
+        {
+            int nbOfColumns = -1;       // Set by the first row
+            std::vector<int64_t> times;
+            std::vector<float> values;  // Row by row
+        };
+
+        Track tracks[nbOfFeatures];
+    };
+
+    //==============================================================================
+    // <directory>/<key in hex>.spfc
+    std::string getPath (const std::string& directory, const Key& key);
+
+    // Writes a temporary file and renames it : a reader never maps an entry which is being written.
+    // Returns false and sets errno if the file cannot be written
+    bool write (const std::string& path, const Key& key, double sampleRate, uint64_t nbOfSamples, const Tracks& tracks);
+
+    //==============================================================================
+    class Reader
+    {
+    public:
+        Reader();
+        ~Reader();
+
+        // Returns false if the file does not exist, is not a complete cache entry, or has another key
+        bool open (const std::string& path, const Key& key);
+        void close();
+
+        // Valid until close()
+        TrackView getTrack (Feature feature) const;
+        double getSampleRate() const;
+        uint64_t getNbOfSamples() const;
+
+    private:
+        int file = -1;
+        const char* mapping = nullptr;
+        size_t mappingSize = 0;
+
+        Reader (const Reader&) = delete;
+        Reader& operator= (const Reader&) = delete;
+    };
+}
+
+#endif  // FEATURECACHE_H_INCLUDED
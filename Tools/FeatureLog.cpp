@@ -0,0 +1,228 @@
+/*
+ ==============================================================================
+
+    FeatureLog.cpp
+    PlayMe - SignalProcessor tools
+    Append-only, memory-mapped log of the packets sent by the plugin
+
+ ==============================================================================
+ */
+
+#include "FeatureLog.h"
+
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FeatureLog
+{
+    static const char magic[8] = { 'S', 'P', 'F', 'L', 'O', 'G', '0', '1' };
+    static const size_t growthSize = 16 * 1024 * 1024;     // The file grows 16 MB at a time
+
+    //==============================================================================
+    Writer::Writer() {}
+
+    Writer::~Writer()
+    {
+        close();
+    }
+
+    bool Writer::open (const std::string& path)
+    {
+        close();
+
+        file = ::open (path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (file < 0)
+            return false;
+
+        if (! grow (sizeof (Header)))
+        {
+            close();
+            return false;
+        }
+
+        Header* header = (Header*) mapping;
+        std::memset (header, 0, sizeof (Header));
+        std::memcpy (header->magic, magic, sizeof (magic));
+        header->usedBytes = sizeof (Header);
+        return true;
+    }
+
+    void Writer::close()
+    {
+        if (mapping != nullptr)
+        {
+            // Give the unused end of the last chunk back to the file system
+            const uint64_t usedBytes = getUsedBytes();
+            munmap (mapping, mappingSize);
+            mapping = nullptr;
+            mappingSize = 0;
+
+            const int truncated = ftruncate (file, (off_t) usedBytes);
+            (void) truncated;               // The log is still valid with its unused end
+        }
+
+        if (file >= 0)
+        {
+            ::close (file);
+            file = -1;
+        }
+    }
+
+    bool Writer::grow (size_t minimumSize)
+    {
+        size_t newSize = mappingSize;
+        while (newSize < minimumSize)
+            newSize += growthSize;
+
+        if (ftruncate (file, (off_t) newSize) != 0)
+            return false;
+
+        void* newMapping = mmap (nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (newMapping == MAP_FAILED)
+            return false;
+
+        if (mapping != nullptr)
+            munmap (mapping, mappingSize);
+
+        mapping = (char*) newMapping;
+        mappingSize = newSize;
+        return true;
+    }
+
+    bool Writer::append (int64_t time, int port, const char* data, size_t size)
+    {
+        if (mapping == nullptr || size > 0xffff)
+            return false;
+
+        Header* header = (Header*) mapping;
+        const size_t offset = (size_t) header->usedBytes;
+        const size_t recordSize = sizeof (RecordHeader) + paddedSize (size);
+
+        if (offset + recordSize > mappingSize)
+        {
+            if (! grow (offset + recordSize))
+                return false;
+
+            header = (Header*) mapping;
+        }
+
+        RecordHeader* record = (RecordHeader*) (mapping + offset);
+        record->time = time;
+        record->port = (uint16_t) port;
+        record->size = (uint16_t) size;
+        record->reserved = 0;
+        std::memcpy (mapping + offset + sizeof (RecordHeader), data, size);
+        std::memset (mapping + offset + sizeof (RecordHeader) + size, 0, paddedSize (size) - size);
+
+        // The record is complete before the header counts it
+        std::atomic_thread_fence (std::memory_order_release);
+        header->nbOfRecords += 1;
+        header->usedBytes = offset + recordSize;
+        return true;
+    }
+
+    uint64_t Writer::getNbOfRecords() const
+    {
+        return mapping != nullptr ? ((const Header*) mapping)->nbOfRecords : 0;
+    }
+
+    uint64_t Writer::getUsedBytes() const
+    {
+        return mapping != nullptr ? ((const Header*) mapping)->usedBytes : 0;
+    }
+
+    //==============================================================================
+    Reader::Reader() {}
+
+    Reader::~Reader()
+    {
+        close();
+    }
+
+    bool Reader::open (const std::string& path)
+    {
+        close();
+
+        file = ::open (path.c_str(), O_RDONLY);
+        if (file < 0)
+            return false;
+
+        struct stat status;
+        if (fstat (file, &status) != 0 || (size_t) status.st_size < sizeof (Header))
+        {
+            close();
+            return false;
+        }
+
+        void* newMapping = mmap (nullptr, (size_t) status.st_size, PROT_READ, MAP_SHARED, file, 0);
+        if (newMapping == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+
+        mapping = (const char*) newMapping;
+        mappingSize = (size_t) status.st_size;
+
+        const Header* header = (const Header*) mapping;
+        if (std::memcmp (header->magic, magic, sizeof (magic)) != 0 || header->usedBytes > mappingSize)
+        {
+            close();
+            return false;
+        }
+
+        // Records are read sequentially, from the start to the end
+        madvise ((void*) mapping, mappingSize, MADV_SEQUENTIAL);
+        return true;
+    }
+
+    void Reader::close()
+    {
+        if (mapping != nullptr)
+        {
+            munmap ((void*) mapping, mappingSize);
+            mapping = nullptr;
+            mappingSize = 0;
+        }
+
+        if (file >= 0)
+        {
+            ::close (file);
+            file = -1;
+        }
+    }
+
+    bool Reader::next (size_t& offset, Record& record) const
+    {
+        if (mapping == nullptr)
+            return false;
+
+        const size_t usedBytes = (size_t) ((const Header*) mapping)->usedBytes;
+        if (offset < sizeof (Header))
+            offset = sizeof (Header);
+
+        if (offset + sizeof (RecordHeader) > usedBytes)
+            return false;
+
+        const RecordHeader* header = (const RecordHeader*) (mapping + offset);
+        const size_t recordSize = sizeof (RecordHeader) + paddedSize (header->size);
+        if (offset + recordSize > usedBytes)
+            return false;
+
+        record.time = header->time;
+        record.port = header->port;
+        record.data = mapping + offset + sizeof (RecordHeader);
+        record.size = header->size;
+        offset += recordSize;
+        return true;
+    }
+
+    uint64_t Reader::getNbOfRecords() const
+    {
+        return mapping != nullptr ? ((const Header*) mapping)->nbOfRecords : 0;
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ ==============================================================================
+
+    FeatureLog.h
+    PlayMe - SignalProcessor tools
+    Append-only, memory-mapped log of the packets sent by the plugin : each
+    record is the raw packet (Protobuf or OSC), the port it was sent to, and
+    its receive time in nanoseconds
+
+ ==============================================================================
+ */
+
+#ifndef FEATURELOG_H_INCLUDED
+#define FEATURELOG_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace FeatureLog
+{
+    // File layout : a Header, then the records one after the other. Every record starts on an 8 bytes
+    // boundary : a RecordHeader followed by the packet, padded with zeros
+    struct Header
+    {
+        char magic[8];                  // "SPFLOG01"
+        uint64_t usedBytes;             // Header and complete records : a crash never leaves a partial record
+        uint64_t nbOfRecords;
+        uint64_t reserved[5];
+    };
+
+    struct RecordHeader
+    {
+        int64_t time;                   // Receive time, nanoseconds (CLOCK_REALTIME when it comes from the kernel)
+        uint16_t port;
+        uint16_t size;                  // Packet size, without the padding
+        uint32_t reserved;
+    };
+
+    static const size_t alignment = 8;
+    inline size_t paddedSize (size_t size)      { return (size + alignment - 1) & ~(alignment - 1); }
+
+    //==============================================================================
+    class Writer
+    {
+    public:
+        Writer();
+        ~Writer();
+
+        // Creates (or truncates) the file. Returns false and sets errno if it cannot be created or mapped
+        bool open (const std::string& path);
+        void close();
+
+        // Returns false if the file could not grow (disk full) : the record is then lost
+        bool append (int64_t time, int port, const char* data, size_t size);
+
+        uint64_t getNbOfRecords() const;
+        uint64_t getUsedBytes() const;
+
+    private:
+        bool grow (size_t minimumSize);
+
+        int file = -1;
+        char* mapping = nullptr;
+        size_t mappingSize = 0;
+
+        Writer (const Writer&) = delete;
+        Writer& operator= (const Writer&) = delete;
+    };
+
+    //==============================================================================
+    class Reader
+    {
+    public:
+        Reader();
+        ~Reader();
+
+        // Returns false if the file cannot be mapped or is not a feature log
+        bool open (const std::string& path);
+        void close();
+
+        struct Record
+        {
+            int64_t time;
+            int port;
+            const char* data;           // Points into the mapped file : valid until close()
+            size_t size;
+        };
+
+        // Iterate over the records : offset starts at 0, returns false after the last record
+        bool next (size_t& offset, Record& record) const;
+
+        uint64_t getNbOfRecords() const;
+
+    private:
+        int file = -1;
+        const char* mapping = nullptr;
+        size_t mappingSize = 0;
+
+        Reader (const Reader&) = delete;
+        Reader& operator= (const Reader&) = delete;
+    };
+}
+
+#endif  // FEATURELOG_H_INCLUDED
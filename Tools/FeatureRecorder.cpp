@@ -0,0 +1,142 @@
+/*
+ ==============================================================================
+
+    FeatureRecorder.cpp
+    PlayMe - SignalProcessor tools
+    Record every packet sent by the plugin (Protobuf ports 7001 to 7005, the
+    MIDI event port 7007 and the OSC port 9000) into a feature log, with the
+    kernel's receive time.
+    The log can then be sent again with FeatureReplayer
+
+ ==============================================================================
+ */
+
+#include "FeatureLog.h"
+#include "udp_client_server.h"
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <poll.h>
+#include <time.h>
+#include <vector>
+
+static volatile std::sig_atomic_t stopRequested = 0;
+static void requestStop (int)       { stopRequested = 1; }
+
+static int64_t realtimeNanoseconds()
+{
+    struct timespec t;
+    clock_gettime (CLOCK_REALTIME, &t);
+    return (int64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+//==============================================================================
+// usage: FeatureRecorder <log file> [durationSeconds=0 (until Ctrl-C)] [ports=7001,7002,7003,7004,7005,7007,9000]
+int main (int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf (stderr, "usage: %s <log file> [durationSeconds] [port,port,...]\n", argv[0]);
+        return 1;
+    }
+
+    const char* path            = argv[1];
+    const int durationSeconds   = (argc > 2) ? std::atoi (argv[2]) : 0;
+    std::vector<int> ports;
+
+    if (argc > 3)
+    {
+        for (char* p = argv[3]; *p != 0; )
+        {
+            ports.push_back ((int) std::strtol (p, &p, 10));
+            if (*p == ',')
+                ++p;
+        }
+    }
+    else
+    {
+        ports = { 7001, 7002, 7003, 7004, 7005, 7007, 9000 };
+    }
+
+    FeatureLog::Writer log;
+    if (! log.open (path))
+    {
+        std::perror (path);
+        return 1;
+    }
+
+    std::vector<udp_server*> servers;
+    std::vector<struct pollfd> pollFds;
+    try
+    {
+        for (size_t i = 0; i < ports.size(); ++i)
+        {
+            servers.push_back (new udp_server ("0.0.0.0", ports[i]));
+            servers.back()->set_timestamps (true);
+
+            struct pollfd p = { servers.back()->get_socket(), POLLIN, 0 };
+            pollFds.push_back (p);
+        }
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::fprintf (stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    std::signal (SIGINT, requestStop);
+    std::signal (SIGTERM, requestStop);
+
+    // Receive buffers : one batch per wake-up and per socket
+    const int batchSize = 32;
+    const size_t maxPacketSize = 65536;
+    std::vector<char> buffers (batchSize * maxPacketSize);
+    struct iovec iovecs[batchSize];
+    size_t sizes[batchSize];
+    struct timespec timestamps[batchSize];
+
+    const int64_t endTime = durationSeconds > 0 ? realtimeNanoseconds() + (int64_t) durationSeconds * 1000000000 : 0;
+    uint64_t nbOfLostRecords = 0;
+
+    while (! stopRequested && (endTime == 0 || realtimeNanoseconds() < endTime))
+    {
+        if (poll (&pollFds[0], pollFds.size(), 100) <= 0)
+            continue;
+
+        for (size_t s = 0; s < servers.size(); ++s)
+        {
+            if ((pollFds[s].revents & POLLIN) == 0)
+                continue;
+
+            for (int i = 0; i < batchSize; ++i)
+            {
+                iovecs[i].iov_base = &buffers[i * maxPacketSize];
+                iovecs[i].iov_len = maxPacketSize;
+            }
+
+            const int received = servers[s]->recv_batch (iovecs, sizes, timestamps, batchSize, 0);
+            for (int i = 0; i < received; ++i)
+            {
+                // Without a kernel timestamp, fall back on the time the packet was read
+                const int64_t time = timestamps[i].tv_sec != 0 || timestamps[i].tv_nsec != 0
+                                       ? (int64_t) timestamps[i].tv_sec * 1000000000 + timestamps[i].tv_nsec
+                                       : realtimeNanoseconds();
+
+                if (! log.append (time, ports[s], (const char*) iovecs[i].iov_base, sizes[i]))
+                    ++nbOfLostRecords;
+            }
+        }
+    }
+
+    std::printf ("records=%llu bytes=%llu lost=%llu\n",
+                 (unsigned long long) log.getNbOfRecords(),
+                 (unsigned long long) log.getUsedBytes(),
+                 (unsigned long long) nbOfLostRecords);
+
+    log.close();
+    for (size_t i = 0; i < servers.size(); ++i)
+        delete servers[i];
+
+    return 0;
+}
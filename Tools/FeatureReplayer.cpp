@@ -0,0 +1,137 @@
+/*
+ ==============================================================================
+
+    FeatureReplayer.cpp
+    PlayMe - SignalProcessor tools
+    Send a feature log recorded by FeatureRecorder back to the ports it was
+    recorded on, at its original pace, N times faster, or as fast as possible
+
+ ==============================================================================
+ */
+
+#include "FeatureLog.h"
+#include "udp_client_server.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// One udp_client per port found in the log, created the first time the port is seen
+class Destinations
+{
+public:
+    Destinations (const std::string& a) : address (a) {}
+
+    ~Destinations()
+    {
+        for (size_t i = 0; i < clients.size(); ++i)
+            delete clients[i];
+    }
+
+    udp_client& get (int port)
+    {
+        for (size_t i = 0; i < clients.size(); ++i)
+            if (clients[i]->get_port() == port)
+                return *clients[i];
+
+        clients.push_back (new udp_client (address, port));
+        return *clients.back();
+    }
+
+private:
+    const std::string address;
+    std::vector<udp_client*> clients;
+};
+
+//==============================================================================
+// usage: FeatureReplayer <log file> [speed=1 (0 : as fast as possible)] [address=127.0.0.1] [loops=1]
+int main (int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf (stderr, "usage: %s <log file> [speed (0 = as fast as possible)] [address] [loops]\n", argv[0]);
+        return 1;
+    }
+
+    const char* path            = argv[1];
+    const double speed          = (argc > 2) ? std::atof (argv[2]) : 1.0;
+    const std::string address   = (argc > 3) ? argv[3] : "127.0.0.1";
+    const int nbOfLoops         = (argc > 4) ? std::atoi (argv[4]) : 1;
+
+    FeatureLog::Reader log;
+    if (! log.open (path))
+    {
+        std::fprintf (stderr, "%s : not a feature log\n", path);
+        return 1;
+    }
+
+    Destinations destinations (address);
+    uint64_t nbOfPackets = 0, nbOfBytes = 0, nbOfSendErrors = 0;
+    int64_t maxLatenessNs = 0;
+    double totalLatenessNs = 0;
+
+    const Clock::time_point replayStart = Clock::now();
+
+    try
+    {
+        for (int loop = 0; loop < nbOfLoops; ++loop)
+        {
+            const Clock::time_point loopStart = Clock::now();
+            size_t offset = 0;
+            int64_t firstTime = 0;
+            bool isFirst = true;
+            FeatureLog::Reader::Record record;
+
+            while (log.next (offset, record))
+            {
+                if (isFirst)
+                {
+                    firstTime = record.time;
+                    isFirst = false;
+                }
+
+                if (speed > 0)
+                {
+                    const Clock::time_point due = loopStart + std::chrono::nanoseconds ((int64_t) ((record.time - firstTime) / speed));
+
+                    // Sleep until shortly before the due time, then spin : sleeps are only accurate to about 100 us
+                    const Clock::time_point wakeUp = due - std::chrono::microseconds (200);
+                    if (Clock::now() < wakeUp)
+                        std::this_thread::sleep_until (wakeUp);
+                    while (Clock::now() < due) {}
+
+                    const int64_t lateness = std::chrono::duration_cast<std::chrono::nanoseconds> (Clock::now() - due).count();
+                    maxLatenessNs = std::max (maxLatenessNs, lateness);
+                    totalLatenessNs += (double) lateness;
+                }
+
+                if (destinations.get (record.port).send (record.data, record.size) < 0)
+                    ++nbOfSendErrors;
+
+                ++nbOfPackets;
+                nbOfBytes += record.size;
+            }
+        }
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::fprintf (stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    const double seconds = std::chrono::duration<double> (Clock::now() - replayStart).count();
+    std::printf ("packets=%llu bytes=%llu errors=%llu seconds=%.3f rate=%.0f pkt/s",
+                 (unsigned long long) nbOfPackets, (unsigned long long) nbOfBytes,
+                 (unsigned long long) nbOfSendErrors, seconds, seconds > 0 ? nbOfPackets / seconds : 0.0);
+
+    if (speed > 0 && nbOfPackets > 0)
+        std::printf (" lateness_avg=%.1f us lateness_max=%.1f us", totalLatenessNs / nbOfPackets / 1000.0, maxLatenessNs / 1000.0);
+
+    std::printf ("\n");
+    return 0;
+}
@@ -0,0 +1,29 @@
+/*
+ ==============================================================================
+
+    AppConfig.h
+    PlayMe - SignalProcessor tools
+    JUCE configuration of the command line tools built by CMakeLists.txt : only
+    the modules which need neither a display nor an audio device. The plugin
+    uses JuceLibraryCode/AppConfig.h, generated by the Introjucer
+
+ ==============================================================================
+ */
+
+#ifndef SIGNALPROCESSOR_TOOLS_APPCONFIG_H_INCLUDED
+#define SIGNALPROCESSOR_TOOLS_APPCONFIG_H_INCLUDED
+
+#define JUCE_MODULE_AVAILABLE_juce_core                     1
+#define JUCE_MODULE_AVAILABLE_juce_audio_basics             1
+#define JUCE_MODULE_AVAILABLE_juce_audio_formats            1
+
+#define JUCE_STANDALONE_APPLICATION                         1
+#define JUCE_GLOBAL_MODULE_SETTINGS_INCLUDED                1
+
+#define JUCE_USE_FLAC                                       1
+#define JUCE_USE_OGGVORBIS                                  1
+
+// The C library has lround : libFLAC must not declare its own
+#define HAVE_LROUND                                         1
+
+#endif  // SIGNALPROCESSOR_TOOLS_APPCONFIG_H_INCLUDED
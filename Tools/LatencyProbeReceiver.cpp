@@ -0,0 +1,357 @@
+/*
+ ==============================================================================
+
+    LatencyProbeReceiver.cpp
+    PlayMe - SignalProcessor tools
+    Loopback receiver of the plugin's latency probe (see Client/LatencyProbe.h) :
+    it reads the stamps of the impulse and signal level messages, Protobuf and
+    OSC, on the same monotonic clock as the plugin, and keeps the histograms
+    of their analysis, queueing and network delays, and of the total, from
+    the block's entry in processBlock to the packet's arrival.
+
+    Every interval, it prints the percentiles of the interval; at the end,
+    those of the whole run and the histogram of the total delay
+
+ ==============================================================================
+ */
+
+#include "LatencyProbe.h"
+#include "PerformanceStats.h"
+#include "osc/OscReceivedElements.h"
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+//==============================================================================
+enum Transport      { protobufTransport = 0, oscTransport, totalNumTransports };
+enum Message        { impulseMessage = 0, signalLevelMessage, totalNumMessages };
+enum Component      { analysisDelay = 0, queueingDelay, networkDelay, totalDelay, totalNumComponents };
+
+static const char* const transportNames[totalNumTransports]    = { "protobuf", "osc" };
+static const char* const messageNames[totalNumMessages]        = { "impulse", "signalLevel" };
+static const char* const componentNames[totalNumComponents]    = { "analysis", "queueing", "network", "total" };
+
+struct Histograms
+{
+    std::unique_ptr<LatencyHistogram> histograms[totalNumTransports][totalNumMessages][totalNumComponents];
+
+    Histograms()                                    { reset(); }
+
+    void reset()
+    {
+        for (int t = 0; t < totalNumTransports; ++t)
+            for (int m = 0; m < totalNumMessages; ++m)
+                for (int c = 0; c < totalNumComponents; ++c)
+                    histograms[t][m][c].reset (new LatencyHistogram());
+    }
+
+    void record (int transport, int message, const LatencyProbe::Stamp& stamp, uint64_t arrival)
+    {
+        std::unique_ptr<LatencyHistogram>* components = histograms[transport][message];
+        components[analysisDelay]->record (stamp.feature - stamp.blockEntry);
+        components[queueingDelay]->record (stamp.send - stamp.feature);
+        components[networkDelay]->record (arrival - stamp.send);
+        components[totalDelay]->record (arrival - stamp.blockEntry);
+    }
+};
+
+static std::atomic<bool> stopRequested (false);
+
+static void requestStop (int)
+{
+    stopRequested.store (true);
+}
+
+//==============================================================================
+struct Percentiles
+{
+    uint64_t count = 0;
+    double p50 = 0, p99 = 0, max = 0;               // Microseconds, middle of the bucket
+};
+
+static Percentiles getPercentiles (const LatencyHistogram& histogram)
+{
+    uint32_t counts[LatencyHistogram::nbOfBuckets];
+    histogram.copyCounts (counts);
+
+    Percentiles result;
+    for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+        result.count += counts[i];
+
+    if (result.count == 0)
+        return result;
+
+    const uint64_t ranks[3] = { (result.count + 1) / 2, result.count - result.count / 100, result.count };
+    double* const values[3] = { &result.p50, &result.p99, &result.max };
+    uint64_t cumulated = 0;
+    int percentile = 0;
+
+    for (int i = 0; i < LatencyHistogram::nbOfBuckets && percentile < 3; ++i)
+    {
+        cumulated += counts[i];
+        while (percentile < 3 && cumulated >= ranks[percentile])
+            *values[percentile++] = (LatencyHistogram::getBucketLowerBound (i) + LatencyHistogram::getBucketUpperBound (i)) / 2000.0;
+    }
+
+    return result;
+}
+
+static void print (const Histograms& histograms, double time, bool json)
+{
+    for (int t = 0; t < totalNumTransports; ++t)
+    {
+        for (int m = 0; m < totalNumMessages; ++m)
+        {
+            Percentiles percentiles[totalNumComponents];
+            for (int c = 0; c < totalNumComponents; ++c)
+                percentiles[c] = getPercentiles (*histograms.histograms[t][m][c]);
+
+            if (percentiles[totalDelay].count == 0)
+                continue;
+
+            if (json)
+            {
+                std::printf ("{\"time\":%.3f,\"transport\":\"%s\",\"message\":\"%s\",\"count\":%llu", time,
+                             transportNames[t], messageNames[m], (unsigned long long) percentiles[totalDelay].count);
+                for (int c = 0; c < totalNumComponents; ++c)
+                    std::printf (",\"%s\":{\"p50\":%.2f,\"p99\":%.2f,\"max\":%.2f}", componentNames[c],
+                                 percentiles[c].p50, percentiles[c].p99, percentiles[c].max);
+                std::printf ("}\n");
+            }
+            else
+            {
+                std::printf ("%8.1f %-9s %-12s %7llu", time, transportNames[t], messageNames[m],
+                             (unsigned long long) percentiles[totalDelay].count);
+                for (int c = 0; c < totalNumComponents; ++c)
+                    std::printf ("  %8.1f %8.1f %8.1f", percentiles[c].p50, percentiles[c].p99, percentiles[c].max);
+                std::printf ("\n");
+            }
+        }
+    }
+
+    std::fflush (stdout);
+}
+
+// The buckets holding values of the total delay, merged over the transports and messages
+static void printTotalHistogram (const Histograms& histograms)
+{
+    uint32_t total[LatencyHistogram::nbOfBuckets] = {};
+    uint32_t counts[LatencyHistogram::nbOfBuckets];
+    uint64_t nbOfValues = 0;
+
+    for (int t = 0; t < totalNumTransports; ++t)
+        for (int m = 0; m < totalNumMessages; ++m)
+        {
+            histograms.histograms[t][m][totalDelay]->copyCounts (counts);
+            for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+            {
+                total[i] += counts[i];
+                nbOfValues += counts[i];
+            }
+        }
+
+    if (nbOfValues == 0)
+        return;
+
+    std::printf ("\nTotal delay (block entry to arrival) :\n");
+    uint64_t cumulated = 0;
+
+    for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+    {
+        if (total[i] == 0)
+            continue;
+
+        cumulated += total[i];
+        std::printf ("%10.1f - %10.1f us %9u %6.2f%%  ", LatencyHistogram::getBucketLowerBound (i) / 1000.0,
+                     LatencyHistogram::getBucketUpperBound (i) / 1000.0, total[i], cumulated * 100.0 / nbOfValues);
+
+        for (int bar = 0; bar < (int) (total[i] * 50 / nbOfValues); ++bar)
+            std::printf ("#");
+        std::printf ("\n");
+    }
+}
+
+//==============================================================================
+// Bundles are unpacked : the plugin sends every OSC message in its own bundle
+static void processOSC (const osc::ReceivedPacket& packet, uint64_t arrival, Histograms* histograms[2], uint64_t& nbOfInvalid)
+{
+    if (packet.IsBundle())
+    {
+        const osc::ReceivedBundle bundle (packet);
+        for (osc::ReceivedBundle::const_iterator element = bundle.ElementsBegin(); element != bundle.ElementsEnd(); ++element)
+            processOSC (osc::ReceivedPacket (element->Contents(), element->Size()), arrival, histograms, nbOfInvalid);
+        return;
+    }
+
+    const osc::ReceivedMessage message (packet);
+    const int type = std::strcmp (message.AddressPattern(), "IMPLS") == 0 ? impulseMessage
+                   : std::strcmp (message.AddressPattern(), "SIGLVL") == 0 ? signalLevelMessage : -1;
+
+    LatencyProbe::Stamp stamp;
+    if (type < 0 || ! LatencyProbe::find (message, stamp))
+        return;
+
+    if (stamp.blockEntry > stamp.feature || stamp.feature > stamp.send || stamp.send > arrival)
+    {
+        nbOfInvalid++;
+        return;
+    }
+
+    for (int h = 0; h < 2; ++h)
+        histograms[h]->record (oscTransport, type, stamp, arrival);
+}
+
+int main (int argc, char* argv[])
+{
+    double duration = 0, interval = 1;
+    std::string address ("127.0.0.1");
+    std::vector<int> ports { 7001, 7003, 9000 };    // Signal level, impulse, OSC
+    bool json = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg (argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if      (arg == "--duration" && hasValue)   duration = std::atof (argv[++i]);
+        else if (arg == "--interval" && hasValue)   interval = std::atof (argv[++i]);
+        else if (arg == "--address" && hasValue)    address = argv[++i];
+        else if (arg == "--json")                   json = true;
+        else
+        {
+            std::fprintf (stderr, "usage: %s [--duration <s>] [--interval <s>] [--address <local address>] [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (interval <= 0 || duration < 0)
+    {
+        std::fprintf (stderr, "The interval must be positive, the duration positive or 0\n");
+        return 1;
+    }
+
+    std::vector<pollfd> sockets;
+    for (size_t i = 0; i < ports.size(); ++i)
+    {
+        pollfd socketFd;
+        socketFd.fd = socket (AF_INET, SOCK_DGRAM, 0);
+        socketFd.events = POLLIN;
+
+        sockaddr_in endpoint = sockaddr_in();
+        endpoint.sin_family = AF_INET;
+        endpoint.sin_port = htons ((uint16_t) ports[i]);
+
+        if (inet_pton (AF_INET, address.c_str(), &endpoint.sin_addr) != 1
+             || bind (socketFd.fd, (const sockaddr*) &endpoint, sizeof (endpoint)) != 0)
+        {
+            std::fprintf (stderr, "Cannot bind %s:%d (is a consumer using it ?)\n", address.c_str(), ports[i]);
+            return 1;
+        }
+
+        sockets.push_back (socketFd);
+    }
+
+    std::signal (SIGINT, requestStop);
+    std::signal (SIGTERM, requestStop);
+
+    if (! json)
+        std::printf ("Waiting for stamped messages : enable the probe with /sp/<channel>/probe 1 on port 9001\n"
+                     "%8s %-9s %-12s %7s  %26s  %26s  %26s  %26s\n"
+                     "%8s %-9s %-12s %7s  %8s %8s %8s  %8s %8s %8s  %8s %8s %8s  %8s %8s %8s\n",
+                     "", "", "", "", "analysis (us)", "queueing (us)", "network (us)", "total (us)",
+                     "time", "transport", "message", "count", "p50", "p99", "max", "p50", "p99", "max",
+                     "p50", "p99", "max", "p50", "p99", "max");
+
+    Histograms intervalHistograms, runHistograms;
+    Histograms* histograms[2] = { &intervalHistograms, &runHistograms };
+    uint64_t nbOfInvalid = 0;
+
+    const uint64_t start = getMonotonicNanoseconds();
+    uint64_t nextPrint = start + (uint64_t) (interval * 1.0e9);
+    std::vector<char> buffer (65536);
+
+    while (! stopRequested.load())
+    {
+        const uint64_t now = getMonotonicNanoseconds();
+        if (duration > 0 && now - start >= (uint64_t) (duration * 1.0e9))
+            break;
+
+        if (now >= nextPrint)
+        {
+            print (intervalHistograms, (now - start) * 1.0e-9, json);
+            intervalHistograms.reset();
+            nextPrint += (uint64_t) (interval * 1.0e9);
+        }
+
+        if (poll (sockets.data(), sockets.size(), 50) <= 0)
+            continue;
+
+        for (size_t i = 0; i < sockets.size(); ++i)
+        {
+            if ((sockets[i].revents & POLLIN) == 0)
+                continue;
+
+            ssize_t size;
+            while ((size = recv (sockets[i].fd, buffer.data(), buffer.size(), MSG_DONTWAIT)) >= 0)
+            {
+                // The arrival : when the receiver gets the packet, as a consumer would
+                const uint64_t arrival = getMonotonicNanoseconds();
+
+                if (ports[i] == 9000)
+                {
+                    try
+                    {
+                        processOSC (osc::ReceivedPacket (buffer.data(), (osc::osc_bundle_element_size_t) size), arrival, histograms, nbOfInvalid);
+                    }
+                    catch (const osc::Exception&)
+                    {
+                    }
+                    continue;
+                }
+
+                LatencyProbe::Stamp stamp;
+                if (! LatencyProbe::find (buffer.data(), (int) size, stamp))
+                    continue;
+
+                if (stamp.blockEntry > stamp.feature || stamp.feature > stamp.send || stamp.send > arrival)
+                {
+                    nbOfInvalid++;
+                    continue;
+                }
+
+                const int type = ports[i] == 7003 ? impulseMessage : signalLevelMessage;
+                for (int h = 0; h < 2; ++h)
+                    histograms[h]->record (protobufTransport, type, stamp, arrival);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < sockets.size(); ++i)
+        close (sockets[i].fd);
+
+    if (! json)
+        std::printf ("\nWhole run :\n");
+    print (runHistograms, (getMonotonicNanoseconds() - start) * 1.0e-9, json);
+
+    if (! json)
+    {
+        printTotalHistogram (runHistograms);
+
+        if (nbOfInvalid > 0)
+            std::printf ("%llu stamps out of order were ignored : the plugin and the receiver must run on the same machine\n",
+                         (unsigned long long) nbOfInvalid);
+    }
+
+    return 0;
+}
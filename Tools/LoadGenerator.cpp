@@ -0,0 +1,389 @@
+/*
+ ==============================================================================
+
+    LoadGenerator.cpp
+    PlayMe - SignalProcessor tools
+    Send synthetic SignalMessages traffic, shaped like the plugin's, to find
+    out at what message rate a consumer starts dropping packets.
+    Every packet carries a LoadTag, so LoadSink can measure loss, reordering
+    and latency on the receiving side
+
+ ==============================================================================
+ */
+
+#include "LoadTag.h"
+#include "SignalWireFormat.h"
+#include "udp_client_server.h"
+#include "osc/OscOutboundPacketStream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile std::sig_atomic_t stopRequested = 0;
+static void requestStop (int)       { stopRequested = 1; }
+
+// Same ports as the plugin
+enum Feature { levelFeature, instantValFeature, impulseFeature, timeInfoFeature, fftFeature, totalNumFeatures };
+static const int featurePorts[totalNumFeatures] = { 7001, 7002, 7003, 7004, 7005 };
+static const int oscPort = 9000;
+static const char* const featureNames[totalNumFeatures] = { "level", "instant", "impulse", "time", "fft" };
+
+struct Settings
+{
+    std::string address         = "127.0.0.1";
+    int nbOfChannels            = 8;
+    double rates[totalNumFeatures] = { 100, 0, 2, 20, 20 };    // Messages per second, per channel (TimeInfo : in total)
+    int nbOfLinearBins          = 0;                            // 0 : LogFFT
+    double blockMs              = 0;                            // 0 : every message is sent on time
+    double durationSeconds      = 10;
+    bool useOSC                 = false;
+};
+
+// One stream per feature and per channel, except TimeInfo which the plugin sends once for all channels
+struct Stream
+{
+    Feature feature;
+    int channel;
+    int64_t periodNs;
+    uint64_t sequence;
+};
+
+struct DueStream
+{
+    int64_t due;
+    int stream;
+    bool operator> (const DueStream& other) const   { return due > other.due; }
+};
+
+//==============================================================================
+class Sender
+{
+public:
+    Sender (const Settings& s) : settings (s), oscStream (oscBuffer, sizeof (oscBuffer))
+    {
+        if (settings.useOSC)
+        {
+            clients.push_back (new udp_client (settings.address, oscPort));
+        }
+        else
+        {
+            for (int f = 0; f < totalNumFeatures; ++f)
+                clients.push_back (new udp_client (settings.address, featurePorts[f]));
+        }
+
+        fft.isLinear = settings.nbOfLinearBins > 0;
+        fft.nbOfValues = fft.isLinear ? settings.nbOfLinearBins : SignalWireFormat::nbOfLogBands;
+    }
+
+    ~Sender()
+    {
+        for (size_t i = 0; i < clients.size(); ++i)
+            delete clients[i];
+    }
+
+    // Returns the size sent, or -1
+    int send (const Stream& stream, uint32_t streamIndex, double seconds)
+    {
+        LoadTag::Tag tag;
+        tag.stream = streamIndex;
+        tag.sequence = stream.sequence;
+
+        // Slowly moving values, different for every channel
+        const float value = 0.5f + 0.5f * (float) std::sin (seconds * 2.0 + stream.channel);
+
+        if (settings.useOSC)
+        {
+            oscStream.Clear();
+            oscStream << osc::BeginBundleImmediate;
+            tag.sendTime = LoadTag::realtimeNanoseconds();
+            writeOSC (stream, value, tag);
+            oscStream << osc::EndBundle;
+            return sendData (*clients[0], oscStream.Data(), (int) oscStream.Size());
+        }
+
+        int size = writeProtobuf (stream, value);
+        tag.sendTime = LoadTag::realtimeNanoseconds();
+        size = LoadTag::append (tag, buffer, size, sizeof (buffer));
+        return sendData (*clients[stream.feature], buffer, size);
+    }
+
+private:
+    static int sendData (udp_client& client, const char* data, int size)
+    {
+        return (size >= 0 && client.send (data, (size_t) size) == size) ? size : -1;
+    }
+
+    int writeProtobuf (const Stream& stream, float value)
+    {
+        switch (stream.feature)
+        {
+            case levelFeature:
+                level.signalID = stream.channel;
+                level.signalLevel = value;
+                return SignalWireFormat::encode (level, buffer, sizeof (buffer));
+
+            case instantValFeature:
+                instantVal.signalID = stream.channel;
+                instantVal.signalInstantVal = value;
+                return SignalWireFormat::encode (instantVal, buffer, sizeof (buffer));
+
+            case impulseFeature:
+                impulse.signalID = stream.channel;
+                return SignalWireFormat::encode (impulse, buffer, sizeof (buffer));
+
+            case timeInfoFeature:
+                timeInfo.isPlaying = true;
+                timeInfo.tempo = 120;
+                timeInfo.position = (float) stream.sequence;
+                return SignalWireFormat::encode (timeInfo, buffer, sizeof (buffer));
+
+            case fftFeature:
+            default:
+                fft.signalID = stream.channel;
+                fft.fundamentalFreq = 440 * value;
+                for (int i = 0; i < fft.nbOfValues; ++i)
+                    fft.values[i] = value / (1 + i);
+                return SignalWireFormat::encode (fft, buffer, sizeof (buffer));
+        }
+    }
+
+    // Same addresses and arguments as the plugin, followed by the tag
+    void writeOSC (const Stream& stream, float value, const LoadTag::Tag& tag)
+    {
+        switch (stream.feature)
+        {
+            case levelFeature:
+                oscStream << osc::BeginMessage ("SIGLVL") << stream.channel << "/" << value;
+                break;
+
+            case instantValFeature:
+                oscStream << osc::BeginMessage ("SIGINSTVAL") << stream.channel << "/" << value;
+                break;
+
+            case impulseFeature:
+                oscStream << osc::BeginMessage ("IMPLS") << stream.channel;
+                break;
+
+            case timeInfoFeature:
+                oscStream << osc::BeginMessage ("TIME") << (float) stream.sequence << osc::EndMessage
+                          << osc::BeginMessage ("BPM") << 120.0f;
+                break;
+
+            case fftFeature:
+            default:
+                oscStream << osc::BeginMessage (fft.isLinear ? "LinearFFT" : "FFT") << stream.channel << 440 * value;
+                for (int i = 0; i < fft.nbOfValues; ++i)
+                    oscStream << value / (1 + i);
+                break;
+        }
+
+        oscStream << tag << osc::EndMessage;
+    }
+
+    const Settings& settings;
+    std::vector<udp_client*> clients;
+
+    char buffer[SignalWireFormat::maxNbOfLinearBins * 4 + 64];
+    char oscBuffer[SignalWireFormat::maxNbOfLinearBins * 8 + 256];
+    osc::OutboundPacketStream oscStream;
+
+    SignalWireFormat::SignalLevelMessage level;
+    SignalWireFormat::SignalInstantValMessage instantVal;
+    SignalWireFormat::ImpulseMessage impulse;
+    SignalWireFormat::TimeInfoMessage timeInfo;
+    SignalWireFormat::FFTMessage fft;
+};
+
+//==============================================================================
+static bool parseArguments (int argc, char* argv[], Settings& settings)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string option = argv[i];
+        if (option == "--osc")
+        {
+            settings.useOSC = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            return false;
+
+        const char* value = argv[++i];
+        bool isFeatureRate = false;
+
+        for (int f = 0; f < totalNumFeatures; ++f)
+        {
+            if (option == std::string ("--") + featureNames[f])
+            {
+                settings.rates[f] = std::atof (value);
+                isFeatureRate = true;
+            }
+        }
+
+        if (isFeatureRate)                  continue;
+        else if (option == "--address")     settings.address = value;
+        else if (option == "--channels")    settings.nbOfChannels = std::atoi (value);
+        else if (option == "--block")       settings.blockMs = std::atof (value);
+        else if (option == "--duration")    settings.durationSeconds = std::atof (value);
+        else if (option == "--spectrum")    settings.nbOfLinearBins = (std::strcmp (value, "log") == 0) ? 0 : std::atoi (value);
+        else                                return false;
+    }
+
+    return settings.nbOfChannels > 0
+        && settings.nbOfLinearBins >= 0 && settings.nbOfLinearBins <= SignalWireFormat::maxNbOfLinearBins
+        && settings.blockMs >= 0;
+}
+
+static void printUsage (const char* name)
+{
+    std::fprintf (stderr,
+                  "usage: %s [--channels 8] [--level 100] [--instant 0] [--impulse 2] [--time 20] [--fft 20]\n"
+                  "          [--spectrum log|<bins>] [--block <ms>] [--duration 10] [--address 127.0.0.1] [--osc]\n"
+                  "rates are in messages per second and per channel (--time : in total), 0 disables a feature\n",
+                  name);
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    Settings settings;
+    if (! parseArguments (argc, argv, settings))
+    {
+        printUsage (argv[0]);
+        return 1;
+    }
+
+    std::vector<Stream> streams;
+    for (int f = 0; f < totalNumFeatures; ++f)
+    {
+        if (settings.rates[f] <= 0)
+            continue;
+
+        const int nbOfStreams = (f == timeInfoFeature) ? 1 : settings.nbOfChannels;
+        for (int c = 0; c < nbOfStreams; ++c)
+        {
+            Stream stream = { (Feature) f, c + 1, (int64_t) (1e9 / settings.rates[f]), 0 };
+            streams.push_back (stream);
+        }
+    }
+
+    if (streams.empty())
+    {
+        printUsage (argv[0]);
+        return 1;
+    }
+
+    Sender* sender;
+    try
+    {
+        sender = new Sender (settings);
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::fprintf (stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    std::signal (SIGINT, requestStop);
+    std::signal (SIGTERM, requestStop);
+
+    // The streams start spread over their period, as the plugin's channels are not in phase
+    std::priority_queue<DueStream, std::vector<DueStream>, std::greater<DueStream> > schedule;
+    for (size_t i = 0; i < streams.size(); ++i)
+    {
+        DueStream dueStream = { (int64_t) (streams[i].periodNs * (double) i / streams.size()), (int) i };
+        schedule.push (dueStream);
+    }
+
+    // With a block period, the messages due during a block are all sent back-to-back at its end,
+    // as the plugin does at the end of every processBlock
+    const int64_t blockNs = (int64_t) (settings.blockMs * 1e6);
+    const int64_t durationNs = (int64_t) (settings.durationSeconds * 1e9);
+
+    uint64_t nbOfPackets = 0, nbOfBytes = 0, nbOfSendErrors = 0;
+    uint64_t intervalPackets = 0, intervalBytes = 0;
+    int64_t maxLatenessNs = 0;
+    int64_t nextReport = 1000000000;
+
+    const Clock::time_point start = Clock::now();
+
+    while (! stopRequested)
+    {
+        int64_t wakeUp = schedule.top().due;
+        if (blockNs > 0)
+            wakeUp = (wakeUp / blockNs + 1) * blockNs;
+
+        if (wakeUp >= durationNs)
+            break;
+
+        // Sleep until shortly before the wake-up time, then spin : sleeps are only accurate to about 100 us
+        const Clock::time_point wakeUpTime = start + std::chrono::nanoseconds (wakeUp);
+        if (Clock::now() < wakeUpTime - std::chrono::microseconds (200))
+            std::this_thread::sleep_until (wakeUpTime - std::chrono::microseconds (200));
+        while (Clock::now() < wakeUpTime) {}
+
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds> (Clock::now() - start).count();
+        maxLatenessNs = std::max (maxLatenessNs, now - wakeUp);
+
+        while (schedule.top().due <= wakeUp)
+        {
+            DueStream dueStream = schedule.top();
+            schedule.pop();
+
+            Stream& stream = streams[dueStream.stream];
+            const int size = sender->send (stream, (uint32_t) dueStream.stream, now * 1e-9);
+            ++stream.sequence;
+
+            if (size < 0)
+            {
+                ++nbOfSendErrors;
+            }
+            else
+            {
+                ++intervalPackets;
+                intervalBytes += (uint64_t) size;
+            }
+
+            dueStream.due += stream.periodNs;
+            schedule.push (dueStream);
+        }
+
+        if (now >= nextReport)
+        {
+            std::printf ("sent %8llu pkt/s %10.3f MB/s errors=%llu lateness_max=%.1f us\n",
+                         (unsigned long long) intervalPackets, intervalBytes / 1e6,
+                         (unsigned long long) nbOfSendErrors, maxLatenessNs / 1000.0);
+            std::fflush (stdout);
+
+            nbOfPackets += intervalPackets;
+            nbOfBytes += intervalBytes;
+            intervalPackets = intervalBytes = 0;
+            maxLatenessNs = 0;
+            nextReport += 1000000000;
+        }
+    }
+
+    nbOfPackets += intervalPackets;
+    nbOfBytes += intervalBytes;
+
+    const double seconds = std::chrono::duration<double> (Clock::now() - start).count();
+    std::printf ("streams=%d packets=%llu bytes=%llu errors=%llu seconds=%.3f rate=%.0f pkt/s %.3f MB/s\n",
+                 (int) streams.size(), (unsigned long long) nbOfPackets, (unsigned long long) nbOfBytes,
+                 (unsigned long long) nbOfSendErrors, seconds,
+                 seconds > 0 ? nbOfPackets / seconds : 0.0, seconds > 0 ? nbOfBytes / seconds / 1e6 : 0.0);
+
+    delete sender;
+    return 0;
+}
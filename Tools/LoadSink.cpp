@@ -0,0 +1,360 @@
+/*
+ ==============================================================================
+
+    LoadSink.cpp
+    PlayMe - SignalProcessor tools
+    Receive the traffic sent by LoadGenerator and measure, for every stream,
+    the lost and reordered packets, and the latency from the send time to the
+    kernel's receive time
+
+ ==============================================================================
+ */
+
+#include "LoadTag.h"
+#include "udp_client_server.h"
+#include "osc/OscReceivedElements.h"
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <poll.h>
+#include <string>
+#include <vector>
+
+static volatile std::sig_atomic_t stopRequested = 0;
+static void requestStop (int)       { stopRequested = 1; }
+
+//==============================================================================
+// 1 us buckets up to 100 ms : the percentiles are exact to the microsecond, without storing the samples
+class LatencyHistogram
+{
+public:
+    LatencyHistogram() : buckets (nbOfBuckets + 1, 0) {}
+
+    void add (int64_t latencyNs)
+    {
+        const int64_t bucket = latencyNs < 0 ? 0 : latencyNs / 1000;
+        ++buckets[bucket < nbOfBuckets ? bucket : nbOfBuckets];
+        ++count;
+        maxNs = std::max (maxNs, latencyNs);
+    }
+
+    // In microseconds. The last bucket collects everything above 100 ms
+    double getPercentile (double percentile) const
+    {
+        const uint64_t rank = (uint64_t) (percentile / 100.0 * (count - 1));
+        uint64_t seen = 0;
+        for (int i = 0; i <= nbOfBuckets; ++i)
+        {
+            seen += buckets[i];
+            if (seen > rank)
+                return i;
+        }
+
+        return nbOfBuckets;
+    }
+
+    uint64_t getCount() const       { return count; }
+    double getMaxUs() const         { return maxNs / 1000.0; }
+
+    void clear()
+    {
+        std::fill (buckets.begin(), buckets.end(), 0);
+        count = 0;
+        maxNs = 0;
+    }
+
+private:
+    static const int nbOfBuckets = 100000;
+    std::vector<uint64_t> buckets;
+    uint64_t count = 0;
+    int64_t maxNs = 0;
+};
+
+//==============================================================================
+// The first packet received on a stream sets its origin : the sink can be started after the generator
+struct StreamTrack
+{
+    bool isStarted          = false;
+    uint64_t firstSequence  = 0;
+    uint64_t highestSequence = 0;
+    uint64_t nbOfReceived   = 0;
+    uint64_t nbOfReordered  = 0;
+
+    void add (uint64_t sequence)
+    {
+        if (! isStarted)
+        {
+            isStarted = true;
+            firstSequence = highestSequence = sequence;
+        }
+        else if (sequence > highestSequence)
+        {
+            highestSequence = sequence;
+        }
+        else
+        {
+            ++nbOfReordered;
+        }
+
+        ++nbOfReceived;
+    }
+
+    uint64_t getNbOfLost() const
+    {
+        const uint64_t expected = isStarted ? highestSequence - firstSequence + 1 : 0;
+        return expected > nbOfReceived ? expected - nbOfReceived : 0;
+    }
+};
+
+struct Totals
+{
+    uint64_t nbOfReceived   = 0;
+    uint64_t nbOfLost       = 0;
+    uint64_t nbOfReordered  = 0;
+};
+
+static Totals sumStreams (const std::vector<StreamTrack>& streams)
+{
+    Totals totals;
+    for (size_t i = 0; i < streams.size(); ++i)
+    {
+        totals.nbOfReceived += streams[i].nbOfReceived;
+        totals.nbOfLost += streams[i].getNbOfLost();
+        totals.nbOfReordered += streams[i].nbOfReordered;
+    }
+
+    return totals;
+}
+
+static bool findTag (int port, const char* data, int size, LoadTag::Tag& tag)
+{
+    if (port != 9000)
+        return LoadTag::find (data, size, tag);
+
+    try
+    {
+        const osc::ReceivedPacket packet (data, (osc::osc_bundle_element_size_t) size);
+        if (packet.IsMessage())
+            return LoadTag::find (osc::ReceivedMessage (packet), tag);
+
+        // The tag is in the last message of the bundle
+        const osc::ReceivedBundle bundle (packet);
+        bool isFound = false;
+        for (osc::ReceivedBundle::const_iterator i = bundle.ElementsBegin(); i != bundle.ElementsEnd(); ++i)
+            if (i->IsMessage())
+                isFound = LoadTag::find (osc::ReceivedMessage (*i), tag);
+
+        return isFound;
+    }
+    catch (const osc::Exception&)
+    {
+        return false;
+    }
+}
+
+static void printReport (const char* title, const Totals& totals, uint64_t nbOfUntagged, const LatencyHistogram& latencies)
+{
+    std::printf ("%s received=%llu lost=%llu reordered=%llu untagged=%llu",
+                 title, (unsigned long long) totals.nbOfReceived, (unsigned long long) totals.nbOfLost,
+                 (unsigned long long) totals.nbOfReordered, (unsigned long long) nbOfUntagged);
+
+    if (latencies.getCount() > 0)
+        std::printf (" latency p50=%.0f p90=%.0f p99=%.0f p99.9=%.0f max=%.1f us",
+                     latencies.getPercentile (50), latencies.getPercentile (90), latencies.getPercentile (99),
+                     latencies.getPercentile (99.9), latencies.getMaxUs());
+
+    std::printf ("\n");
+    std::fflush (stdout);
+}
+
+//==============================================================================
+struct Settings
+{
+    double durationSeconds = 0;                 // 0 : until Ctrl-C
+    std::vector<int> ports { 7001, 7002, 7003, 7004, 7005, 9000 };
+};
+
+// A comma separated list of ports, nothing else
+static bool parsePorts (const char* list, std::vector<int>& ports)
+{
+    ports.clear();
+
+    for (const char* p = list;; ++p)
+    {
+        char* end;
+        const long port = std::strtol (p, &end, 10);
+        if (end == p || port <= 0 || port > 65535)
+            return false;
+
+        ports.push_back ((int) port);
+        p = end;
+
+        if (*p == 0)
+            return true;
+        if (*p != ',')
+            return false;
+    }
+}
+
+// Same options as LoadGenerator : an unknown argument is an error, rather than a duration of 0
+static bool parseArguments (int argc, char* argv[], Settings& settings)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string option = argv[i];
+
+        if (i + 1 >= argc)
+            return false;
+
+        const char* value = argv[++i];
+
+        if (option == "--duration")
+        {
+            char* end;
+            settings.durationSeconds = std::strtod (value, &end);
+            if (end == value || *end != 0 || settings.durationSeconds < 0)
+                return false;
+        }
+        else if (option == "--ports")
+        {
+            if (! parsePorts (value, settings.ports))
+                return false;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void printUsage (const char* name)
+{
+    std::fprintf (stderr,
+                  "usage: %s [--duration 0] [--ports 7001,7002,7003,7004,7005,9000]\n"
+                  "--duration in seconds, 0 : until Ctrl-C\n",
+                  name);
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    Settings settings;
+    if (! parseArguments (argc, argv, settings))
+    {
+        printUsage (argv[0]);
+        return 1;
+    }
+
+    const std::vector<int>& ports = settings.ports;
+
+    std::vector<udp_server*> servers;
+    std::vector<struct pollfd> pollFds;
+    try
+    {
+        for (size_t i = 0; i < ports.size(); ++i)
+        {
+            servers.push_back (new udp_server ("0.0.0.0", ports[i]));
+            servers.back()->set_timestamps (true);
+
+            struct pollfd p = { servers.back()->get_socket(), POLLIN, 0 };
+            pollFds.push_back (p);
+        }
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::fprintf (stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    std::signal (SIGINT, requestStop);
+    std::signal (SIGTERM, requestStop);
+
+    const int batchSize = 32;
+    const size_t maxPacketSize = 65536;
+    std::vector<char> buffers (batchSize * maxPacketSize);
+    struct iovec iovecs[batchSize];
+    size_t sizes[batchSize];
+    struct timespec timestamps[batchSize];
+
+    // Indexed by the stream number of the tag, grown when a new stream shows up
+    std::vector<StreamTrack> streams;
+    LatencyHistogram latencies, intervalLatencies;
+    uint64_t nbOfUntagged = 0;
+    Totals previousTotals;
+
+    const int64_t startTime = LoadTag::realtimeNanoseconds();
+    const int64_t endTime = settings.durationSeconds > 0 ? startTime + (int64_t) (settings.durationSeconds * 1.0e9) : 0;
+    int64_t nextReport = startTime + 1000000000;
+
+    while (! stopRequested && (endTime == 0 || LoadTag::realtimeNanoseconds() < endTime))
+    {
+        if (poll (&pollFds[0], pollFds.size(), 100) > 0)
+        {
+            for (size_t s = 0; s < servers.size(); ++s)
+            {
+                if ((pollFds[s].revents & POLLIN) == 0)
+                    continue;
+
+                for (int i = 0; i < batchSize; ++i)
+                {
+                    iovecs[i].iov_base = &buffers[i * maxPacketSize];
+                    iovecs[i].iov_len = maxPacketSize;
+                }
+
+                const int received = servers[s]->recv_batch (iovecs, sizes, timestamps, batchSize, 0);
+                const int64_t readTime = LoadTag::realtimeNanoseconds();
+
+                for (int i = 0; i < received; ++i)
+                {
+                    LoadTag::Tag tag;
+                    if (! findTag (ports[s], (const char*) iovecs[i].iov_base, (int) sizes[i], tag) || tag.stream > 1000000)
+                    {
+                        ++nbOfUntagged;
+                        continue;
+                    }
+
+                    if (tag.stream >= streams.size())
+                        streams.resize (tag.stream + 1);
+
+                    streams[tag.stream].add (tag.sequence);
+
+                    // Without a kernel timestamp, the time the batch was read is the receive time
+                    const int64_t receiveTime = timestamps[i].tv_sec != 0 || timestamps[i].tv_nsec != 0
+                                                  ? (int64_t) timestamps[i].tv_sec * 1000000000 + timestamps[i].tv_nsec
+                                                  : readTime;
+
+                    latencies.add (receiveTime - tag.sendTime);
+                    intervalLatencies.add (receiveTime - tag.sendTime);
+                }
+            }
+        }
+
+        if (LoadTag::realtimeNanoseconds() >= nextReport)
+        {
+            const Totals totals = sumStreams (streams);
+            Totals interval;
+            interval.nbOfReceived = totals.nbOfReceived - previousTotals.nbOfReceived;
+            // A late packet fills a gap counted as a loss in a previous interval
+            interval.nbOfLost = totals.nbOfLost > previousTotals.nbOfLost ? totals.nbOfLost - previousTotals.nbOfLost : 0;
+            interval.nbOfReordered = totals.nbOfReordered - previousTotals.nbOfReordered;
+
+            printReport ("1s", interval, nbOfUntagged, intervalLatencies);
+            previousTotals = totals;
+            intervalLatencies.clear();
+            nextReport += 1000000000;
+        }
+    }
+
+    printReport ("total", sumStreams (streams), nbOfUntagged, latencies);
+    std::printf ("streams=%d\n", (int) streams.size());
+
+    for (size_t i = 0; i < servers.size(); ++i)
+        delete servers[i];
+
+    return 0;
+}
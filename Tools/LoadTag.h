@@ -0,0 +1,104 @@
+/*
+ ==============================================================================
+
+    LoadTag.h
+    PlayMe - SignalProcessor tools
+    Tag written by LoadGenerator into every packet it sends, and read back by
+    LoadSink : the stream the packet belongs to, its sequence number in that
+    stream, and the CLOCK_REALTIME time it was sent at.
+
+    Protobuf packets carry the tag as three fields which are not part of
+    SignalMessages.proto, so the consumers skip them. OSC messages carry it as
+    three extra arguments (int32, int64, int64) after the plugin's own ones.
+
+ ==============================================================================
+ */
+
+#ifndef LOADTAG_H_INCLUDED
+#define LOADTAG_H_INCLUDED
+
+#include "SignalWireFormat.h"
+#include "osc/OscOutboundPacketStream.h"
+#include "osc/OscReceivedElements.h"
+
+#include <time.h>
+
+namespace LoadTag
+{
+    static const int streamField    = 1000;     // varint
+    static const int sequenceField  = 1001;     // varint
+    static const int sendTimeField  = 1002;     // fixed64, ns
+
+    struct Tag
+    {
+        uint32_t stream     = 0;
+        uint64_t sequence   = 0;
+        int64_t sendTime    = 0;
+    };
+
+    inline int64_t realtimeNanoseconds()
+    {
+        struct timespec t;
+        clock_gettime (CLOCK_REALTIME, &t);
+        return (int64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+    }
+
+    //==============================================================================
+    // Returns the new size of the packet, or -1 if the buffer is too small
+    inline int append (const Tag& tag, char* buffer, int size, int capacity)
+    {
+        size = SignalWireFormat::appendVarintField (streamField, tag.stream, buffer, size, capacity);
+        if (size >= 0)
+            size = SignalWireFormat::appendVarintField (sequenceField, tag.sequence, buffer, size, capacity);
+        if (size >= 0)
+            size = SignalWireFormat::appendFixed64Field (sendTimeField, (uint64_t) tag.sendTime, buffer, size, capacity);
+        return size;
+    }
+
+    inline bool find (const char* data, int size, Tag& tag)
+    {
+        uint64_t stream, sendTime;
+        if (! SignalWireFormat::findVarintField (data, size, streamField, stream)
+             || ! SignalWireFormat::findVarintField (data, size, sequenceField, tag.sequence)
+             || ! SignalWireFormat::findFixed64Field (data, size, sendTimeField, sendTime))
+            return false;
+
+        tag.stream = (uint32_t) stream;
+        tag.sendTime = (int64_t) sendTime;
+        return true;
+    }
+
+    //==============================================================================
+    // Must be streamed before osc::EndMessage
+    inline osc::OutboundPacketStream& operator<< (osc::OutboundPacketStream& stream, const Tag& tag)
+    {
+        return stream << (osc::int32) tag.stream << (osc::int64) tag.sequence << (osc::int64) tag.sendTime;
+    }
+
+    // Looks for the tag in the last three arguments of the message
+    inline bool find (const osc::ReceivedMessage& message, Tag& tag)
+    {
+        const int nbOfArguments = (int) message.ArgumentCount();
+        if (nbOfArguments < 3)
+            return false;
+
+        osc::ReceivedMessage::const_iterator argument = message.ArgumentsBegin();
+        for (int i = 0; i < nbOfArguments - 3; ++i)
+            ++argument;
+
+        // The iterator owns the argument it points to : copy them
+        const osc::ReceivedMessageArgument stream = *argument++;
+        const osc::ReceivedMessageArgument sequence = *argument++;
+        const osc::ReceivedMessageArgument sendTime = *argument;
+
+        if (! stream.IsInt32() || ! sequence.IsInt64() || ! sendTime.IsInt64())
+            return false;
+
+        tag.stream = (uint32_t) stream.AsInt32Unchecked();
+        tag.sequence = (uint64_t) sequence.AsInt64Unchecked();
+        tag.sendTime = sendTime.AsInt64Unchecked();
+        return true;
+    }
+}
+
+#endif  // LOADTAG_H_INCLUDED
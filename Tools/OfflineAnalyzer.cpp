@@ -0,0 +1,565 @@
+/*
+ ==============================================================================
+
+    OfflineAnalyzer.cpp
+    PlayMe - SignalProcessor tools
+    Analyse audio files (WAV, AIFF, FLAC, Ogg) with the plugin's
+    AnalysisEngine, much faster than real time, and write the features of
+    every file as a feature log (see FeatureLog.h) : the messages the plugin
+    would have sent while the file was played, timed from the start of the
+    file. FeatureReplayer can then send them to the consumers during a show.
+
+    The files, and the chunks of every file, are analysed in parallel on a
+    ThreadPool. Every chunk is preceded by a pre-roll which is analysed but
+    not written, so that the averages (signal level, beat detection, FFT
+    bands) have converged when the chunk starts.
+
+    With --cache, the features of every file are also stored in a
+    FeatureCache entry, keyed by the file content and the settings : the
+    files which were already analysed with the same settings are not
+    decoded nor analysed again, their logs are written from the cache
+
+ ==============================================================================
+ */
+
+#include "AppConfig.h"
+#include "juce_audio_formats/juce_audio_formats.h"
+
+#include "AnalysisEngine.h"
+#include "FeatureCache.h"
+#include "FeatureLog.h"
+#include "SignalWireFormat.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace juce;
+
+// Same ports as the plugin, by FeatureCache::Feature : the logs can be replayed to the consumers as they are
+static const int portNumbers[FeatureCache::nbOfFeatures] = { 7001, 7002, 7003, 7005, 7005 };
+
+struct Options
+{
+    AnalysisEngine::Settings settings;
+    int blockSize           = 512;          // The beat detection works on blocks, as in a DAW
+    bool stereo             = false;
+    int channel             = 1;            // signalID of the messages
+    double chunkSeconds     = 60;
+    double preRollSeconds   = 5;
+    int nbOfThreads         = SystemStats::getNumCpus();
+    File outputDirectory    = File::getCurrentWorkingDirectory();
+    File cacheDirectory;                    // No cache when it is not set
+    Array<File> files;
+};
+
+//==============================================================================
+// Features of one chunk, pre-roll excluded, timed in samples from the start of the file
+class ChunkSink  : public FeatureSink
+{
+public:
+    ChunkSink (int64 first, int64 offset)
+        : firstSample (first), timeOffset (offset)
+    {
+    }
+
+    FeatureCache::Tracks tracks;
+
+    void signalLevelComputed (int, int64_t time, float level) override
+    {
+        add (FeatureCache::signalLevel, time, &level, 1);
+    }
+
+    void signalInstantValComputed (int, int64_t time, float value) override
+    {
+        add (FeatureCache::signalInstantVal, time, &value, 1);
+    }
+
+    void impulseDetected (int, int64_t time) override
+    {
+        add (FeatureCache::impulse, time, nullptr, 0);
+    }
+
+    void logFFTComputed (int, int64_t time, const float* bands, int nbOfBands, float fundamentalFreq) override
+    {
+        addFFT (FeatureCache::logFFT, time, bands, nbOfBands, fundamentalFreq);
+    }
+
+    void linearFFTComputed (int, int64_t time, const float* bins, int nbOfBins, float fundamentalFreq) override
+    {
+        addFFT (FeatureCache::linearFFT, time, bins, nbOfBins, fundamentalFreq);
+    }
+
+private:
+    // The fundamental frequency is the first column
+    void addFFT (FeatureCache::Feature feature, int64_t time, const float* values, int nbOfValues, float fundamentalFreq)
+    {
+        nbOfValues = jmin (nbOfValues, AnalysisEngine::fftSize / 2);
+        row[0] = fundamentalFreq;
+        std::copy (values, values + nbOfValues, row + 1);
+        add (feature, time, row, nbOfValues + 1);
+    }
+
+    void add (FeatureCache::Feature feature, int64_t time, const float* values, int nbOfValues)
+    {
+        // The pre-roll is only there for the averages to converge
+        const int64 sample = timeOffset + time;
+        if (sample >= firstSample)
+            tracks.add (feature, sample, values, nbOfValues);
+    }
+
+    const int64 firstSample;        // First sample of the chunk, pre-roll excluded
+    const int64 timeOffset;         // Position of the engine's time 0 in the file
+    float row[1 + AnalysisEngine::fftSize / 2];
+};
+
+//==============================================================================
+class ChunkJob  : public ThreadPoolJob
+{
+public:
+    ChunkJob (AudioFormatManager& manager, const File& f, const Options& o,
+              double sampleRate, int64 start, int64 end, int64 preRoll)
+        : ThreadPoolJob (f.getFileName()), formatManager (manager), file (f), options (o),
+          readStart (jmax ((int64) 0, start - preRoll)), chunkEnd (end),
+          sink (start, jmax ((int64) 0, start - preRoll))
+    {
+        engine.settings = options.settings;
+        engine.setSampleRate (sampleRate);
+    }
+
+    JobStatus runJob() override
+    {
+        ScopedPointer<AudioFormatReader> reader (createReader());
+        if (reader == nullptr)
+        {
+            failed = true;
+            return jobHasFinished;
+        }
+
+        if (options.settings.fftEnabled)
+            engine.prepareFFT();
+
+        const int nbOfChannels = (options.stereo && reader->numChannels > 1) ? 2 : 1;
+        const int readSize = options.blockSize * 128;
+        AudioSampleBuffer buffer (nbOfChannels, readSize);
+
+        for (int64 position = readStart; position < chunkEnd && ! shouldExit(); position += readSize)
+        {
+            const int nbOfSamples = (int) jmin ((int64) readSize, chunkEnd - position);
+            reader->read (&buffer, 0, nbOfSamples, position, true, nbOfChannels > 1);
+
+            for (int offset = 0; offset < nbOfSamples; offset += options.blockSize)
+            {
+                const float* channels[2] = { buffer.getReadPointer (0, offset),
+                                             buffer.getReadPointer (nbOfChannels - 1, offset) };
+                engine.process (channels, nbOfChannels, jmin (options.blockSize, nbOfSamples - offset), sink);
+            }
+        }
+
+        // With two channels, the instant values of a block are produced channel after channel
+        sink.tracks.sort();
+        return jobHasFinished;
+    }
+
+    const FeatureCache::Tracks& getResult() const   { return sink.tracks; }
+    bool hasFailed() const                          { return failed; }
+
+private:
+    // WAV and AIFF files are memory-mapped : the chunks are read concurrently without any copy or lock
+    AudioFormatReader* createReader()
+    {
+        if (AudioFormat* format = formatManager.findFormatForFileExtension (file.getFileExtension()))
+        {
+            if (MemoryMappedAudioFormatReader* mapped = format->createMemoryMappedReader (file))
+            {
+                if (mapped->mapSectionOfFile (Range<int64> (readStart, chunkEnd)))
+                    return mapped;
+
+                delete mapped;
+            }
+        }
+
+        return formatManager.createReaderFor (file);
+    }
+
+    AudioFormatManager& formatManager;
+    const File file;
+    const Options& options;
+    const int64 readStart, chunkEnd;
+
+    AnalysisEngine engine;
+    ChunkSink sink;
+    bool failed = false;
+};
+
+//==============================================================================
+struct FileAnalysis
+{
+    File file;
+    double sampleRate = 0;
+    int64 nbOfSamples = 0;
+    FeatureCache::Key key;
+    OwnedArray<ChunkJob> chunks;
+};
+
+// Part of every cache key : increment it when a change of the engine or of this tool changes the
+// features, so that the entries analysed by the previous versions are not used anymore
+static const int analysisVersion = 1;
+
+// Everything which changes the features. The signalID is not part of it : it is only added to the messages
+static String getSettingsDescription (const Options& options)
+{
+    const AnalysisEngine::Settings& settings = options.settings;
+
+    String description;
+    return description << "version=" << analysisVersion
+                    << " averaging=" << settings.averagingBufferSize
+                    << " fftWindow=" << settings.fftAveragingWindow
+                    << " sensitivity=" << settings.inputSensitivity
+                    << " energyBuffer=" << settings.averageEnergyBufferSize
+                    << " instantGain=" << settings.instantValGain
+                    << " instantSkip=" << settings.instantValNbOfSamplesToSkip
+                    << " logFFT=" << (int) settings.logarithmicFFT
+                    << " enabled=" << (int) settings.signalLevelEnabled << (int) settings.signalInstantValEnabled
+                                   << (int) settings.impulseEnabled << (int) settings.fftEnabled
+                    << " block=" << options.blockSize
+                    << " stereo=" << (int) options.stereo
+                    << " chunk=" << options.chunkSeconds
+                    << " preroll=" << options.preRollSeconds;
+}
+
+// The key is a hash of the file content, followed by the settings. The content is hashed, not the path :
+// a renamed or copied file is found in the cache, a modified one is analysed again
+class KeyJob  : public ThreadPoolJob
+{
+public:
+    KeyJob (FileAnalysis& a, const String& s)
+        : ThreadPoolJob (a.file.getFileName()), analysis (a), settings (s)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        FeatureCache::KeyHasher hasher;
+        MemoryMappedFile content (analysis.file, MemoryMappedFile::readOnly);
+
+        if (content.getData() != nullptr)
+        {
+            hasher.update (content.getData(), content.getSize());
+        }
+        else
+        {
+            // Not mappable : read it
+            FileInputStream input (analysis.file);
+            HeapBlock<char> buffer (1 << 20);
+            for (int size; (size = input.read (buffer, 1 << 20)) > 0;)
+                hasher.update (buffer, (size_t) size);
+        }
+
+        const int64 contentSize = analysis.file.getSize();
+        hasher.update (&contentSize, sizeof (contentSize));
+        hasher.update (settings.toRawUTF8(), settings.getNumBytesAsUTF8());
+        analysis.key = hasher.getKey();
+        return jobHasFinished;
+    }
+
+private:
+    FileAnalysis& analysis;
+    const String settings;
+};
+
+// Chunk boundaries are multiples of the FFT size, the block size and the averaging buffer size :
+// the FFTs, blocks and signal levels fall at the same positions as in a single pass. The instant values
+// are not aligned (their period is not a power of two) : every chunk restarts their skip counter
+static int64 getChunkAlignment (const Options& options)
+{
+    int64 alignment = AnalysisEngine::fftSize;
+    const int64 others[] = { options.blockSize, options.settings.averagingBufferSize };
+
+    for (int i = 0; i < numElementsInArray (others); ++i)
+    {
+        int64 a = alignment, b = others[i];
+        while (b != 0) { const int64 t = a % b; a = b; b = t; }
+        alignment = alignment / a * others[i];
+    }
+
+    return alignment;
+}
+
+static int64 roundUp (double samples, int64 alignment)
+{
+    return jmax ((int64) 1, (int64) std::ceil (samples / alignment)) * alignment;
+}
+
+//==============================================================================
+typedef FeatureCache::TrackView TrackViews[FeatureCache::nbOfFeatures];
+
+static int encodeRow (const FeatureCache::TrackView& track, FeatureCache::Feature feature, uint64 row, int channel,
+                      SignalWireFormat::FFTMessage& fft, char* buffer, int bufferSize)
+{
+    switch (feature)
+    {
+        case FeatureCache::signalLevel:
+        {
+            SignalWireFormat::SignalLevelMessage message;
+            message.signalID = channel;
+            message.signalLevel = track.get (row, 0);
+            return SignalWireFormat::encode (message, buffer, bufferSize);
+        }
+
+        case FeatureCache::signalInstantVal:
+        {
+            SignalWireFormat::SignalInstantValMessage message;
+            message.signalID = channel;
+            message.signalInstantVal = track.get (row, 0);
+            return SignalWireFormat::encode (message, buffer, bufferSize);
+        }
+
+        case FeatureCache::impulse:
+        {
+            SignalWireFormat::ImpulseMessage message;
+            message.signalID = channel;
+            return SignalWireFormat::encode (message, buffer, bufferSize);
+        }
+
+        case FeatureCache::logFFT:
+        case FeatureCache::linearFFT:
+        {
+            fft.signalID = channel;
+            fft.fundamentalFreq = track.get (row, 0);
+            fft.isLinear = feature == FeatureCache::linearFFT;
+            fft.nbOfValues = jmin (track.nbOfColumns - 1, SignalWireFormat::maxNbOfLinearBins);
+            for (int i = 0; i < fft.nbOfValues; ++i)
+                fft.values[i] = track.get (row, i + 1);
+
+            return SignalWireFormat::encode (fft, buffer, bufferSize);
+        }
+
+        default:
+            return -1;
+    }
+}
+
+// Merge the tracks by time into a feature log, encoding the messages as the plugin does
+static bool writeLog (const TrackViews& tracks, double sampleRate, int channel, const File& output, uint64& nbOfRecords)
+{
+    FeatureLog::Writer log;
+    if (! log.open (output.getFullPathName().toStdString()))
+        return false;
+
+    ScopedPointer<SignalWireFormat::FFTMessage> fft (new SignalWireFormat::FFTMessage());
+    HeapBlock<char> buffer (SignalWireFormat::maxNbOfLinearBins * 4 + 64);
+    uint64 next[FeatureCache::nbOfFeatures] = { 0 };
+
+    for (;;)
+    {
+        // The earliest row of all the tracks. Rows with the same time are written in the order of the features
+        int feature = -1;
+        for (int f = 0; f < FeatureCache::nbOfFeatures; ++f)
+            if (next[f] < tracks[f].nbOfRows
+                 && (feature < 0 || tracks[f].times[next[f]] < tracks[feature].times[next[feature]]))
+                feature = f;
+
+        if (feature < 0)
+            break;
+
+        const uint64 row = next[feature]++;
+        const int size = encodeRow (tracks[feature], (FeatureCache::Feature) feature, row, channel, *fft,
+                                    buffer, SignalWireFormat::maxNbOfLinearBins * 4 + 64);
+        const int64 time = (int64) (tracks[feature].times[row] * 1.0e9 / sampleRate);
+
+        if (size > 0 && ! log.append (time, portNumbers[feature], buffer, (size_t) size))
+            return false;
+    }
+
+    nbOfRecords = log.getNbOfRecords();
+    return true;
+}
+
+//==============================================================================
+static bool parseArguments (const StringArray& args, Options& options)
+{
+    for (int i = 0; i < args.size(); ++i)
+    {
+        const String& arg = args[i];
+        const bool hasValue = i + 1 < args.size();
+
+        if      (arg == "--fft")                    options.settings.fftEnabled = true;
+        else if (arg == "--linear")                 { options.settings.fftEnabled = true; options.settings.logarithmicFFT = false; }
+        else if (arg == "--no-instant")             options.settings.signalInstantValEnabled = false;
+        else if (arg == "--stereo")                 options.stereo = true;
+        else if (arg == "--threads" && hasValue)    options.nbOfThreads = args[++i].getIntValue();
+        else if (arg == "--chunk" && hasValue)      options.chunkSeconds = args[++i].getDoubleValue();
+        else if (arg == "--preroll" && hasValue)    options.preRollSeconds = args[++i].getDoubleValue();
+        else if (arg == "--block" && hasValue)      options.blockSize = args[++i].getIntValue();
+        else if (arg == "--channel" && hasValue)    options.channel = args[++i].getIntValue();
+        else if (arg == "--averaging" && hasValue)  options.settings.averagingBufferSize = args[++i].getIntValue();
+        else if (arg == "--output" && hasValue)     options.outputDirectory = File::getCurrentWorkingDirectory().getChildFile (args[++i]);
+        else if (arg == "--cache" && hasValue)      options.cacheDirectory = File::getCurrentWorkingDirectory().getChildFile (args[++i]);
+        else if (arg.startsWith ("--"))             return false;
+        else                                        options.files.add (File::getCurrentWorkingDirectory().getChildFile (arg));
+    }
+
+    return options.files.size() > 0 && options.nbOfThreads > 0 && options.blockSize > 0
+        && options.settings.averagingBufferSize > 0 && options.chunkSeconds > 0 && options.preRollSeconds >= 0;
+}
+
+int main (int argc, char* argv[])
+{
+    StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add (String::fromUTF8 (argv[i]));
+
+    Options options;
+    if (! parseArguments (args, options))
+    {
+        std::fprintf (stderr,
+                      "usage: %s [--fft | --linear] [--no-instant] [--stereo] [--threads <n>] [--chunk 60] [--preroll 5]\n"
+                      "          [--block 512] [--averaging 2048] [--channel 1] [--output <directory>] [--cache <directory>]\n"
+                      "          <audio file>...\n",
+                      argv[0]);
+        return 1;
+    }
+
+    const bool useCache = options.cacheDirectory.getFullPathName().isNotEmpty();
+    const File directories[] = { options.outputDirectory, useCache ? options.cacheDirectory : options.outputDirectory };
+
+    for (int i = 0; i < numElementsInArray (directories); ++i)
+    {
+        if (! directories[i].createDirectory())
+        {
+            std::fprintf (stderr, "%s : cannot create the directory\n", directories[i].getFullPathName().toRawUTF8());
+            return 1;
+        }
+    }
+
+    AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    ThreadPool pool (options.nbOfThreads);
+    OwnedArray<FileAnalysis> analyses;
+    OwnedArray<KeyJob> keyJobs;
+    const String settingsDescription (getSettingsDescription (options));
+    const double startTime = Time::getMillisecondCounterHiRes();
+
+    for (int i = 0; i < options.files.size(); ++i)
+    {
+        ScopedPointer<AudioFormatReader> reader (formatManager.createReaderFor (options.files[i]));
+        if (reader == nullptr || reader->sampleRate <= 0)
+        {
+            std::fprintf (stderr, "%s : unsupported or unreadable file\n", options.files[i].getFullPathName().toRawUTF8());
+            continue;
+        }
+
+        FileAnalysis* analysis = analyses.add (new FileAnalysis());
+        analysis->file = options.files[i];
+        analysis->sampleRate = reader->sampleRate;
+        analysis->nbOfSamples = reader->lengthInSamples;
+
+        if (useCache)
+            pool.addJob (keyJobs.add (new KeyJob (*analysis, settingsDescription)), false);
+    }
+
+    // The files are hashed in parallel too
+    for (int i = 0; i < keyJobs.size(); ++i)
+        pool.waitForJobToFinish (keyJobs[i], -1);
+
+    // Queue every chunk of every file which is not in the cache, then write the files in order as their chunks finish
+    OwnedArray<FeatureCache::Reader> cacheEntries;
+    const int64 alignment = getChunkAlignment (options);
+
+    for (int i = 0; i < analyses.size(); ++i)
+    {
+        FileAnalysis* analysis = analyses[i];
+
+        FeatureCache::Reader* entry = cacheEntries.add (new FeatureCache::Reader());
+        if (useCache && entry->open (FeatureCache::getPath (options.cacheDirectory.getFullPathName().toStdString(), analysis->key),
+                                     analysis->key))
+            continue;
+
+        const int64 chunkSize = roundUp (options.chunkSeconds * analysis->sampleRate, alignment);
+        const int64 preRoll = options.preRollSeconds > 0 ? roundUp (options.preRollSeconds * analysis->sampleRate, alignment) : 0;
+
+        for (int64 start = 0; start < analysis->nbOfSamples; start += chunkSize)
+        {
+            ChunkJob* job = analysis->chunks.add (new ChunkJob (formatManager, analysis->file, options, analysis->sampleRate,
+                                                                start, jmin (start + chunkSize, analysis->nbOfSamples), preRoll));
+            pool.addJob (job, false);
+        }
+    }
+
+    double totalSeconds = 0;
+    int nbOfFailures = 0, nbOfCacheHits = 0;
+
+    for (int i = 0; i < analyses.size(); ++i)
+    {
+        FileAnalysis& analysis = *analyses[i];
+        FeatureCache::Reader& entry = *cacheEntries[i];
+        const bool isCached = analysis.chunks.size() == 0;
+        const int nbOfChunks = analysis.chunks.size();
+        FeatureCache::Tracks tracks;
+        TrackViews views;
+        bool failed = false;
+
+        if (isCached)
+        {
+            // The columns are used in place, in the mapped entry
+            for (int f = 0; f < FeatureCache::nbOfFeatures; ++f)
+                views[f] = entry.getTrack ((FeatureCache::Feature) f);
+
+            ++nbOfCacheHits;
+        }
+        else
+        {
+            // The chunks do not overlap : their rows are appended in order
+            for (int c = 0; c < analysis.chunks.size(); ++c)
+            {
+                pool.waitForJobToFinish (analysis.chunks[c], -1);
+                failed = failed || analysis.chunks[c]->hasFailed();
+                tracks.append (analysis.chunks[c]->getResult());
+            }
+
+            // The results of the chunks are not needed anymore
+            analysis.chunks.clear();
+
+            for (int f = 0; f < FeatureCache::nbOfFeatures; ++f)
+                views[f] = tracks.getTrack ((FeatureCache::Feature) f);
+
+            if (useCache && ! failed)
+            {
+                const std::string path (FeatureCache::getPath (options.cacheDirectory.getFullPathName().toStdString(), analysis.key));
+                if (! FeatureCache::write (path, analysis.key, analysis.sampleRate, (uint64) analysis.nbOfSamples, tracks))
+                    std::fprintf (stderr, "%s : cannot write the cache entry (%s)\n", path.c_str(), std::strerror (errno));
+            }
+        }
+
+        const File output (options.outputDirectory.getChildFile (analysis.file.getFileNameWithoutExtension() + ".features"));
+        const double seconds = analysis.nbOfSamples / analysis.sampleRate;
+        uint64 nbOfRecords = 0;
+
+        if (failed || ! writeLog (views, analysis.sampleRate, options.channel, output, nbOfRecords))
+        {
+            std::fprintf (stderr, "%s : analysis failed\n", analysis.file.getFullPathName().toRawUTF8());
+            ++nbOfFailures;
+        }
+        else
+        {
+            std::printf ("%s : %.1f s, %s, %llu records -> %s\n", analysis.file.getFileName().toRawUTF8(), seconds,
+                         isCached ? "cached" : (String (nbOfChunks) + " chunks").toRawUTF8(),
+                         (unsigned long long) nbOfRecords, output.getFullPathName().toRawUTF8());
+            totalSeconds += seconds;
+        }
+
+        entry.close();
+    }
+
+    const double elapsedSeconds = (Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+    std::printf ("files=%d cached=%d audio=%.1f s elapsed=%.2f s speed=%.0fx real time threads=%d\n",
+                 analyses.size() - nbOfFailures, nbOfCacheHits, totalSeconds, elapsedSeconds,
+                 elapsedSeconds > 0 ? totalSeconds / elapsedSeconds : 0.0, options.nbOfThreads);
+
+    return (nbOfFailures == 0 && options.files.size() == analyses.size()) ? 0 : 1;
+}
@@ -0,0 +1,596 @@
+/*
+ ==============================================================================
+
+    ScalingHost.cpp
+    PlayMe - SignalProcessor tools
+    Minimal headless host measuring how the plugin scales with the number of
+    instances : it creates N SignalProcessorAudioProcessors, drives
+    prepareToPlay / processBlock from simulated audio callbacks paced at the
+    block rate (one or more audio threads, as a DAW does), runs the message
+    loop their timers and async updates need, and reports the processBlock
+    and callback time distributions, the CPU, memory, threads and sockets of
+    the process, and the packets the instances sent.
+
+    There is no audio device : the callbacks are paced with the monotonic
+    clock, on the inputs of a synthetic signal (noise, clicks and tones)
+
+ ==============================================================================
+ */
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+//==============================================================================
+struct Options
+{
+    std::vector<int> instanceCounts { 1, 8, 16, 32, 64 };
+    int blockSize = 256;
+    double sampleRate = 48000;
+    int nbOfChannels = 2;
+    int channelsPerGroup = 0;           // 0 : one analysed signal per instance, see SignalProcessorAudioProcessor::channelsPerGroup
+    int nbOfThreads = 1;                // Audio threads, every one processing its share of the instances
+    int nbOfAnalysisWorkers = 0;        // FFT worker threads of every instance, see SignalProcessorAudioProcessor::setAnalysisWorkers
+    double seconds = 10;                // Measured, after warmUpSeconds
+    double warmUpSeconds = 2;
+    bool fft = false, linearFFT = false, stereo = false, osc = false, binary = true;
+    bool paced = true;                  // false : the callbacks run back to back (throughput)
+    bool receive = true;                // Count the packets on the plugin's ports
+    bool json = false;
+};
+
+static Options options;
+
+//==============================================================================
+// Every instance sees the same position, advanced by the first audio thread
+class SimulatedPlayHead  : public AudioPlayHead
+{
+public:
+    void blockPlayed (int nbOfSamples)              { samplesPlayed.fetch_add (nbOfSamples, std::memory_order_relaxed); }
+
+    bool getCurrentPosition (CurrentPositionInfo& result) override
+    {
+        const int64 position = samplesPlayed.load (std::memory_order_relaxed);
+
+        result.resetToDefault();
+        result.bpm = 120;
+        result.timeInSamples = position;
+        result.timeInSeconds = position / options.sampleRate;
+        result.ppqPosition = result.timeInSeconds * 2;
+        result.isPlaying = true;
+        return true;
+    }
+
+private:
+    std::atomic<int64> samplesPlayed { 0 };
+};
+
+//==============================================================================
+// Process-wide resources, from /proc and getrusage
+struct ProcessSnapshot
+{
+    int64 residentBytes = 0;
+    int nbOfThreads = 0;
+    int nbOfSockets = 0;
+    double cpuSeconds = 0;              // User + system, all the threads
+
+    static ProcessSnapshot take()
+    {
+        ProcessSnapshot snapshot;
+
+        if (FILE* status = std::fopen ("/proc/self/status", "r"))
+        {
+            char line[256];
+            while (std::fgets (line, sizeof (line), status) != nullptr)
+            {
+                long value;
+                if (std::sscanf (line, "VmRSS: %ld kB", &value) == 1)    snapshot.residentBytes = (int64) value * 1024;
+                if (std::sscanf (line, "Threads: %ld", &value) == 1)     snapshot.nbOfThreads = (int) value;
+            }
+            std::fclose (status);
+        }
+
+        if (DIR* fds = opendir ("/proc/self/fd"))
+        {
+            char path[64], target[64];
+            while (const dirent* entry = readdir (fds))
+            {
+                std::snprintf (path, sizeof (path), "/proc/self/fd/%s", entry->d_name);
+                const ssize_t length = readlink (path, target, sizeof (target) - 1);
+                if (length > 7 && std::strncmp (target, "socket:", 7) == 0)
+                    snapshot.nbOfSockets++;
+            }
+            closedir (fds);
+        }
+
+        rusage usage;
+        if (getrusage (RUSAGE_SELF, &usage) == 0)
+            snapshot.cpuSeconds = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1.0e-6
+                                + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1.0e-6;
+
+        return snapshot;
+    }
+};
+
+//==============================================================================
+/*  Binds the plugin's ports on the loopback and counts what arrives. A port used by a consumer cannot be
+    bound : its packets are not counted (reported as such)
+*/
+class PacketCounter
+{
+public:
+    static const int nbOfPorts = 7;
+
+    PacketCounter()
+    {
+        static const int ports[nbOfPorts] = { 7001, 7002, 7003, 7004, 7005, 7006, 9000 };
+
+        for (int i = 0; i < nbOfPorts; ++i)
+        {
+            sockets[i] = socket (AF_INET, SOCK_DGRAM, 0);
+
+            const int bufferSize = 4 * 1024 * 1024;
+            setsockopt (sockets[i], SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof (bufferSize));
+
+            sockaddr_in address = sockaddr_in();
+            address.sin_family = AF_INET;
+            address.sin_port = htons ((uint16_t) ports[i]);
+            address.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+
+            if (bind (sockets[i], (const sockaddr*) &address, sizeof (address)) != 0)
+            {
+                std::fprintf (stderr, "Port %d is in use : its packets are not counted\n", ports[i]);
+                close (sockets[i]);
+                sockets[i] = -1;
+            }
+        }
+
+        thread = std::thread ([this] { run(); });
+    }
+
+    ~PacketCounter()
+    {
+        stopping.store (true);
+        thread.join();
+
+        for (int i = 0; i < nbOfPorts; ++i)
+            if (sockets[i] >= 0)
+                close (sockets[i]);
+    }
+
+    int getNbOfPortsBound() const
+    {
+        return (int) std::count_if (sockets, sockets + nbOfPorts, [] (int s) { return s >= 0; });
+    }
+
+    uint64 getPackets() const                       { return packets.load(); }
+    uint64 getBytes() const                         { return bytes.load(); }
+
+private:
+    int sockets[nbOfPorts];
+    std::atomic<uint64> packets { 0 }, bytes { 0 };
+    std::atomic<bool> stopping { false };
+    std::thread thread;
+
+    void run()
+    {
+        pollfd fds[nbOfPorts];
+        for (int i = 0; i < nbOfPorts; ++i)
+        {
+            fds[i].fd = sockets[i];         // Negative : ignored by poll
+            fds[i].events = POLLIN;
+        }
+
+        char buffer[65536];
+        while (! stopping.load())
+        {
+            if (poll (fds, nbOfPorts, 100) <= 0)
+                continue;
+
+            for (int i = 0; i < nbOfPorts; ++i)
+            {
+                if ((fds[i].revents & POLLIN) == 0)
+                    continue;
+
+                ssize_t size;
+                while ((size = recv (sockets[i], buffer, sizeof (buffer), MSG_DONTWAIT)) >= 0)
+                {
+                    packets.fetch_add (1, std::memory_order_relaxed);
+                    bytes.fetch_add ((uint64) size, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+};
+
+//==============================================================================
+// Percentile of histogram counts, in microseconds (middle of the bucket)
+static double getPercentile (const uint32_t* counts, double fraction)
+{
+    uint64 total = 0;
+    for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+        total += counts[i];
+
+    if (total == 0)
+        return 0;
+
+    const uint64 rank = std::max<uint64> (1, (uint64) std::ceil (fraction * total));
+    uint64 cumulated = 0;
+
+    for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+    {
+        cumulated += counts[i];
+        if (cumulated >= rank)
+            return (LatencyHistogram::getBucketLowerBound (i) + LatencyHistogram::getBucketUpperBound (i)) / 2000.0;
+    }
+
+    return 0;
+}
+
+/*  One audio thread : every period, it copies the next block of the test signal into the input buffer of
+    each of its instances, as a host hands every track its own buffer, and calls their processBlock.
+    Only the processBlock calls are timed
+*/
+class AudioThread
+{
+public:
+    AudioThread (Array<SignalProcessorAudioProcessor*> p, const AudioSampleBuffer& s, SimulatedPlayHead* h)
+        : processors (p), signal (s), playHead (h)
+    {
+        for (int i = 0; i < processors.size(); ++i)
+            buffers.add (new AudioSampleBuffer (options.nbOfChannels, options.blockSize));
+    }
+
+    void start()                                    { thread = std::thread ([this] { run(); }); }
+    void startMeasuring()                           { measuring.store (true); }
+
+    void stop()
+    {
+        stopping.store (true);
+        thread.join();
+    }
+
+    LatencyHistogram instanceTimes, callbackTimes;
+    std::atomic<uint32_t> nbOfCallbacks { 0 }, nbOfOverruns { 0 };
+    double cpuSeconds = 0;                          // Of the measured callbacks
+
+private:
+    Array<SignalProcessorAudioProcessor*> processors;
+    OwnedArray<AudioSampleBuffer> buffers;
+    const AudioSampleBuffer& signal;
+    SimulatedPlayHead* const playHead;              // nullptr : advanced by another thread
+    std::atomic<bool> measuring { false }, stopping { false };
+    std::thread thread;
+
+    static uint64_t getThreadCPUNanoseconds()
+    {
+        timespec now;
+        clock_gettime (CLOCK_THREAD_CPUTIME_ID, &now);
+        return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+    }
+
+    void run()
+    {
+        // As a host's audio thread, when the process may use SCHED_FIFO (rtprio limit, or root)
+        sched_param parameters;
+        parameters.sched_priority = 70;
+        pthread_setschedparam (pthread_self(), SCHED_FIFO, &parameters);
+
+        const uint64_t period = (uint64_t) (options.blockSize * 1.0e9 / options.sampleRate);
+        uint64_t deadline = getMonotonicNanoseconds() + period;
+        int position = 0;
+        MidiBuffer midi;
+
+        while (! stopping.load (std::memory_order_relaxed))
+        {
+            const bool measured = measuring.load (std::memory_order_relaxed);
+            const uint64_t cpuStart = getThreadCPUNanoseconds();
+            const uint64_t callbackStart = getMonotonicNanoseconds();
+
+            for (int i = 0; i < processors.size(); ++i)
+            {
+                AudioSampleBuffer& buffer = *buffers.getUnchecked (i);
+
+                // Every instance its own part of the signal, not to process the same samples in sync
+                const int offset = (position + i * 4801) % (signal.getNumSamples() - options.blockSize);
+                for (int channel = 0; channel < options.nbOfChannels; ++channel)
+                    buffer.copyFrom (channel, 0, signal, channel % signal.getNumChannels(), offset, options.blockSize);
+
+                const uint64_t start = getMonotonicNanoseconds();
+                processors.getUnchecked (i)->processBlock (buffer, midi);
+
+                if (measured)
+                    instanceTimes.record (getMonotonicNanoseconds() - start);
+            }
+
+            const uint64_t end = getMonotonicNanoseconds();
+
+            if (measured)
+            {
+                callbackTimes.record (end - callbackStart);
+                cpuSeconds += (getThreadCPUNanoseconds() - cpuStart) * 1.0e-9;
+                nbOfCallbacks.store (nbOfCallbacks.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+                if (end > deadline)
+                    nbOfOverruns.store (nbOfOverruns.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            if (playHead != nullptr)
+                playHead->blockPlayed (options.blockSize);
+
+            position = (position + options.blockSize) % (signal.getNumSamples() - options.blockSize);
+
+            // The next callback at the next period, or right away when late (the device would have dropped
+            // the late blocks : the schedule starts again from now)
+            if (options.paced && end < deadline)
+            {
+                const timespec wakeUp = { (time_t) (deadline / 1000000000ull), (long) (deadline % 1000000000ull) };
+                clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUp, nullptr);
+                deadline += period;
+            }
+            else
+            {
+                deadline = std::max (deadline, end) + period;
+            }
+        }
+    }
+};
+
+//==============================================================================
+// Ten seconds of noise, 120 BPM clicks and a few partials, different on every channel
+static void fillTestSignal (AudioSampleBuffer& signal)
+{
+    Random random (1);
+
+    for (int channel = 0; channel < signal.getNumChannels(); ++channel)
+    {
+        float* data = signal.getWritePointer (channel);
+        const double fundamental = 110.0 * (channel + 1);
+
+        for (int i = 0; i < signal.getNumSamples(); ++i)
+        {
+            const double t = i / options.sampleRate;
+            const double sinceBeat = std::fmod (t, 0.5);
+
+            data[i] = (float) (0.2 * std::sin (2 * double_Pi * fundamental * t)
+                               + 0.1 * std::sin (2 * double_Pi * fundamental * 3 * t)
+                               + 0.05 * (random.nextFloat() * 2 - 1)
+                               + (sinceBeat < 0.005 ? 0.8 * (random.nextFloat() * 2 - 1) * std::exp (-sinceBeat * 1000) : 0));
+        }
+    }
+}
+
+static void configure (SignalProcessorAudioProcessor& processor, int index, SimulatedPlayHead& playHead)
+{
+    processor.setAnalysisWorkers (options.nbOfAnalysisWorkers);
+    processor.setParameter (SignalProcessorAudioProcessor::channelParam, (float) (index + 1));
+    processor.setParameter (SignalProcessorAudioProcessor::sendFFTParam, options.fft ? 1.0f : 0.0f);
+    processor.setParameter (SignalProcessorAudioProcessor::logarithmicFFTParam, options.linearFFT ? 0.0f : 1.0f);
+    processor.setParameter (SignalProcessorAudioProcessor::monoStereoParam, options.stereo ? 1.0f : 0.0f);
+    processor.setParameter (SignalProcessorAudioProcessor::channelsPerGroupParam, (float) options.channelsPerGroup);
+    processor.setParameter (SignalProcessorAudioProcessor::sendOSCParam, options.osc ? 1.0f : 0.0f);
+    processor.setParameter (SignalProcessorAudioProcessor::sendBinaryUDPParam, options.binary ? 1.0f : 0.0f);
+    processor.setParameter (SignalProcessorAudioProcessor::sendTimeInfoParam, 1.0f);
+
+    processor.setPlayHead (&playHead);
+    processor.setPlayConfigDetails (options.nbOfChannels, options.nbOfChannels, options.sampleRate, options.blockSize);
+    processor.prepareToPlay (options.sampleRate, options.blockSize);
+}
+
+//==============================================================================
+static void report (int nbOfInstances, const OwnedArray<AudioThread>& threads, const ProcessSnapshot& before,
+                    const ProcessSnapshot& prepared, const ProcessSnapshot& start, const ProcessSnapshot& end,
+                    double seconds, const PacketCounter* counter, uint64 packets, uint64 bytes)
+{
+    uint32_t instanceCounts[LatencyHistogram::nbOfBuckets] = {}, callbackCounts[LatencyHistogram::nbOfBuckets] = {};
+    uint32_t counts[LatencyHistogram::nbOfBuckets];
+    uint32_t nbOfCallbacks = 0, nbOfOverruns = 0;
+    double audioCPUSeconds = 0;
+
+    for (int t = 0; t < threads.size(); ++t)
+    {
+        AudioThread& thread = *threads.getUnchecked (t);
+
+        thread.instanceTimes.copyCounts (counts);
+        for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+            instanceCounts[i] += counts[i];
+
+        thread.callbackTimes.copyCounts (counts);
+        for (int i = 0; i < LatencyHistogram::nbOfBuckets; ++i)
+            callbackCounts[i] += counts[i];
+
+        nbOfCallbacks += thread.nbOfCallbacks.load();
+        nbOfOverruns += thread.nbOfOverruns.load();
+        audioCPUSeconds += thread.cpuSeconds;
+    }
+
+    const double period = options.blockSize * 1.0e6 / options.sampleRate;
+    const double callbackP99 = getPercentile (callbackCounts, 0.99);
+    const double processCPU = (end.cpuSeconds - start.cpuSeconds) / seconds * 100;
+    const double audioCPU = audioCPUSeconds / seconds * 100;
+    const double memoryPerInstance = (prepared.residentBytes - before.residentBytes) / (double) nbOfInstances / 1024;
+    const double socketsPerInstance = (end.nbOfSockets - before.nbOfSockets) / (double) nbOfInstances;
+    const double threadsPerInstance = (end.nbOfThreads - before.nbOfThreads) / (double) nbOfInstances;
+    const double packetsPerSecond = counter != nullptr ? packets / seconds : -1;
+    const double megabytesPerSecond = counter != nullptr ? bytes / seconds / 1.0e6 : -1;
+
+    if (options.json)
+    {
+        std::printf ("{\"instances\":%d,\"threads\":%d,\"workers\":%d,\"blockSize\":%d,\"sampleRate\":%g,\"callbacks\":%u,\"overruns\":%u,"
+                     "\"instanceUsP50\":%.2f,\"instanceUsP99\":%.2f,\"instanceUsMax\":%.2f,"
+                     "\"callbackUsP50\":%.2f,\"callbackUsP99\":%.2f,\"callbackUsMax\":%.2f,\"deadlineUtilizationP99\":%.4f,"
+                     "\"audioCpuPercent\":%.2f,\"processCpuPercent\":%.2f,\"residentKiB\":%lld,\"residentKiBPerInstance\":%.1f,"
+                     "\"sockets\":%d,\"socketsPerInstance\":%.2f,\"processThreads\":%d,\"threadsPerInstance\":%.2f,"
+                     "\"packetsPerSecond\":%.1f,\"megabytesPerSecond\":%.3f,\"portsCounted\":%d}\n",
+                     nbOfInstances, threads.size(), options.nbOfAnalysisWorkers, options.blockSize, options.sampleRate, nbOfCallbacks, nbOfOverruns,
+                     getPercentile (instanceCounts, 0.5), getPercentile (instanceCounts, 0.99), getPercentile (instanceCounts, 1),
+                     getPercentile (callbackCounts, 0.5), callbackP99, getPercentile (callbackCounts, 1), callbackP99 / period,
+                     audioCPU, processCPU, (long long) (end.residentBytes / 1024), memoryPerInstance,
+                     end.nbOfSockets, socketsPerInstance, end.nbOfThreads, threadsPerInstance,
+                     packetsPerSecond, megabytesPerSecond, counter != nullptr ? counter->getNbOfPortsBound() : 0);
+        return;
+    }
+
+    std::printf ("%9d %8u %8u  %7.1f %7.1f %8.1f  %8.1f %8.1f %8.1f %6.3f  %6.1f %6.1f  %8.1f %7.2f %7.2f  %10.0f %8.3f\n",
+                 nbOfInstances, nbOfCallbacks, nbOfOverruns,
+                 getPercentile (instanceCounts, 0.5), getPercentile (instanceCounts, 0.99), getPercentile (instanceCounts, 1),
+                 getPercentile (callbackCounts, 0.5), callbackP99, getPercentile (callbackCounts, 1), callbackP99 / period,
+                 audioCPU, processCPU, memoryPerInstance, socketsPerInstance, threadsPerInstance,
+                 packetsPerSecond, megabytesPerSecond);
+    std::fflush (stdout);
+}
+
+static void runInstances (int nbOfInstances, const AudioSampleBuffer& signal)
+{
+    const ProcessSnapshot before (ProcessSnapshot::take());
+    SimulatedPlayHead playHead;
+
+    OwnedArray<SignalProcessorAudioProcessor> processors;
+    for (int i = 0; i < nbOfInstances; ++i)
+    {
+        SignalProcessorAudioProcessor* processor = processors.add (new SignalProcessorAudioProcessor());
+        configure (*processor, i, playHead);
+    }
+
+    // The sockets are created in the background by prepareToPlay
+    MessageManager::getInstance()->runDispatchLoopUntil (500);
+    const ProcessSnapshot prepared (ProcessSnapshot::take());
+
+    ScopedPointer<PacketCounter> counter (options.receive ? new PacketCounter() : nullptr);
+
+    // The instances, spread over the audio threads
+    OwnedArray<AudioThread> threads;
+    for (int t = 0; t < options.nbOfThreads; ++t)
+    {
+        Array<SignalProcessorAudioProcessor*> share;
+        for (int i = t; i < nbOfInstances; i += options.nbOfThreads)
+            share.add (processors.getUnchecked (i));
+
+        threads.add (new AudioThread (share, signal, t == 0 ? &playHead : nullptr));
+    }
+
+    for (int t = 0; t < threads.size(); ++t)
+        threads.getUnchecked (t)->start();
+
+    // The message thread keeps running the processors' timers and async updates
+    MessageManager::getInstance()->runDispatchLoopUntil ((int) (options.warmUpSeconds * 1000));
+
+    const ProcessSnapshot start (ProcessSnapshot::take());
+    const uint64 packetsAtStart = counter != nullptr ? counter->getPackets() : 0;
+    const uint64 bytesAtStart = counter != nullptr ? counter->getBytes() : 0;
+    const double startTime = Time::getMillisecondCounterHiRes();
+
+    for (int t = 0; t < threads.size(); ++t)
+        threads.getUnchecked (t)->startMeasuring();
+
+    MessageManager::getInstance()->runDispatchLoopUntil ((int) (options.seconds * 1000));
+
+    const ProcessSnapshot end (ProcessSnapshot::take());
+    const double seconds = (Time::getMillisecondCounterHiRes() - startTime) / 1000;
+    const uint64 packets = counter != nullptr ? counter->getPackets() - packetsAtStart : 0;
+    const uint64 bytes = counter != nullptr ? counter->getBytes() - bytesAtStart : 0;
+
+    for (int t = 0; t < threads.size(); ++t)
+        threads.getUnchecked (t)->stop();
+
+    report (nbOfInstances, threads, before, prepared, start, end, seconds, counter, packets, bytes);
+
+    for (int i = 0; i < processors.size(); ++i)
+        processors.getUnchecked (i)->releaseResources();
+}
+
+//==============================================================================
+static bool parseInstanceCounts (const String& text)
+{
+    options.instanceCounts.clear();
+
+    StringArray values;
+    values.addTokens (text, ",", "");
+    for (int i = 0; i < values.size(); ++i)
+    {
+        if (values[i].getIntValue() <= 0)
+            return false;
+
+        options.instanceCounts.push_back (values[i].getIntValue());
+    }
+
+    return ! options.instanceCounts.empty();
+}
+
+int main (int argc, char* argv[])
+{
+    bool valid = true;
+
+    for (int i = 1; i < argc && valid; ++i)
+    {
+        const String arg (argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if      (arg == "--instances" && hasValue)  valid = parseInstanceCounts (argv[++i]);
+        else if (arg == "--block" && hasValue)      options.blockSize = String (argv[++i]).getIntValue();
+        else if (arg == "--rate" && hasValue)       options.sampleRate = String (argv[++i]).getDoubleValue();
+        else if (arg == "--channels" && hasValue)   options.nbOfChannels = String (argv[++i]).getIntValue();
+        else if (arg == "--threads" && hasValue)    options.nbOfThreads = String (argv[++i]).getIntValue();
+        else if (arg == "--groups" && hasValue)     options.channelsPerGroup = String (argv[++i]).getIntValue();
+        else if (arg == "--workers" && hasValue)    options.nbOfAnalysisWorkers = String (argv[++i]).getIntValue();
+        else if (arg == "--duration" && hasValue)   options.seconds = String (argv[++i]).getDoubleValue();
+        else if (arg == "--warmup" && hasValue)     options.warmUpSeconds = String (argv[++i]).getDoubleValue();
+        else if (arg == "--fft")                    options.fft = true;
+        else if (arg == "--linear")                 options.fft = options.linearFFT = true;
+        else if (arg == "--stereo")                 options.stereo = true;
+        else if (arg == "--osc")                    options.osc = true;
+        else if (arg == "--osc-only")               { options.osc = true; options.binary = false; }
+        else if (arg == "--unpaced")                options.paced = false;
+        else if (arg == "--no-receive")             options.receive = false;
+        else if (arg == "--json")                   options.json = true;
+        else                                        valid = false;
+    }
+
+    valid = valid && options.blockSize > 0 && options.sampleRate > 0 && options.nbOfChannels > 0 && options.channelsPerGroup >= 0
+             && options.nbOfThreads > 0 && options.nbOfAnalysisWorkers >= 0 && options.nbOfAnalysisWorkers <= AnalysisTaskPool::maxNbOfWorkers
+             && options.seconds > 0 && options.warmUpSeconds >= 0;
+
+    if (! valid)
+    {
+        std::fprintf (stderr, "usage: %s [--instances 1,8,32] [--block <samples>] [--rate <Hz>] [--channels <n>] [--groups <n>]\n"
+                              "       [--threads <n>] [--workers <n>] [--duration <s>] [--warmup <s>] [--fft | --linear] [--stereo] [--osc | --osc-only]\n"
+                              "       [--unpaced] [--no-receive] [--json]\n", argv[0]);
+        return 1;
+    }
+
+    ScopedJuceInitialiser_GUI juce;
+
+    AudioSampleBuffer signal (options.nbOfChannels, (int) (10 * options.sampleRate));
+    fillTestSignal (signal);
+
+    if (! options.json)
+    {
+        std::printf ("%d samples at %g Hz (%.2f ms), %d channels, %d audio threads, %d FFT workers per instance, %s, %s\n",
+                     options.blockSize, options.sampleRate, options.blockSize * 1000 / options.sampleRate,
+                     options.nbOfChannels, options.nbOfThreads, options.nbOfAnalysisWorkers, options.paced ? "paced" : "unpaced",
+                     options.fft ? (options.linearFFT ? "linear FFT" : "log FFT") : "no FFT");
+        std::printf ("%9s %8s %8s  %7s %7s %8s  %8s %8s %8s %6s  %6s %6s  %8s %7s %7s  %10s %8s\n",
+                     "instances", "blocks", "overrun", "inst50", "inst99", "instmax", "cb50", "cb99", "cbmax", "util99",
+                     "audio%", "proc%", "KiB/inst", "sock/i", "thr/i", "packets/s", "MB/s");
+    }
+
+    for (size_t i = 0; i < options.instanceCounts.size(); ++i)
+        runInstances (options.instanceCounts[i], signal);
+
+    return 0;
+}
@@ -57,6 +57,22 @@
 #include <stdexcept>
 #include <vector>
 
+// On Linux, SocketReceiveMultiplexer uses epoll, recvmmsg and timerfd instead of
+// select(). Define OSCPACK_USE_EPOLL to 0 to fall back to the portable select() loop.
+#if !defined(OSCPACK_USE_EPOLL)
+#if defined(__linux__)
+#define OSCPACK_USE_EPOLL 1
+#else
+#define OSCPACK_USE_EPOLL 0
+#endif
+#endif
+
+#if OSCPACK_USE_EPOLL
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#endif
+
 #include "ip/PacketListener.h"
 #include "ip/TimerListener.h"
 
@@ -403,6 +419,15 @@ public:
 	}
 
     void Run()
+	{
+#if OSCPACK_USE_EPOLL
+		RunEpoll();
+#else
+		RunSelect();
+#endif
+	}
+
+    void RunSelect()
 	{
 		break_ = false;
         char *data = 0;
@@ -524,6 +549,180 @@ public:
         }
 	}
 
+#if OSCPACK_USE_EPOLL
+	// number of datagrams read by a single recvmmsg() call
+	enum { RECEIVE_BATCH_SIZE = 32 };
+
+	// Descriptors and buffers owned by one call to RunEpoll()
+	struct EpollRunState{
+		int epollFd;
+		std::vector< int > timerFds;
+		char *data;
+		struct mmsghdr *messages;
+		struct iovec *iovecs;
+		struct sockaddr_in *fromAddrs;
+
+		EpollRunState() : epollFd( -1 ), data( 0 ), messages( 0 ), iovecs( 0 ), fromAddrs( 0 ) {}
+
+		~EpollRunState()
+		{
+			for( std::vector< int >::iterator i = timerFds.begin(); i != timerFds.end(); ++i )
+				close( *i );
+			if( epollFd != -1 )
+				close( epollFd );
+			delete [] data;
+			delete [] messages;
+			delete [] iovecs;
+			delete [] fromAddrs;
+		}
+	};
+
+	// epoll_event.data.u64 tags: the break pipe, a socket listener index or a timer listener index
+	enum { BREAK_PIPE_TAG = 0, SOCKET_TAG = 1, TIMER_TAG = 2 };
+
+	static uint64_t MakeEventTag( int kind, std::size_t index ) { return ((uint64_t)index << 2) | (uint64_t)kind; }
+
+	void AddToEpoll( int epollFd, int fd, uint64_t tag )
+	{
+		struct epoll_event ev;
+		std::memset( &ev, 0, sizeof(ev) );
+		ev.events = EPOLLIN;
+		ev.data.u64 = tag;
+		if( epoll_ctl( epollFd, EPOLL_CTL_ADD, fd, &ev ) < 0 )
+			throw std::runtime_error("epoll_ctl failed\n");
+	}
+
+	static void MillisecondsToTimespec( int ms, struct timespec& ts )
+	{
+		ts.tv_sec = ms / 1000;
+		ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+	}
+
+	// Drain a readable socket: read batches of datagrams until the socket is empty
+	void ReceiveFromSocket( EpollRunState& state, std::pair< PacketListener*, UdpSocket* >& socketListener )
+	{
+		const int MAX_BUFFER_SIZE = 4098;
+		int fd = socketListener.second->impl_->Socket();
+		IpEndpointName remoteEndpoint;
+
+		for( ;; ){
+			// the headers are rewritten by the kernel, reset the lengths before each batch
+			for( int i = 0; i < RECEIVE_BATCH_SIZE; ++i ){
+				state.iovecs[i].iov_base = state.data + i * MAX_BUFFER_SIZE;
+				state.iovecs[i].iov_len = MAX_BUFFER_SIZE;
+				std::memset( &state.messages[i].msg_hdr, 0, sizeof(state.messages[i].msg_hdr) );
+				state.messages[i].msg_hdr.msg_iov = &state.iovecs[i];
+				state.messages[i].msg_hdr.msg_iovlen = 1;
+				state.messages[i].msg_hdr.msg_name = &state.fromAddrs[i];
+				state.messages[i].msg_hdr.msg_namelen = sizeof(state.fromAddrs[i]);
+				state.messages[i].msg_len = 0;
+			}
+
+			int count = recvmmsg( fd, state.messages, RECEIVE_BATCH_SIZE, MSG_DONTWAIT, 0 );
+			if( count <= 0 )
+				return; // EAGAIN: the socket is drained. other errors are reported again by epoll
+
+			for( int i = 0; i < count; ++i ){
+				if( state.messages[i].msg_len == 0 )
+					continue;
+
+				remoteEndpoint.address = ntohl( state.fromAddrs[i].sin_addr.s_addr );
+				remoteEndpoint.port = ntohs( state.fromAddrs[i].sin_port );
+
+				socketListener.first->ProcessPacket( (const char*)state.iovecs[i].iov_base,
+						(int)state.messages[i].msg_len, remoteEndpoint );
+				if( break_ )
+					return;
+			}
+
+			if( count < RECEIVE_BATCH_SIZE )
+				return;
+		}
+	}
+
+    void RunEpoll()
+	{
+		break_ = false;
+
+		const int MAX_BUFFER_SIZE = 4098;
+		EpollRunState state;
+
+		state.epollFd = epoll_create1( EPOLL_CLOEXEC );
+		if( state.epollFd < 0 )
+			throw std::runtime_error("epoll_create1 failed\n");
+
+		// in addition to listening to the inbound sockets we
+		// also listen to the asynchronous break pipe, so that AsynchronousBreak()
+		// can break us out of epoll_wait() from another thread.
+		AddToEpoll( state.epollFd, breakPipe_[0], MakeEventTag( BREAK_PIPE_TAG, 0 ) );
+
+		for( std::size_t i = 0; i < socketListeners_.size(); ++i )
+			AddToEpoll( state.epollFd, socketListeners_[i].second->impl_->Socket(), MakeEventTag( SOCKET_TAG, i ) );
+
+		// one monotonic timerfd per periodic timer: the kernel keeps the schedule,
+		// no sorted queue or wall clock arithmetic is needed here
+		for( std::size_t i = 0; i < timerListeners_.size(); ++i ){
+			int timerFd = timerfd_create( CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC );
+			if( timerFd < 0 )
+				throw std::runtime_error("timerfd_create failed\n");
+			state.timerFds.push_back( timerFd );
+
+			struct itimerspec spec;
+			MillisecondsToTimespec( timerListeners_[i].periodMs, spec.it_interval );
+			// a zero it_value would disarm the timer, fire as soon as possible instead
+			MillisecondsToTimespec( std::max( timerListeners_[i].initialDelayMs, 0 ), spec.it_value );
+			if( spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0 )
+				spec.it_value.tv_nsec = 1;
+			if( timerfd_settime( timerFd, 0, &spec, 0 ) < 0 )
+				throw std::runtime_error("timerfd_settime failed\n");
+
+			AddToEpoll( state.epollFd, timerFd, MakeEventTag( TIMER_TAG, i ) );
+		}
+
+		// preallocated receive ring, shared by all the sockets
+		state.data = new char[ RECEIVE_BATCH_SIZE * MAX_BUFFER_SIZE ];
+		state.messages = new struct mmsghdr[ RECEIVE_BATCH_SIZE ];
+		state.iovecs = new struct iovec[ RECEIVE_BATCH_SIZE ];
+		state.fromAddrs = new struct sockaddr_in[ RECEIVE_BATCH_SIZE ];
+
+		std::vector< struct epoll_event > events( 1 + socketListeners_.size() + timerListeners_.size() );
+
+		while( !break_ ){
+			int readyCount = epoll_wait( state.epollFd, &events[0], (int)events.size(), -1 );
+			if( readyCount < 0 ){
+				if( break_ ){
+					break;
+				}else if( errno == EINTR ){
+					continue;
+				}else{
+					throw std::runtime_error("epoll_wait failed\n");
+				}
+			}
+
+			for( int e = 0; e < readyCount && !break_; ++e ){
+				int kind = (int)(events[e].data.u64 & 3);
+				std::size_t index = (std::size_t)(events[e].data.u64 >> 2);
+
+				if( kind == BREAK_PIPE_TAG ){
+					// clear pending data from the asynchronous break pipe
+					char c;
+					read( breakPipe_[0], &c, 1 );
+				}else if( kind == SOCKET_TAG ){
+					ReceiveFromSocket( state, socketListeners_[index] );
+				}else{
+					uint64_t expirations = 0;
+					if( read( state.timerFds[index], &expirations, sizeof(expirations) ) != sizeof(expirations) )
+						continue;
+
+					// run the listener once per elapsed period, as the select() loop does when it is late
+					for( uint64_t n = 0; n < expirations && !break_; ++n )
+						timerListeners_[index].listener->TimerExpired();
+				}
+			}
+		}
+	}
+#endif
+
     void Break()
 	{
 		break_ = true;